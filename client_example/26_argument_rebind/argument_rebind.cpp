@@ -0,0 +1,294 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+// Host latency of MakeArgumentPointer() against SetDataPointers() for all GEMM + Add + Add +
+// FastGelu and 2D grouped convolution forward instances. Nothing is launched, the pointers are
+// never dereferenced on host.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm_multiple_d.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/gemm_add_add_fastgelu.hpp"
+#include "ck/library/tensor_operation_instance/gpu/grouped_convolution_forward.hpp"
+
+using F16 = ck::half_t;
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+using NHWGC = ck::tensor_layout::convolution::NHWGC;
+using GKYXC = ck::tensor_layout::convolution::GKYXC;
+using NHWGK = ck::tensor_layout::convolution::NHWGK;
+
+using ck::tensor_operation::device::BaseArgument;
+
+using PassThrough    = ck::tensor_operation::element_wise::PassThrough;
+using AddAddFastGelu = ck::tensor_operation::element_wise::AddAddFastGelu;
+
+using DeviceGemmOp = ck::tensor_operation::device::DeviceGemmMultipleD<Row,
+                                                                       Col,
+                                                                       ck::Tuple<Row, Row>,
+                                                                       Row,
+                                                                       F16,
+                                                                       F16,
+                                                                       ck::Tuple<F16, F16>,
+                                                                       F16,
+                                                                       PassThrough,
+                                                                       PassThrough,
+                                                                       AddAddFastGelu>;
+
+using DeviceConvOp = ck::tensor_operation::device::DeviceGroupedConvFwdMultipleABD<2,
+                                                                                   NHWGC,
+                                                                                   GKYXC,
+                                                                                   ck::Tuple<>,
+                                                                                   NHWGK,
+                                                                                   F16,
+                                                                                   F16,
+                                                                                   ck::Tuple<>,
+                                                                                   F16,
+                                                                                   PassThrough,
+                                                                                   PassThrough,
+                                                                                   PassThrough>;
+
+struct RebindLatency
+{
+    std::string op_name_;
+    double make_us_;
+    double rebind_us_; // negative if the instance does not support rebinding
+};
+
+template <typename F>
+double get_average_us(F f, int num_iter)
+{
+    // warm up
+    f(0);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for(int i = 0; i < num_iter; ++i)
+        f(i);
+
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::micro>(end - start).count() / num_iter;
+}
+
+template <typename OpPtrs, typename MakeArgument, typename Rebind>
+std::vector<RebindLatency> get_rebind_latencies(const OpPtrs& op_ptrs,
+                                                MakeArgument make_argument,
+                                                Rebind rebind,
+                                                int num_iter)
+{
+    std::vector<RebindLatency> latencies;
+
+    for(const auto& op_ptr : op_ptrs)
+    {
+        RebindLatency latency{op_ptr->GetTypeString(), 0, -1};
+
+        latency.make_us_ =
+            get_average_us([&](int i) { auto argument_ptr = make_argument(*op_ptr, i); }, num_iter);
+
+        auto argument_ptr = make_argument(*op_ptr, 0);
+
+        if(rebind(*op_ptr, argument_ptr.get(), 1))
+        {
+            latency.rebind_us_ = get_average_us(
+                [&](int i) { rebind(*op_ptr, argument_ptr.get(), i); }, num_iter);
+        }
+
+        latencies.push_back(latency);
+    }
+
+    return latencies;
+}
+
+void report(const std::string& family, const std::vector<RebindLatency>& latencies, bool verbose)
+{
+    double total_make_us   = 0;
+    double total_rebind_us = 0;
+    std::size_t num_rebind = 0;
+    double min_speedup     = 0;
+    double max_speedup     = 0;
+
+    for(const auto& latency : latencies)
+    {
+        if(verbose)
+        {
+            std::cout << std::setw(10) << latency.make_us_ << " us, ";
+
+            if(latency.rebind_us_ < 0)
+                std::cout << std::setw(10) << "n/a";
+            else
+                std::cout << std::setw(10) << latency.rebind_us_ << " us";
+
+            std::cout << ", " << latency.op_name_ << std::endl;
+        }
+
+        if(latency.rebind_us_ < 0)
+            continue;
+
+        const double speedup = latency.make_us_ / std::max(latency.rebind_us_, 1e-6);
+
+        min_speedup = num_rebind == 0 ? speedup : std::min(min_speedup, speedup);
+        max_speedup = num_rebind == 0 ? speedup : std::max(max_speedup, speedup);
+
+        total_make_us += latency.make_us_;
+        total_rebind_us += latency.rebind_us_;
+        ++num_rebind;
+    }
+
+    std::cout << family << ": " << latencies.size() << " instances, " << num_rebind
+              << " support rebinding";
+
+    if(num_rebind > 0)
+    {
+        std::cout << ", MakeArgumentPointer " << total_make_us / num_rebind
+                  << " us, SetDataPointers " << total_rebind_us / num_rebind
+                  << " us on average, speedup " << min_speedup << "x - " << max_speedup << "x";
+    }
+
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    int num_iter = 1000;
+    bool verbose = false;
+
+    if(argc == 1)
+    {
+        // use default case
+    }
+    else if(argc == 3)
+    {
+        num_iter = std::stoi(argv[1]);
+        verbose  = std::stoi(argv[2]) != 0;
+    }
+    else
+    {
+        std::cerr << "arg1: number of iterations (default 1000)" << std::endl
+                  << "arg2: print every instance (0=no, 1=yes)" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << std::setprecision(3);
+
+    // two sets of buffers the argument is alternately bound to
+    std::array<std::array<char, 5>, 2> buffers{};
+
+    const auto get_pointer = [&](int i, int tensor) { return &buffers[i % 2][tensor]; };
+
+    // small-batch GEMM
+    {
+        constexpr ck::index_t M = 16;
+        constexpr ck::index_t N = 4096;
+        constexpr ck::index_t K = 4096;
+
+        const auto op_ptrs =
+            ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+                DeviceGemmOp>::GetInstances();
+
+        const auto make_argument = [&](DeviceGemmOp& op, int i) {
+            return op.MakeArgumentPointer(get_pointer(i, 0),
+                                          get_pointer(i, 1),
+                                          {get_pointer(i, 2), get_pointer(i, 3)},
+                                          get_pointer(i, 4),
+                                          M,
+                                          N,
+                                          K,
+                                          K,
+                                          K,
+                                          {0, N},
+                                          N,
+                                          PassThrough{},
+                                          PassThrough{},
+                                          AddAddFastGelu{});
+        };
+
+        const auto rebind = [&](DeviceGemmOp& op, BaseArgument* p_arg, int i) {
+            return op.SetDataPointers(p_arg,
+                                      get_pointer(i, 0),
+                                      get_pointer(i, 1),
+                                      {get_pointer(i, 2), get_pointer(i, 3)},
+                                      get_pointer(i, 4));
+        };
+
+        report("gemm_add_add_fastgelu",
+               get_rebind_latencies(op_ptrs, make_argument, rebind, num_iter),
+               verbose);
+    }
+
+    // small-batch 3x3 convolution
+    {
+        constexpr ck::index_t G  = 1;
+        constexpr ck::index_t N  = 1;
+        constexpr ck::index_t K  = 256;
+        constexpr ck::index_t C  = 256;
+        constexpr ck::index_t Y  = 3;
+        constexpr ck::index_t X  = 3;
+        constexpr ck::index_t Hi = 14;
+        constexpr ck::index_t Wi = 14;
+        constexpr ck::index_t Ho = 14;
+        constexpr ck::index_t Wo = 14;
+
+        const std::array<ck::index_t, 5> in_lengths{G, N, C, Hi, Wi};
+        const std::array<ck::index_t, 5> in_strides{C, Hi * Wi * G * C, 1, Wi * G * C, G * C};
+        const std::array<ck::index_t, 5> wei_lengths{G, K, C, Y, X};
+        const std::array<ck::index_t, 5> wei_strides{K * Y * X * C, Y * X * C, 1, X * C, C};
+        const std::array<ck::index_t, 5> out_lengths{G, N, K, Ho, Wo};
+        const std::array<ck::index_t, 5> out_strides{K, Ho * Wo * G * K, 1, Wo * G * K, G * K};
+
+        const std::array<ck::index_t, 2> filter_strides{1, 1};
+        const std::array<ck::index_t, 2> filter_dilations{1, 1};
+        const std::array<ck::index_t, 2> input_left_pads{1, 1};
+        const std::array<ck::index_t, 2> input_right_pads{1, 1};
+
+        const auto op_ptrs =
+            ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+                DeviceConvOp>::GetInstances();
+
+        const auto make_argument = [&](DeviceConvOp& op, int i) {
+            return op.MakeArgumentPointer(get_pointer(i, 0),
+                                          get_pointer(i, 1),
+                                          {},
+                                          get_pointer(i, 4),
+                                          in_lengths,
+                                          in_strides,
+                                          wei_lengths,
+                                          wei_strides,
+                                          {},
+                                          {},
+                                          out_lengths,
+                                          out_strides,
+                                          filter_strides,
+                                          filter_dilations,
+                                          input_left_pads,
+                                          input_right_pads,
+                                          PassThrough{},
+                                          PassThrough{},
+                                          PassThrough{});
+        };
+
+        const auto rebind = [&](DeviceConvOp& op, BaseArgument* p_arg, int i) {
+            return op.SetDataPointers(
+                p_arg, get_pointer(i, 0), get_pointer(i, 1), {}, get_pointer(i, 4));
+        };
+
+        report("grouped_conv2d_fwd",
+               get_rebind_latencies(op_ptrs, make_argument, rebind, num_iter),
+               verbose);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -23,6 +23,7 @@
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_permute.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 
@@ -278,44 +279,6 @@ inline auto is_valid_shape(const Shape& shape) -> std::enable_if_t<detail::is_ra
     return !empty(shape) && std::all_of(begin(shape), end(shape), [](auto dim) { return 0 < dim; });
 }
 
-template <typename Shape, typename Indices>
-inline auto is_valid_indices(const Shape& shape, const Indices& indices)
-    -> std::enable_if_t<detail::is_sized_range_v<Shape> && detail::is_sized_range_v<Indices>, bool>
-{
-    static_assert(std::is_unsigned_v<ck::remove_cvref_t<decltype(*std::begin(indices))>>);
-
-    if(!is_valid_shape(shape))
-    {
-        return false;
-    }
-
-    using std::empty;
-    if(empty(indices))
-    {
-        return false;
-    }
-
-    using std::size;
-    if(size(shape) != size(indices))
-    {
-        return false;
-    }
-
-    using std::begin, std::end;
-
-    auto dim = begin(shape);
-    auto idx = begin(indices);
-    for(; dim != end(shape) && idx != end(indices); ++dim, ++idx)
-    {
-        if(*dim <= *idx)
-        {
-            return false;
-        }
-    }
-
-    return true;
-}
-
 template <std::size_t Size>
 std::array<std::size_t, Size> transpose(const std::array<std::size_t, Size>& shape,
                                         const std::array<std::size_t, Size>& axes)
@@ -356,32 +319,6 @@ auto extend_axes(const Problem::Axes& axes)
     return extended_axes;
 }
 
-template <typename Shape, typename Indices>
-auto advance_indices(const Shape& shape, Indices& indices) -> std::enable_if_t<
-    detail::is_bidirectional_range_v<Shape> && detail::is_sized_range_v<Shape> &&
-        detail::is_bidirectional_range_v<Indices> && detail::is_sized_range_v<Indices>,
-    bool>
-{
-    using std::size;
-    if(!(is_valid_shape(shape) && is_valid_indices(shape, indices) && size(shape) == size(indices)))
-    {
-        return false;
-    }
-
-    bool carry = true;
-
-    using std::rbegin, std::rend;
-    auto dim = rbegin(shape);
-    auto idx = rbegin(indices);
-    for(; carry && dim != rend(shape) && idx != rend(indices); ++dim, ++idx)
-    {
-        *idx  = (*idx + carry);
-        carry = ((*idx == *dim) ? (*idx = 0, true) : false);
-    }
-
-    return !carry;
-}
-
 template <typename Src, typename Axes, typename Functor, typename Dest>
 auto host_permute(const Tensor<Src>& src, const Axes& axes, Functor functor, Tensor<Dest>& dest)
     -> std::enable_if_t<detail::is_random_access_range_v<Axes> && detail::is_sized_range_v<Axes> &&
@@ -423,34 +360,7 @@ auto host_permute(const Tensor<Src>& src, const Axes& axes, Functor functor, Ten
         }
     }
 
-    std::vector<std::size_t> indices(size(shape), 0);
-    if(!is_valid_indices(shape, indices))
-    {
-        return false;
-    }
-
-    switch(size(shape))
-    {
-    case 3: {
-        do
-        {
-            Dest output = 0;
-            functor(output, src(indices[0], indices[1], indices[2]));
-            dest(indices[axes[0]], indices[axes[1]], indices[axes[2]]) = output;
-        } while(advance_indices(shape, indices));
-    }
-    break;
-    case 4: {
-        do
-        {
-            Dest output = 0;
-            functor(output, src(indices[0], indices[1], indices[2], indices[3]));
-            dest(indices[axes[0]], indices[axes[1]], indices[axes[2]], indices[axes[3]]) = output;
-        } while(advance_indices(shape, indices));
-    }
-    break;
-    default: return false;
-    }
+    ck::utils::host_permute(src, axes, dest, functor);
 
     return true;
 }
@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_description/tensor_descriptor_simplify.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/operator_transform/transform_contraction_to_gemm.hpp"
+#include "ck/tensor_operation/operator_transform/transform_conv_fwd_to_gemm.hpp"
+
+#include "ck/library/utility/algorithm.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/utility/tensor_descriptor_cost.hpp"
+
+// Index math cost of the GEMM descriptors made for convolutions and contractions: the integer
+// operations of CalculateOffset() and of a coordinate step along each GEMM dimension, and their
+// host time, before and after simplify_tensor_descriptor()
+
+using ck::index_t;
+
+namespace ctc = ck::tensor_layout::convolution;
+
+using ConvSpec   = ck::tensor_operation::device::ConvolutionForwardSpecialization;
+using TensorSpec = ck::tensor_operation::device::TensorSpecialization;
+
+// number of indices timed per descriptor
+constexpr ck::long_index_t max_num_index = 1 << 20;
+
+template <typename Desc>
+void report(const std::string& name, const Desc& desc, index_t nrepeat)
+{
+    const auto simplified_desc = ck::simplify_tensor_descriptor(desc);
+
+    const auto time            = ck::utils::time_tensor_descriptor(desc, max_num_index, nrepeat);
+    const auto simplified_time =
+        ck::utils::time_tensor_descriptor(simplified_desc, max_num_index, nrepeat);
+
+    std::cout << name << std::endl;
+    std::cout << ck::utils::get_tensor_descriptor_cost(desc);
+    std::cout << "time: CalculateOffset " << time.calculate_offset_ns_
+              << " ns, move_tensor_coordinate " << time.move_coordinate_ns_ << " ns" << std::endl;
+    std::cout << "simplified:" << std::endl;
+    std::cout << ck::utils::get_tensor_descriptor_cost(simplified_desc);
+    std::cout << "time: CalculateOffset " << simplified_time.calculate_offset_ns_
+              << " ns, move_tensor_coordinate " << simplified_time.move_coordinate_ns_ << " ns"
+              << std::endl
+              << std::endl;
+}
+
+template <index_t NDimSpatial,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          ConvSpec ConvForwardSpecialization>
+void report_conv_fwd(const std::string& name,
+                     const ck::utils::conv::ConvParam& conv_param,
+                     index_t nrepeat)
+{
+    using Transform =
+        ck::tensor_operation::TransformConvFwdToGemm<NDimSpatial, ConvForwardSpecialization>;
+
+    const auto in_g_n_c_wis_desc =
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param);
+    const auto wei_g_k_c_xs_desc =
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(conv_param);
+    const auto out_g_n_k_wos_desc =
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(
+            conv_param);
+
+    std::array<index_t, NDimSpatial + 3> a_g_n_c_wis_lengths{};
+    std::array<index_t, NDimSpatial + 3> a_g_n_c_wis_strides{};
+    std::array<index_t, NDimSpatial + 3> b_g_k_c_xs_lengths{};
+    std::array<index_t, NDimSpatial + 3> b_g_k_c_xs_strides{};
+    std::array<index_t, NDimSpatial + 3> c_g_n_k_wos_lengths{};
+    std::array<index_t, NDimSpatial + 3> c_g_n_k_wos_strides{};
+    std::array<index_t, NDimSpatial> conv_filter_strides{};
+    std::array<index_t, NDimSpatial> conv_filter_dilations{};
+    std::array<index_t, NDimSpatial> input_left_pads{};
+    std::array<index_t, NDimSpatial> input_right_pads{};
+
+    auto copy = [](const auto& x, auto& y) { ck::ranges::copy(x, y.begin()); };
+
+    copy(in_g_n_c_wis_desc.GetLengths(), a_g_n_c_wis_lengths);
+    copy(in_g_n_c_wis_desc.GetStrides(), a_g_n_c_wis_strides);
+    copy(wei_g_k_c_xs_desc.GetLengths(), b_g_k_c_xs_lengths);
+    copy(wei_g_k_c_xs_desc.GetStrides(), b_g_k_c_xs_strides);
+    copy(out_g_n_k_wos_desc.GetLengths(), c_g_n_k_wos_lengths);
+    copy(out_g_n_k_wos_desc.GetStrides(), c_g_n_k_wos_strides);
+    copy(conv_param.conv_filter_strides_, conv_filter_strides);
+    copy(conv_param.conv_filter_dilations_, conv_filter_dilations);
+    copy(conv_param.input_left_pads_, input_left_pads);
+    copy(conv_param.input_right_pads_, input_right_pads);
+
+    report(name + " A[M, K]",
+           Transform::template MakeADescriptor_M_K<InLayout>(a_g_n_c_wis_lengths,
+                                                             a_g_n_c_wis_strides,
+                                                             b_g_k_c_xs_lengths,
+                                                             b_g_k_c_xs_strides,
+                                                             c_g_n_k_wos_lengths,
+                                                             c_g_n_k_wos_strides,
+                                                             conv_filter_strides,
+                                                             conv_filter_dilations,
+                                                             input_left_pads,
+                                                             input_right_pads),
+           nrepeat);
+
+    report(name + " B[N, K]",
+           Transform::template MakeBDescriptor_N_K<WeiLayout>(b_g_k_c_xs_lengths,
+                                                              b_g_k_c_xs_strides),
+           nrepeat);
+
+    report(name + " C[M, N]",
+           Transform::template MakeCDescriptor_M_N<OutLayout>(c_g_n_k_wos_lengths,
+                                                              c_g_n_k_wos_strides),
+           nrepeat);
+}
+
+template <TensorSpec TensorSpecialization>
+void report_contraction(const std::string& name,
+                        const std::vector<index_t>& gs_ms_ns_lengths,
+                        const std::vector<index_t>& gs_ms_ns_strides,
+                        index_t nrepeat)
+{
+    const auto grid_desc_pair =
+        ck::tensor_operation::MakeGridDescriptorPair<1, 2, 2, TensorSpecialization>(
+            gs_ms_ns_lengths, gs_ms_ns_strides);
+
+    report(name + " [G, M, N]", grid_desc_pair.first, nrepeat);
+    report(name + " [M, N]", grid_desc_pair.second, nrepeat);
+}
+
+int main(int argc, char* argv[])
+{
+    index_t nrepeat = 5;
+
+    if(argc == 2)
+    {
+        nrepeat = std::stoi(argv[1]);
+    }
+    else if(argc != 1)
+    {
+        std::cout << "arg1: number of repetitions of the timing (default 5)" << std::endl;
+        return 1;
+    }
+
+    // G, N, K, C, filter, input, strides, dilations, left pads, right pads
+    const ck::utils::conv::ConvParam conv_3x3{
+        2, 2, 16, 128, 64, {3, 3}, {28, 28}, {1, 1}, {1, 1}, {1, 1}, {1, 1}};
+    const ck::utils::conv::ConvParam conv_1x1_stride2{
+        2, 2, 16, 128, 64, {1, 1}, {28, 28}, {2, 2}, {1, 1}, {0, 0}, {0, 0}};
+    const ck::utils::conv::ConvParam conv_1x1{
+        2, 2, 16, 128, 64, {1, 1}, {28, 28}, {1, 1}, {1, 1}, {0, 0}, {0, 0}};
+    const ck::utils::conv::ConvParam conv3d_3x3x3{
+        3, 2, 4, 64, 32, {3, 3, 3}, {8, 16, 16}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}};
+
+    report_conv_fwd<2, ctc::GNHWC, ctc::GKYXC, ctc::GNHWK, ConvSpec::Default>(
+        "conv2d fwd GNHWC 3x3", conv_3x3, nrepeat);
+    report_conv_fwd<2, ctc::NHWGC, ctc::GKYXC, ctc::NHWGK, ConvSpec::Default>(
+        "conv2d fwd NHWGC 3x3", conv_3x3, nrepeat);
+    report_conv_fwd<2, ctc::GNHWC, ctc::GKYXC, ctc::GNHWK, ConvSpec::Filter1x1Pad0>(
+        "conv2d fwd GNHWC 1x1 stride 2", conv_1x1_stride2, nrepeat);
+    report_conv_fwd<2, ctc::NHWGC, ctc::GKYXC, ctc::NHWGK, ConvSpec::Filter1x1Pad0>(
+        "conv2d fwd NHWGC 1x1 stride 2", conv_1x1_stride2, nrepeat);
+    report_conv_fwd<2, ctc::NHWGC, ctc::GKYXC, ctc::NHWGK, ConvSpec::Filter1x1Stride1Pad0>(
+        "conv2d fwd NHWGC 1x1 stride 1", conv_1x1, nrepeat);
+    report_conv_fwd<3, ctc::NDHWGC, ctc::GKZYXC, ctc::NDHWGK, ConvSpec::Default>(
+        "conv3d fwd NDHWGC 3x3x3", conv3d_3x3x3, nrepeat);
+
+    // G0, M0, M1, N0, N1
+    const std::vector<index_t> lengths{4, 8, 32, 16, 64};
+    const std::vector<index_t> packed_strides{8 * 32 * 16 * 64, 32 * 16 * 64, 16 * 64, 64, 1};
+    const std::vector<index_t> permuted_strides{64, 4 * 64, 4 * 64 * 8, 4 * 64 * 8 * 32, 1};
+
+    report_contraction<TensorSpec::Packed>(
+        "contraction G1_M2_N2 packed", lengths, packed_strides, nrepeat);
+    report_contraction<TensorSpec::Default>(
+        "contraction G1_M2_N2 row-major", lengths, packed_strides, nrepeat);
+    report_contraction<TensorSpec::Default>(
+        "contraction G1_M2_N2 permuted", lengths, permuted_strides, nrepeat);
+
+    return 0;
+}
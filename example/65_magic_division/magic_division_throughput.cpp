@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/magic_division.hpp"
+
+// Host throughput of the magic number division variants against the / operator, on random
+// dividends of their full range. The divisors are only known at run time, like the lengths of a
+// Merge transform made from run-time lengths.
+
+using ck::index_t;
+using ck::long_index_t;
+using ck::MagicDivision;
+
+constexpr index_t num_dividend = 1 << 22;
+
+template <typename T, typename F>
+void report(const std::string& name, const std::vector<T>& dividends, F f, index_t nrepeat)
+{
+    using clock = std::chrono::steady_clock;
+
+    // the checksum keeps the divisions from being optimized out
+    uint64_t checksum = 0;
+
+    const auto t0 = clock::now();
+
+    for(index_t r = 0; r < nrepeat; ++r)
+    {
+        for(const T& dividend : dividends)
+        {
+            checksum += static_cast<uint64_t>(f(dividend));
+        }
+    }
+
+    const auto t1 = clock::now();
+
+    const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() /
+                      (static_cast<double>(dividends.size()) * nrepeat);
+
+    std::cout << name << ": " << ns << " ns per division, checksum " << checksum << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    index_t nrepeat    = 5;
+    uint64_t divisor_u = 641;
+
+    if(argc == 3)
+    {
+        nrepeat   = std::stoi(argv[1]);
+        divisor_u = std::stoull(argv[2]);
+    }
+    else if(argc != 1)
+    {
+        std::cout << "arg1: number of repetitions of the timing (default 5)" << std::endl;
+        std::cout << "arg2: divisor, within [1, INT32_MAX] (default 641)" << std::endl;
+        return 1;
+    }
+
+    if(divisor_u < 1 || divisor_u > INT32_MAX)
+    {
+        std::cout << "divisor needs to be within [1, INT32_MAX]" << std::endl;
+        return 1;
+    }
+
+    std::mt19937_64 gen(11939);
+
+    std::vector<uint32_t> dividends_u32(num_dividend);
+    std::vector<int32_t> dividends_i32(num_dividend);
+    std::vector<long_index_t> dividends_i64(num_dividend);
+
+    for(index_t i = 0; i < num_dividend; ++i)
+    {
+        dividends_u32[i] = static_cast<uint32_t>(gen());
+        dividends_i32[i] = static_cast<int32_t>(gen());
+        dividends_i64[i] = static_cast<long_index_t>(gen());
+    }
+
+    const uint32_t divisor_u32     = static_cast<uint32_t>(divisor_u);
+    const int32_t divisor_i32      = static_cast<int32_t>(divisor_u);
+    const long_index_t divisor_i64 = static_cast<long_index_t>(divisor_u);
+
+    const auto magic          = MagicDivision::CalculateMagicNumbers(divisor_u32);
+    const uint32_t multiplier = magic[ck::Number<0>{}];
+    const uint32_t shift      = magic[ck::Number<1>{}];
+
+    const auto magic64          = MagicDivision::CalculateMagicNumbers64(divisor_u);
+    const uint64_t multiplier64 = magic64[ck::Number<0>{}];
+    const uint32_t shift64      = magic64[ck::Number<1>{}];
+
+    std::cout << "divisor " << divisor_u << ", " << num_dividend << " dividends" << std::endl;
+
+    // the fast path is exact for dividends within 31 bits only
+    std::vector<uint32_t> dividends_u31(dividends_u32);
+
+    for(auto& dividend : dividends_u31)
+    {
+        dividend >>= 1;
+    }
+
+    report(
+        "uint32_t 31-bit /", dividends_u31, [&](uint32_t n) { return n / divisor_u32; }, nrepeat);
+    report(
+        "uint32_t 31-bit DoMagicDivision",
+        dividends_u31,
+        [&](uint32_t n) { return MagicDivision::DoMagicDivision(n, multiplier, shift); },
+        nrepeat);
+    report(
+        "uint32_t /", dividends_u32, [&](uint32_t n) { return n / divisor_u32; }, nrepeat);
+    report(
+        "uint32_t DoMagicDivisionFullRange",
+        dividends_u32,
+        [&](uint32_t n) { return MagicDivision::DoMagicDivisionFullRange(n, multiplier, shift); },
+        nrepeat);
+    report(
+        "int32_t /", dividends_i32, [&](int32_t n) { return n / divisor_i32; }, nrepeat);
+    report(
+        "int32_t DoMagicDivisionSigned",
+        dividends_i32,
+        [&](int32_t n) { return MagicDivision::DoMagicDivisionSigned(n, multiplier, shift); },
+        nrepeat);
+    report(
+        "long_index_t /", dividends_i64, [&](long_index_t n) { return n / divisor_i64; }, nrepeat);
+    report(
+        "long_index_t DoMagicDivision64",
+        dividends_i64,
+        [&](long_index_t n) { return MagicDivision::DoMagicDivision64(n, multiplier64, shift64); },
+        nrepeat);
+
+    return 0;
+}
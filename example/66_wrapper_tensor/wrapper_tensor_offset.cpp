@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+
+#include "ck/wrapper/layout.hpp"
+#include "ck/wrapper/tensor.hpp"
+
+// Host time of the element offsets of a tiled and partitioned row-major matrix, read through
+// wrapper local_tile/local_partition, through a hand-written naive descriptor and through plain
+// index arithmetic. With compile-time tile and thread shapes the three loops are expected to
+// compile to the same code, i.e. to take the same time.
+
+using ck::index_t;
+
+constexpr index_t M = 1024;
+constexpr index_t N = 1024;
+
+constexpr auto MPerTile   = ck::Number<64>{};
+constexpr auto NPerTile   = ck::Number<64>{};
+constexpr auto MPerThread = ck::Number<16>{};
+constexpr auto NPerThread = ck::Number<16>{};
+constexpr auto MRepeat    = MPerTile / MPerThread;
+constexpr auto NRepeat    = NPerTile / NPerThread;
+
+// calls f(m_tile, n_tile, thread_id) over all tiles and threads
+template <typename F>
+void for_each_thread(F&& f)
+{
+    for(index_t m_tile = 0; m_tile < M / MPerTile; m_tile++)
+    {
+        for(index_t n_tile = 0; n_tile < N / NPerTile; n_tile++)
+        {
+            for(index_t thread_id = 0; thread_id < MPerThread * NPerThread; thread_id++)
+            {
+                f(m_tile, n_tile, thread_id);
+            }
+        }
+    }
+}
+
+index_t sum_wrapper(const index_t* p)
+{
+    const auto tensor = ck::wrapper::make_tensor<ck::AddressSpaceEnum::Global>(
+        p, ck::wrapper::make_layout(ck::make_tuple(M, N), ck::make_tuple(N, 1)));
+
+    index_t sum = 0;
+    for_each_thread([&](index_t m_tile, index_t n_tile, index_t thread_id) {
+        const auto tile = ck::wrapper::local_tile(
+            tensor, ck::make_tuple(MPerTile, NPerTile), ck::make_tuple(m_tile, n_tile));
+        const auto partition = ck::wrapper::local_partition(
+            tile, ck::make_tuple(MPerThread, NPerThread), thread_id);
+
+        ck::static_for<0, MRepeat, 1>{}([&](auto m) {
+            ck::static_for<0, NRepeat, 1>{}([&](auto n) { sum += partition(m, n); });
+        });
+    });
+    return sum;
+}
+
+index_t sum_descriptor(const index_t* p)
+{
+    const auto desc = ck::make_naive_tensor_descriptor(ck::make_tuple(M, N), ck::make_tuple(N, 1));
+
+    index_t sum = 0;
+    for_each_thread([&](index_t m_tile, index_t n_tile, index_t thread_id) {
+        const index_t m_origin = m_tile * MPerTile + thread_id % MPerThread;
+        const index_t n_origin = n_tile * NPerTile + thread_id / MPerThread;
+
+        ck::static_for<0, MRepeat, 1>{}([&](auto m) {
+            ck::static_for<0, NRepeat, 1>{}([&](auto n) {
+                sum += p[desc.CalculateOffset(ck::make_multi_index(
+                    m_origin + m * MPerThread, n_origin + n * NPerThread))];
+            });
+        });
+    });
+    return sum;
+}
+
+index_t sum_hand_written(const index_t* p)
+{
+    index_t sum = 0;
+    for_each_thread([&](index_t m_tile, index_t n_tile, index_t thread_id) {
+        const index_t m_origin = m_tile * MPerTile + thread_id % MPerThread;
+        const index_t n_origin = n_tile * NPerTile + thread_id / MPerThread;
+
+        ck::static_for<0, MRepeat, 1>{}([&](auto m) {
+            ck::static_for<0, NRepeat, 1>{}([&](auto n) {
+                sum += p[(m_origin + m * MPerThread) * N + n_origin + n * NPerThread];
+            });
+        });
+    });
+    return sum;
+}
+
+// returns the time per element, the sum of the first run is written to sum
+template <typename F>
+float time_ns_per_element(F&& f, const index_t* p, index_t nrepeat, index_t& sum)
+{
+    using clock = std::chrono::steady_clock;
+
+    sum = f(p);
+
+    // keeps the timed runs from being optimized away
+    volatile index_t sink = 0;
+
+    const auto start = clock::now();
+    for(index_t i = 0; i < nrepeat; i++)
+    {
+        sink = sink + f(p);
+    }
+    const auto stop = clock::now();
+
+    return std::chrono::duration<float, std::nano>(stop - start).count() /
+           (static_cast<float>(nrepeat) * M * N);
+}
+
+int main(int argc, char* argv[])
+{
+    index_t nrepeat = 20;
+
+    if(argc == 2)
+    {
+        nrepeat = std::stoi(argv[1]);
+    }
+    else if(argc != 1)
+    {
+        std::cout << "arg1: number of repetitions of the timing (default 20)" << std::endl;
+        return 1;
+    }
+
+    std::vector<index_t> data(M * N);
+    for(index_t i = 0; i < M * N; i++)
+    {
+        data[i] = i % 7;
+    }
+
+    const index_t* p = data.data();
+
+    index_t sum_0 = 0;
+    index_t sum_1 = 0;
+    index_t sum_2 = 0;
+
+    const float wrapper_ns      = time_ns_per_element(sum_wrapper, p, nrepeat, sum_0);
+    const float descriptor_ns   = time_ns_per_element(sum_descriptor, p, nrepeat, sum_1);
+    const float hand_written_ns = time_ns_per_element(sum_hand_written, p, nrepeat, sum_2);
+
+    std::cout << "M " << M << ", N " << N << ", tile " << MPerTile << "x" << NPerTile
+              << ", threads " << MPerThread << "x" << NPerThread << std::endl;
+    std::cout << "wrapper local_tile/local_partition: " << wrapper_ns << " ns/element" << std::endl;
+    std::cout << "naive tensor descriptor:            " << descriptor_ns << " ns/element"
+              << std::endl;
+    std::cout << "hand-written offsets:               " << hand_written_ns << " ns/element"
+              << std::endl;
+
+    if(sum_0 != sum_2 || sum_1 != sum_2)
+    {
+        std::cout << "wrong! sums differ: " << sum_0 << ", " << sum_1 << ", " << sum_2
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
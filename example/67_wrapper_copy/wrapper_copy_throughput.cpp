@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/common_header.hpp"
+
+#include "ck/wrapper/layout.hpp"
+#include "ck/wrapper/tensor.hpp"
+#include "ck/wrapper/operations/copy.hpp"
+
+// Host throughput of ck::wrapper::copy for contiguous, strided and transposed M x N int32
+// matrices, copied tile by tile. Tiles of compile-time shape are accessed with vectors along
+// the dim of unit stride, runtime tiles element by element.
+
+using ck::index_t;
+using ck::wrapper::make_layout;
+using ck::wrapper::make_tensor;
+
+constexpr auto Global = ck::AddressSpaceEnum::Global;
+
+constexpr index_t M = 2048;
+constexpr index_t N = 2048;
+
+constexpr auto MPerTile = ck::Number<64>{};
+constexpr auto NPerTile = ck::Number<64>{};
+
+// copies src to dst tile by tile
+template <typename SrcTensor, typename DstTensor, typename TileShape>
+void copy_tiles(const SrcTensor& src, const DstTensor& dst, const TileShape& tile_shape)
+{
+    for(index_t m_tile = 0; m_tile < M / MPerTile; m_tile++)
+    {
+        for(index_t n_tile = 0; n_tile < N / NPerTile; n_tile++)
+        {
+            const auto tile_coords = ck::make_tuple(m_tile, n_tile);
+            ck::wrapper::copy(ck::wrapper::local_tile(src, tile_shape, tile_coords),
+                              ck::wrapper::local_tile(dst, tile_shape, tile_coords));
+        }
+    }
+}
+
+template <typename F>
+float time_gb_per_s(F&& f, index_t nrepeat)
+{
+    using clock = std::chrono::steady_clock;
+
+    // warm up
+    f();
+
+    const auto start = clock::now();
+    for(index_t i = 0; i < nrepeat; i++)
+    {
+        f();
+    }
+    const auto stop = clock::now();
+
+    const float bytes = 2.f * sizeof(index_t) * M * N * static_cast<float>(nrepeat);
+    return bytes / std::chrono::duration<float, std::nano>(stop - start).count();
+}
+
+int main(int argc, char* argv[])
+{
+    index_t nrepeat = 10;
+
+    if(argc == 2)
+    {
+        nrepeat = std::stoi(argv[1]);
+    }
+    else if(argc != 1)
+    {
+        std::cout << "arg1: number of repetitions of the timing (default 10)" << std::endl;
+        return 1;
+    }
+
+    // the source has twice the columns, to read every second one in the strided copy
+    std::vector<index_t> src(M * N * 2);
+    std::vector<index_t> dst(M * N);
+    for(index_t i = 0; i < M * N * 2; i++)
+    {
+        src[i] = i;
+    }
+
+    const auto shape         = ck::make_tuple(M, N);
+    const auto row_major     = make_layout(shape, ck::make_tuple(N, ck::Number<1>{}));
+    const auto column_major  = make_layout(shape, ck::make_tuple(ck::Number<1>{}, M));
+    const auto row_pitch_2n  = make_layout(shape, ck::make_tuple(2 * N, ck::Number<1>{}));
+    const auto every_second  = make_layout(shape, ck::make_tuple(2 * N, ck::Number<2>{}));
+    const auto tile_shape    = ck::make_tuple(MPerTile, NPerTile);
+    const auto runtime_tile  = ck::make_tuple(index_t{MPerTile}, index_t{NPerTile});
+    const auto src_packed    = make_tensor<Global>(src.data(), row_major);
+    const auto src_pitched   = make_tensor<Global>(src.data(), row_pitch_2n);
+    const auto src_strided   = make_tensor<Global>(src.data(), every_second);
+    const auto dst_packed    = make_tensor<Global>(dst.data(), row_major);
+    const auto dst_col_major = make_tensor<Global>(dst.data(), column_major);
+
+    bool pass = true;
+
+    // checks dst(m, n) == src(m * src_row_stride + n * src_col_stride) on a grid of elements
+    auto check = [&](const std::string& name,
+                     float gb_per_s,
+                     index_t dst_row_stride,
+                     index_t dst_col_stride,
+                     index_t src_row_stride,
+                     index_t src_col_stride) {
+        bool correct = true;
+        for(index_t m = 0; m < M; m += 7)
+        {
+            for(index_t n = 0; n < N; n += 5)
+            {
+                correct &= dst[m * dst_row_stride + n * dst_col_stride] ==
+                           src[m * src_row_stride + n * src_col_stride];
+            }
+        }
+        std::cout << name << gb_per_s << " GB/s" << (correct ? "" : ", wrong result!")
+                  << std::endl;
+        pass &= correct;
+    };
+
+    const float memcpy_gb_per_s = time_gb_per_s(
+        [&] { std::memcpy(dst.data(), src.data(), sizeof(index_t) * M * N); }, nrepeat);
+    std::cout << "memcpy:                        " << memcpy_gb_per_s << " GB/s" << std::endl;
+
+    check("contiguous, compile-time tiles: ",
+          time_gb_per_s([&] { copy_tiles(src_packed, dst_packed, tile_shape); }, nrepeat),
+          N,
+          1,
+          N,
+          1);
+    check("contiguous, runtime tiles:      ",
+          time_gb_per_s([&] { copy_tiles(src_packed, dst_packed, runtime_tile); }, nrepeat),
+          N,
+          1,
+          N,
+          1);
+    check("row pitch 2N:                   ",
+          time_gb_per_s([&] { copy_tiles(src_pitched, dst_packed, tile_shape); }, nrepeat),
+          N,
+          1,
+          2 * N,
+          1);
+    check("every second column:            ",
+          time_gb_per_s([&] { copy_tiles(src_strided, dst_packed, tile_shape); }, nrepeat),
+          N,
+          1,
+          2 * N,
+          2);
+    check("transpose, compile-time tiles:  ",
+          time_gb_per_s([&] { copy_tiles(src_packed, dst_col_major, tile_shape); }, nrepeat),
+          1,
+          M,
+          N,
+          1);
+    check("transpose, runtime tiles:       ",
+          time_gb_per_s([&] { copy_tiles(src_packed, dst_col_major, runtime_tile); }, nrepeat),
+          1,
+          M,
+          N,
+          1);
+
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
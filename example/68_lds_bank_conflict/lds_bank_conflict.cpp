@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/block/blockwise_gemm_xdlops.hpp"
+
+#include "ck/library/utility/lds_bank_conflict.hpp"
+
+// LDS bank conflicts of the (K0, M, K1) A tile of half_t xdlops GEMMs, written by
+// ThreadGroupTensorSliceTransfer_v4r1 and read by BlockwiseGemmXdlops, for a packed tile, a tile
+// padded with ABlockLdsExtraM = 1 and a packed tile with an XOR swizzle of M by K0
+
+using ck::index_t;
+using ck::Number;
+using ck::Sequence;
+
+using ADataType = ck::half_t;
+
+constexpr index_t BlockSize = 256;
+
+constexpr auto K1 = Number<8>{};
+
+enum struct LdsLayout
+{
+    Packed,
+    Padded,
+    Xor
+};
+
+template <LdsLayout Layout, typename K0, typename M>
+constexpr auto make_a_lds_desc(K0, M)
+{
+    if constexpr(Layout == LdsLayout::Padded)
+    {
+        return ck::make_naive_tensor_descriptor(
+            ck::make_tuple(K0{}, M{}, K1),
+            ck::make_tuple(Number<(M{} + 1) * K1>{}, K1, Number<1>{}));
+    }
+    else
+    {
+        const auto packed_desc =
+            ck::make_naive_tensor_descriptor_packed(ck::make_tuple(K0{}, M{}, K1));
+
+        if constexpr(Layout == LdsLayout::Xor)
+        {
+            return ck::transform_tensor_descriptor(
+                packed_desc,
+                ck::make_tuple(ck::make_xor_transform(ck::make_tuple(K0{}, M{})),
+                               ck::make_pass_through_transform(K1)),
+                ck::make_tuple(Sequence<0, 1>{}, Sequence<2>{}),
+                ck::make_tuple(Sequence<0, 1>{}, Sequence<2>{}));
+        }
+        else
+        {
+            return packed_desc;
+        }
+    }
+}
+
+// conflict cycles per wave of the worst wave, and per instruction
+void report(const std::string& name, const ck::utils::LdsAccessPattern& pattern, index_t num_bank)
+{
+    ck::utils::LdsBankConflicts worst;
+
+    for(const auto& conflicts : ck::utils::get_lds_bank_conflicts(pattern, num_bank))
+    {
+        if(conflicts.conflict_cycles_ >= worst.conflict_cycles_)
+            worst = conflicts;
+    }
+
+    std::cout << "    " << name << worst << " ("
+              << static_cast<float>(worst.conflict_cycles_) / worst.accesses_
+              << " conflict cycles per instruction)" << std::endl;
+}
+
+template <LdsLayout Layout,
+          index_t MPerBlock,
+          index_t KPerBlock,
+          index_t MRepeat,
+          typename ThreadClusterLengths>
+void report_a_tile(const std::string& name, index_t num_bank)
+{
+    constexpr auto K0 = Number<KPerBlock / K1>{};
+    constexpr auto M  = Number<MPerBlock>{};
+
+    constexpr auto a_desc = make_a_lds_desc<Layout>(K0, M);
+
+    using ADesc = ck::remove_cvref_t<decltype(a_desc)>;
+
+    // 2 x 2 waves of 32x32 xdlops, A and B have the same tile
+    using BlockwiseGemm =
+        ck::BlockwiseGemmXdlops_k0mk1_k0nk1_m0n0m1n1m2m3m4n2_v1<BlockSize,
+                                                                ADataType,
+                                                                ADataType,
+                                                                float,
+                                                                ADesc,
+                                                                ADesc,
+                                                                32,
+                                                                32,
+                                                                MRepeat,
+                                                                MRepeat,
+                                                                K1>;
+
+    const auto write =
+        ck::utils::get_thread_group_slice_transfer_write_pattern<ADataType,
+                                                                 Sequence<K0, M, K1>,
+                                                                 ThreadClusterLengths,
+                                                                 Sequence<1, 0, 2>,
+                                                                 2,
+                                                                 K1>(a_desc, BlockSize);
+    const auto read =
+        ck::utils::get_blockwise_gemm_xdlops_a_read_pattern<ADataType, BlockwiseGemm>();
+
+    std::cout << name << ", " << num_bank << " banks, LDS "
+              << a_desc.GetElementSpaceSize() * sizeof(ADataType) << " bytes" << std::endl;
+
+    report("write: ", write, num_bank);
+    report("read:  ", read, num_bank);
+}
+
+template <index_t MPerBlock, index_t KPerBlock, index_t MRepeat, typename ThreadClusterLengths>
+void report_a_tiles(const std::string& name, index_t num_bank)
+{
+    report_a_tile<LdsLayout::Packed, MPerBlock, KPerBlock, MRepeat, ThreadClusterLengths>(
+        name + " packed", num_bank);
+    report_a_tile<LdsLayout::Padded, MPerBlock, KPerBlock, MRepeat, ThreadClusterLengths>(
+        name + " padded", num_bank);
+    report_a_tile<LdsLayout::Xor, MPerBlock, KPerBlock, MRepeat, ThreadClusterLengths>(
+        name + " xor", num_bank);
+}
+
+int main(int argc, char* argv[])
+{
+    index_t num_bank = 32;
+
+    if(argc == 2)
+    {
+        num_bank = std::stoi(argv[1]);
+    }
+    else if(argc != 1)
+    {
+        std::cout << "arg1: number of LDS banks (default 32)" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << std::setprecision(3);
+
+    // a thread writes 4 rows
+    report_a_tiles<256, 32, 4, Sequence<4, 64, 1>>("256x32 tile", num_bank);
+    // a thread writes 2 rows
+    report_a_tiles<128, 32, 2, Sequence<4, 64, 1>>("128x32 tile", num_bank);
+    // K0 = 8, a thread writes 4 rows of a single K0
+    report_a_tiles<128, 64, 2, Sequence<8, 32, 1>>("128x64 tile", num_bank);
+
+    return EXIT_SUCCESS;
+}
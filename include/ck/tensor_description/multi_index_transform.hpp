@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cassert>
+
 #include "ck/utility/common_header.hpp"
 #include "ck/utility/multi_index.hpp"
 
@@ -999,38 +1001,79 @@ struct Merge_v1_carry_check
     }
 };
 
+template <typename Length>
+struct is_long_index_length : integral_constant<bool, is_same<Length, long_index_t>::value>
+{
+};
+
+template <long_index_t X>
+struct is_long_index_length<LongNumber<X>> : integral_constant<bool, true>
+{
+};
+
+// index type of the magic division of a Merge: long_index_t (or LongNumber) lengths select the
+// 64-bit magic division, index_t lengths the fast 32-bit one
 template <typename LowLengths>
+struct merge_magic_division_index;
+
+template <typename... Ls>
+struct merge_magic_division_index<Tuple<Ls...>>
+{
+    using type = conditional_t<(is_long_index_length<remove_cvref_t<Ls>>::value || ...),
+                               long_index_t,
+                               index_t>;
+};
+
+template <index_t... Is>
+struct merge_magic_division_index<Sequence<Is...>>
+{
+    using type = index_t;
+};
+
+// a length of a Merge as its DivisionIndex, so that the magic numbers of all lengths are those of
+// the magic division picked for the Merge, compile-time lengths stay compile-time
+template <typename DivisionIndex, typename T, T X>
+__host__ __device__ constexpr auto to_merge_division_index(integral_constant<T, X>)
+{
+    return integral_constant<DivisionIndex, static_cast<DivisionIndex>(X)>{};
+}
+
+template <typename DivisionIndex, typename T>
+__host__ __device__ constexpr DivisionIndex to_merge_division_index(const T& x)
+{
+    return static_cast<DivisionIndex>(x);
+}
+
+template <typename LowLengths, typename DivisionIndex>
 struct lambda_merge_generate_MagicDivision_calculate_magic_multiplier
 {
     template <index_t I>
     __host__ __device__ constexpr auto operator()(Number<I> i) const
     {
-        return MagicDivision::CalculateMagicMultiplier(LowLengths{}[i]);
+        return MagicDivision::CalculateMagicMultiplier(
+            to_merge_division_index<DivisionIndex>(LowLengths{}[i]));
     }
 };
 
-template <typename LowLengths>
+template <typename LowLengths, typename DivisionIndex>
 struct lambda_merge_generate_MagicDivision_calculate_magic_shift
 {
     template <index_t I>
     __host__ __device__ constexpr auto operator()(Number<I> i) const
     {
-        return MagicDivision::CalculateMagicShift(LowLengths{}[i]);
+        return MagicDivision::CalculateMagicShift(
+            to_merge_division_index<DivisionIndex>(LowLengths{}[i]));
     }
 };
 
 // Implementation of "Merge" transformation primitive that uses magic-number-division to do lowering
 // of both multi-index and delta of multi-index
 // Caution:
-//   1. The magic number division implementation being used would produce correct result if the
-//   dividended is uint32_t and its value is with in 31-bit value range of uint32_t.
-//   2. The magic number division for int32_t dividened has not been implemented, the int32_t
-//   dividend would be bit-wise interpreted as uint32_t and magic number division implementation for
-//   uint32_t is then used.
-//   3. For Merge primitive, upper-index is the dividend.
-//   4. When upper-index is uint32_t, its value need to be within 31-bit range.
-//   5. When upper-index is int32_t type (when index_t is int32_t), its value need to be
-//   non-negative.
+//   For Merge primitive, upper-index is the dividend and the low lengths (or their scan) are the
+//   divisors. The magic division is picked from the type of the lengths, see
+//   merge_magic_division_index: index_t lengths are within [1, INT32_MAX] and the upper-index is a
+//   non-negative index_t, which is the exact range of the fast MagicDivision::DoMagicDivision(),
+//   and long_index_t lengths use MagicDivision::DoMagicDivision64().
 template <typename LowLengths>
 struct Merge_v2_magic_division
 {
@@ -1042,12 +1085,14 @@ struct Merge_v2_magic_division
     using UpLengths =
         decltype(make_tuple(container_reduce(LowLengths{}, math::multiplies{}, Number<1>{})));
 
+    using DivisionIndex = typename merge_magic_division_index<LowLengths>::type;
+
     using LowLengthsMagicDivisorMultipiler = decltype(generate_tuple(
-        lambda_merge_generate_MagicDivision_calculate_magic_multiplier<LowLengths>{},
+        lambda_merge_generate_MagicDivision_calculate_magic_multiplier<LowLengths, DivisionIndex>{},
         Number<NDimLow>{}));
 
     using LowLengthsMagicDivisorShift = decltype(generate_tuple(
-        lambda_merge_generate_MagicDivision_calculate_magic_shift<LowLengths>{},
+        lambda_merge_generate_MagicDivision_calculate_magic_shift<LowLengths, DivisionIndex>{},
         Number<NDimLow>{}));
 
     LowLengths low_lengths_;
@@ -1060,10 +1105,16 @@ struct Merge_v2_magic_division
     __host__ __device__ constexpr Merge_v2_magic_division(const LowLengths& low_lengths)
         : low_lengths_{low_lengths},
           low_lengths_magic_divisor_multiplier_{generate_tuple(
-              [&](auto i) { return MagicDivision::CalculateMagicMultiplier(low_lengths[i]); },
+              [&](auto i) {
+                  return MagicDivision::CalculateMagicMultiplier(
+                      to_merge_division_index<DivisionIndex>(low_lengths[i]));
+              },
               Number<NDimLow>{})},
           low_lengths_magic_divisor_shift_{generate_tuple(
-              [&](auto i) { return MagicDivision::CalculateMagicShift(low_lengths[i]); },
+              [&](auto i) {
+                  return MagicDivision::CalculateMagicShift(
+                      to_merge_division_index<DivisionIndex>(low_lengths[i]));
+              },
               Number<NDimLow>{})},
           up_lengths_{make_tuple(container_reduce(low_lengths, math::multiplies{}, Number<1>{}))}
     {
@@ -1083,10 +1134,10 @@ struct Merge_v2_magic_division
         static_assert(LowIdx::Size() == NDimLow && UpIdx::Size() == 1,
                       "wrong! inconsistent # of dimension");
 
-        index_t tmp = idx_up[Number<0>{}];
+        DivisionIndex tmp = idx_up[Number<0>{}];
 
         static_for<NDimLow - 1, 0, -1>{}([&, this](auto i) {
-            index_t tmp2 =
+            DivisionIndex tmp2 =
                 MagicDivision::DoMagicDivision(tmp,
                                                this->low_lengths_magic_divisor_multiplier_[i],
                                                this->low_lengths_magic_divisor_shift_[i]);
@@ -1112,10 +1163,10 @@ struct Merge_v2_magic_division
                           LowIdx::Size() == NDimLow && UpIdx::Size() == 1,
                       "wrong! inconsistent # of dimension");
 
-        index_t tmp = idx_up_new[Number<0>{}];
+        DivisionIndex tmp = idx_up_new[Number<0>{}];
 
         static_for<NDimLow - 1, 0, -1>{}([&, this](auto i) {
-            index_t tmp2 =
+            DivisionIndex tmp2 =
                 MagicDivision::DoMagicDivision(tmp,
                                                this->low_lengths_magic_divisor_multiplier_[i],
                                                this->low_lengths_magic_divisor_shift_[i]);
@@ -1174,15 +1225,7 @@ struct Merge_v2_magic_division
 // Implementation of "Merge" transformation primitive that uses magic-number-division to do lowering
 // of both multi-index and delta of multi-index
 // Caution:
-//   1. The magic number division implementation being used would produce correct result if the
-//   dividended is uint32_t and its value is with in 31-bit value range of uint32_t.
-//   2. The magic number division for int32_t dividened has not been implemented, the int32_t
-//   dividend would be bit-wise interpreted as uint32_t and magic number division implementation for
-//   uint32_t is then used.
-//   3. For Merge primitive, upper-index is the dividend.
-//   4. When upper-index is uint32_t, its value need to be within 31-bit range.
-//   5. When upper-index is int32_t type (when index_t is int32_t), its value need to be
-//   non-negative.
+//   The magic division is picked from the type of the lengths, like for Merge_v2_magic_division.
 template <typename LowLengths>
 struct Merge_v2r2_magic_division
 {
@@ -1197,12 +1240,16 @@ struct Merge_v2r2_magic_division
     using UpLengths =
         decltype(make_tuple(container_reduce(LowLengths{}, math::multiplies{}, Number<1>{})));
 
-    using LowLengthsScanMagicDivisorMultipiler = decltype(generate_tuple(
-        lambda_merge_generate_MagicDivision_calculate_magic_multiplier<LowLengthsScan>{},
-        Number<NDimLow>{}));
+    using DivisionIndex = typename merge_magic_division_index<LowLengths>::type;
+
+    using LowLengthsScanMagicDivisorMultipiler =
+        decltype(generate_tuple(lambda_merge_generate_MagicDivision_calculate_magic_multiplier<
+                                    LowLengthsScan,
+                                    DivisionIndex>{},
+                                Number<NDimLow>{}));
 
     using LowLengthsScanMagicDivisorShift = decltype(generate_tuple(
-        lambda_merge_generate_MagicDivision_calculate_magic_shift<LowLengthsScan>{},
+        lambda_merge_generate_MagicDivision_calculate_magic_shift<LowLengthsScan, DivisionIndex>{},
         Number<NDimLow>{}));
 
     LowLengths low_lengths_;
@@ -1218,10 +1265,16 @@ struct Merge_v2r2_magic_division
           low_lengths_scan_{
               container_reverse_exclusive_scan(low_lengths, math::multiplies{}, Number<1>{})},
           low_lengths_scan_magic_divisor_multiplier_{generate_tuple(
-              [&](auto i) { return MagicDivision::CalculateMagicMultiplier(low_lengths_scan_[i]); },
+              [&](auto i) {
+                  return MagicDivision::CalculateMagicMultiplier(
+                      to_merge_division_index<DivisionIndex>(low_lengths_scan_[i]));
+              },
               Number<NDimLow>{})},
           low_lengths_scan_magic_divisor_shift_{generate_tuple(
-              [&](auto i) { return MagicDivision::CalculateMagicShift(low_lengths_scan_[i]); },
+              [&](auto i) {
+                  return MagicDivision::CalculateMagicShift(
+                      to_merge_division_index<DivisionIndex>(low_lengths_scan_[i]));
+              },
               Number<NDimLow>{})},
           up_lengths_{make_tuple(container_reduce(low_lengths, math::multiplies{}, Number<1>{}))}
     {
@@ -1241,7 +1294,7 @@ struct Merge_v2r2_magic_division
         static_assert(LowIdx::Size() == NDimLow && UpIdx::Size() == 1,
                       "wrong! inconsistent # of dimension");
 
-        index_t tmp = idx_up[Number<0>{}];
+        DivisionIndex tmp = idx_up[Number<0>{}];
 
         static_for<0, NDimLow - 1, 1>{}([&, this](auto i) {
             idx_low(i) =
@@ -1270,7 +1323,7 @@ struct Merge_v2r2_magic_division
                           LowIdx::Size() == NDimLow && UpIdx::Size() == 1,
                       "wrong! inconsistent # of dimension");
 
-        index_t tmp = idx_up_new[Number<0>{}];
+        DivisionIndex tmp = idx_up_new[Number<0>{}];
 
         static_for<0, NDimLow - 1, 1>{}([&, this](auto i) {
             index_t idx_low_old = idx_low[i];
@@ -1951,4 +2004,118 @@ struct Modulo
         printf("}");
     }
 };
+
+/*
+ * \brief lower_idx = (upper_idx[0], upper_idx[1] ^ ((upper_idx[0] * multiplier) % length[1])).
+ * XOR swizzle of the columns of every row, e.g. for LDS tiles without padding: a column of the
+ * tile is spread over the banks. length[1] must be a power of 2.
+ */
+template <typename LowLengths, typename Multiplier>
+struct Xor
+{
+    using LowerIndex = MultiIndex<2>;
+    using UpperIndex = MultiIndex<2>;
+
+    using UpLengths = LowLengths;
+
+    UpLengths up_lengths_;
+    Multiplier multiplier_;
+
+    __host__ __device__ constexpr Xor() = default;
+
+    __host__ __device__ constexpr Xor(const LowLengths& low_lengths, const Multiplier& multiplier)
+        : up_lengths_{low_lengths}, multiplier_{multiplier}
+    {
+        static_assert(LowLengths::Size() == 2, "wrong! Xor swizzles a 2d index");
+
+        // otherwise the swizzled column can leave [0, length[1])
+        using Length1 = remove_cvref_t<tuple_element_t<1, LowLengths>>;
+
+        if constexpr(is_known_at_compile_time<Length1>::value)
+        {
+            static_assert(Length1::value > 0 && (Length1::value & (Length1::value - 1)) == 0,
+                          "wrong! length[1] of Xor is not a power of 2");
+        }
+        else
+        {
+            assert(low_lengths[Number<1>{}] > 0 &&
+                   (low_lengths[Number<1>{}] & (low_lengths[Number<1>{}] - 1)) == 0);
+        }
+    }
+
+    __host__ __device__ static constexpr index_t GetNumOfLowerDimension() { return 2; }
+
+    __host__ __device__ static constexpr index_t GetNumOfUpperDimension() { return 2; }
+
+    __host__ __device__ constexpr const auto& GetUpperLengths() const { return up_lengths_; }
+
+    template <typename LowIdx, typename UpIdx>
+    __host__ __device__ constexpr void CalculateLowerIndex(LowIdx& idx_low,
+                                                           const UpIdx& idx_up) const
+    {
+        static_assert(LowIdx::Size() == 2 && UpIdx::Size() == 2,
+                      "wrong! inconsistent # of dimension");
+
+        constexpr auto I0 = Number<0>{};
+        constexpr auto I1 = Number<1>{};
+
+        idx_low(I0) = idx_up[I0];
+        idx_low(I1) = idx_up[I1] ^ ((idx_up[I0] * multiplier_) % up_lengths_[I1]);
+    }
+
+    template <typename LowIdxDiff,
+              typename UpIdxDiff,
+              typename LowIdx,
+              typename UpIdx,
+              index_t Hack>
+    __host__ __device__ void UpdateLowerIndex(LowIdxDiff& idx_diff_low,
+                                              const UpIdxDiff&,
+                                              LowIdx& idx_low,
+                                              const UpIdx& idx_up_new,
+                                              Number<Hack>) const
+    {
+        static_assert(LowIdxDiff::Size() == 2 && UpIdxDiff::Size() == 2 && LowIdx::Size() == 2 &&
+                          UpIdx::Size() == 2,
+                      "wrong! inconsistent # of dimension");
+
+        constexpr auto I0 = Number<0>{};
+        constexpr auto I1 = Number<1>{};
+
+        const auto idx_low_old = idx_low;
+
+        CalculateLowerIndex(idx_low, idx_up_new);
+
+        idx_diff_low(I0) = idx_low[I0] - idx_low_old[I0];
+        idx_diff_low(I1) = idx_low[I1] - idx_low_old[I1];
+    }
+
+    __host__ __device__ static constexpr bool IsLinearTransform() { return false; }
+
+    __host__ __device__ static constexpr bool IsValidUpperIndexAlwaysMappedToValidLowerIndex()
+    {
+        return true;
+    }
+
+    template <typename UpIdx>
+    __host__ __device__ static constexpr bool
+    IsValidUpperIndexMappedToValidLowerIndex(const UpIdx& /* idx_up */)
+    {
+        return true;
+    }
+
+    __host__ __device__ static constexpr bool IsKnownAtCompileTime()
+    {
+        return is_known_at_compile_time<UpLengths>::value &&
+               is_known_at_compile_time<Multiplier>::value;
+    }
+
+    __host__ __device__ void Print() const
+    {
+        printf("{");
+        printf("Xor, ");
+        printf("up_lengths_");
+        print_multi_index(up_lengths_);
+        printf("}");
+    }
+};
 } // namespace ck
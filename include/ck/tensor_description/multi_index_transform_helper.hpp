@@ -127,4 +127,11 @@ __host__ __device__ constexpr auto make_modulo_transform(const Modulus& modulus,
 {
     return Modulo<Modulus, UpLength>{modulus, up_length};
 }
+
+template <typename LowLengths, typename Multiplier = Number<1>>
+__host__ __device__ constexpr auto make_xor_transform(const LowLengths& low_lengths,
+                                                      const Multiplier& multiplier = Multiplier{})
+{
+    return Xor<LowLengths, Multiplier>{low_lengths, multiplier};
+}
 } // namespace ck
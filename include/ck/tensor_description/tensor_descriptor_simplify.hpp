@@ -0,0 +1,807 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/utility/common_header.hpp"
+#include "ck/utility/is_static_value.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+
+namespace ck {
+
+/*
+ * simplify_tensor_descriptor() returns a descriptor with a shorter transform chain that gives the
+ * same offset, coordinate movement and offset validity for every valid visible index. These
+ * rewrites are applied until none of them matches:
+ *   1) identity transforms are removed: PassThrough, Merge/UnMerge of a single dimension, Embed of
+ *      a single dimension with coefficient 1, Slice of the whole length, and zero padding whose
+ *      validity check is skipped or implied by the validity of the visible index
+ *   2) an UnMerge of the output of a Merge with the same lengths cancels it
+ *   3) an Embed/UnMerge producing an upper dimension of another Embed/UnMerge is folded into it,
+ *      the coefficients are multiplied
+ *   4) a Merge of upper dimensions of an Embed/UnMerge that are contiguous with respect to each
+ *      other (coefficient[i] == coefficient[i + 1] * length[i + 1]) becomes a single upper
+ *      dimension of it, so the division of the Merge is replaced by a multiplication
+ * Rewrites 2) to 4) remove the hidden dimensions between the two transforms, so they only apply
+ * if the second transform is the only one reading them and none of them is visible.
+ * The rewrites are decided from the types only: the structure of the chain and the values of
+ * Number<> lengths, pads and coefficients. Runtime values are never compared, besides assuming,
+ * like everywhere else, that a transform is created with the lengths of its lower dimensions.
+ * The hidden dimensions are renumbered, so the number of transforms and the ids differ from the
+ * original descriptor and UpdateLowerIndexHack sequences made for it do not apply.
+ */
+
+namespace detail {
+
+template <index_t... Is>
+__host__ __device__ constexpr index_t find_in_sequence(Sequence<Is...>, index_t x)
+{
+    constexpr index_t ids[] = {Is..., -1};
+
+    for(index_t i = 0; i < index_t(sizeof...(Is)); ++i)
+    {
+        if(ids[i] == x)
+            return i;
+    }
+
+    return -1;
+}
+
+template <index_t... Is>
+__host__ __device__ constexpr index_t count_in_sequence(Sequence<Is...>, index_t x)
+{
+    return ((Is == x ? 1 : 0) + ... + 0);
+}
+
+// identity transforms
+template <typename Tran>
+__host__ __device__ constexpr bool is_identity_transform(const Tran*, bool)
+{
+    return false;
+}
+
+template <typename LowLength>
+__host__ __device__ constexpr bool is_identity_transform(const PassThrough<LowLength>*, bool)
+{
+    return true;
+}
+
+template <typename LowLength, typename LeftPadLength, typename RightPadLength, bool SkipCheck>
+__host__ __device__ constexpr bool
+is_identity_transform(const Pad<LowLength, LeftPadLength, RightPadLength, SkipCheck>*,
+                      bool is_upper_visible)
+{
+    return (SkipCheck || is_upper_visible) && is_static_value<LeftPadLength, 0>::value &&
+           is_static_value<RightPadLength, 0>::value;
+}
+
+template <typename LowLength, typename LeftPadLength, bool SkipCheck>
+__host__ __device__ constexpr bool
+is_identity_transform(const LeftPad<LowLength, LeftPadLength, SkipCheck>*, bool is_upper_visible)
+{
+    return (SkipCheck || is_upper_visible) && is_static_value<LeftPadLength, 0>::value;
+}
+
+template <typename LowLength, typename RightPadLength, bool SkipCheck>
+__host__ __device__ constexpr bool
+is_identity_transform(const RightPad<LowLength, RightPadLength, SkipCheck>*, bool is_upper_visible)
+{
+    return (SkipCheck || is_upper_visible) && is_static_value<RightPadLength, 0>::value;
+}
+
+template <typename LowLength, typename SliceBegin, typename SliceEnd>
+__host__ __device__ constexpr bool
+is_identity_transform(const Slice<LowLength, SliceBegin, SliceEnd>*, bool)
+{
+    return is_static_value<SliceBegin, 0>::value && is_static_equal<SliceEnd, LowLength>::value;
+}
+
+template <typename UpLengths, typename Coefficients>
+__host__ __device__ constexpr bool is_identity_transform(const Embed<UpLengths, Coefficients>*,
+                                                         bool)
+{
+    using Coefficient = remove_cvref_t<decltype(Coefficients{}[Number<0>{}])>;
+
+    return UpLengths::Size() == 1 && is_static_value<Coefficient, 1>::value;
+}
+
+template <typename UpLengths, bool Use24BitIntegerCalculation>
+__host__ __device__ constexpr bool
+is_identity_transform(const UnMerge<UpLengths, Use24BitIntegerCalculation>*, bool)
+{
+    return UpLengths::Size() == 1;
+}
+
+template <typename LowLengths>
+__host__ __device__ constexpr bool is_identity_transform(const Merge_v1_carry_check<LowLengths>*,
+                                                         bool)
+{
+    return LowLengths::Size() == 1;
+}
+
+template <typename LowLengths>
+__host__ __device__ constexpr bool
+is_identity_transform(const Merge_v2_magic_division<LowLengths>*, bool)
+{
+    return LowLengths::Size() == 1;
+}
+
+template <typename LowLengths>
+__host__ __device__ constexpr bool
+is_identity_transform(const Merge_v2r2_magic_division<LowLengths>*, bool)
+{
+    return LowLengths::Size() == 1;
+}
+
+template <typename LowLengths>
+__host__ __device__ constexpr bool is_identity_transform(const Merge_v3_division_mod<LowLengths>*,
+                                                         bool)
+{
+    return LowLengths::Size() == 1;
+}
+
+// Merge transforms, low lengths type
+template <typename Tran>
+__host__ __device__ constexpr bool is_merge_transform(const Tran*)
+{
+    return false;
+}
+
+template <typename LowLengths>
+__host__ __device__ constexpr bool is_merge_transform(const Merge_v1_carry_check<LowLengths>*)
+{
+    return true;
+}
+
+template <typename LowLengths>
+__host__ __device__ constexpr bool is_merge_transform(const Merge_v2_magic_division<LowLengths>*)
+{
+    return true;
+}
+
+template <typename LowLengths>
+__host__ __device__ constexpr bool
+is_merge_transform(const Merge_v2r2_magic_division<LowLengths>*)
+{
+    return true;
+}
+
+template <typename LowLengths>
+__host__ __device__ constexpr bool is_merge_transform(const Merge_v3_division_mod<LowLengths>*)
+{
+    return true;
+}
+
+template <typename Tran>
+using merge_low_lengths_t = remove_cvref_t<decltype(Tran{}.low_lengths_)>;
+
+// Embed and UnMerge, which compute the lower index as a linear combination of the upper index
+template <typename Tran>
+__host__ __device__ constexpr bool is_embed_like_transform(const Tran*)
+{
+    return false;
+}
+
+template <typename UpLengths, typename Coefficients>
+__host__ __device__ constexpr bool is_embed_like_transform(const Embed<UpLengths, Coefficients>*)
+{
+    return true;
+}
+
+template <typename UpLengths>
+__host__ __device__ constexpr bool is_embed_like_transform(const UnMerge<UpLengths, false>*)
+{
+    return true;
+}
+
+template <typename Tran>
+__host__ __device__ constexpr bool is_unmerge_transform(const Tran*)
+{
+    return false;
+}
+
+template <typename UpLengths, bool Use24BitIntegerCalculation>
+__host__ __device__ constexpr bool
+is_unmerge_transform(const UnMerge<UpLengths, Use24BitIntegerCalculation>*)
+{
+    return true;
+}
+
+template <typename UpLengths, typename Coefficients>
+__host__ __device__ constexpr const auto&
+get_embed_coefficients(const Embed<UpLengths, Coefficients>& tran)
+{
+    return tran.coefficients_;
+}
+
+template <typename UpLengths>
+__host__ __device__ constexpr const auto&
+get_embed_coefficients(const UnMerge<UpLengths, false>& tran)
+{
+    return tran.up_lengths_scan_;
+}
+
+template <typename Tran>
+using embed_coefficients_t = remove_cvref_t<decltype(get_embed_coefficients(Tran{}))>;
+
+template <typename Desc, index_t ITran>
+using transform_t = remove_cvref_t<decltype(Desc{}.GetTransforms()[Number<ITran>{}])>;
+
+template <typename Desc, index_t ITran>
+__host__ __device__ constexpr auto get_lower_dimension_ids(Number<ITran>)
+{
+    return Desc::GetLowerDimensionIdss()[Number<ITran>{}];
+}
+
+template <typename Desc, index_t ITran>
+__host__ __device__ constexpr auto get_upper_dimension_ids(Number<ITran>)
+{
+    return Desc::GetUpperDimensionIdss()[Number<ITran>{}];
+}
+
+// index of the transform having hidden dimension x as upper dimension, -1 if x is visible
+template <typename Desc>
+__host__ __device__ constexpr index_t find_transform_by_upper_dimension(index_t x)
+{
+    index_t found = -1;
+
+    static_for<0, Desc::GetNumOfTransform(), 1>{}([&](auto itran) {
+        if(find_in_sequence(get_upper_dimension_ids<Desc>(itran), x) >= 0)
+            found = itran;
+    });
+
+    return found;
+}
+
+// index of the transform having x as its only lower dimension, -1 if there is none
+template <typename Desc>
+__host__ __device__ constexpr index_t find_transform_by_lower_dimension(index_t x)
+{
+    index_t found = -1;
+
+    static_for<0, Desc::GetNumOfTransform(), 1>{}([&](auto itran) {
+        constexpr auto low_ids = get_lower_dimension_ids<Desc>(itran);
+
+        if constexpr(low_ids.Size() == 1)
+        {
+            if(low_ids[Number<0>{}] == x)
+                found = itran;
+        }
+    });
+
+    return found;
+}
+
+// whether hidden dimension x is an upper dimension of a single transform and is not visible
+template <typename Desc>
+__host__ __device__ constexpr bool is_read_once(index_t x)
+{
+    index_t num_reads = count_in_sequence(Desc::GetVisibleDimensionIds(), x);
+
+    static_for<0, Desc::GetNumOfTransform(), 1>{}([&](auto itran) {
+        num_reads += count_in_sequence(get_upper_dimension_ids<Desc>(itran), x);
+    });
+
+    return num_reads == 1;
+}
+
+// maps a dimension id to its rank among the used ones, to keep the hidden ids dense
+template <typename UsedIds>
+struct lambda_get_compact_dim_id;
+
+template <index_t... Us>
+struct lambda_get_compact_dim_id<Sequence<Us...>>
+{
+    __host__ __device__ constexpr index_t operator()(index_t x) const
+    {
+        return ((Us < x ? 1 : 0) + ... + 0);
+    }
+};
+
+template <typename OldIds, typename NewIds>
+struct lambda_rename_dim_id;
+
+template <index_t... Os, index_t... Ns>
+struct lambda_rename_dim_id<Sequence<Os...>, Sequence<Ns...>>
+{
+    __host__ __device__ constexpr index_t operator()(index_t x) const
+    {
+        index_t y = x;
+
+        ((y = x == Os ? Ns : y), ...);
+
+        return y;
+    }
+};
+
+// New descriptor made of the transforms KeptTransformIds of desc, in this order. Transform
+// IReplace (if any) is replaced by new_transform with upper dimensions NewUpperIds, and the
+// hidden dimensions OldIds are renamed to NewIds before the ids are made dense again.
+template <typename KeptTransformIds,
+          index_t IReplace,
+          typename OldIds,
+          typename NewIds,
+          typename Desc,
+          typename NewTransform,
+          typename NewUpperIds>
+__host__ __device__ constexpr auto
+rebuild_tensor_descriptor(const Desc& desc, const NewTransform& new_transform, NewUpperIds)
+{
+    constexpr auto rename = lambda_rename_dim_id<OldIds, NewIds>{};
+
+    const auto transforms = generate_tuple(
+        [&](auto i) {
+            constexpr index_t itran = KeptTransformIds::At(i);
+
+            if constexpr(itran == IReplace)
+                return new_transform;
+            else
+                return desc.GetTransforms()[Number<itran>{}];
+        },
+        KeptTransformIds::Size());
+
+    constexpr auto low_idss = generate_tuple(
+        [&](auto i) {
+            constexpr index_t itran = KeptTransformIds::At(i);
+
+            return transform_sequences(rename, get_lower_dimension_ids<Desc>(Number<itran>{}));
+        },
+        KeptTransformIds::Size());
+
+    constexpr auto up_idss = generate_tuple(
+        [&](auto i) {
+            constexpr index_t itran = KeptTransformIds::At(i);
+
+            if constexpr(itran == IReplace)
+                return NewUpperIds{};
+            else
+                return transform_sequences(rename, get_upper_dimension_ids<Desc>(Number<itran>{}));
+        },
+        KeptTransformIds::Size());
+
+    constexpr auto visible_ids = transform_sequences(rename, Desc::GetVisibleDimensionIds());
+
+    // make the hidden ids dense
+    constexpr auto all_ids =
+        merge_sequences(unpack([](auto... xs) { return merge_sequences(xs...); }, low_idss),
+                        unpack([](auto... xs) { return merge_sequences(xs...); }, up_idss),
+                        visible_ids);
+
+    using UsedIds = typename sequence_unique_sort<remove_cv_t<decltype(all_ids)>,
+                                                  math::less<index_t>,
+                                                  math::equal<index_t>>::type;
+
+    constexpr auto compact = lambda_get_compact_dim_id<UsedIds>{};
+
+    constexpr auto compact_low_idss =
+        transform_tuples([&](auto ids) { return transform_sequences(compact, ids); }, low_idss);
+
+    constexpr auto compact_up_idss =
+        transform_tuples([&](auto ids) { return transform_sequences(compact, ids); }, up_idss);
+
+    constexpr auto compact_visible_ids = transform_sequences(compact, visible_ids);
+
+    const auto element_space_size = desc.GetElementSpaceSize();
+
+    return TensorDescriptor<remove_cv_t<decltype(transforms)>,
+                            remove_cv_t<decltype(compact_low_idss)>,
+                            remove_cv_t<decltype(compact_up_idss)>,
+                            remove_cv_t<decltype(compact_visible_ids)>,
+                            remove_cv_t<decltype(element_space_size)>>{transforms,
+                                                                       element_space_size};
+}
+
+// all transforms but ITran0 and ITran1 (ITran0 < ITran1, ITran1 may be -1)
+template <index_t NTransform, index_t ITran0, index_t ITran1>
+__host__ __device__ constexpr auto get_kept_transform_ids()
+{
+    if constexpr(ITran1 < 0)
+    {
+        return merge_sequences(typename arithmetic_sequence_gen<0, ITran0, 1>::type{},
+                               typename arithmetic_sequence_gen<ITran0 + 1, NTransform, 1>::type{});
+    }
+    else
+    {
+        return merge_sequences(typename arithmetic_sequence_gen<0, ITran0, 1>::type{},
+                               typename arithmetic_sequence_gen<ITran0 + 1, ITran1, 1>::type{},
+                               typename arithmetic_sequence_gen<ITran1 + 1, NTransform, 1>::type{});
+    }
+}
+
+// 1) identity transform, returns its index or -1
+template <typename Desc>
+__host__ __device__ constexpr index_t find_identity_transform()
+{
+    index_t found = -1;
+
+    static_for<0, Desc::GetNumOfTransform(), 1>{}([&](auto itran) {
+        constexpr auto low_ids = get_lower_dimension_ids<Desc>(itran);
+        constexpr auto up_ids  = get_upper_dimension_ids<Desc>(itran);
+
+        if constexpr(low_ids.Size() == 1 && up_ids.Size() == 1)
+        {
+            // the offset dimension cannot be an upper dimension
+            constexpr bool is_low_offset = low_ids[Number<0>{}] == 0;
+            constexpr bool is_up_visible =
+                find_in_sequence(Desc::GetVisibleDimensionIds(), up_ids[Number<0>{}]) >= 0;
+
+            using Tran = transform_t<Desc, itran>;
+
+            if(found < 0 && !is_low_offset &&
+               is_identity_transform(static_cast<const Tran*>(nullptr), is_up_visible))
+                found = itran;
+        }
+    });
+
+    return found;
+}
+
+template <index_t ITran, typename Desc>
+__host__ __device__ constexpr auto remove_identity_transform(const Desc& desc)
+{
+    constexpr auto low_ids = get_lower_dimension_ids<Desc>(Number<ITran>{});
+    constexpr auto up_ids  = get_upper_dimension_ids<Desc>(Number<ITran>{});
+
+    using KeptTransformIds =
+        decltype(get_kept_transform_ids<Desc::GetNumOfTransform(), ITran, -1>());
+
+    return rebuild_tensor_descriptor<KeptTransformIds,
+                                     -1,
+                                     remove_cv_t<decltype(up_ids)>,
+                                     remove_cv_t<decltype(low_ids)>>(desc, Tuple<>{}, Sequence<>{});
+}
+
+// 2) UnMerge of a Merge output, returns (merge, unmerge) or (-1, -1)
+template <typename Desc>
+__host__ __device__ constexpr auto find_merge_unmerge_pair()
+{
+    index_t found_merge   = -1;
+    index_t found_unmerge = -1;
+
+    static_for<0, Desc::GetNumOfTransform(), 1>{}([&](auto iunmerge) {
+        using UnMergeTran = transform_t<Desc, iunmerge>;
+
+        if constexpr(is_unmerge_transform(static_cast<const UnMergeTran*>(nullptr)))
+        {
+            constexpr index_t merge_up_id = get_lower_dimension_ids<Desc>(iunmerge)[Number<0>{}];
+            constexpr index_t imerge      = find_transform_by_upper_dimension<Desc>(merge_up_id);
+
+            if constexpr(imerge >= 0 && is_read_once<Desc>(merge_up_id))
+            {
+                using MergeTran = transform_t<Desc, imerge>;
+
+                if constexpr(is_merge_transform(static_cast<const MergeTran*>(nullptr)))
+                {
+                    using LowLengths = merge_low_lengths_t<MergeTran>;
+                    using UpLengths  = remove_cvref_t<decltype(UnMergeTran{}.GetUpperLengths())>;
+
+                    constexpr auto merge_low_ids = get_lower_dimension_ids<Desc>(Number<imerge>{});
+
+                    bool is_same_lengths = LowLengths::Size() == UpLengths::Size();
+
+                    if constexpr(LowLengths::Size() == UpLengths::Size())
+                    {
+                        static_for<0, LowLengths::Size(), 1>{}([&](auto i) {
+                            is_same_lengths &=
+                                is_static_equal<remove_cvref_t<decltype(LowLengths{}[i])>,
+                                                remove_cvref_t<decltype(UpLengths{}[i])>>::value;
+                        });
+                    }
+
+                    if(found_merge < 0 && is_same_lengths &&
+                       find_in_sequence(merge_low_ids, 0) < 0)
+                    {
+                        found_merge   = imerge;
+                        found_unmerge = iunmerge;
+                    }
+                }
+            }
+        }
+    });
+
+    return make_tuple(found_merge, found_unmerge);
+}
+
+template <index_t IMerge, index_t IUnMerge, typename Desc>
+__host__ __device__ constexpr auto remove_merge_unmerge_pair(const Desc& desc)
+{
+    constexpr auto merge_low_ids  = get_lower_dimension_ids<Desc>(Number<IMerge>{});
+    constexpr auto unmerge_up_ids = get_upper_dimension_ids<Desc>(Number<IUnMerge>{});
+
+    using KeptTransformIds =
+        decltype(get_kept_transform_ids<Desc::GetNumOfTransform(), IMerge, IUnMerge>());
+
+    return rebuild_tensor_descriptor<KeptTransformIds,
+                                     -1,
+                                     remove_cv_t<decltype(unmerge_up_ids)>,
+                                     remove_cv_t<decltype(merge_low_ids)>>(
+        desc, Tuple<>{}, Sequence<>{});
+}
+
+// 3) Embed/UnMerge whose upper dimension is produced by another Embed/UnMerge, returns
+// (outer, inner, position of the dimension among the upper dimensions of outer) or -1s
+template <typename Desc>
+__host__ __device__ constexpr auto find_embed_embed_pair()
+{
+    index_t found_outer    = -1;
+    index_t found_inner    = -1;
+    index_t found_position = -1;
+
+    static_for<0, Desc::GetNumOfTransform(), 1>{}([&](auto iouter) {
+        using OuterTran = transform_t<Desc, iouter>;
+
+        if constexpr(is_embed_like_transform(static_cast<const OuterTran*>(nullptr)))
+        {
+            constexpr auto up_ids = get_upper_dimension_ids<Desc>(iouter);
+
+            static_for<0, up_ids.Size(), 1>{}([&](auto j) {
+                constexpr index_t iinner =
+                    find_transform_by_lower_dimension<Desc>(up_ids[Number<j>{}]);
+
+                if constexpr(iinner >= 0)
+                {
+                    using InnerTran = transform_t<Desc, iinner>;
+
+                    if(found_outer < 0 &&
+                       is_embed_like_transform(static_cast<const InnerTran*>(nullptr)) &&
+                       is_read_once<Desc>(up_ids[Number<j>{}]))
+                    {
+                        found_outer    = iouter;
+                        found_inner    = iinner;
+                        found_position = j;
+                    }
+                }
+            });
+        }
+    });
+
+    return make_tuple(found_outer, found_inner, found_position);
+}
+
+template <index_t IOuter, index_t IInner, index_t Position, typename Desc>
+__host__ __device__ constexpr auto fuse_embed_embed_pair(const Desc& desc)
+{
+    const auto& outer = desc.GetTransforms()[Number<IOuter>{}];
+    const auto& inner = desc.GetTransforms()[Number<IInner>{}];
+
+    const auto& outer_lengths      = outer.GetUpperLengths();
+    const auto& inner_lengths      = inner.GetUpperLengths();
+    const auto& outer_coefficients = get_embed_coefficients(outer);
+    const auto& inner_coefficients = get_embed_coefficients(inner);
+
+    constexpr auto outer_up_ids = get_upper_dimension_ids<Desc>(Number<IOuter>{});
+    constexpr auto inner_up_ids = get_upper_dimension_ids<Desc>(Number<IInner>{});
+
+    constexpr index_t NOuter = outer_up_ids.Size();
+    constexpr index_t NInner = inner_up_ids.Size();
+
+    // the upper dimension Position of outer is replaced by the upper dimensions of inner
+    auto f_fuse = [&](auto i, auto f_outer, auto f_inner) {
+        if constexpr(i.value < Position)
+            return f_outer(i);
+        else if constexpr(i.value < Position + NInner)
+            return f_inner(Number<i.value - Position>{});
+        else
+            return f_outer(Number<i.value - NInner + 1>{});
+    };
+
+    const auto lengths = generate_tuple(
+        [&](auto i) {
+            return f_fuse(
+                i,
+                [&](auto j) { return outer_lengths[j]; },
+                [&](auto j) { return inner_lengths[j]; });
+        },
+        Number<NOuter + NInner - 1>{});
+
+    const auto coefficients = generate_tuple(
+        [&](auto i) {
+            return f_fuse(
+                i,
+                [&](auto j) { return outer_coefficients[j]; },
+                [&](auto j) {
+                    return outer_coefficients[Number<Position>{}] * inner_coefficients[j];
+                });
+        },
+        Number<NOuter + NInner - 1>{});
+
+    constexpr auto up_ids = generate_sequence_v2(
+        [&](auto i) {
+            return f_fuse(
+                i,
+                [&](auto j) { return Number<outer_up_ids[j]>{}; },
+                [&](auto j) { return Number<inner_up_ids[j]>{}; });
+        },
+        Number<NOuter + NInner - 1>{});
+
+    using KeptTransformIds =
+        decltype(get_kept_transform_ids<Desc::GetNumOfTransform(), IInner, -1>());
+
+    return rebuild_tensor_descriptor<KeptTransformIds, IOuter, Sequence<>, Sequence<>>(
+        desc, make_embed_transform(lengths, coefficients), up_ids);
+}
+
+// 4) Merge of contiguous upper dimensions of an Embed/UnMerge, returns (embed, merge) or -1s
+template <typename Desc>
+__host__ __device__ constexpr auto find_embed_merge_pair()
+{
+    index_t found_embed = -1;
+    index_t found_merge = -1;
+
+    static_for<0, Desc::GetNumOfTransform(), 1>{}([&](auto imerge) {
+        using MergeTran = transform_t<Desc, imerge>;
+
+        if constexpr(is_merge_transform(static_cast<const MergeTran*>(nullptr)))
+        {
+            constexpr auto merge_low_ids = get_lower_dimension_ids<Desc>(imerge);
+
+            constexpr index_t iembed =
+                find_transform_by_upper_dimension<Desc>(merge_low_ids[Number<0>{}]);
+
+            if constexpr(iembed >= 0)
+            {
+                using EmbedTran = transform_t<Desc, iembed>;
+
+                if constexpr(is_embed_like_transform(static_cast<const EmbedTran*>(nullptr)))
+                {
+                    using LowLengths   = merge_low_lengths_t<MergeTran>;
+                    using Coefficients = embed_coefficients_t<EmbedTran>;
+
+                    constexpr auto embed_up_ids = get_upper_dimension_ids<Desc>(Number<iembed>{});
+
+                    bool is_foldable = true;
+
+                    static_for<0, merge_low_ids.Size(), 1>{}([&](auto i) {
+                        is_foldable &= is_read_once<Desc>(merge_low_ids[Number<i>{}]);
+                    });
+
+                    static_for<0, merge_low_ids.Size() - 1, 1>{}([&](auto i) {
+                        constexpr index_t p0 =
+                            find_in_sequence(embed_up_ids, merge_low_ids[Number<i>{}]);
+                        constexpr index_t p1 =
+                            find_in_sequence(embed_up_ids, merge_low_ids[Number<i + 1>{}]);
+
+                        if constexpr(p0 < 0 || p1 < 0)
+                        {
+                            is_foldable = false;
+                        }
+                        else
+                        {
+                            // consecutive dimensions of an UnMerge are contiguous
+                            constexpr bool is_unmerge_neighbour =
+                                is_unmerge_transform(static_cast<const EmbedTran*>(nullptr)) &&
+                                p1 == p0 + 1;
+
+                            using C0 = remove_cvref_t<decltype(Coefficients{}[Number<p0>{}])>;
+                            using C1 = remove_cvref_t<decltype(Coefficients{}[Number<p1>{}])>;
+                            using L1 = remove_cvref_t<decltype(LowLengths{}[Number<i + 1>{}])>;
+
+                            is_foldable &=
+                                is_unmerge_neighbour || is_static_product<C0, C1, L1>::value;
+                        }
+                    });
+
+                    if(found_embed < 0 && is_foldable)
+                    {
+                        found_embed = iembed;
+                        found_merge = imerge;
+                    }
+                }
+            }
+        }
+    });
+
+    return make_tuple(found_embed, found_merge);
+}
+
+template <index_t IEmbed, index_t IMerge, typename Desc>
+__host__ __device__ constexpr auto fold_embed_merge_pair(const Desc& desc)
+{
+    const auto& embed = desc.GetTransforms()[Number<IEmbed>{}];
+    const auto& merge = desc.GetTransforms()[Number<IMerge>{}];
+
+    const auto& embed_lengths      = embed.GetUpperLengths();
+    const auto& embed_coefficients = get_embed_coefficients(embed);
+
+    constexpr auto embed_up_ids  = get_upper_dimension_ids<Desc>(Number<IEmbed>{});
+    constexpr auto merge_low_ids = get_lower_dimension_ids<Desc>(Number<IMerge>{});
+    constexpr auto merge_up_ids  = get_upper_dimension_ids<Desc>(Number<IMerge>{});
+
+    // the first merged dimension becomes the merged one, the other merged dimensions are removed
+    constexpr index_t p_first = find_in_sequence(embed_up_ids, merge_low_ids[Number<0>{}]);
+    constexpr index_t p_last =
+        find_in_sequence(embed_up_ids, merge_low_ids[Number<merge_low_ids.Size() - 1>{}]);
+
+    constexpr auto kept_mask = generate_sequence_v2(
+        [&](auto i) {
+            constexpr index_t p = find_in_sequence(merge_low_ids, embed_up_ids[i]);
+
+            return Number<(p <= 0 ? 1 : 0)>{};
+        },
+        Number<embed_up_ids.Size()>{});
+
+    constexpr auto kept_positions = pick_sequence_elements_by_mask(
+        typename arithmetic_sequence_gen<0, embed_up_ids.Size(), 1>::type{}, kept_mask);
+
+    const auto lengths = generate_tuple(
+        [&](auto i) {
+            constexpr index_t p = kept_positions[i];
+
+            if constexpr(p == p_first)
+                return merge.GetUpperLengths()[Number<0>{}];
+            else
+                return embed_lengths[Number<p>{}];
+        },
+        kept_positions.Size());
+
+    const auto coefficients = generate_tuple(
+        [&](auto i) {
+            constexpr index_t p = kept_positions[i];
+
+            if constexpr(p == p_first)
+                return embed_coefficients[Number<p_last>{}];
+            else
+                return embed_coefficients[Number<p>{}];
+        },
+        kept_positions.Size());
+
+    constexpr auto up_ids = generate_sequence_v2(
+        [&](auto i) {
+            constexpr index_t p = kept_positions[i];
+
+            if constexpr(p == p_first)
+                return Number<merge_up_ids[Number<0>{}]>{};
+            else
+                return Number<embed_up_ids[Number<p>{}]>{};
+        },
+        kept_positions.Size());
+
+    using KeptTransformIds =
+        decltype(get_kept_transform_ids<Desc::GetNumOfTransform(), IMerge, -1>());
+
+    return rebuild_tensor_descriptor<KeptTransformIds, IEmbed, Sequence<>, Sequence<>>(
+        desc, make_embed_transform(lengths, coefficients), up_ids);
+}
+
+} // namespace detail
+
+template <typename Desc>
+__host__ __device__ constexpr auto simplify_tensor_descriptor(const Desc& desc)
+{
+    constexpr index_t identity = detail::find_identity_transform<Desc>();
+
+    constexpr auto merge_unmerge = detail::find_merge_unmerge_pair<Desc>();
+    constexpr auto embed_embed   = detail::find_embed_embed_pair<Desc>();
+    constexpr auto embed_merge   = detail::find_embed_merge_pair<Desc>();
+
+    if constexpr(identity >= 0)
+    {
+        return simplify_tensor_descriptor(detail::remove_identity_transform<identity>(desc));
+    }
+    else if constexpr(merge_unmerge[Number<0>{}] >= 0)
+    {
+        return simplify_tensor_descriptor(
+            detail::remove_merge_unmerge_pair<merge_unmerge[Number<0>{}],
+                                              merge_unmerge[Number<1>{}]>(desc));
+    }
+    else if constexpr(embed_embed[Number<0>{}] >= 0)
+    {
+        return simplify_tensor_descriptor(
+            detail::fuse_embed_embed_pair<embed_embed[Number<0>{}],
+                                          embed_embed[Number<1>{}],
+                                          embed_embed[Number<2>{}]>(desc));
+    }
+    else if constexpr(embed_merge[Number<0>{}] >= 0)
+    {
+        return simplify_tensor_descriptor(
+            detail::fold_embed_merge_pair<embed_merge[Number<0>{}], embed_merge[Number<1>{}]>(
+                desc));
+    }
+    else
+    {
+        return desc;
+    }
+}
+
+} // namespace ck
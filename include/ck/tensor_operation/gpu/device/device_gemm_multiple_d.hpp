@@ -50,6 +50,19 @@ struct DeviceGemmMultipleD : public BaseOperator
                         BElementwiseOperation b_element_op,
                         CDEElementwiseOperation cde_element_op) = 0;
 
+    // Rebind the data pointers of an argument made by MakeArgumentPointer() of this instance,
+    // keeping its descriptors, so a problem of the same shape can be run on other buffers without
+    // rebuilding the argument. The workspace is rebound by SetWorkSpacePointer(). Returns false if
+    // the instance does not support it, a new argument has to be made then.
+    virtual bool SetDataPointers([[maybe_unused]] BaseArgument* p_arg,
+                                 [[maybe_unused]] const void* p_a,
+                                 [[maybe_unused]] const void* p_b,
+                                 [[maybe_unused]] std::array<const void*, NumDTensor> p_ds,
+                                 [[maybe_unused]] void* p_e) const
+    {
+        return false;
+    }
+
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
 };
 
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "device_base.hpp"
+#include "split_k_selector.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -24,6 +25,7 @@ template <typename ALayout,
           typename ComputeType = CDataType>
 struct DeviceGemmSplitK : public BaseOperator
 {
+    // KBatch can be KBatchAuto
     virtual std::unique_ptr<BaseArgument> MakeArgumentPointer(const void* p_a,
                                                               const void* p_b,
                                                               void* p_c,
@@ -39,6 +41,9 @@ struct DeviceGemmSplitK : public BaseOperator
                                                               ck::index_t KBatch) = 0;
 
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+
+    // the split the argument runs with, KBatchAuto resolved
+    virtual ck::index_t GetKBatch(const BaseArgument* p_arg) const = 0;
 };
 
 template <typename ALayout,
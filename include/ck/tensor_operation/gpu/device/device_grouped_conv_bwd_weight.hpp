@@ -6,6 +6,7 @@
 #include <array>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/split_k_selector.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -25,6 +26,7 @@ template <ck::index_t NDimSpatial,
           typename ComputeTypeB = ComputeTypeA>
 struct DeviceGroupedConvBwdWeight : public BaseOperator
 {
+    // split_k can be KBatchAuto
     virtual std::unique_ptr<BaseArgument>
     MakeArgumentPointer(const void* p_in,
                         void* p_wei,
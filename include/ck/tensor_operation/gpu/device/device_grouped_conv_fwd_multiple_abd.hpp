@@ -124,6 +124,33 @@ struct DeviceGroupedConvFwdMultipleABD : public BaseOperator
         const BElementwiseOperation& b_element_op,
         const CDEElementwiseOperation& cde_element_op) = 0;
 
+    /**
+     * \brief Rebind the data pointers of an argument made by MakeArgumentPointer().
+     *
+     * \details
+     * The descriptors, block-to-tile map and batch strides of the argument are kept, so a
+     * problem of the same shape can be run on other buffers without rebuilding the argument.
+     * The workspace is rebound by SetWorkSpacePointer().
+     *
+     * \param p_arg Argument made by MakeArgumentPointer() of this instance.
+     * \param p_a A pointer to the input (std::array<const void*, NumA> with
+                  pointers for multiple A).
+     * \param p_b A pointer to the weight (std::array<const void*, NumA> with
+                  pointers for multiple B).
+     * \param p_ds A pointers to the Ds.
+     * \param p_e A pointers to the output.
+     * \return False if the instance does not support rebinding, a new argument has to be made
+     *         then.
+     */
+    virtual bool SetDataPointers([[maybe_unused]] BaseArgument* p_arg,
+                                 [[maybe_unused]] APointers p_a,
+                                 [[maybe_unused]] BPointers p_b,
+                                 [[maybe_unused]] const std::array<const void*, NumDTensor>& p_ds,
+                                 [[maybe_unused]] void* p_e) const
+    {
+        return false;
+    }
+
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
 };
 
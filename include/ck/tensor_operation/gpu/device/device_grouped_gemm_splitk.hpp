@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "device_grouped_gemm.hpp"
+#include "split_k_selector.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -31,6 +32,7 @@ struct DeviceGroupedGemmSplitK : public DeviceGroupedGemm<ALayout,
                                                           BElementwiseOperation,
                                                           CElementwiseOperation>
 {
+    // kbatch can be KBatchAuto
     virtual void SetKBatchSize(BaseArgument* p_arg, index_t kbatch) const = 0;
 };
 
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <limits>
+#include <utility>
+
+#include "ck/ck.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Host-side canonicalization of num_dim dimensions shared by NumTensor tensors of the same
+// lengths, e.g. the invariant or the reduce dimensions of a reduction, or all dimensions of an
+// elementwise operation. lengths[] and strides[t][] are rewritten in place:
+//   1. size-1 dimensions are dropped
+//   2. if reorder is true, dimensions are stably sorted by decreasing stride of tensor ref_tensor,
+//      broadcast (stride 0) dimensions going outermost
+//   3. adjacent dimensions that are contiguous in every tensor are merged
+//   4. the remaining dimensions are moved innermost, the outer ones are padded with length 1 and
+//      stride 1
+// The element offsets visited in every tensor, and which offsets are visited together, are
+// unchanged, so is the row-major order of the elements unless dimensions are reordered. Empty
+// tensors are left untouched. Returns the number of dimensions which are not padding.
+template <index_t NumTensor>
+index_t canonicalize_dims(index_t* lengths,
+                          const std::array<index_t*, NumTensor>& strides,
+                          index_t num_dim,
+                          index_t ref_tensor = 0,
+                          bool reorder       = true)
+{
+    for(index_t i = 0; i < num_dim; ++i)
+    {
+        if(lengths[i] == 0)
+            return num_dim;
+    }
+
+    const auto move_dim = [&](index_t from, index_t to) {
+        lengths[to] = lengths[from];
+
+        for(index_t* s : strides)
+            s[to] = s[from];
+    };
+
+    // drop size-1 dimensions
+    index_t num_kept = 0;
+
+    for(index_t i = 0; i < num_dim; ++i)
+    {
+        if(lengths[i] != 1)
+            move_dim(i, num_kept++);
+    }
+
+    // insertion sort, the number of dimensions is small
+    if(reorder)
+    {
+        const index_t* ref_strides = strides[ref_tensor];
+
+        const auto is_outer = [&](index_t i, index_t j) {
+            const index_t si = ref_strides[i];
+            const index_t sj = ref_strides[j];
+
+            return si != sj && (si == 0 || (sj != 0 && si > sj));
+        };
+
+        for(index_t i = 1; i < num_kept; ++i)
+        {
+            for(index_t j = i; j > 0 && is_outer(j, j - 1); --j)
+            {
+                std::swap(lengths[j], lengths[j - 1]);
+
+                for(index_t* s : strides)
+                    std::swap(s[j], s[j - 1]);
+            }
+        }
+    }
+
+    // merge dimension i into the outer dimension num_merged - 1 if contiguous in all tensors
+    index_t num_merged = 0;
+
+    for(index_t i = 0; i < num_kept; ++i)
+    {
+        bool is_contiguous =
+            num_merged > 0 && static_cast<long_index_t>(lengths[num_merged - 1]) * lengths[i] <=
+                                  std::numeric_limits<index_t>::max();
+
+        for(const index_t* s : strides)
+        {
+            is_contiguous = is_contiguous && static_cast<long_index_t>(s[i]) * lengths[i] ==
+                                                 s[num_merged - 1];
+        }
+
+        if(is_contiguous)
+        {
+            lengths[num_merged - 1] *= lengths[i];
+
+            for(index_t* s : strides)
+                s[num_merged - 1] = s[i];
+        }
+        else
+        {
+            move_dim(i, num_merged++);
+        }
+    }
+
+    // right-align, pad the outer dimensions
+    const index_t num_pad = num_dim - num_merged;
+
+    for(index_t i = num_merged - 1; i >= 0; --i)
+        move_dim(i, i + num_pad);
+
+    for(index_t i = 0; i < num_pad; ++i)
+    {
+        lengths[i] = 1;
+
+        for(index_t* s : strides)
+            s[i] = 1;
+    }
+
+    return num_merged;
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -9,6 +9,7 @@
 #include "ck/utility/math.hpp"
 #include "ck/utility/sequence.hpp"
 #include "ck/tensor_operation/gpu/device/device_elementwise.hpp"
+#include "ck/tensor_operation/gpu/device/dims_canonicalizer.hpp"
 #include "ck/tensor_operation/gpu/grid/gridwise_elementwise_1d.hpp"
 #include "ck/tensor_description/tensor_descriptor_helper.hpp"
 
@@ -147,6 +148,21 @@ struct DeviceElementwiseImpl
               elementwise_op_(elementwise_op),
               blockSize_(256)
         {
+            // merge the dims contiguous in all tensors and drop size-1 dims, the vector access
+            // then spans the widest innermost extent. The dims are not reordered: the innermost
+            // dim of a permute differs between the tensors, and ordering by any one of them
+            // breaks the ScalarPerVector of the others
+            std::array<index_t*, NumInput + NumOutput> strides;
+
+            for(index_t i = 0; i < NumInput; ++i)
+                strides[i] = inStridesArray_[i].data();
+
+            for(index_t i = 0; i < NumOutput; ++i)
+                strides[NumInput + i] = outStridesArray_[i].data();
+
+            canonicalize_dims<NumInput + NumOutput>(
+                lengths_.data(), strides, NumDim, NumInput, false);
+
             in_dev_buffers_ = generate_tuple(
                 [&](auto I) {
                     using DataType = remove_cvref_t<decltype(InDataTypeTuple{}[I])>;
@@ -326,10 +326,10 @@ struct DeviceGemmMultipleD_Xdl_CShuffle : public DeviceGemmMultipleD<ALayout,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
                  CDEElementwiseOperation cde_element_op)
-            : p_a_grid_{static_cast<const ADataType*>(p_a_grid)},
-              p_b_grid_{static_cast<const BDataType*>(p_b_grid)},
+            : p_a_grid_{},
+              p_b_grid_{},
               p_ds_grid_{},
-              p_e_grid_{static_cast<EDataType*>(p_e_grid)},
+              p_e_grid_{},
               a_grid_desc_m_k_{DeviceOp::MakeAGridDescriptor_M_K(MRaw, KRaw, StrideA)},
               b_grid_desc_n_k_{DeviceOp::MakeBGridDescriptor_N_K(KRaw, NRaw, StrideB)},
               ds_grid_desc_m_n_{},
@@ -348,13 +348,11 @@ struct DeviceGemmMultipleD_Xdl_CShuffle : public DeviceGemmMultipleD<ALayout,
               NRaw_{NRaw},
               KRaw_{KRaw}
         {
-            // populate pointer, desc for Ds
-            static_for<0, NumDTensor, 1>{}([&](auto i) {
-                using DLayout   = remove_cvref_t<tuple_element_t<i.value, DsLayout>>;
-                using DDataType = remove_cvref_t<tuple_element_t<i.value, DsDataType>>;
+            SetDataPointers(p_a_grid, p_b_grid, p_ds_grid, p_e_grid);
 
-                // D pointer
-                p_ds_grid_(i) = static_cast<const DDataType*>(p_ds_grid[i]);
+            // populate desc for Ds
+            static_for<0, NumDTensor, 1>{}([&](auto i) {
+                using DLayout = remove_cvref_t<tuple_element_t<i.value, DsLayout>>;
 
                 // D desc
                 ds_grid_desc_m_n_(i) =
@@ -378,6 +376,23 @@ struct DeviceGemmMultipleD_Xdl_CShuffle : public DeviceGemmMultipleD<ALayout,
             }
         }
 
+        // only the pointers depend on the buffers, the descriptors are kept
+        void SetDataPointers(const void* p_a_grid,
+                             const void* p_b_grid,
+                             std::array<const void*, NumDTensor> p_ds_grid,
+                             void* p_e_grid)
+        {
+            p_a_grid_ = static_cast<const ADataType*>(p_a_grid);
+            p_b_grid_ = static_cast<const BDataType*>(p_b_grid);
+            p_e_grid_ = static_cast<EDataType*>(p_e_grid);
+
+            static_for<0, NumDTensor, 1>{}([&](auto i) {
+                using DDataType = remove_cvref_t<tuple_element_t<i.value, DsDataType>>;
+
+                p_ds_grid_(i) = static_cast<const DDataType*>(p_ds_grid[i]);
+            });
+        }
+
         void Print() const
         {
             std::cout << "A[M, K]: " << a_grid_desc_m_k_ << std::endl;
@@ -664,6 +679,26 @@ struct DeviceGemmMultipleD_Xdl_CShuffle : public DeviceGemmMultipleD<ALayout,
                                           cde_element_op);
     }
 
+    // polymorphic
+    bool SetDataPointers(BaseArgument* p_arg,
+                         const void* p_a,
+                         const void* p_b,
+                         std::array<const void*, NumDTensor> p_ds,
+                         void* p_e) const override
+    {
+        auto p_arg_ = dynamic_cast<Argument*>(p_arg);
+
+        // not an argument of this operation
+        if(p_arg_ == nullptr)
+        {
+            return false;
+        }
+
+        p_arg_->SetDataPointers(p_a, p_b, p_ds, p_e);
+
+        return true;
+    }
+
     // polymorphic
     std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
     {
@@ -12,6 +12,7 @@
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
 #include "ck/tensor_operation/gpu/device/device_gemm_splitk.hpp"
 #include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/split_k_selector.hpp"
 #include "ck/tensor_operation/gpu/grid/gridwise_gemm_xdlops_v2r4r2.hpp"
 #include "ck/host_utility/device_prop.hpp"
 #include "ck/host_utility/kernel_launch.hpp"
@@ -316,6 +317,26 @@ struct DeviceGemmXdlSplitKCShuffle : public DeviceGemmSplitK<ALayout,
         return IsSupportedArgument(*dynamic_cast<const Argument*>(p_arg));
     }
 
+    // the split of the cost model if KBatch is KBatchAuto
+    static index_t GetKBatch(index_t M, index_t N, index_t K, index_t KBatch)
+    {
+        if(KBatch != KBatchAuto)
+            return KBatch;
+
+        const auto kernel = kernel_gemm_xdlops_v2r4r2_simplified<GridwiseGemm,
+                                                                 true,
+                                                                 InMemoryDataOperationEnum::Set,
+                                                                 DefaultBlock2CTileMap,
+                                                                 AElementwiseOperation,
+                                                                 BElementwiseOperation,
+                                                                 CElementwiseOperation>;
+
+        return select_k_batch(
+            SplitKProblem{1, M, N, K},
+            SplitKTile{MPerBlock, NPerBlock, K0PerBlock * K1, is_k_padded(GemmSpec)},
+            make_split_k_cost_model(kernel, BlockSize));
+    }
+
     static auto MakeArgument(const ADataType* p_a,
                              const BDataType* p_b,
                              CDataType* p_c,
@@ -330,6 +351,8 @@ struct DeviceGemmXdlSplitKCShuffle : public DeviceGemmSplitK<ALayout,
                              CElementwiseOperation c_element_op,
                              index_t KBatch)
     {
+        KBatch = GetKBatch(M, N, K, KBatch);
+
         return Argument(p_a,
                         p_b,
                         p_c,
@@ -366,6 +389,8 @@ struct DeviceGemmXdlSplitKCShuffle : public DeviceGemmSplitK<ALayout,
                                                       CElementwiseOperation c_element_op,
                                                       ck::index_t KBatch = 1) override
     {
+        KBatch = GetKBatch(M, N, K, KBatch);
+
         return std::make_unique<Argument>(static_cast<const ADataType*>(p_a),
                                           static_cast<const BDataType*>(p_b),
                                           static_cast<CDataType*>(p_c),
@@ -391,6 +416,12 @@ struct DeviceGemmXdlSplitKCShuffle : public DeviceGemmSplitK<ALayout,
         return std::make_unique<Invoker>(Invoker{});
     }
 
+    // polymorphic
+    index_t GetKBatch(const BaseArgument* p_arg) const override
+    {
+        return dynamic_cast<const Argument*>(p_arg)->k_batch;
+    }
+
     // polymorphic
     std::string GetTypeString() const override
     {
@@ -497,7 +497,7 @@ struct DeviceGroupedConvBwdWeight_Wmma_CShuffle
               conv_filter_strides_{conv_filter_strides},
               input_left_pads_{input_left_pads},
               input_right_pads_{input_right_pads},
-              k_batch_{split_k}
+              k_batch_{split_k == KBatchAuto ? 1 : split_k}
         {
             constexpr index_t spatial_offset = 3;
             std::copy(begin(a_g_n_c_wis_lengths) + spatial_offset,
@@ -13,6 +13,7 @@
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
 #include "ck/tensor_operation/gpu/device/device_grouped_conv_bwd_weight.hpp"
 #include "ck/tensor_operation/gpu/device/convolution_backward_weight_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/split_k_selector.hpp"
 #include "ck/tensor_operation/gpu/grid/gridwise_gemm_xdlops_bwd_weight.hpp"
 #include "ck/tensor_operation/gpu/device/impl/device_grouped_conv_utils.hpp"
 #include "ck/host_utility/device_prop.hpp"
@@ -1084,6 +1085,49 @@ struct DeviceGroupedConvBwdWeight_Xdl_CShuffle
     using Block2CTileMap =
         decltype(GridwiseGemm::MakeCBlockClusterAdaptor(CGridDesc_M_N{}, 1, 1, 1));
 
+    // the split of the cost model if split_k is KBatchAuto, a group is a GEMM of M = K,
+    // N = C * filter size and K = N * output size, which is padded to the split
+    static index_t GetKBatch(const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_lengths,
+                             const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+                             const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_lengths,
+                             index_t split_k)
+    {
+        if(split_k != KBatchAuto)
+            return split_k;
+
+        constexpr index_t spatial_offset = 3;
+
+        const index_t gemm_m = b_g_k_c_xs_lengths[1];
+        const index_t gemm_n = std::accumulate(begin(b_g_k_c_xs_lengths) + spatial_offset,
+                                               end(b_g_k_c_xs_lengths),
+                                               a_g_n_c_wis_lengths[2],
+                                               std::multiplies<>{});
+        const index_t gemm_k = std::accumulate(begin(e_g_n_k_wos_lengths) + spatial_offset,
+                                               end(e_g_n_k_wos_lengths),
+                                               a_g_n_c_wis_lengths[1],
+                                               std::multiplies<>{});
+
+        const auto kernel = kernel_batched_gemm_xdlops_bwd_weight<
+            GridwiseGemm,
+            ADataType,
+            BDataType,
+            CDataType,
+            OutElementwiseOperation,
+            InElementwiseOperation,
+            WeiElementwiseOperation,
+            remove_reference_t<DeviceOp::AGridDesc_K0_M_K1>,
+            remove_reference_t<DeviceOp::BGridDesc_K0_N_K1>,
+            remove_reference_t<DeviceOp::CGridDesc_MBlock_MPerBlock_NBlock_NPerBlock>,
+            remove_reference_t<DeviceOp::Block2CTileMap>,
+            ComputePtrOffsetOfStridedBatch<>,
+            true>;
+
+        // the weight is always zeroed and written with atomics, also without splitting K
+        return select_k_batch(SplitKProblem{a_g_n_c_wis_lengths[0], gemm_m, gemm_n, gemm_k},
+                              SplitKTile{MPerBlock, NPerBlock, K0PerBlock * K1, true, true},
+                              make_split_k_cost_model(kernel, BlockSize));
+    }
+
     struct Argument : public BaseArgument
     {
         Argument(const InDataType* p_in_grid,
@@ -1129,7 +1173,8 @@ struct DeviceGroupedConvBwdWeight_Xdl_CShuffle
               conv_filter_strides_{conv_filter_strides},
               input_left_pads_{input_left_pads},
               input_right_pads_{input_right_pads},
-              k_batch_{split_k}
+              k_batch_{GetKBatch(
+                  a_g_n_c_wis_lengths, b_g_k_c_xs_lengths, e_g_n_k_wos_lengths, split_k)}
         {
             constexpr index_t spatial_offset = 3;
             std::copy(begin(a_g_n_c_wis_lengths) + spatial_offset,
@@ -461,7 +461,7 @@ struct DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle
             : p_as_grid_{},
               p_bs_grid_{},
               p_ds_grid_{},
-              p_e_grid_{static_cast<EDataType*>(p_e)},
+              p_e_grid_{},
               num_group_{a_g_n_c_wis_lengths[0]},
               a_grid_desc_m_k_{DeviceOp::MakeAGridDescriptor_M_K<ALayout>(a_g_n_c_wis_lengths,
                                                                           a_g_n_c_wis_strides,
@@ -502,67 +502,29 @@ struct DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle
               input_left_pads_{input_left_pads},
               input_right_pads_{input_right_pads}
         {
+            SetDataPointers(p_as, p_bs, p_ds, p_e);
+
             // A/B/E Batch Stride
             if constexpr(isMultiA || isMultiB)
             {
                 static_for<0, NumATensor, 1>{}([&](auto i) {
                     // Init compute_ptr_offset_of_batch_ for multiple AB
                     compute_ptr_offset_of_batch_.BatchStrideA_(i) = a_g_n_c_wis_strides[0];
-
-                    // Use GemmADataType/GemmBDataType to iterate over tuple (even if passed data
-                    // type is not tuple)
-                    using DataType = remove_cvref_t<tuple_element_t<i.value, GemmADataType>>;
-                    // It is possible that one of the AB is a pointer and one is a tuple.
-                    // Then also use multiAB but we have to cast single pointer instead of tuple of
-                    // pointer.
-                    if constexpr(isMultiA)
-                    {
-                        // p_as is tuple
-                        p_as_grid_(i) = static_cast<const DataType*>(p_as[i.value]);
-                    }
-                    else
-                    {
-                        // if MultiB and not MultiA then p_as is single pointer
-                        p_as_grid_(i) = static_cast<const DataType*>(p_as);
-                    }
                 });
                 static_for<0, NumBTensor, 1>{}([&](auto i) {
                     // Init compute_ptr_offset_of_batch_ for multiple AB
                     compute_ptr_offset_of_batch_.BatchStrideB_(i) = b_g_k_c_xs_strides[0];
-
-                    using DataType = remove_cvref_t<tuple_element_t<i.value, GemmBDataType>>;
-                    // It is possible that one of the AB is a pointer and one is a tuple.
-                    // Then also use multiAB but we have to cast single pointer instead of tuple of
-                    // pointer.
-                    if constexpr(isMultiB)
-                    {
-                        // p_bs is tuple
-                        p_bs_grid_(i) = static_cast<const DataType*>(p_bs[i.value]);
-                    }
-                    else
-                    {
-                        // if MultiA and not MultiB then p_bs is single pointer
-                        p_bs_grid_(i) = static_cast<const DataType*>(p_bs);
-                    }
                 });
             }
             else
             {
                 compute_ptr_offset_of_batch_.BatchStrideA_ = a_g_n_c_wis_strides[0];
                 compute_ptr_offset_of_batch_.BatchStrideB_ = b_g_k_c_xs_strides[0];
-
-                // p_as and p_bs are pointers
-                p_as_grid_(I0) = static_cast<const ADataType*>(p_as);
-                p_bs_grid_(I0) = static_cast<const BDataType*>(p_bs);
             }
 
-            // populate pointer, batch stride, desc for Ds
+            // populate batch stride, desc for Ds
             static_for<0, NumDTensor, 1>{}([&](auto i) {
-                using DLayout   = remove_cvref_t<tuple_element_t<i.value, DsLayout>>;
-                using DDataType = remove_cvref_t<tuple_element_t<i.value, DsDataType>>;
-
-                // D pointer
-                p_ds_grid_(i) = static_cast<const DDataType*>(p_ds[i]);
+                using DLayout = remove_cvref_t<tuple_element_t<i.value, DsLayout>>;
 
                 // D batch stride
                 compute_ptr_offset_of_batch_.BatchStrideDs_(i) = ds_g_n_k_wos_strides[i][0];
@@ -615,6 +577,65 @@ struct DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle
             }
         }
 
+        // only the pointers depend on the buffers, the descriptors and batch strides are kept
+        void SetDataPointers(APointers p_as,
+                             BPointers p_bs,
+                             const std::array<const void*, NumDTensor>& p_ds,
+                             void* p_e)
+        {
+            if constexpr(isMultiA || isMultiB)
+            {
+                static_for<0, NumATensor, 1>{}([&](auto i) {
+                    // Use GemmADataType/GemmBDataType to iterate over tuple (even if passed data
+                    // type is not tuple)
+                    using DataType = remove_cvref_t<tuple_element_t<i.value, GemmADataType>>;
+                    // It is possible that one of the AB is a pointer and one is a tuple.
+                    // Then also use multiAB but we have to cast single pointer instead of tuple of
+                    // pointer.
+                    if constexpr(isMultiA)
+                    {
+                        // p_as is tuple
+                        p_as_grid_(i) = static_cast<const DataType*>(p_as[i.value]);
+                    }
+                    else
+                    {
+                        // if MultiB and not MultiA then p_as is single pointer
+                        p_as_grid_(i) = static_cast<const DataType*>(p_as);
+                    }
+                });
+                static_for<0, NumBTensor, 1>{}([&](auto i) {
+                    using DataType = remove_cvref_t<tuple_element_t<i.value, GemmBDataType>>;
+                    // It is possible that one of the AB is a pointer and one is a tuple.
+                    // Then also use multiAB but we have to cast single pointer instead of tuple of
+                    // pointer.
+                    if constexpr(isMultiB)
+                    {
+                        // p_bs is tuple
+                        p_bs_grid_(i) = static_cast<const DataType*>(p_bs[i.value]);
+                    }
+                    else
+                    {
+                        // if MultiA and not MultiB then p_bs is single pointer
+                        p_bs_grid_(i) = static_cast<const DataType*>(p_bs);
+                    }
+                });
+            }
+            else
+            {
+                // p_as and p_bs are pointers
+                p_as_grid_(I0) = static_cast<const ADataType*>(p_as);
+                p_bs_grid_(I0) = static_cast<const BDataType*>(p_bs);
+            }
+
+            static_for<0, NumDTensor, 1>{}([&](auto i) {
+                using DDataType = remove_cvref_t<tuple_element_t<i.value, DsDataType>>;
+
+                p_ds_grid_(i) = static_cast<const DDataType*>(p_ds[i]);
+            });
+
+            p_e_grid_ = static_cast<EDataType*>(p_e);
+        }
+
         void Print() const
         {
             std::cout << "A[M, K]: " << a_grid_desc_m_k_ << std::endl;
@@ -1071,6 +1092,25 @@ struct DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle
                                           cde_element_op);
     }
 
+    bool SetDataPointers(BaseArgument* p_arg,
+                         APointers p_a,
+                         BPointers p_b,
+                         const std::array<const void*, NumDTensor>& p_ds,
+                         void* p_e) const override
+    {
+        auto p_arg_ = dynamic_cast<Argument*>(p_arg);
+
+        // not an argument of this operation
+        if(p_arg_ == nullptr)
+        {
+            return false;
+        }
+
+        p_arg_->SetDataPointers(p_a, p_b, p_ds, p_e);
+
+        return true;
+    }
+
     std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
     {
         return std::make_unique<Invoker>(Invoker{});
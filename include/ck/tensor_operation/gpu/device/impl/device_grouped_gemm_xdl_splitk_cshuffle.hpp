@@ -17,6 +17,7 @@
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
 #include "ck/tensor_operation/gpu/device/device_grouped_gemm_splitk.hpp"
 #include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/split_k_selector.hpp"
 #include "ck/tensor_operation/gpu/grid/gridwise_gemm_xdlops_v2r4r2.hpp"
 
 namespace ck {
@@ -215,6 +216,19 @@ struct DeviceGroupedGemmXdlSplitKCShuffle : public DeviceGroupedGemmSplitK<ALayo
 
     static constexpr index_t DefaultKBatch = 1;
 
+    // the split of the cost model for KBatchAuto, shared by all groups
+    static index_t SelectKBatch(const std::vector<SplitKProblem>& problems)
+    {
+        const auto kernel = kernel_grouped_gemm_xdl_splitk<GridwiseGemm,
+                                                           GemmTransKernelArg,
+                                                           true,
+                                                           InMemoryDataOperationEnum::Set>;
+
+        return select_k_batch(problems,
+                              SplitKTile{MPerBlock, NPerBlock, KPerBlock, is_k_padded(GemmSpec)},
+                              make_split_k_cost_model(kernel, BlockSize));
+    }
+
     // Argument
     struct Argument : public BaseArgument
     {
@@ -233,8 +247,19 @@ struct DeviceGroupedGemmXdlSplitKCShuffle : public DeviceGroupedGemmSplitK<ALayo
                  std::vector<void*>& p_Es,
                  std::vector<GemmDesc>& gemm_descs,
                  index_t kbatch)
-            : K_BATCH{kbatch}
         {
+            if(kbatch == KBatchAuto)
+            {
+                std::vector<SplitKProblem> problems;
+
+                for(const auto& gemm_desc : gemm_descs)
+                    problems.push_back({1, gemm_desc.M_, gemm_desc.N_, gemm_desc.K_});
+
+                kbatch = SelectKBatch(problems);
+            }
+
+            K_BATCH = kbatch;
+
             grid_size_   = 0;
             group_count_ = ck::type_convert<ck::index_t>(gemm_descs.size());
 
@@ -308,10 +333,24 @@ struct DeviceGroupedGemmXdlSplitKCShuffle : public DeviceGroupedGemmSplitK<ALayo
         /**
          * @brief      Recalculate group grid size for all gemms and update B2C maps.
          *
-         * @param[in]  kbatch  The new splitK parameter value.
+         * @param[in]  kbatch  The new splitK parameter value, or KBatchAuto.
          */
         void UpdateKBatch(index_t kbatch)
         {
+            if(kbatch == KBatchAuto)
+            {
+                std::vector<SplitKProblem> problems;
+
+                for(const auto& gemm_kernel_arg : gemm_kernel_args_)
+                {
+                    const auto& karg = gemm_kernel_arg.karg_;
+
+                    problems.push_back({1, karg.M, karg.N, karg.K});
+                }
+
+                kbatch = SelectKBatch(problems);
+            }
+
             K_BATCH    = kbatch;
             grid_size_ = 0;
 
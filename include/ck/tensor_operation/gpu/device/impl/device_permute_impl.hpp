@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <memory>
 #include <utility>
@@ -11,6 +12,7 @@
 #include "ck/utility/sequence.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/tensor_operation/gpu/device/device_permute.hpp"
+#include "ck/tensor_operation/gpu/device/dims_canonicalizer.hpp"
 #include "ck/tensor_operation/gpu/device/matrix_padder.hpp"
 #include "ck/tensor_operation/gpu/grid/gridwise_permute.hpp"
 #include "ck/tensor_description/tensor_descriptor_helper.hpp"
@@ -129,6 +131,15 @@ struct DevicePermuteImpl : DevicePermute<NumDim, InDataType, OutDataType, Elemen
               elementwise_op_(elementwise_op),
               block_2_tile_map_(GridwisePermute::MakeDefaultBlock2TileMap(in_grid_desc_))
         {
+            // merge the leading dims contiguous in both tensors and drop size-1 ones, N, H and W
+            // of the descriptors do not change but N is merged from fewer dims
+            canonicalize_dims<2>(
+                in_lengths_.data(), {in_strides_.data(), out_strides_.data()}, NumDim - 2, 1);
+
+            std::copy_n(in_lengths_.begin(), NumDim - 2, out_lengths_.begin());
+
+            in_grid_desc_  = MakeDescriptor_N_H_W(in_lengths_, in_strides_);
+            out_grid_desc_ = MakeDescriptor_N_H_W(out_lengths_, out_strides_);
         }
 
         const InDataType* in_dev_buffer_;
@@ -9,6 +9,7 @@
 #include "ck/utility/common_header.hpp"
 #include "ck/utility/reduction_enums.hpp"
 #include "ck/utility/reduction_operator.hpp"
+#include "ck/tensor_operation/gpu/device/dims_canonicalizer.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -137,6 +138,41 @@ shuffle_tensor_dimensions(const std::array<index_t, Rank>& origLengthsStrides,
     return newLengthsStrides;
 };
 
+// here, inLengths[] and inStrides[] are already shuffled, the invariant dims of the input and the
+// dims of the output (if outLengths is not nullptr) are canonicalized together, ordered by the
+// output strides, the reduce dims are canonicalized on their own, ordered by the input strides if
+// reorderReduceDims is true. Reordering the reduce dims changes the index of the reduced element.
+template <index_t Rank, index_t NumReduceDim>
+void canonicalize_shuffled_dimensions(index_t* inLengths,
+                                      index_t* inStrides,
+                                      index_t* outLengths,
+                                      index_t* outStrides,
+                                      bool reorderReduceDims)
+{
+    constexpr index_t NumInvariantDim = Rank - NumReduceDim;
+
+    if constexpr(NumInvariantDim > 0)
+    {
+        if(outLengths != nullptr)
+        {
+            canonicalize_dims<2>(inLengths, {inStrides, outStrides}, NumInvariantDim, 1);
+
+            for(index_t i = 0; i < NumInvariantDim; i++)
+                outLengths[i] = inLengths[i];
+        }
+        else
+        {
+            canonicalize_dims<1>(inLengths, {inStrides}, NumInvariantDim);
+        }
+    };
+
+    canonicalize_dims<1>(inLengths + NumInvariantDim,
+                         {inStrides + NumInvariantDim},
+                         NumReduceDim,
+                         0,
+                         reorderReduceDims);
+};
+
 } // namespace device
 } // namespace tensor_operation
 } // namespace ck
@@ -184,6 +184,15 @@ struct DeviceReduceThreadWise : public DeviceReduce<InDataType,
             inLengths_ = shuffle_tensor_dimensions<Rank, NumReduceDim>(inLengths, reduceDims);
             inStrides_ = shuffle_tensor_dimensions<Rank, NumReduceDim>(inStrides, reduceDims);
 
+            // merge contiguous dims and drop size-1 dims to widen the innermost extents, the
+            // reduce dims can only be reordered if no index is output
+            canonicalize_shuffled_dimensions<Rank, NumReduceDim>(
+                inLengths_.data(),
+                inStrides_.data(),
+                NumInvariantDim > 0 ? outLengths_.data() : nullptr,
+                NumInvariantDim > 0 ? outStrides_.data() : nullptr,
+                !OutputIndex);
+
             alpha_ = type_convert<AccDataType>(alpha);
             beta_  = type_convert<AccDataType>(beta);
 
@@ -190,6 +190,11 @@ struct DeviceSoftmaxImpl : public DeviceSoftmax<InDataType,
             inLengths_ = shuffle_tensor_dimensions<Rank, NumReduceDim>(inLengths, reduceDims);
             inStrides_ = shuffle_tensor_dimensions<Rank, NumReduceDim>(inStrides, reduceDims);
 
+            // merge contiguous dims and drop size-1 dims to widen the innermost extents, the output
+            // has the layout of the input
+            canonicalize_shuffled_dimensions<Rank, NumReduceDim>(
+                inLengths_.data(), inStrides_.data(), nullptr, nullptr, true);
+
             long_index_t invariant_total_length;
             long_index_t reduce_total_length;
 
@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+#include <hip/hip_runtime.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+#include "ck/host_utility/hip_check_error.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// k_batch of the split-K device operations asking them to select the split with the cost model
+// below, based on the problem, the tile of the instance and the current device
+static constexpr index_t KBatchAuto = -1;
+
+// G independent M x N x K GEMMs, e.g. the groups of a grouped convolution
+struct SplitKProblem
+{
+    index_t G_;
+    index_t M_;
+    index_t N_;
+    index_t K_;
+};
+
+// tile computed by a workgroup per iteration of its main loop
+struct SplitKTile
+{
+    index_t MPerBlock_;
+    index_t NPerBlock_;
+    index_t KPerBlock_;
+
+    // whether the instance pads K to a multiple of k_batch * KPerBlock, otherwise only the k_batch
+    // dividing K / KPerBlock are supported
+    bool PadK_ = true;
+
+    // whether the instance writes C with atomics into a zeroed C even at k_batch = 1
+    bool AtomicAtEverySplit_ = false;
+};
+
+// whether a GEMM specialization pads K, e.g. for SplitKTile::PadK_
+constexpr bool is_k_padded(GemmSpecialization gemm_spec)
+{
+    return gemm_spec == GemmSpecialization::KPadding ||
+           gemm_spec == GemmSpecialization::MKPadding ||
+           gemm_spec == GemmSpecialization::NKPadding ||
+           gemm_spec == GemmSpecialization::MNKPadding;
+}
+
+// Host cost model of a split-K GEMM, in units of one main loop iteration of a workgroup. With
+// k_batch = k every C tile is computed by k workgroups over ceil(KTiles / k) iterations each, and
+// the grid of Tiles * k workgroups runs in ceil(Tiles * k / (NumCU * Occupancy)) waves:
+//   cost(1) = Waves(1) * (KTiles + EpilogueCost)
+//   cost(k) = Waves(k) * (ceil(KTiles / k) + EpilogueCost + AtomicEpilogueCost) + ZeroInitCost
+// where the partial reduction of k > 1 writes C with atomics, which first need C to be zeroed.
+// Instances with SplitKTile::AtomicAtEverySplit_ pay for both at k = 1 as well, cost(1) then
+// follows the formula of cost(k). Zeroing is bandwidth bound, it costs
+// ZeroInitCost = ceil(Tiles / (NumCU * Occupancy)) times the ratio of the elements of a C tile to
+// those loaded per iteration.
+struct SplitKCostModel
+{
+    index_t num_cu_;
+    index_t occupancy_ = 1;
+
+    // writing a C tile, and the extra cost of doing it with atomics
+    float epilogue_cost_        = 2.f;
+    float atomic_epilogue_cost_ = 4.f;
+
+    index_t max_k_batch_ = 128;
+};
+
+// cost of the problems computed by a single grid, e.g. the groups of a grouped GEMM, of which
+// every workgroup runs as many iterations as the one of the largest K
+inline float get_split_k_cost(const std::vector<SplitKProblem>& problems,
+                              const SplitKTile& tile,
+                              const SplitKCostModel& model,
+                              index_t k_batch)
+{
+    const auto ceil_div = [](long_index_t a, long_index_t b) { return (a + b - 1) / b; };
+
+    long_index_t tiles   = 0;
+    long_index_t k_tiles = 0;
+
+    for(const auto& problem : problems)
+    {
+        tiles += static_cast<long_index_t>(problem.G_) * ceil_div(problem.M_, tile.MPerBlock_) *
+                 ceil_div(problem.N_, tile.NPerBlock_);
+        k_tiles = std::max(k_tiles, ceil_div(problem.K_, tile.KPerBlock_));
+    }
+
+    const long_index_t slots = std::max(1, model.num_cu_ * model.occupancy_);
+    const long_index_t waves = ceil_div(tiles * k_batch, slots);
+
+    if(k_batch == 1 && !tile.AtomicAtEverySplit_)
+        return static_cast<float>(waves) * (static_cast<float>(k_tiles) + model.epilogue_cost_);
+
+    const float tile_ratio = static_cast<float>(tile.MPerBlock_) *
+                             static_cast<float>(tile.NPerBlock_) /
+                             static_cast<float>((tile.MPerBlock_ + tile.NPerBlock_) *
+                                                tile.KPerBlock_);
+
+    const float zero_init_cost = static_cast<float>(ceil_div(tiles, slots)) * tile_ratio;
+
+    return static_cast<float>(waves) *
+               (static_cast<float>(ceil_div(k_tiles, k_batch)) + model.epilogue_cost_ +
+                model.atomic_epilogue_cost_) +
+           zero_init_cost;
+}
+
+inline float get_split_k_cost(const SplitKProblem& problem,
+                              const SplitKTile& tile,
+                              const SplitKCostModel& model,
+                              index_t k_batch)
+{
+    return get_split_k_cost(std::vector<SplitKProblem>{problem}, tile, model, k_batch);
+}
+
+// whether the tile supports k_batch for every problem
+inline bool is_k_batch_supported(const std::vector<SplitKProblem>& problems,
+                                 const SplitKTile& tile,
+                                 index_t k_batch)
+{
+    if(tile.PadK_)
+        return true;
+
+    return std::all_of(problems.begin(), problems.end(), [&](const SplitKProblem& problem) {
+        return problem.K_ % (k_batch * tile.KPerBlock_) == 0;
+    });
+}
+
+// k_batch of the lowest modeled cost, the smallest one on ties, among those supported by the tile.
+// Every split of the largest K gets at least one iteration. Empty problems are skipped.
+inline index_t select_k_batch(const std::vector<SplitKProblem>& problems,
+                              const SplitKTile& tile,
+                              const SplitKCostModel& model)
+{
+    std::vector<SplitKProblem> non_empty_problems;
+    index_t k_tiles = 0;
+
+    for(const auto& problem : problems)
+    {
+        if(problem.G_ > 0 && problem.M_ > 0 && problem.N_ > 0 && problem.K_ > 0)
+        {
+            non_empty_problems.push_back(problem);
+            k_tiles = std::max(k_tiles, (problem.K_ + tile.KPerBlock_ - 1) / tile.KPerBlock_);
+        }
+    }
+
+    if(non_empty_problems.empty())
+        return 1;
+
+    const index_t max_k_batch = std::min(model.max_k_batch_, k_tiles);
+
+    index_t best_k_batch = 1;
+    float best_cost      = get_split_k_cost(non_empty_problems, tile, model, 1);
+
+    for(index_t k_batch = 2; k_batch <= max_k_batch; ++k_batch)
+    {
+        if(!is_k_batch_supported(non_empty_problems, tile, k_batch))
+            continue;
+
+        const float cost = get_split_k_cost(non_empty_problems, tile, model, k_batch);
+
+        if(cost < best_cost)
+        {
+            best_k_batch = k_batch;
+            best_cost    = cost;
+        }
+    }
+
+    return best_k_batch;
+}
+
+inline index_t
+select_k_batch(const SplitKProblem& problem, const SplitKTile& tile, const SplitKCostModel& model)
+{
+    return select_k_batch(std::vector<SplitKProblem>{problem}, tile, model);
+}
+
+// cost model of the current device for a kernel with static LDS launched with block_size threads.
+// The occupancy and the CU count are queried once per kernel and device, later calls only look the
+// model up.
+template <typename Kernel>
+SplitKCostModel make_split_k_cost_model(Kernel kernel, index_t block_size)
+{
+    static std::mutex mutex;
+    static std::map<std::tuple<const void*, index_t, int>, SplitKCostModel> models;
+
+    int dev;
+    hip_check_error(hipGetDevice(&dev));
+
+    const auto key = std::make_tuple(reinterpret_cast<const void*>(kernel), block_size, dev);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto model = models.find(key);
+
+    if(model == models.end())
+    {
+        int occupancy;
+        hip_check_error(
+            hipOccupancyMaxActiveBlocksPerMultiprocessor(&occupancy, kernel, block_size, 0));
+
+        hipDeviceProp_t dev_prop;
+        hip_check_error(hipGetDeviceProperties(&dev_prop, dev));
+
+        SplitKCostModel new_model{};
+
+        new_model.num_cu_    = dev_prop.multiProcessorCount;
+        new_model.occupancy_ = std::max(1, occupancy);
+
+        model = models.emplace(key, new_model).first;
+    }
+
+    return model->second;
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
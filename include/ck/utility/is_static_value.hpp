@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/ck.hpp"
+#include "integral_constant.hpp"
+
+namespace ck {
+
+// true if X is a Number<> (or another integral_constant) of value V, false for runtime values
+template <typename X, index_t V>
+struct is_static_value : integral_constant<bool, false>
+{
+};
+
+template <typename T, T X, index_t V>
+struct is_static_value<integral_constant<T, X>, V> : integral_constant<bool, X == V>
+{
+};
+
+// true if X and Y are integral_constants of the same value
+template <typename X, typename Y>
+struct is_static_equal : integral_constant<bool, false>
+{
+};
+
+template <typename T, T X, typename U, U Y>
+struct is_static_equal<integral_constant<T, X>, integral_constant<U, Y>>
+    : integral_constant<bool, X == Y>
+{
+};
+
+// X == Y * Z, for integral_constants
+template <typename X, typename Y, typename Z>
+struct is_static_product : integral_constant<bool, false>
+{
+};
+
+template <typename T, T X, typename U, U Y, typename V, V Z>
+struct is_static_product<integral_constant<T, X>, integral_constant<U, Y>, integral_constant<V, Z>>
+    : integral_constant<bool, X == Y * Z>
+{
+};
+
+} // namespace ck
@@ -12,25 +12,27 @@
 namespace ck {
 
 // magic number division
-// Caution:
-//   1. For uint32_t as dividend: magic number division implementation being used would produce
-//   correct result if the dividend is uint32_t and its value is within 31-bit value range.
-//   2. For int32_t as dividendd: magic number division for int32_t dividened has not been
-//   implemented, the int32_t dividend would be bit-wise interpreted as uint32_t and magic number
-//   division implementation for uint32_t is then used. Therefore, dividend value need to be
-//   non-negative.
-// TODO:
-//   1. Implement magic number divison for int32_t
-//   2. Implement magic number divison for unit32_t with 32-bit value range
+//   1. DoMagicDivision() with CalculateMagicNumbers() is the fast path used by MDiv, MDiv2 and the
+//   Merge transforms of index_t lengths: it is exact for divisors within [1, INT32_MAX] and
+//   dividends within [0, INT32_MAX]. An int32_t dividend is bit-wise interpreted as uint32_t, so it
+//   needs to be non-negative.
+//   2. DoMagicDivisionFullRange() with CalculateMagicNumbersFullRange() is exact for any uint32_t
+//   dividend and divisor within [1, UINT32_MAX]. Divisors above 2^31 have a shift of 32, which
+//   only the 64-bit sum of DoMagicDivisionFullRange() can take.
+//   3. DoMagicDivisionSigned() is exact for any int32_t dividend and a positive divisor, rounding
+//   toward zero like the / operator, with the magic numbers of CalculateMagicNumbersFullRange().
+//   MDivSigned also handles negative divisors.
+//   4. CalculateMagicNumbers64() and DoMagicDivision64() do the same for long_index_t dividends
+//   and divisors within [1, 2^63]. The long_index_t overloads of CalculateMagicMultiplier(),
+//   CalculateMagicShift() and DoMagicDivision() use them, so that a Merge of long_index_t lengths
+//   picks them.
 struct MagicDivision
 {
-    // uint32_t
-    __host__ __device__ static constexpr auto CalculateMagicNumbers(uint32_t divisor)
+    // magic numbers for DoMagicDivisionFullRange() and DoMagicDivisionSigned(), the shift is 32
+    // for divisors above 2^31
+    __host__ __device__ static constexpr auto CalculateMagicNumbersFullRange(uint32_t divisor)
     {
-        // WARNING: magic division is only applicable for division inside this range.
-        // You should use the return value of CalculateMagicNumbers, if division is not inside this
-        // range. The "else" logic below is to quiet down run-time error.
-        if(divisor >= 1 && divisor <= INT32_MAX)
+        if(divisor >= 1)
         {
             uint32_t shift = 0;
             for(shift = 0; shift < 32; ++shift)
@@ -53,6 +55,24 @@ struct MagicDivision
         }
     }
 
+    // uint32_t
+    __host__ __device__ static constexpr auto CalculateMagicNumbers(uint32_t divisor)
+    {
+        // WARNING: magic division is only applicable for division inside this range.
+        // You should use the return value of CalculateMagicNumbers, if division is not inside this
+        // range. The "else" logic below is to quiet down run-time error.
+        // The shift is at most 31 inside this range, so the 32-bit shift of DoMagicDivision() is
+        // defined. Larger divisors need CalculateMagicNumbersFullRange().
+        if(divisor >= 1 && divisor <= INT32_MAX)
+        {
+            return CalculateMagicNumbersFullRange(divisor);
+        }
+        else
+        {
+            return make_tuple(uint32_t(0), uint32_t(0));
+        }
+    }
+
     __host__ __device__ static constexpr uint32_t CalculateMagicMultiplier(uint32_t divisor)
     {
         auto tmp = CalculateMagicNumbers(divisor);
@@ -121,6 +141,79 @@ struct MagicDivision
         return CalculateMagicShift(integral_constant<uint32_t, Divisor>{});
     }
 
+    // 64-bit magic numbers for a divisor within [1, 2^63]
+    __host__ __device__ static constexpr auto CalculateMagicNumbers64(uint64_t divisor)
+    {
+        if(divisor >= 1 && divisor <= (uint64_t{1} << 63))
+        {
+            uint32_t shift = 0;
+
+            while((uint64_t{1} << shift) < divisor)
+            {
+                ++shift;
+            }
+
+            // multiplier = 2^64 * (2^shift - divisor) / divisor + 1, by long division since the
+            // product does not fit into 64 bits
+            uint64_t remainder  = (uint64_t{1} << shift) - divisor;
+            uint64_t multiplier = 0;
+
+            for(uint32_t i = 0; i < 64; ++i)
+            {
+                remainder <<= 1;
+                multiplier <<= 1;
+
+                if(remainder >= divisor)
+                {
+                    remainder -= divisor;
+                    multiplier |= 1;
+                }
+            }
+
+            return make_tuple(multiplier + 1, shift);
+        }
+        else
+        {
+            return make_tuple(uint64_t{0}, uint32_t{0});
+        }
+    }
+
+    // long_index_t, the 64-bit magic numbers of CalculateMagicNumbers64()
+    template <typename Divisor,
+              typename enable_if<is_same<Divisor, long_index_t>::value, bool>::type = false>
+    __host__ __device__ static constexpr uint64_t CalculateMagicMultiplier(Divisor divisor)
+    {
+        auto tmp = CalculateMagicNumbers64(static_cast<uint64_t>(divisor));
+
+        return tmp[Number<0>{}];
+    }
+
+    template <typename Divisor,
+              typename enable_if<is_same<Divisor, long_index_t>::value, bool>::type = false>
+    __host__ __device__ static constexpr uint32_t CalculateMagicShift(Divisor divisor)
+    {
+        auto tmp = CalculateMagicNumbers64(static_cast<uint64_t>(divisor));
+
+        return tmp[Number<1>{}];
+    }
+
+    // integral_constant<long_index_t, .>
+    template <long_index_t Divisor>
+    __host__ __device__ static constexpr auto CalculateMagicMultiplier(LongNumber<Divisor>)
+    {
+        constexpr uint64_t multiplier = CalculateMagicMultiplier(long_index_t{Divisor});
+
+        return integral_constant<uint64_t, multiplier>{};
+    }
+
+    template <long_index_t Divisor>
+    __host__ __device__ static constexpr auto CalculateMagicShift(LongNumber<Divisor>)
+    {
+        constexpr uint32_t shift = CalculateMagicShift(long_index_t{Divisor});
+
+        return integral_constant<uint32_t, shift>{};
+    }
+
     // magic division for uint32_t
     __device__ static constexpr uint32_t
     DoMagicDivision(uint32_t dividend, uint32_t multiplier, uint32_t shift)
@@ -155,6 +248,77 @@ struct MagicDivision
         uint32_t tmp          = static_cast<uint64_t>(dividend_u32) * multiplier >> 32;
         return (tmp + dividend_u32) >> shift;
     }
+
+    // magic division for long_index_t, with the magic numbers of the long_index_t divisor
+    template <typename Dividend,
+              typename enable_if<is_same<Dividend, long_index_t>::value, bool>::type = false>
+    __host__ __device__ static constexpr long_index_t
+    DoMagicDivision(Dividend dividend, uint64_t multiplier, uint32_t shift)
+    {
+        return DoMagicDivision64(dividend, multiplier, shift);
+    }
+
+    // magic division for any uint32_t dividend, the sum takes 33 bits
+    __device__ static constexpr uint32_t
+    DoMagicDivisionFullRange(uint32_t dividend, uint32_t multiplier, uint32_t shift)
+    {
+        uint32_t tmp = __umulhi(dividend, multiplier);
+        return static_cast<uint32_t>((static_cast<uint64_t>(tmp) + dividend) >> shift);
+    }
+
+    __host__ static constexpr uint32_t
+    DoMagicDivisionFullRange(uint32_t dividend, uint32_t multiplier, uint32_t shift)
+    {
+        uint32_t tmp = static_cast<uint64_t>(dividend) * multiplier >> 32;
+        return static_cast<uint32_t>((static_cast<uint64_t>(tmp) + dividend) >> shift);
+    }
+
+    // magic division for any int32_t dividend by a positive divisor, rounding toward zero
+    __host__ __device__ static constexpr int32_t
+    DoMagicDivisionSigned(int32_t dividend_i32, uint32_t multiplier, uint32_t shift)
+    {
+        const uint32_t dividend_u32 = static_cast<uint32_t>(dividend_i32);
+        const uint32_t abs_dividend = dividend_i32 < 0 ? 0U - dividend_u32 : dividend_u32;
+
+        const uint32_t quotient = DoMagicDivisionFullRange(abs_dividend, multiplier, shift);
+
+        return static_cast<int32_t>(dividend_i32 < 0 ? 0U - quotient : quotient);
+    }
+
+    // high 64 bits of a 64 x 64-bit product
+    __device__ static constexpr uint64_t MulHi64(uint64_t a, uint64_t b)
+    {
+        return __umul64hi(a, b);
+    }
+
+    __host__ static constexpr uint64_t MulHi64(uint64_t a, uint64_t b)
+    {
+        const uint64_t a_lo = a & 0xffffffffU;
+        const uint64_t a_hi = a >> 32;
+        const uint64_t b_lo = b & 0xffffffffU;
+        const uint64_t b_hi = b >> 32;
+
+        const uint64_t lo_lo = a_lo * b_lo;
+        const uint64_t lo_hi = a_lo * b_hi;
+        const uint64_t hi_lo = a_hi * b_lo;
+
+        const uint64_t mid = (lo_lo >> 32) + (lo_hi & 0xffffffffU) + (hi_lo & 0xffffffffU);
+
+        return a_hi * b_hi + (lo_hi >> 32) + (hi_lo >> 32) + (mid >> 32);
+    }
+
+    // magic division for any long_index_t dividend by a divisor within [1, 2^63], rounding toward
+    // zero. The absolute value of the dividend is at most 2^63, so the sum fits into 64 bits.
+    __host__ __device__ static constexpr long_index_t
+    DoMagicDivision64(long_index_t dividend_i64, uint64_t multiplier, uint32_t shift)
+    {
+        const uint64_t dividend_u64 = static_cast<uint64_t>(dividend_i64);
+        const uint64_t abs_dividend = dividend_i64 < 0 ? 0ULL - dividend_u64 : dividend_u64;
+
+        const uint64_t quotient = (MulHi64(abs_dividend, multiplier) + abs_dividend) >> shift;
+
+        return static_cast<long_index_t>(dividend_i64 < 0 ? 0ULL - quotient : quotient);
+    }
 };
 
 struct MDiv
@@ -229,4 +393,44 @@ struct MDiv2
     }
 };
 
+// signed division rounding toward zero, like the / operator, for any int32_t dividend and non-zero
+// divisor (but INT32_MIN / -1)
+struct MDivSigned
+{
+    int32_t divisor;
+    uint32_t multiplier;
+    uint32_t shift;
+
+    // prefer construct on host
+    __host__ __device__ MDivSigned(int32_t divisor_) : divisor(divisor_)
+    {
+        // the absolute value of INT32_MIN is 2^31, which needs the full divisor range
+        const uint32_t divisor_u32 = static_cast<uint32_t>(divisor_);
+
+        auto tmp = MagicDivision::CalculateMagicNumbersFullRange(divisor_ < 0 ? 0U - divisor_u32
+                                                                              : divisor_u32);
+
+        multiplier = tmp[Number<0>{}];
+        shift      = tmp[Number<1>{}];
+    }
+
+    __host__ __device__ MDivSigned() : divisor(0), multiplier(0), shift(0) {}
+
+    __host__ __device__ int32_t div(int32_t dividend_) const
+    {
+        const int32_t quotient = MagicDivision::DoMagicDivisionSigned(dividend_, multiplier, shift);
+
+        return divisor < 0 ? -quotient : quotient;
+    }
+
+    __host__ __device__ void
+    divmod(int32_t dividend_, int32_t& quotient_, int32_t& remainder_) const
+    {
+        quotient_  = div(dividend_);
+        remainder_ = dividend_ - quotient_ * divisor;
+    }
+
+    __host__ __device__ int32_t get() const { return divisor; }
+};
+
 } // namespace ck
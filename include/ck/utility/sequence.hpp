@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <utility>
+
 #include "ck/utility/integral_constant.hpp"
 #include "ck/utility/type.hpp"
 #include "ck/utility/functional.hpp"
@@ -34,6 +36,69 @@ __host__ __device__ constexpr auto sequence_pop_front(Sequence<I, Is...>);
 template <typename Seq>
 __host__ __device__ constexpr auto sequence_pop_back(Seq);
 
+namespace detail {
+
+template <typename T, T... Is>
+struct sequence_from_integer_sequence
+{
+    using type = Sequence<Is...>;
+};
+
+template <typename>
+struct sequence_from_std_integer_sequence;
+
+template <index_t... Is>
+struct sequence_from_std_integer_sequence<std::integer_sequence<index_t, Is...>>
+{
+    using type = Sequence<Is...>;
+};
+
+} // namespace detail
+
+// Sequence<0, 1, ..., N - 1>, made by the compiler builtin instead of recursive instantiation
+#if defined(__clang__)
+template <index_t N>
+using make_index_sequence =
+    typename __make_integer_seq<detail::sequence_from_integer_sequence, index_t, N>::type;
+#else
+template <index_t N>
+using make_index_sequence = typename detail::sequence_from_std_integer_sequence<
+    std::make_integer_sequence<index_t, N>>::type;
+#endif
+
+namespace detail {
+
+// values of a sequence for the constexpr algorithms below, the extra element keeps the array
+// non-empty
+template <index_t N>
+struct sequence_values
+{
+    __host__ __device__ constexpr index_t& operator[](index_t i) { return mData[i]; }
+
+    __host__ __device__ constexpr index_t operator[](index_t i) const { return mData[i]; }
+
+    index_t mData[N + 1];
+};
+
+template <index_t... Is>
+__host__ __device__ constexpr auto make_sequence_values(Sequence<Is...>)
+{
+    return sequence_values<sizeof...(Is)>{{Is..., 0}};
+}
+
+// Values has the static constexpr members value and size, the result is
+// Sequence<Values::value[0], ..., Values::value[Values::size - 1]>
+template <typename Values, typename Ids = make_index_sequence<Values::size>>
+struct sequence_from_values;
+
+template <typename Values, index_t... Ids>
+struct sequence_from_values<Values, Sequence<Ids...>>
+{
+    using type = Sequence<Values::value[Ids]...>;
+};
+
+} // namespace detail
+
 template <index_t... Is>
 struct Sequence
 {
@@ -81,7 +146,7 @@ struct Sequence
 
         static_assert(is_valid_sequence_map<Sequence<IRs...>>::value, "wrong! invalid reorder map");
 
-        return Sequence<Type::At(Number<IRs>{})...>{};
+        return Sequence<Type::At(IRs)...>{};
     }
 
     // MapOld2New is Sequence<...>
@@ -144,13 +209,13 @@ struct Sequence
     template <index_t... Ns>
     __host__ __device__ static constexpr auto Extract(Number<Ns>...)
     {
-        return Sequence<Type::At(Number<Ns>{})...>{};
+        return Sequence<Type::At(Ns)...>{};
     }
 
     template <index_t... Ns>
     __host__ __device__ static constexpr auto Extract(Sequence<Ns...>)
     {
-        return Sequence<Type::At(Number<Ns>{})...>{};
+        return Sequence<Type::At(Ns)...>{};
     }
 
     template <index_t I, index_t X>
@@ -180,11 +245,29 @@ struct Sequence
     }
 };
 
+namespace detail {
+
+template <typename Seq>
+struct sequence_merge_operand
+{
+    using type = Seq;
+};
+
+template <index_t... Xs, index_t... Ys>
+__host__ __device__ constexpr auto operator+(sequence_merge_operand<Sequence<Xs...>>,
+                                             sequence_merge_operand<Sequence<Ys...>>)
+{
+    return sequence_merge_operand<Sequence<Xs..., Ys...>>{};
+}
+
+} // namespace detail
+
 // merge sequence
 template <typename Seq, typename... Seqs>
 struct sequence_merge
 {
-    using type = typename sequence_merge<Seq, typename sequence_merge<Seqs...>::type>::type;
+    using type = typename decltype((detail::sequence_merge_operand<remove_cv_t<Seq>>{} + ... +
+                                    detail::sequence_merge_operand<remove_cv_t<Seqs>>{}))::type;
 };
 
 template <index_t... Xs, index_t... Ys>
@@ -199,95 +282,106 @@ struct sequence_merge<Seq>
     using type = Seq;
 };
 
-// generate sequence
-template <index_t NSize, typename F>
-struct sequence_gen
+namespace detail {
+
+template <typename F, typename Ids>
+struct sequence_gen_impl;
+
+template <typename F, index_t... Is>
+struct sequence_gen_impl<F, Sequence<Is...>>
 {
-    template <index_t IBegin, index_t NRemain, typename G>
-    struct sequence_gen_impl
-    {
-        static constexpr index_t NRemainLeft  = NRemain / 2;
-        static constexpr index_t NRemainRight = NRemain - NRemainLeft;
-        static constexpr index_t IMiddle      = IBegin + NRemainLeft;
+    using type = Sequence<F{}(Number<Is>{})...>;
+};
 
-        using type = typename sequence_merge<
-            typename sequence_gen_impl<IBegin, NRemainLeft, G>::type,
-            typename sequence_gen_impl<IMiddle, NRemainRight, G>::type>::type;
-    };
+template <index_t IBegin, index_t Increment, typename Ids>
+struct arithmetic_sequence_gen_impl;
 
-    template <index_t I, typename G>
-    struct sequence_gen_impl<I, 1, G>
-    {
-        static constexpr index_t Is = G{}(Number<I>{});
-        using type                  = Sequence<Is>;
-    };
+template <index_t IBegin, index_t Increment, index_t... Is>
+struct arithmetic_sequence_gen_impl<IBegin, Increment, Sequence<Is...>>
+{
+    using type = Sequence<(Is * Increment + IBegin)...>;
+};
 
-    template <index_t I, typename G>
-    struct sequence_gen_impl<I, 0, G>
-    {
-        using type = Sequence<>;
-    };
+template <index_t I, typename Ids>
+struct uniform_sequence_gen_impl;
 
-    using type = typename sequence_gen_impl<0, NSize, F>::type;
+template <index_t I, index_t... Is>
+struct uniform_sequence_gen_impl<I, Sequence<Is...>>
+{
+    using type = Sequence<(Is * 0 + I)...>;
+};
+
+} // namespace detail
+
+// generate sequence
+template <index_t NSize, typename F>
+struct sequence_gen
+{
+    using type = typename detail::sequence_gen_impl<F, make_index_sequence<NSize>>::type;
 };
 
 // arithmetic sequence
 template <index_t IBegin, index_t IEnd, index_t Increment>
 struct arithmetic_sequence_gen
 {
-    struct F
-    {
-        __host__ __device__ constexpr index_t operator()(index_t i) const
-        {
-            return i * Increment + IBegin;
-        }
-    };
-
-    using type0 = typename sequence_gen<(IEnd - IBegin) / Increment, F>::type;
-    using type1 = Sequence<>;
-
     static constexpr bool kHasContent =
         (Increment > 0 && IBegin < IEnd) || (Increment < 0 && IBegin > IEnd);
 
-    using type = typename conditional<kHasContent, type0, type1>::type;
+    static constexpr index_t NSize = kHasContent ? (IEnd - IBegin) / Increment : 0;
+
+    using type = typename detail::
+        arithmetic_sequence_gen_impl<IBegin, Increment, make_index_sequence<NSize>>::type;
+};
+
+template <index_t IEnd>
+struct arithmetic_sequence_gen<0, IEnd, 1>
+{
+    using type = make_index_sequence<(IEnd > 0 ? IEnd : 0)>;
 };
 
 // uniform sequence
 template <index_t NSize, index_t I>
 struct uniform_sequence_gen
 {
-    struct F
-    {
-        __host__ __device__ constexpr index_t operator()(index_t) const { return I; }
-    };
-
-    using type = typename sequence_gen<NSize, F>::type;
+    using type = typename detail::uniform_sequence_gen_impl<I, make_index_sequence<NSize>>::type;
 };
 
-// reverse inclusive scan (with init) sequence
-template <typename, typename, index_t>
-struct sequence_reverse_inclusive_scan;
+namespace detail {
 
-template <index_t I, index_t... Is, typename Reduce, index_t Init>
-struct sequence_reverse_inclusive_scan<Sequence<I, Is...>, Reduce, Init>
+template <typename Reduce, index_t Init, index_t... Is>
+__host__ __device__ constexpr auto sequence_reverse_inclusive_scan_values(Sequence<Is...>)
 {
-    using old_scan = typename sequence_reverse_inclusive_scan<Sequence<Is...>, Reduce, Init>::type;
+    constexpr index_t n = sizeof...(Is);
 
-    static constexpr index_t new_reduce = Reduce{}(I, old_scan{}.Front());
+    sequence_values<n> values = make_sequence_values(Sequence<Is...>{});
 
-    using type = typename sequence_merge<Sequence<new_reduce>, old_scan>::type;
-};
+    index_t result = Init;
+
+    for(index_t i = n - 1; i >= 0; --i)
+    {
+        result    = Reduce{}(values[i], result);
+        values[i] = result;
+    }
+
+    return values;
+}
 
-template <index_t I, typename Reduce, index_t Init>
-struct sequence_reverse_inclusive_scan<Sequence<I>, Reduce, Init>
+template <typename Seq, typename Reduce, index_t Init>
+struct sequence_reverse_inclusive_scan_impl
 {
-    using type = Sequence<Reduce{}(I, Init)>;
+    static constexpr index_t size = Seq::Size();
+
+    static constexpr auto value = sequence_reverse_inclusive_scan_values<Reduce, Init>(Seq{});
 };
 
-template <typename Reduce, index_t Init>
-struct sequence_reverse_inclusive_scan<Sequence<>, Reduce, Init>
+} // namespace detail
+
+// reverse inclusive scan (with init) sequence
+template <typename Seq, typename Reduce, index_t Init>
+struct sequence_reverse_inclusive_scan
 {
-    using type = Sequence<>;
+    using type = typename detail::sequence_from_values<
+        detail::sequence_reverse_inclusive_scan_impl<Seq, Reduce, Init>>::type;
 };
 
 // split sequence
@@ -303,28 +397,40 @@ struct sequence_split
     using right_type = decltype(Seq::Extract(range1{}));
 };
 
-// reverse sequence
-template <typename Seq>
-struct sequence_reverse
+namespace detail {
+
+template <index_t... Is>
+__host__ __device__ constexpr auto sequence_reverse_values(Sequence<Is...>)
 {
-    static constexpr index_t NSize = Seq{}.Size();
+    constexpr index_t n = sizeof...(Is);
 
-    using seq_split = sequence_split<Seq, NSize / 2>;
-    using type      = typename sequence_merge<
-        typename sequence_reverse<typename seq_split::right_type>::type,
-        typename sequence_reverse<typename seq_split::left_type>::type>::type;
-};
+    const auto values = make_sequence_values(Sequence<Is...>{});
+
+    sequence_values<n> reversed{};
+
+    for(index_t i = 0; i < n; ++i)
+    {
+        reversed[i] = values[n - 1 - i];
+    }
+
+    return reversed;
+}
 
-template <index_t I>
-struct sequence_reverse<Sequence<I>>
+template <typename Seq>
+struct sequence_reverse_impl
 {
-    using type = Sequence<I>;
+    static constexpr index_t size = Seq::Size();
+
+    static constexpr auto value = sequence_reverse_values(Seq{});
 };
 
-template <index_t I0, index_t I1>
-struct sequence_reverse<Sequence<I0, I1>>
+} // namespace detail
+
+// reverse sequence
+template <typename Seq>
+struct sequence_reverse
 {
-    using type = Sequence<I1, I0>;
+    using type = typename detail::sequence_from_values<detail::sequence_reverse_impl<Seq>>::type;
 };
 
 #if 1
@@ -349,269 +455,189 @@ struct sequence_reduce<Reduce, Seq>
 };
 #endif
 
-template <typename Values, typename Ids, typename Compare>
-struct sequence_sort_impl
+namespace detail {
+
+// merge sort of values[begin, end) along with their ids. A value of the left half is taken first
+// only if it compares less, like the former recursive implementation.
+template <typename Compare, index_t N>
+__host__ __device__ constexpr void sort_sequence_values(sequence_values<N>& values,
+                                                        sequence_values<N>& ids,
+                                                        index_t begin,
+                                                        index_t end)
 {
-    template <typename LeftValues,
-              typename LeftIds,
-              typename RightValues,
-              typename RightIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl
-    {
-        static constexpr bool choose_left = LeftValues::Front() < RightValues::Front();
-
-        static constexpr index_t chosen_value =
-            choose_left ? LeftValues::Front() : RightValues::Front();
-        static constexpr index_t chosen_id = choose_left ? LeftIds::Front() : RightIds::Front();
-
-        using new_merged_values = decltype(MergedValues::PushBack(Number<chosen_value>{}));
-        using new_merged_ids    = decltype(MergedIds::PushBack(Number<chosen_id>{}));
-
-        using new_left_values =
-            typename conditional<choose_left, decltype(LeftValues::PopFront()), LeftValues>::type;
-        using new_left_ids =
-            typename conditional<choose_left, decltype(LeftIds::PopFront()), LeftIds>::type;
-
-        using new_right_values =
-            typename conditional<choose_left, RightValues, decltype(RightValues::PopFront())>::type;
-        using new_right_ids =
-            typename conditional<choose_left, RightIds, decltype(RightIds::PopFront())>::type;
-
-        using merge = sorted_sequence_merge_impl<new_left_values,
-                                                 new_left_ids,
-                                                 new_right_values,
-                                                 new_right_ids,
-                                                 new_merged_values,
-                                                 new_merged_ids,
-                                                 Comp>;
-        // this is output
-        using merged_values = typename merge::merged_values;
-        using merged_ids    = typename merge::merged_ids;
-    };
+    if(end - begin < 2)
+    {
+        return;
+    }
 
-    template <typename LeftValues,
-              typename LeftIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl<LeftValues,
-                                      LeftIds,
-                                      Sequence<>,
-                                      Sequence<>,
-                                      MergedValues,
-                                      MergedIds,
-                                      Comp>
-    {
-        using merged_values = typename sequence_merge<MergedValues, LeftValues>::type;
-        using merged_ids    = typename sequence_merge<MergedIds, LeftIds>::type;
-    };
+    const index_t middle = begin + (end - begin) / 2;
 
-    template <typename RightValues,
-              typename RightIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl<Sequence<>,
-                                      Sequence<>,
-                                      RightValues,
-                                      RightIds,
-                                      MergedValues,
-                                      MergedIds,
-                                      Comp>
-    {
-        using merged_values = typename sequence_merge<MergedValues, RightValues>::type;
-        using merged_ids    = typename sequence_merge<MergedIds, RightIds>::type;
-    };
+    sort_sequence_values<Compare>(values, ids, begin, middle);
+    sort_sequence_values<Compare>(values, ids, middle, end);
 
-    template <typename LeftValues,
-              typename LeftIds,
-              typename RightValues,
-              typename RightIds,
-              typename Comp>
-    struct sorted_sequence_merge
-    {
-        using merge = sorted_sequence_merge_impl<LeftValues,
-                                                 LeftIds,
-                                                 RightValues,
-                                                 RightIds,
-                                                 Sequence<>,
-                                                 Sequence<>,
-                                                 Comp>;
-
-        using merged_values = typename merge::merged_values;
-        using merged_ids    = typename merge::merged_ids;
-    };
+    sequence_values<N> merged_values{};
+    sequence_values<N> merged_ids{};
 
-    static constexpr index_t nsize = Values::Size();
+    index_t left  = begin;
+    index_t right = middle;
 
-    using split_unsorted_values = sequence_split<Values, nsize / 2>;
-    using split_unsorted_ids    = sequence_split<Ids, nsize / 2>;
+    for(index_t i = 0; i < end - begin; ++i)
+    {
+        const bool choose_left =
+            right == end || (left < middle && Compare{}(values[left], values[right]));
 
-    using left_unsorted_values = typename split_unsorted_values::left_type;
-    using left_unsorted_ids    = typename split_unsorted_ids::left_type;
-    using left_sort          = sequence_sort_impl<left_unsorted_values, left_unsorted_ids, Compare>;
-    using left_sorted_values = typename left_sort::sorted_values;
-    using left_sorted_ids    = typename left_sort::sorted_ids;
+        const index_t chosen = choose_left ? left++ : right++;
 
-    using right_unsorted_values = typename split_unsorted_values::right_type;
-    using right_unsorted_ids    = typename split_unsorted_ids::right_type;
-    using right_sort = sequence_sort_impl<right_unsorted_values, right_unsorted_ids, Compare>;
-    using right_sorted_values = typename right_sort::sorted_values;
-    using right_sorted_ids    = typename right_sort::sorted_ids;
+        merged_values[i] = values[chosen];
+        merged_ids[i]    = ids[chosen];
+    }
 
-    using merged_sorted = sorted_sequence_merge<left_sorted_values,
-                                                left_sorted_ids,
-                                                right_sorted_values,
-                                                right_sorted_ids,
-                                                Compare>;
+    for(index_t i = 0; i < end - begin; ++i)
+    {
+        values[begin + i] = merged_values[i];
+        ids[begin + i]    = merged_ids[i];
+    }
+}
 
-    using sorted_values = typename merged_sorted::merged_values;
-    using sorted_ids    = typename merged_sorted::merged_ids;
+template <index_t N>
+struct sorted_sequence_values
+{
+    sequence_values<N> values;
+    sequence_values<N> ids;
+    index_t size;
 };
 
-template <index_t ValueX, index_t ValueY, index_t IdX, index_t IdY, typename Compare>
-struct sequence_sort_impl<Sequence<ValueX, ValueY>, Sequence<IdX, IdY>, Compare>
+// sorted values and their ids in the unsorted sequence, without the repeated values if Unique
+template <typename Less, typename Equal, bool Unique, index_t... Is>
+__host__ __device__ constexpr auto sort_sequence(Sequence<Is...>)
 {
-    static constexpr bool choose_x = Compare{}(ValueX, ValueY);
+    constexpr index_t n = sizeof...(Is);
 
-    using sorted_values =
-        typename conditional<choose_x, Sequence<ValueX, ValueY>, Sequence<ValueY, ValueX>>::type;
-    using sorted_ids = typename conditional<choose_x, Sequence<IdX, IdY>, Sequence<IdY, IdX>>::type;
-};
+    sorted_sequence_values<n> sorted{make_sequence_values(Sequence<Is...>{}),
+                                     make_sequence_values(make_index_sequence<n>{}),
+                                     n};
 
-template <index_t Value, index_t Id, typename Compare>
-struct sequence_sort_impl<Sequence<Value>, Sequence<Id>, Compare>
-{
-    using sorted_values = Sequence<Value>;
-    using sorted_ids    = Sequence<Id>;
-};
+    sort_sequence_values<Less>(sorted.values, sorted.ids, 0, n);
 
-template <typename Compare>
-struct sequence_sort_impl<Sequence<>, Sequence<>, Compare>
-{
-    using sorted_values = Sequence<>;
-    using sorted_ids    = Sequence<>;
-};
+    if(Unique && n > 0)
+    {
+        sorted.size = 1;
 
-template <typename Values, typename Compare>
-struct sequence_sort
+        for(index_t i = 1; i < n; ++i)
+        {
+            if(!Equal{}(sorted.values[i], sorted.values[sorted.size - 1]))
+            {
+                sorted.values[sorted.size] = sorted.values[i];
+                sorted.ids[sorted.size]    = sorted.ids[i];
+                ++sorted.size;
+            }
+        }
+    }
+
+    return sorted;
+}
+
+template <typename Values, typename Less, typename Equal, bool Unique>
+struct sequence_sort_impl
 {
-    using unsorted_ids = typename arithmetic_sequence_gen<0, Values::Size(), 1>::type;
-    using sort         = sequence_sort_impl<Values, unsorted_ids, Compare>;
+    static constexpr auto sorted = sort_sequence<Less, Equal, Unique>(Values{});
 
-    // this is output
-    using type                = typename sort::sorted_values;
-    using sorted2unsorted_map = typename sort::sorted_ids;
+    struct sorted_values
+    {
+        static constexpr index_t size = sorted.size;
+        static constexpr auto value   = sorted.values;
+    };
+
+    struct sorted_ids
+    {
+        static constexpr index_t size = sorted.size;
+        static constexpr auto value   = sorted.ids;
+    };
+
+    using type                = typename sequence_from_values<sorted_values>::type;
+    using sorted2unsorted_map = typename sequence_from_values<sorted_ids>::type;
 };
 
-template <typename Values, typename Less, typename Equal>
-struct sequence_unique_sort
+template <index_t... Is>
+__host__ __device__ constexpr bool is_valid_sequence_map_values(Sequence<Is...>)
 {
-    template <typename RemainValues,
-              typename RemainIds,
-              typename UniquifiedValues,
-              typename UniquifiedIds,
-              typename Eq>
-    struct sorted_sequence_uniquify_impl
-    {
-        static constexpr index_t current_value = RemainValues::Front();
-        static constexpr index_t current_id    = RemainIds::Front();
+    constexpr index_t n = sizeof...(Is);
+
+    const auto values = make_sequence_values(Sequence<Is...>{});
 
-        static constexpr bool is_unique_value = (current_value != UniquifiedValues::Back());
+    bool found[n + 1] = {};
+
+    for(index_t i = 0; i < n; ++i)
+    {
+        if(values[i] < 0 || values[i] >= n || found[values[i]])
+        {
+            return false;
+        }
 
-        using new_remain_values = decltype(RemainValues::PopFront());
-        using new_remain_ids    = decltype(RemainIds::PopFront());
+        found[values[i]] = true;
+    }
 
-        using new_uniquified_values =
-            typename conditional<is_unique_value,
-                                 decltype(UniquifiedValues::PushBack(Number<current_value>{})),
-                                 UniquifiedValues>::type;
+    return true;
+}
 
-        using new_uniquified_ids =
-            typename conditional<is_unique_value,
-                                 decltype(UniquifiedIds::PushBack(Number<current_id>{})),
-                                 UniquifiedIds>::type;
+template <index_t... Is>
+__host__ __device__ constexpr auto sequence_map_inverse_values(Sequence<Is...>)
+{
+    constexpr index_t n = sizeof...(Is);
 
-        using uniquify = sorted_sequence_uniquify_impl<new_remain_values,
-                                                       new_remain_ids,
-                                                       new_uniquified_values,
-                                                       new_uniquified_ids,
-                                                       Eq>;
+    const auto x2y = make_sequence_values(Sequence<Is...>{});
 
-        // this is output
-        using uniquified_values = typename uniquify::uniquified_values;
-        using uniquified_ids    = typename uniquify::uniquified_ids;
-    };
+    sequence_values<n> y2x{};
 
-    template <typename UniquifiedValues, typename UniquifiedIds, typename Eq>
-    struct sorted_sequence_uniquify_impl<Sequence<>,
-                                         Sequence<>,
-                                         UniquifiedValues,
-                                         UniquifiedIds,
-                                         Eq>
+    for(index_t x = 0; x < n; ++x)
     {
-        using uniquified_values = UniquifiedValues;
-        using uniquified_ids    = UniquifiedIds;
-    };
+        y2x[x2y[x]] = x;
+    }
 
-    template <typename SortedValues, typename SortedIds, typename Eq>
-    struct sorted_sequence_uniquify
-    {
-        using uniquify = sorted_sequence_uniquify_impl<decltype(SortedValues::PopFront()),
-                                                       decltype(SortedIds::PopFront()),
-                                                       Sequence<SortedValues::Front()>,
-                                                       Sequence<SortedIds::Front()>,
-                                                       Eq>;
+    return y2x;
+}
 
-        using uniquified_values = typename uniquify::uniquified_values;
-        using uniquified_ids    = typename uniquify::uniquified_ids;
-    };
+template <typename SeqMap>
+struct sequence_map_inverse_impl
+{
+    static constexpr index_t size = SeqMap::Size();
+
+    static constexpr auto value = sequence_map_inverse_values(SeqMap{});
+};
 
-    using sort          = sequence_sort<Values, Less>;
-    using sorted_values = typename sort::type;
-    using sorted_ids    = typename sort::sorted2unsorted_map;
+} // namespace detail
 
-    using uniquify = sorted_sequence_uniquify<sorted_values, sorted_ids, Equal>;
+template <typename Values, typename Compare>
+struct sequence_sort
+{
+    using sort = detail::sequence_sort_impl<Values, Compare, math::equal<index_t>, false>;
 
     // this is output
-    using type                = typename uniquify::uniquified_values;
-    using sorted2unsorted_map = typename uniquify::uniquified_ids;
+    using type                = typename sort::type;
+    using sorted2unsorted_map = typename sort::sorted2unsorted_map;
+};
+
+template <typename Values, typename Less, typename Equal>
+struct sequence_unique_sort
+{
+    using sort = detail::sequence_sort_impl<Values, Less, Equal, true>;
+
+    // this is output
+    using type                = typename sort::type;
+    using sorted2unsorted_map = typename sort::sorted2unsorted_map;
 };
 
 template <typename SeqMap>
-struct is_valid_sequence_map : is_same<typename arithmetic_sequence_gen<0, SeqMap::Size(), 1>::type,
-                                       typename sequence_sort<SeqMap, math::less<index_t>>::type>
+struct is_valid_sequence_map
+    : integral_constant<bool, detail::is_valid_sequence_map_values(SeqMap{})>
 {
 };
 
 template <typename SeqMap>
 struct sequence_map_inverse
 {
-    template <typename X2Y, typename WorkingY2X, index_t XBegin, index_t XRemain>
-    struct sequence_map_inverse_impl
-    {
-        static constexpr auto new_y2x =
-            WorkingY2X::Modify(X2Y::At(Number<XBegin>{}), Number<XBegin>{});
-
-        using type =
-            typename sequence_map_inverse_impl<X2Y, decltype(new_y2x), XBegin + 1, XRemain - 1>::
-                type;
-    };
-
-    template <typename X2Y, typename WorkingY2X, index_t XBegin>
-    struct sequence_map_inverse_impl<X2Y, WorkingY2X, XBegin, 0>
-    {
-        using type = WorkingY2X;
-    };
-
     using type =
-        typename sequence_map_inverse_impl<SeqMap,
-                                           typename uniform_sequence_gen<SeqMap::Size(), 0>::type,
-                                           0,
-                                           SeqMap::Size()>::type;
+        typename detail::sequence_from_values<detail::sequence_map_inverse_impl<SeqMap>>::type;
 };
 
 template <index_t... Xs, index_t... Ys>
@@ -730,7 +756,7 @@ template <typename Seq>
 __host__ __device__ constexpr auto sequence_pop_back(Seq)
 {
     static_assert(Seq::Size() > 0, "wrong! cannot pop an empty Sequence!");
-    return sequence_pop_front(Seq::Reverse()).Reverse();
+    return Seq::Extract(make_index_sequence<Seq::Size() - 1>{});
 }
 
 template <typename... Seqs>
@@ -789,64 +815,88 @@ __host__ __device__ constexpr auto pick_sequence_elements_by_ids(Seq, Sequence<I
     return Sequence<Seq::At(Number<Is>{})...>{};
 }
 
-#if 1
 namespace detail {
-template <typename WorkSeq, typename RemainSeq, typename RemainMask>
-struct pick_sequence_elements_by_mask_impl
-{
-    using new_work_seq = typename conditional<RemainMask::Front(),
-                                              decltype(WorkSeq::PushBack(RemainSeq::Front())),
-                                              WorkSeq>::type;
 
-    using type =
-        typename pick_sequence_elements_by_mask_impl<new_work_seq,
-                                                     decltype(RemainSeq::PopFront()),
-                                                     decltype(RemainMask::PopFront())>::type;
+template <index_t N>
+struct picked_sequence_values
+{
+    sequence_values<N> values;
+    index_t size;
 };
 
-template <typename WorkSeq>
-struct pick_sequence_elements_by_mask_impl<WorkSeq, Sequence<>, Sequence<>>
+template <typename Seq, typename Mask>
+__host__ __device__ constexpr auto pick_sequence_values_by_mask()
 {
-    using type = WorkSeq;
-};
+    constexpr index_t n = Seq::Size();
 
-} // namespace detail
+    const auto values = make_sequence_values(Seq{});
+    const auto mask   = make_sequence_values(Mask{});
+
+    picked_sequence_values<n> picked{};
+
+    for(index_t i = 0; i < n; ++i)
+    {
+        if(mask[i])
+        {
+            picked.values[picked.size++] = values[i];
+        }
+    }
+
+    return picked;
+}
 
 template <typename Seq, typename Mask>
-__host__ __device__ constexpr auto pick_sequence_elements_by_mask(Seq, Mask)
+struct pick_sequence_elements_by_mask_impl
 {
-    static_assert(Seq::Size() == Mask::Size(), "wrong!");
+    static constexpr auto picked = pick_sequence_values_by_mask<Seq, Mask>();
+
+    static constexpr index_t size = picked.size;
+    static constexpr auto value   = picked.values;
+};
+
+template <typename Seq, typename Values, typename Ids>
+__host__ __device__ constexpr auto modify_sequence_values_by_ids()
+{
+    auto result = make_sequence_values(Seq{});
+
+    const auto values = make_sequence_values(Values{});
+    const auto ids    = make_sequence_values(Ids{});
+
+    for(index_t i = 0; i < Values::Size(); ++i)
+    {
+        result[ids[i]] = values[i];
+    }
 
-    return typename detail::pick_sequence_elements_by_mask_impl<Sequence<>, Seq, Mask>::type{};
+    return result;
 }
 
-namespace detail {
-template <typename WorkSeq, typename RemainValues, typename RemainIds>
+template <typename Seq, typename Values, typename Ids>
 struct modify_sequence_elements_by_ids_impl
 {
-    using new_work_seq = decltype(WorkSeq::Modify(RemainIds::Front(), RemainValues::Front()));
+    static constexpr index_t size = Seq::Size();
 
-    using type =
-        typename modify_sequence_elements_by_ids_impl<new_work_seq,
-                                                      decltype(RemainValues::PopFront()),
-                                                      decltype(RemainIds::PopFront())>::type;
+    static constexpr auto value = modify_sequence_values_by_ids<Seq, Values, Ids>();
 };
 
-template <typename WorkSeq>
-struct modify_sequence_elements_by_ids_impl<WorkSeq, Sequence<>, Sequence<>>
-{
-    using type = WorkSeq;
-};
 } // namespace detail
 
+template <typename Seq, typename Mask>
+__host__ __device__ constexpr auto pick_sequence_elements_by_mask(Seq, Mask)
+{
+    static_assert(Seq::Size() == Mask::Size(), "wrong!");
+
+    return typename detail::sequence_from_values<
+        detail::pick_sequence_elements_by_mask_impl<Seq, Mask>>::type{};
+}
+
 template <typename Seq, typename Values, typename Ids>
 __host__ __device__ constexpr auto modify_sequence_elements_by_ids(Seq, Values, Ids)
 {
     static_assert(Values::Size() == Ids::Size() && Seq::Size() >= Values::Size(), "wrong!");
 
-    return typename detail::modify_sequence_elements_by_ids_impl<Seq, Values, Ids>::type{};
+    return typename detail::sequence_from_values<
+        detail::modify_sequence_elements_by_ids_impl<Seq, Values, Ids>>::type{};
 }
-#endif
 
 template <typename Seq, typename Reduce, index_t Init>
 __host__ __device__ constexpr index_t
@@ -113,10 +113,9 @@ struct TupleImpl<Sequence<Is...>, Xs...> : TupleElementKeyData<TupleElementKey<I
 } // namespace detail
 
 template <typename... Xs>
-struct Tuple : detail::TupleImpl<typename arithmetic_sequence_gen<0, sizeof...(Xs), 1>::type, Xs...>
+struct Tuple : detail::TupleImpl<make_index_sequence<sizeof...(Xs)>, Xs...>
 {
-    using base =
-        detail::TupleImpl<typename arithmetic_sequence_gen<0, sizeof...(Xs), 1>::type, Xs...>;
+    using base = detail::TupleImpl<make_index_sequence<sizeof...(Xs)>, Xs...>;
 
     __host__ __device__ constexpr Tuple() = default;
 
@@ -204,6 +203,15 @@ struct tuple_element
     using type = decltype(detail::get_tuple_element_data<detail::TupleElementKey<I>>(TTuple{}));
 };
 
+#if defined(__clang__)
+// element type by the compiler builtin, instead of overload resolution over the tuple bases
+template <index_t I, typename... Xs>
+struct tuple_element<I, Tuple<Xs...>>
+{
+    using type = __type_pack_element<I, Xs...>;
+};
+#endif
+
 template <index_t I, typename TTuple>
 using tuple_element_t = typename tuple_element<I, TTuple>::type;
 
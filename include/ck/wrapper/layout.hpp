@@ -239,7 +239,7 @@ struct Layout
      * \return Layout object.
      */
     __host__ __device__ Layout() = delete;
-    __host__ __device__ Layout(const Shape& shape, const Strides& strides) : descriptor_{}
+    __host__ __device__ constexpr Layout(const Shape& shape, const Strides& strides) : descriptor_{}
     {
         // Construct if runtime mode
         if constexpr(!NaiveDescriptorType::IsKnownAtCompileTime())
@@ -250,7 +250,7 @@ struct Layout
         }
     }
 
-    __host__ __device__ Layout(const Shape& shape) : descriptor_{}
+    __host__ __device__ constexpr Layout(const Shape& shape) : descriptor_{}
     {
         if constexpr(!NaiveDescriptorType::IsKnownAtCompileTime())
         {
@@ -281,11 +281,20 @@ struct Layout
      * \return Calculated offset.
      */
     template <typename... Ts>
-    __host__ __device__ index_t operator()(const Tuple<Ts...>& Idx) const
+    __host__ __device__ constexpr index_t operator()(const Tuple<Ts...>& Idx) const
     {
-        // Static to construct transformed_desc only once
-        static const auto transformed_desc = TransformDesc(shape_, Idx);
-        return transformed_desc.CalculateOffset(UnrollNestedTuple(Idx));
+        if constexpr(!IsNestedTuple(Tuple<Ts...>{}) &&
+                     Tuple<Ts...>::Size() == NaiveDescriptorType::GetNumOfDimension())
+        {
+            // Flat index over all dims, the naive descriptor is enough
+            return descriptor_.CalculateOffset(Idx);
+        }
+        else
+        {
+            // Transformed per call, the shape is a runtime value which may differ between layouts
+            const auto transformed_desc = TransformDesc(shape_, Idx);
+            return transformed_desc.CalculateOffset(UnrollNestedTuple(Idx));
+        }
     }
 
     /**
@@ -322,6 +331,17 @@ struct Layout
                                                             unrolled_shape);
     }
 
+    /**
+     * \brief Number of elements between the first and past the last element
+     *        (differs from size for strided layouts).
+     *
+     * \return Calculated element space size.
+     */
+    __host__ __device__ constexpr auto GetElementSpaceSize() const
+    {
+        return descriptor_.GetElementSpaceSize();
+    }
+
     /**
      * \brief Shape getter.
      *
@@ -0,0 +1,553 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/wrapper/layout.hpp"
+
+#include "ck/utility/is_known_at_compile_time.hpp"
+
+// Layout algebra on wrapper layouts, seen as functions from the column-major 1d index to the
+// offset. Static layouts (Number<> shape and strides) are evaluated during compilation and give
+// static layouts, so no index math is left at run time. A few forms also take runtime layouts:
+// composition with a single-mode layout and the by-mode divides of single-mode dims by shapes.
+
+namespace ck {
+namespace wrapper {
+
+// Disable from doxygen docs generation
+/// @cond
+namespace detail {
+
+constexpr index_t max_static_modes = 32;
+
+// Flat list of (shape, stride) modes, evaluated in constexpr functions
+struct StaticModes
+{
+    index_t shape[max_static_modes]  = {};
+    index_t stride[max_static_modes] = {};
+    index_t size                     = 0;
+    // false if the operation is not defined for the input
+    bool valid = true;
+
+    constexpr void Append(index_t s, index_t d)
+    {
+        shape[size]  = s;
+        stride[size] = d;
+        size++;
+    }
+
+    constexpr index_t GetSize() const
+    {
+        index_t result = 1;
+        for(index_t i = 0; i < size; i++)
+            result *= shape[i];
+        return result;
+    }
+
+    constexpr index_t GetCosize() const
+    {
+        index_t result = 1;
+        for(index_t i = 0; i < size; i++)
+            result += (shape[i] - 1) * stride[i];
+        return result;
+    }
+
+    // Indices of the modes sorted by stride
+    constexpr void SortByStride(index_t (&order)[max_static_modes]) const
+    {
+        for(index_t i = 0; i < size; i++)
+            order[i] = i;
+        for(index_t i = 0; i < size; i++)
+        {
+            for(index_t j = i + 1; j < size; j++)
+            {
+                if(stride[order[j]] < stride[order[i]] ||
+                   (stride[order[j]] == stride[order[i]] && shape[order[j]] < shape[order[i]]))
+                {
+                    const index_t tmp = order[i];
+                    order[i]          = order[j];
+                    order[j]          = tmp;
+                }
+            }
+        }
+    }
+};
+
+template <typename T>
+struct StaticValues;
+
+template <typename... Ts>
+struct StaticValues<Tuple<Ts...>>
+{
+    // trailing 0, as arrays cannot be empty
+    static constexpr index_t values[sizeof...(Ts) + 1] = {remove_cvref_t<Ts>::value..., 0};
+};
+
+template <typename Shape, typename Strides>
+constexpr StaticModes GetStaticModes()
+{
+    using UnrolledShape   = remove_cvref_t<decltype(UnrollNestedTuple(Shape{}))>;
+    using UnrolledStrides = remove_cvref_t<decltype(UnrollNestedTuple(Strides{}))>;
+    static_assert(UnrolledShape::Size() == UnrolledStrides::Size(),
+                  "Size of strides and shape are not consistent.");
+    static_assert(UnrolledShape::Size() <= max_static_modes, "Too many modes");
+
+    StaticModes modes;
+    for(index_t i = 0; i < UnrolledShape::Size(); i++)
+    {
+        modes.Append(StaticValues<UnrolledShape>::values[i],
+                     StaticValues<UnrolledStrides>::values[i]);
+    }
+    return modes;
+}
+
+// Drops size-1 modes and merges neighbouring modes which continue each other
+constexpr StaticModes Coalesce(const StaticModes& in)
+{
+    StaticModes out;
+    for(index_t i = 0; i < in.size; i++)
+    {
+        if(in.shape[i] == 1)
+            continue;
+
+        if(out.size > 0 && out.shape[out.size - 1] * out.stride[out.size - 1] == in.stride[i])
+            out.shape[out.size - 1] *= in.shape[i];
+        else
+            out.Append(in.shape[i], in.stride[i]);
+    }
+    if(out.size == 0)
+        out.Append(1, 0);
+    return out;
+}
+
+// Modes of a o (s : d), a is coalesced. The stride d is divided out of the modes of a, then
+// the shape s is taken from what is left, the last mode of a is unbounded.
+constexpr StaticModes ComposeMode(const StaticModes& a, index_t s, index_t d)
+{
+    StaticModes out;
+    index_t rest_shape  = s;
+    index_t rest_stride = d;
+
+    if(d == 0 || s == 1)
+    {
+        out.Append(s, 0);
+        return out;
+    }
+
+    for(index_t k = 0; k < a.size && rest_shape > 1; k++)
+    {
+        if(k == a.size - 1)
+        {
+            out.Append(rest_shape, rest_stride * a.stride[k]);
+            break;
+        }
+        if(rest_stride >= a.shape[k])
+        {
+            // stride skips the whole mode
+            out.valid &= rest_stride % a.shape[k] == 0;
+            rest_stride /= a.shape[k];
+            continue;
+        }
+
+        out.valid &= a.shape[k] % rest_stride == 0;
+
+        const index_t available = a.shape[k] / rest_stride;
+        const index_t taken     = available < rest_shape ? available : rest_shape;
+        out.valid &= rest_shape % taken == 0;
+
+        out.Append(taken, rest_stride * a.stride[k]);
+        rest_shape /= taken;
+        rest_stride = 1;
+    }
+
+    StaticModes result = Coalesce(out);
+    result.valid       = out.valid;
+    return result;
+}
+
+// Modes which fill the holes of a up to cosize_hi, ordered by stride
+constexpr StaticModes Complement(const StaticModes& in, index_t cosize_hi)
+{
+    const StaticModes a = Coalesce(in);
+    index_t order[max_static_modes] = {};
+    a.SortByStride(order);
+
+    StaticModes out;
+    index_t current = 1;
+    for(index_t i = 0; i < a.size; i++)
+    {
+        const index_t s = a.shape[order[i]];
+        const index_t d = a.stride[order[i]];
+        if(d == 0 || s == 1)
+            continue;
+        // not injective, no complement
+        out.valid &= d % current == 0;
+        out.Append(d / current, current);
+        current = s * d;
+    }
+    out.Append((cosize_hi + current - 1) / current, current);
+
+    StaticModes result = Coalesce(out);
+    result.valid       = out.valid;
+    return result;
+}
+
+// Modes of r with a(r(i)) == i for the longest contiguous range of a's image from 0
+constexpr StaticModes RightInverse(const StaticModes& in)
+{
+    const StaticModes a = Coalesce(in);
+    index_t order[max_static_modes] = {};
+    a.SortByStride(order);
+
+    // column-major strides of the modes in the domain of a
+    index_t domain_stride[max_static_modes] = {};
+    index_t product                         = 1;
+    for(index_t i = 0; i < a.size; i++)
+    {
+        domain_stride[i] = product;
+        product *= a.shape[i];
+    }
+
+    StaticModes out;
+    index_t current = 1;
+    for(index_t i = 0; i < a.size; i++)
+    {
+        if(a.stride[order[i]] == 0)
+            continue;
+        if(a.stride[order[i]] != current)
+            break;
+        out.Append(a.shape[order[i]], domain_stride[order[i]]);
+        current *= a.shape[order[i]];
+    }
+
+    return Coalesce(out);
+}
+
+// Static values of the algebra, held in types so that they can be template arguments
+template <typename Shape, typename Strides>
+struct LayoutModes
+{
+    static constexpr StaticModes value = GetStaticModes<Shape, Strides>();
+};
+
+template <typename Modes>
+struct CoalescedModes
+{
+    static constexpr StaticModes value = Coalesce(Modes::value);
+};
+
+template <typename Modes, index_t S, index_t D>
+struct ComposedModes
+{
+    static constexpr StaticModes value = ComposeMode(Coalesce(Modes::value), S, D);
+    static_assert(value.valid, "Divisibility conditions of composition not met");
+};
+
+template <typename Modes, index_t CosizeHi>
+struct ComplementModes
+{
+    static constexpr StaticModes value = Complement(Modes::value, CosizeHi);
+    static_assert(value.valid, "Complement needs an injective layout");
+};
+
+template <typename Modes>
+struct RightInverseModes
+{
+    static constexpr StaticModes value = RightInverse(Modes::value);
+};
+
+template <typename Modes>
+__host__ __device__ constexpr auto MakeStaticShape()
+{
+    return generate_tuple([](auto i) { return Number<Modes::value.shape[i.value]>{}; },
+                          Number<Modes::value.size>{});
+}
+
+template <typename Modes>
+__host__ __device__ constexpr auto MakeStaticStrides()
+{
+    return generate_tuple([](auto i) { return Number<Modes::value.stride[i.value]>{}; },
+                          Number<Modes::value.size>{});
+}
+
+// (shape, strides) of a mode, a single mode is not wrapped in a tuple
+template <typename Modes>
+__host__ __device__ constexpr auto MakeStaticMode()
+{
+    if constexpr(Modes::value.size == 1)
+    {
+        return make_tuple(Number<Modes::value.shape[0]>{}, Number<Modes::value.stride[0]>{});
+    }
+    else
+    {
+        return make_tuple(MakeStaticShape<Modes>(), MakeStaticStrides<Modes>());
+    }
+}
+
+template <typename T>
+__host__ __device__ constexpr bool IsStatic()
+{
+    return is_known_at_compile_time<remove_cvref_t<T>>::value;
+}
+
+template <typename Shape>
+__host__ __device__ constexpr index_t GetRank(const Shape&)
+{
+    if constexpr(is_detected<is_tuple, Shape>::value)
+        return decltype(UnrollNestedTuple(Shape{}))::Size();
+    else
+        return 1;
+}
+
+// Tuple of the first (I == 0) or second (I == 1) element of the pairs
+template <index_t I, typename... Pairs>
+__host__ __device__ constexpr auto GetPairElements(const Tuple<Pairs...>& pairs)
+{
+    return generate_tuple([&](auto i) { return pairs.At(i).At(Number<I>{}); },
+                          Number<sizeof...(Pairs)>{});
+}
+
+// (shape, strides) of a o b, b is kept hierarchical
+template <typename AShape, typename AStrides, typename BShape, typename BStrides>
+__host__ __device__ constexpr auto ComposeImpl(const AShape& a_shape,
+                                               const AStrides& a_strides,
+                                               const BShape& b_shape,
+                                               const BStrides& b_strides)
+{
+    if constexpr(is_detected<is_tuple, BShape>::value)
+    {
+        // Composition distributes over the modes of b
+        const auto modes = generate_tuple(
+            [&](auto i) { return ComposeImpl(a_shape, a_strides, b_shape.At(i), b_strides.At(i)); },
+            Number<BShape::Size()>{});
+        return make_tuple(GetPairElements<0>(modes), GetPairElements<1>(modes));
+    }
+    else if constexpr(GetRank(AShape{}) == 1)
+    {
+        // Single-mode a only scales the stride, also at run time
+        const auto a_stride = [&]() {
+            if constexpr(is_detected<is_tuple, AStrides>::value)
+                return UnrollNestedTuple(a_strides).At(Number<0>{});
+            else
+                return a_strides;
+        }();
+        return make_tuple(b_shape, b_strides * a_stride);
+    }
+    else
+    {
+        static_assert(IsStatic<AShape>() && IsStatic<AStrides>() && IsStatic<BShape>() &&
+                          IsStatic<BStrides>(),
+                      "Composition with multi-mode layout needs static layouts");
+        using AModes = LayoutModes<remove_cvref_t<decltype(make_tuple(a_shape))>,
+                                   remove_cvref_t<decltype(make_tuple(a_strides))>>;
+        return MakeStaticMode<ComposedModes<AModes, BShape::value, BStrides::value>>();
+    }
+}
+
+// (shape, strides) of the divide of a single dim by the tile
+template <typename Shape, typename Stride, typename Tile>
+__host__ __device__ constexpr auto DivideModeImpl(const Shape& shape,
+                                                  const Stride& stride,
+                                                  const Tile& tile)
+{
+    if constexpr(!is_detected<is_tuple, Shape>::value && !is_detected<is_tuple, Tile>::value)
+    {
+        // shape : stride o (tile, shape / tile) : (1, tile)
+        if constexpr(IsStatic<Shape>() && IsStatic<Tile>())
+        {
+            static_assert(Shape::value % Tile::value == 0, "Tile must divide the shape");
+        }
+        return make_tuple(make_tuple(tile, shape / tile), make_tuple(stride, tile * stride));
+    }
+    else
+    {
+        // shape : stride o (tile, complement(tile, size))
+        static_assert(IsStatic<Shape>() && IsStatic<Stride>() && IsStatic<Tile>(),
+                      "Divide of nested dims needs static layouts");
+        using TileShape   = Tuple<Tile>;
+        using TileStrides = typename Layout<TileShape>::DeducedStrides;
+        using Modes       = LayoutModes<Tuple<Shape>, Tuple<Stride>>;
+        using RestModes =
+            ComplementModes<LayoutModes<TileShape, TileStrides>, Modes::value.GetSize()>;
+
+        const auto rest          = MakeStaticMode<RestModes>();
+        const auto tiler_shape   = make_tuple(tile, rest.At(Number<0>{}));
+        const auto tiler_strides = make_tuple(TileStrides{}.At(Number<0>{}), rest.At(Number<1>{}));
+        return ComposeImpl(shape, stride, tiler_shape, tiler_strides);
+    }
+}
+
+} // namespace detail
+/// @endcond
+
+/**
+ * \brief Coalesce a static layout: drop size-1 modes and merge the modes
+ *        which continue each other. The 1d offsets do not change.
+ *
+ * \param layout Static layout.
+ * \return Flat static layout.
+ */
+template <typename Shape, typename Strides>
+__host__ __device__ constexpr auto coalesce([[maybe_unused]] const Layout<Shape, Strides>& layout)
+{
+    using DeducedStrides = typename Layout<Shape, Strides>::DeducedStrides;
+    static_assert(detail::IsStatic<Shape>() && detail::IsStatic<DeducedStrides>(),
+                  "Coalesce needs a static layout");
+    using Modes = detail::CoalescedModes<detail::LayoutModes<Shape, DeducedStrides>>;
+    return make_layout(detail::MakeStaticShape<Modes>(), detail::MakeStaticStrides<Modes>());
+}
+
+/**
+ * \brief Composition of layouts, result(i) == a(b(i)). The result has the
+ *        shape hierarchy of b. Needs static layouts, unless a has a single mode.
+ *
+ * \param a Outer layout.
+ * \param b Inner layout.
+ * \return Composed layout.
+ */
+template <typename AShape, typename AStrides, typename BShape, typename BStrides>
+__host__ __device__ constexpr auto composition(const Layout<AShape, AStrides>& a,
+                                               const Layout<BShape, BStrides>& b)
+{
+    const auto result =
+        detail::ComposeImpl(a.GetShape(), a.GetStrides(), b.GetShape(), b.GetStrides());
+    return make_layout(result.At(Number<0>{}), result.At(Number<1>{}));
+}
+
+/**
+ * \brief Complement of a static layout: the layout, ordered by stride, of the
+ *        offsets in [0, cosize_hi) that the layout does not reach.
+ *
+ * \param layout Static injective layout.
+ * \param cosize_hi Number<> upper bound of the offsets.
+ * \return Flat static layout.
+ */
+template <typename Shape, typename Strides, index_t CosizeHi>
+__host__ __device__ constexpr auto complement([[maybe_unused]] const Layout<Shape, Strides>& layout,
+                                              [[maybe_unused]] Number<CosizeHi> cosize_hi)
+{
+    using DeducedStrides = typename Layout<Shape, Strides>::DeducedStrides;
+    static_assert(detail::IsStatic<Shape>() && detail::IsStatic<DeducedStrides>(),
+                  "Complement needs a static layout");
+    using Modes = detail::ComplementModes<detail::LayoutModes<Shape, DeducedStrides>, CosizeHi>;
+    return make_layout(detail::MakeStaticShape<Modes>(), detail::MakeStaticStrides<Modes>());
+}
+
+/**
+ * \brief Complement up to the cosize of the layout.
+ *
+ * \param layout Static injective layout.
+ * \return Flat static layout.
+ */
+template <typename Shape, typename Strides>
+__host__ __device__ constexpr auto complement(const Layout<Shape, Strides>& layout)
+{
+    using DeducedStrides = typename Layout<Shape, Strides>::DeducedStrides;
+    constexpr index_t cosize = detail::LayoutModes<Shape, DeducedStrides>::value.GetCosize();
+    return complement(layout, Number<cosize>{});
+}
+
+/**
+ * \brief Right inverse of a static layout, layout(result(i)) == i for i in
+ *        [0, size(result)).
+ *
+ * \param layout Static layout.
+ * \return Flat static layout.
+ */
+template <typename Shape, typename Strides>
+__host__ __device__ constexpr auto
+right_inverse([[maybe_unused]] const Layout<Shape, Strides>& layout)
+{
+    using DeducedStrides = typename Layout<Shape, Strides>::DeducedStrides;
+    static_assert(detail::IsStatic<Shape>() && detail::IsStatic<DeducedStrides>(),
+                  "Right inverse needs a static layout");
+    using Modes = detail::RightInverseModes<detail::LayoutModes<Shape, DeducedStrides>>;
+    return make_layout(detail::MakeStaticShape<Modes>(), detail::MakeStaticStrides<Modes>());
+}
+
+/**
+ * \brief Divide a static layout by a tiler layout, result is
+ *        (tile, rest) = layout o (tiler, complement(tiler, size(layout))).
+ *
+ * \param layout Static layout to divide.
+ * \param tiler Static layout of the tile.
+ * \return Layout of shape (tile modes, rest modes).
+ */
+template <typename Shape, typename Strides, typename TileShape, typename TileStrides>
+__host__ __device__ constexpr auto logical_divide(const Layout<Shape, Strides>& layout,
+                                                  const Layout<TileShape, TileStrides>& tiler)
+{
+    using DeducedStrides     = typename Layout<Shape, Strides>::DeducedStrides;
+    using TileDeducedStrides = typename Layout<TileShape, TileStrides>::DeducedStrides;
+    constexpr index_t size   = detail::LayoutModes<Shape, DeducedStrides>::value.GetSize();
+
+    const auto rest = complement(tiler, Number<size>{});
+    const auto tiler_with_rest =
+        make_layout(make_tuple(TileShape{}, rest.GetShape()),
+                    make_tuple(TileDeducedStrides{}, rest.GetStrides()));
+    return composition(layout, tiler_with_rest);
+}
+
+/**
+ * \brief Divide every dim of the layout by the tile of the same index, dim i
+ *        of the result is (tile_i, rest_i). Single-mode dims divided by a
+ *        shape may be runtime values.
+ *
+ * Example, (8, 6):(6, 1) divided by (2, 3) gives ((2, 4), (3, 2)):((6, 12), (1, 3)).
+ *
+ * \param layout Layout to divide.
+ * \param tiles Tuple of tile shapes, one per dim.
+ * \return Layout of shape ((tile_0, rest_0), (tile_1, rest_1), ...).
+ */
+template <typename Shape, typename Strides, typename... Tiles>
+__host__ __device__ constexpr auto logical_divide(const Layout<Shape, Strides>& layout,
+                                                  const Tuple<Tiles...>& tiles)
+{
+    static_assert(Shape::Size() == sizeof...(Tiles), "Tile rank and layout rank must be the same");
+    const auto shape   = layout.GetShape();
+    const auto strides = layout.GetStrides();
+
+    const auto modes = generate_tuple(
+        [&](auto i) { return detail::DivideModeImpl(shape.At(i), strides.At(i), tiles.At(i)); },
+        Number<sizeof...(Tiles)>{});
+    return make_layout(detail::GetPairElements<0>(modes), detail::GetPairElements<1>(modes));
+}
+
+/**
+ * \brief logical_divide by dims with the tiles and the rests gathered, result
+ *        is ((tile_0, tile_1, ...), (rest_0, rest_1, ...)).
+ *
+ * \param layout Layout to divide.
+ * \param tiles Tuple of tile shapes, one per dim.
+ * \return Layout of shape (tile, rest).
+ */
+template <typename Shape, typename Strides, typename... Tiles>
+__host__ __device__ constexpr auto zipped_divide(const Layout<Shape, Strides>& layout,
+                                                 const Tuple<Tiles...>& tiles)
+{
+    const auto divided = logical_divide(layout, tiles);
+    const auto shape   = divided.GetShape();
+    const auto strides = divided.GetStrides();
+
+    return make_layout(
+        make_tuple(detail::GetPairElements<0>(shape), detail::GetPairElements<1>(shape)),
+        make_tuple(detail::GetPairElements<0>(strides), detail::GetPairElements<1>(strides)));
+}
+
+/**
+ * \brief zipped_divide by a tiler layout, the same as logical_divide.
+ *
+ * \param layout Static layout to divide.
+ * \param tiler Static layout of the tile.
+ * \return Layout of shape (tile modes, rest modes).
+ */
+template <typename Shape, typename Strides, typename TileShape, typename TileStrides>
+__host__ __device__ constexpr auto zipped_divide(const Layout<Shape, Strides>& layout,
+                                                 const Layout<TileShape, TileStrides>& tiler)
+{
+    return logical_divide(layout, tiler);
+}
+
+} // namespace wrapper
+} // namespace ck
@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/wrapper/tensor.hpp"
+
+#include "ck/utility/c_style_pointer_cast.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/type_convert.hpp"
+
+namespace ck {
+namespace wrapper {
+
+// Disable from doxygen docs generation
+/// @cond
+namespace detail {
+
+// Widest access, dwordx4
+constexpr index_t max_vector_bytes = 16;
+
+template <typename TensorType>
+__host__ __device__ constexpr bool IsRegisterTensor()
+{
+    return TensorType::TensorBufferAddressSpace == AddressSpaceEnum::Sgpr ||
+           TensorType::TensorBufferAddressSpace == AddressSpaceEnum::Vgpr;
+}
+
+// Memory tensor with compile-time unit stride in the (unrolled) dim
+template <typename TensorType, index_t IDim>
+__host__ __device__ constexpr bool IsContiguousDim()
+{
+    if constexpr(IsRegisterTensor<TensorType>())
+    {
+        return false;
+    }
+    else
+    {
+        using Strides = remove_cvref_t<decltype(
+            UnrollNestedTuple(std::declval<TensorType>().GetLayout().GetStrides()))>;
+        return is_same_v<remove_cvref_t<tuple_element_t<IDim, Strides>>, Number<1>>;
+    }
+}
+
+// Widest power of two vector of T which divides the compile-time length
+template <typename T, index_t Length>
+__host__ __device__ constexpr index_t GetScalarPerVector()
+{
+    index_t scalar_per_vector = math::max(max_vector_bytes / static_cast<index_t>(sizeof(T)), 1);
+    while(Length % scalar_per_vector != 0)
+    {
+        scalar_per_vector /= 2;
+    }
+    return scalar_per_vector;
+}
+
+// Dim of compile-time length accessed with vectors: contiguous in both tensors if possible,
+// else in the destination, else in the source, -1 if none
+template <typename SrcTensorType, typename DstTensorType, typename Lengths, index_t... Is>
+__host__ __device__ constexpr index_t GetCopyVectorDim(Sequence<Is...>)
+{
+    constexpr bool known[] = {
+        is_known_at_compile_time<remove_cvref_t<tuple_element_t<Is, Lengths>>>::value...};
+    constexpr bool src_contiguous[] = {IsContiguousDim<SrcTensorType, Is>()...};
+    constexpr bool dst_contiguous[] = {IsContiguousDim<DstTensorType, Is>()...};
+
+    index_t both_dim = -1;
+    index_t dst_dim  = -1;
+    index_t src_dim  = -1;
+    for(index_t i = static_cast<index_t>(sizeof...(Is)) - 1; i >= 0; i--)
+    {
+        if(known[i] && src_contiguous[i] && dst_contiguous[i])
+            both_dim = i;
+        if(known[i] && dst_contiguous[i])
+            dst_dim = i;
+        if(known[i] && src_contiguous[i])
+            src_dim = i;
+    }
+    return both_dim >= 0 ? both_dim : (dst_dim >= 0 ? dst_dim : src_dim);
+}
+
+template <typename TensorType, typename Lengths, index_t... Is>
+__host__ __device__ constexpr index_t GetFillVectorDim(Sequence<Is...>)
+{
+    constexpr bool known[] = {
+        is_known_at_compile_time<remove_cvref_t<tuple_element_t<Is, Lengths>>>::value...};
+    constexpr bool contiguous[] = {IsContiguousDim<TensorType, Is>()...};
+
+    for(index_t i = 0; i < static_cast<index_t>(sizeof...(Is)); i++)
+    {
+        if(known[i] && contiguous[i])
+            return i;
+    }
+    return -1;
+}
+
+template <index_t IDim, typename Idx, typename X>
+__host__ __device__ constexpr auto AddToDim(const Idx& idx, const X x)
+{
+    return generate_tuple(
+        [&](auto d) {
+            if constexpr(d.value == IDim)
+            {
+                return idx.At(d) + x;
+            }
+            else
+            {
+                return idx.At(d);
+            }
+        },
+        Number<Idx::Size()>{});
+}
+
+} // namespace detail
+/// @endcond
+
+/**
+ * \brief Copy tensor elements, converted to the destination type. Elements
+ *        are matched by their (unrolled) index, the tensors must have the same
+ *        unrolled shape. A dim of compile-time length with compile-time unit
+ *        stride is accessed with vectors of up to 16 bytes, as with
+ *        SrcScalarPerVector/DstScalarPerVector of ThreadwiseTensorSliceTransfer
+ *        the memory must then be aligned to the vector. Register tensors need
+ *        compile-time shapes and are accessed element by element.
+ *
+ * \param src Source tensor.
+ * \param dst Destination tensor.
+ */
+template <typename SrcTensorType, typename DstTensorType>
+__host__ __device__ void copy(const SrcTensorType& src, DstTensorType&& dst)
+{
+    using DstTensor = remove_cvref_t<DstTensorType>;
+    using SrcType   = remove_cv_t<typename SrcTensorType::TensorElementType>;
+    using DstType   = remove_cv_t<typename DstTensor::TensorElementType>;
+
+    const auto lengths = UnrollNestedTuple(src.GetLayout().GetShape());
+    using Lengths      = remove_cvref_t<decltype(lengths)>;
+    static_assert(Lengths::Size() == decltype(UnrollNestedTuple(
+                                         dst.GetLayout().GetShape()))::Size(),
+                  "Source and destination must have the same rank");
+
+    constexpr index_t vector_dim = detail::GetCopyVectorDim<SrcTensorType, DstTensor, Lengths>(
+        typename arithmetic_sequence_gen<0, Lengths::Size(), 1>::type{});
+
+    if constexpr(vector_dim < 0)
+    {
+        detail::for_each_index<-1, 1>(
+            lengths, [&](auto idx) { dst(idx) = type_convert<DstType>(src(idx)); });
+    }
+    else
+    {
+        constexpr index_t length = remove_cvref_t<tuple_element_t<vector_dim, Lengths>>::value;
+        constexpr index_t scalar_per_vector =
+            math::min(detail::GetScalarPerVector<SrcType, length>(),
+                      detail::GetScalarPerVector<DstType, length>());
+
+        using SrcVector = vector_type<SrcType, scalar_per_vector>;
+        using DstVector = vector_type<DstType, scalar_per_vector>;
+
+        detail::for_each_index<vector_dim, scalar_per_vector>(lengths, [&](auto idx) {
+            SrcVector src_vector;
+            if constexpr(detail::IsContiguousDim<SrcTensorType, vector_dim>())
+            {
+                src_vector.template AsType<typename SrcVector::type>()(Number<0>{}) =
+                    *c_style_pointer_cast<const typename SrcVector::type*>(&src(idx));
+            }
+            else
+            {
+                static_for<0, scalar_per_vector, 1>{}([&](auto i) {
+                    src_vector.template AsType<SrcType>()(i) =
+                        src(detail::AddToDim<vector_dim>(idx, i));
+                });
+            }
+
+            DstVector dst_vector;
+            static_for<0, scalar_per_vector, 1>{}([&](auto i) {
+                dst_vector.template AsType<DstType>()(i) =
+                    type_convert<DstType>(src_vector.template AsType<SrcType>()[i]);
+            });
+
+            if constexpr(detail::IsContiguousDim<DstTensor, vector_dim>())
+            {
+                *c_style_pointer_cast<typename DstVector::type*>(&dst(idx)) =
+                    dst_vector.template AsType<typename DstVector::type>()[Number<0>{}];
+            }
+            else
+            {
+                static_for<0, scalar_per_vector, 1>{}([&](auto i) {
+                    dst(detail::AddToDim<vector_dim>(idx, i)) =
+                        dst_vector.template AsType<DstType>()[i];
+                });
+            }
+        });
+    }
+}
+
+/**
+ * \brief Set all tensor elements to the value, with vectors along a dim of
+ *        compile-time length and compile-time unit stride as in copy.
+ *
+ * \param tensor Tensor to fill.
+ * \param value Value converted to the tensor element type.
+ */
+template <typename TensorType, typename T>
+__host__ __device__ void fill(TensorType&& tensor, const T& value)
+{
+    using Tensor      = remove_cvref_t<TensorType>;
+    using ElementType = remove_cv_t<typename Tensor::TensorElementType>;
+
+    const auto lengths = UnrollNestedTuple(tensor.GetLayout().GetShape());
+    using Lengths      = remove_cvref_t<decltype(lengths)>;
+
+    constexpr index_t vector_dim = detail::GetFillVectorDim<Tensor, Lengths>(
+        typename arithmetic_sequence_gen<0, Lengths::Size(), 1>::type{});
+
+    const ElementType element = type_convert<ElementType>(value);
+
+    if constexpr(vector_dim < 0)
+    {
+        detail::for_each_index<-1, 1>(lengths, [&](auto idx) { tensor(idx) = element; });
+    }
+    else
+    {
+        constexpr index_t length = remove_cvref_t<tuple_element_t<vector_dim, Lengths>>::value;
+        constexpr index_t scalar_per_vector = detail::GetScalarPerVector<ElementType, length>();
+
+        using Vector = vector_type<ElementType, scalar_per_vector>;
+
+        Vector vector;
+        static_for<0, scalar_per_vector, 1>{}(
+            [&](auto i) { vector.template AsType<ElementType>()(i) = element; });
+
+        detail::for_each_index<vector_dim, scalar_per_vector>(lengths, [&](auto idx) {
+            *c_style_pointer_cast<typename Vector::type*>(&tensor(idx)) =
+                vector.template AsType<typename Vector::type>()[Number<0>{}];
+        });
+    }
+}
+
+/**
+ * \brief Set all tensor elements to zero.
+ *
+ * \param tensor Tensor to clear.
+ */
+template <typename TensorType>
+__host__ __device__ void clear(TensorType&& tensor)
+{
+    using ElementType = remove_cv_t<typename remove_cvref_t<TensorType>::TensorElementType>;
+    fill(tensor, ElementType{0});
+}
+
+} // namespace wrapper
+} // namespace ck
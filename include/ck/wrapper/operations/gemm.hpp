@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/wrapper/tensor.hpp"
+
+#include "ck/utility/type_convert.hpp"
+
+namespace ck {
+namespace wrapper {
+
+/**
+ * \brief Thread-level GEMM, c(m, n) += a(m, k) * b(n, k), accumulated in the
+ *        element type of c. Dims of compile-time length are fully unrolled,
+ *        register tensors need them. K is the outermost loop, so register
+ *        tiles are updated with outer products.
+ *
+ * \param a Tensor of shape (M, K).
+ * \param b Tensor of shape (N, K).
+ * \param c Tensor of shape (M, N).
+ */
+template <typename ATensorType, typename BTensorType, typename CTensorType>
+__host__ __device__ void gemm(const ATensorType& a, const BTensorType& b, CTensorType&& c)
+{
+    using CType = remove_cv_t<typename remove_cvref_t<CTensorType>::TensorElementType>;
+
+    constexpr auto I0 = Number<0>{};
+    constexpr auto I1 = Number<1>{};
+    constexpr auto I2 = Number<2>{};
+
+    const auto a_shape = a.GetLayout().GetShape();
+    const auto b_shape = b.GetLayout().GetShape();
+    static_assert(decltype(a_shape)::Size() == 2 && decltype(b_shape)::Size() == 2 &&
+                      decltype(c.GetLayout().GetShape())::Size() == 2,
+                  "GEMM tensors must be 2d");
+
+    // M is the innermost loop and K the outermost
+    const auto lengths = make_tuple(detail::GetDimLength(a_shape.At(I0)),
+                                    detail::GetDimLength(b_shape.At(I0)),
+                                    detail::GetDimLength(a_shape.At(I1)));
+
+    detail::for_each_index<-1, 1>(lengths, [&](auto idx) {
+        const auto m = idx.At(I0);
+        const auto n = idx.At(I1);
+        const auto k = idx.At(I2);
+        c(m, n) += type_convert<CType>(a(m, k)) * type_convert<CType>(b(n, k));
+    });
+}
+
+} // namespace wrapper
+} // namespace ck
@@ -0,0 +1,271 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/wrapper/layout.hpp"
+#include "ck/wrapper/tensor_utils.hpp"
+
+namespace ck {
+namespace wrapper {
+
+/**
+ * \brief Tensor wrapper that binds a layout to memory or registers.
+ *
+ * \tparam BufferAddressSpace Address space of the data. Global, Lds and Generic
+ *         tensors point to memory, Sgpr and Vgpr tensors own a static buffer
+ *         and need a layout known at compile time.
+ * \tparam ElementType Type of the elements.
+ * \tparam Shape Tuple of Number<> (for compile-time layout) or index_t
+ *         (dynamic layout).
+ * \tparam Strides Tuple of Number<> (for compile-time layout) or index_t
+ *         (dynamic layout).
+ */
+template <AddressSpaceEnum BufferAddressSpace,
+          typename ElementType,
+          typename Shape,
+          typename Strides>
+struct Tensor
+{
+    private:
+    using LayoutType = Layout<Shape, Strides>;
+
+    static constexpr bool IsDynamicBuffer = !(BufferAddressSpace == AddressSpaceEnum::Sgpr ||
+                                              BufferAddressSpace == AddressSpaceEnum::Vgpr);
+
+    __host__ __device__ static constexpr index_t GetRegisterBufferSize()
+    {
+        if constexpr(IsDynamicBuffer)
+        {
+            return 0;
+        }
+        else
+        {
+            static_assert(LayoutType::NaiveDescriptorType::IsKnownAtCompileTime(),
+                          "Layout of register tensor must be known at compile time");
+            return typename LayoutType::NaiveDescriptorType{}.GetElementSpaceSize();
+        }
+    }
+
+    using StaticBufferType =
+        StaticBuffer<BufferAddressSpace, ElementType, GetRegisterBufferSize(), true>;
+    using BufferType = std::conditional_t<IsDynamicBuffer, ElementType*, StaticBufferType>;
+
+    // Register tensors are statically indexed, the offset is computed at compile time
+    template <typename... Ts>
+    __host__ __device__ static constexpr auto GetRegisterOffset(const Tuple<Ts...>&)
+    {
+        static_assert(!IsNestedTuple(Tuple<Ts...>{}) &&
+                          sizeof...(Ts) == LayoutType::NaiveDescriptorType::GetNumOfDimension(),
+                      "Register tensor must be accessed with flat index");
+        constexpr index_t offset =
+            typename LayoutType::NaiveDescriptorType{}.CalculateOffset(Tuple<Ts...>{});
+        return Number<offset>{};
+    }
+
+    template <typename... Ts>
+    __host__ __device__ static constexpr bool HasSlice(const Tuple<Ts...>&)
+    {
+        return (is_detected<is_slice, Ts>::value || ...);
+    }
+
+    // Sliced dims are kept, dims indexed with an integer are dropped
+    template <typename... Ts>
+    __host__ __device__ constexpr auto GetSubTensor(const Tuple<Ts...>& idx) const
+    {
+        static_assert(IsDynamicBuffer, "Register tensor cannot be sliced");
+        static_assert(!IsNestedTuple(Shape{}) && !IsNestedTuple(Tuple<Ts...>{}),
+                      "Slicing of nested shapes is not supported");
+        static_assert(sizeof...(Ts) == Shape::Size(), "Idx rank and Shape rank must be the same");
+
+        const auto strides = layout_.GetStrides();
+
+        const auto sliced_dims = [&](auto get_dim) {
+            const auto dims = generate_tuple(
+                [&](auto d) {
+                    if constexpr(is_detected<is_slice, tuple_element_t<d, Tuple<Ts...>>>::value)
+                    {
+                        return make_tuple(get_dim(d));
+                    }
+                    else
+                    {
+                        return Tuple<>{};
+                    }
+                },
+                Number<sizeof...(Ts)>{});
+            return unpack([](auto... xs) { return concat_tuple(xs...); }, dims);
+        };
+        const auto new_shape   = sliced_dims([&](auto d) { return idx.At(d).GetLength(); });
+        const auto new_strides = sliced_dims([&](auto d) { return strides.At(d); });
+
+        index_t offset = 0;
+        static_for<0, sizeof...(Ts), 1>{}([&](auto d) {
+            if constexpr(is_detected<is_slice, tuple_element_t<d, Tuple<Ts...>>>::value)
+            {
+                offset += idx.At(d).from_ * strides.At(d);
+            }
+            else
+            {
+                offset += idx.At(d) * strides.At(d);
+            }
+        });
+
+        return make_tensor<BufferAddressSpace>(buffer_ + offset,
+                                               make_layout(new_shape, new_strides));
+    }
+
+    public:
+    static constexpr AddressSpaceEnum TensorBufferAddressSpace = BufferAddressSpace;
+    using TensorElementType                                    = ElementType;
+
+    /**
+     * \brief Tensor constructor for memory (global, LDS or generic).
+     *
+     * \param pointer Pointer to the first element.
+     * \param layout Tensor layout.
+     */
+    __host__ __device__ Tensor() = delete;
+    __host__ __device__ Tensor(ElementType* pointer, const LayoutType& layout)
+        : layout_(layout), buffer_(pointer)
+    {
+        static_assert(IsDynamicBuffer, "Register tensor does not take a pointer");
+    }
+
+    /**
+     * \brief Tensor constructor for registers (Sgpr or Vgpr).
+     *
+     * \param layout Tensor layout.
+     */
+    __host__ __device__ Tensor(const LayoutType& layout) : layout_(layout), buffer_{}
+    {
+        static_assert(!IsDynamicBuffer, "Memory tensor needs a pointer");
+    }
+
+    /**
+     * \brief Element access or slicing. If any index is a Slice, the sub tensor
+     *        is returned, otherwise the reference to the element.
+     *
+     * \param idx Tuple of indexes, Number<> only for register tensors.
+     * \return Element reference or sub tensor.
+     */
+    template <typename... Ts>
+    __host__ __device__ constexpr decltype(auto) operator()(const Tuple<Ts...>& idx) const
+    {
+        if constexpr(HasSlice(Tuple<Ts...>{}))
+        {
+            return GetSubTensor(idx);
+        }
+        else if constexpr(IsDynamicBuffer)
+        {
+            return static_cast<const ElementType&>(buffer_[layout_(idx)]);
+        }
+        else
+        {
+            return buffer_[GetRegisterOffset(idx)];
+        }
+    }
+
+    template <typename... Ts>
+    __host__ __device__ constexpr decltype(auto) operator()(const Tuple<Ts...>& idx)
+    {
+        if constexpr(HasSlice(Tuple<Ts...>{}))
+        {
+            return GetSubTensor(idx);
+        }
+        else if constexpr(IsDynamicBuffer)
+        {
+            return buffer_[layout_(idx)];
+        }
+        else
+        {
+            return buffer_(GetRegisterOffset(idx));
+        }
+    }
+
+    /**
+     * \brief Element access or slicing with indexes passed separately.
+     *
+     * \param idxs Indexes (or nested tuples of indexes, or slices).
+     * \return Element reference or sub tensor.
+     */
+    template <typename... Idxs>
+    __host__ __device__ constexpr decltype(auto) operator()(const Idxs&... idxs) const
+    {
+        return operator()(make_tuple(idxs...));
+    }
+
+    template <typename... Idxs>
+    __host__ __device__ constexpr decltype(auto) operator()(const Idxs&... idxs)
+    {
+        return operator()(make_tuple(idxs...));
+    }
+
+    template <typename... Ts>
+    __host__ __device__ constexpr decltype(auto) operator[](const Tuple<Ts...>& idx) const
+    {
+        return operator()(idx);
+    }
+
+    template <typename... Ts>
+    __host__ __device__ constexpr decltype(auto) operator[](const Tuple<Ts...>& idx)
+    {
+        return operator()(idx);
+    }
+
+    /**
+     * \brief Layout getter.
+     *
+     * \return Layout.
+     */
+    __host__ __device__ constexpr const LayoutType& GetLayout() const { return layout_; }
+
+    /**
+     * \brief Pointer getter (memory tensors only).
+     *
+     * \return Pointer to the first element.
+     */
+    __host__ __device__ constexpr ElementType* GetPointer() const
+    {
+        static_assert(IsDynamicBuffer, "Register tensor has no pointer");
+        return buffer_;
+    }
+
+    /**
+     * \brief Buffer getter. Dynamic buffer over the layout element space for
+     *        memory tensors, the static buffer for register tensors.
+     *
+     * \return Buffer.
+     */
+    __host__ __device__ constexpr decltype(auto) GetBuffer() const
+    {
+        if constexpr(IsDynamicBuffer)
+        {
+            return make_dynamic_buffer<BufferAddressSpace>(buffer_,
+                                                           layout_.GetElementSpaceSize());
+        }
+        else
+        {
+            return (buffer_);
+        }
+    }
+
+    __host__ __device__ constexpr decltype(auto) GetBuffer()
+    {
+        if constexpr(IsDynamicBuffer)
+        {
+            return make_dynamic_buffer<BufferAddressSpace>(buffer_,
+                                                           layout_.GetElementSpaceSize());
+        }
+        else
+        {
+            return (buffer_);
+        }
+    }
+
+    private:
+    LayoutType layout_;
+    BufferType buffer_;
+};
+
+} // namespace wrapper
+} // namespace ck
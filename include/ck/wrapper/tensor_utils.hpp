@@ -0,0 +1,297 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/wrapper/layout_utils.hpp"
+
+#include "ck/utility/amd_address_space.hpp"
+#include "ck/utility/dynamic_buffer.hpp"
+#include "ck/utility/static_buffer.hpp"
+
+namespace ck {
+namespace wrapper {
+
+// Disable from doxygen docs generation
+/// @cond
+// forward declaration
+template <AddressSpaceEnum BufferAddressSpace,
+          typename ElementType,
+          typename Shape,
+          typename Strides>
+struct Tensor;
+
+template <typename T>
+using is_slice = decltype(std::declval<T&>().IsSlice());
+/// @endcond
+
+/**
+ * \brief Range of a tensor dimension [from, to) used for slicing.
+ *
+ * \tparam FromType Number<> (compile-time slice) or index_t.
+ * \tparam ToType Number<> (compile-time slice) or index_t.
+ */
+template <typename FromType, typename ToType>
+struct Slice
+{
+    __host__ __device__ constexpr Slice() : from_(), to_() {}
+    __host__ __device__ constexpr Slice(FromType from, ToType to) : from_(from), to_(to) {}
+
+    /**
+     * \brief Length of the sliced dimension.
+     *
+     * \return Number<> if both ends are known at compile time, index_t otherwise.
+     */
+    __host__ __device__ constexpr auto GetLength() const { return to_ - from_; }
+
+    __host__ __device__ static constexpr bool IsSlice() { return true; }
+
+    FromType from_;
+    ToType to_;
+};
+
+/**
+ * \brief Make slice [from, to) of a dimension.
+ *
+ * \param from First index of the slice.
+ * \param to Index past the last one of the slice.
+ * \return Slice object.
+ */
+template <typename FromType, typename ToType>
+__host__ __device__ constexpr auto make_slice(const FromType from, const ToType to)
+{
+    return Slice<FromType, ToType>(from, to);
+}
+
+/**
+ * \brief Make slice [0, to) of a dimension.
+ *
+ * \param to Index past the last one of the slice.
+ * \return Slice object.
+ */
+template <typename ToType>
+__host__ __device__ constexpr auto make_slice(const ToType to)
+{
+    return Slice<Number<0>, ToType>(Number<0>{}, to);
+}
+
+/**
+ * \brief Make tensor on memory (global, LDS or generic).
+ *
+ * \tparam BufferAddressSpace Address space of the memory.
+ * \param pointer Pointer to the first element.
+ * \param layout Tensor layout.
+ * \return Constructed tensor.
+ */
+template <AddressSpaceEnum BufferAddressSpace,
+          typename ElementType,
+          typename Shape,
+          typename Strides>
+__host__ __device__ constexpr auto make_tensor(ElementType* pointer,
+                                               const Layout<Shape, Strides>& layout)
+{
+    return Tensor<BufferAddressSpace, ElementType, Shape, Strides>(pointer, layout);
+}
+
+/**
+ * \brief Make tensor held in registers. The layout has to be known at compile
+ *        time, the elements are then statically indexed.
+ *
+ * \tparam BufferAddressSpace Address space of the registers (Sgpr or Vgpr).
+ * \tparam ElementType Type of the elements.
+ * \param layout Tensor layout.
+ * \return Constructed tensor.
+ */
+template <AddressSpaceEnum BufferAddressSpace,
+          typename ElementType,
+          typename Shape,
+          typename Strides>
+__host__ __device__ constexpr auto make_register_tensor(const Layout<Shape, Strides>& layout)
+{
+    static_assert(BufferAddressSpace == AddressSpaceEnum::Sgpr ||
+                      BufferAddressSpace == AddressSpaceEnum::Vgpr,
+                  "Register tensor must be in Sgpr or Vgpr");
+    return Tensor<BufferAddressSpace, ElementType, Shape, Strides>(layout);
+}
+
+/**
+ * \brief Get tensor layout.
+ *
+ * \param tensor Tensor to get layout.
+ * \return Requsted layout.
+ */
+template <AddressSpaceEnum BufferAddressSpace,
+          typename ElementType,
+          typename Shape,
+          typename Strides>
+__host__ __device__ constexpr const auto&
+layout(const Tensor<BufferAddressSpace, ElementType, Shape, Strides>& tensor)
+{
+    return tensor.GetLayout();
+}
+
+/**
+ * \brief Tensor size (product of dims).
+ *
+ * \param tensor Tensor to calculate size.
+ * \return Requsted size.
+ */
+template <AddressSpaceEnum BufferAddressSpace,
+          typename ElementType,
+          typename Shape,
+          typename Strides>
+__host__ __device__ constexpr index_t
+size(const Tensor<BufferAddressSpace, ElementType, Shape, Strides>& tensor)
+{
+    return size(tensor.GetLayout());
+}
+
+/**
+ * \brief Tile of the tensor at the given tile coordinates. The tile keeps the
+ *        strides of the tensor, only the pointer is moved.
+ *
+ * Example, 2x2 tiles of a 4x4 tensor:
+ * tile_shape:  (2, 2)
+ * tile_coords: (1, 0) -> elements (2..3, 0..1)
+ *
+ * \param tensor Tensor to tile, with a flat (not nested) shape.
+ * \param tile_shape Shape of the tile.
+ * \param tile_coords Coordinates of the tile in the grid of tiles.
+ * \return Tile tensor.
+ */
+template <typename TensorType, typename... TileDims, typename... CoordDims>
+__host__ __device__ constexpr auto local_tile(const TensorType& tensor,
+                                              const Tuple<TileDims...>& tile_shape,
+                                              const Tuple<CoordDims...>& tile_coords)
+{
+    using Shape = remove_cvref_t<decltype(tensor.GetLayout().GetShape())>;
+    static_assert(!IsNestedTuple(Shape{}) && !IsNestedTuple(Tuple<TileDims...>{}),
+                  "Tiling of nested shapes is not supported");
+    static_assert(Shape::Size() == sizeof...(TileDims) && Shape::Size() == sizeof...(CoordDims),
+                  "Tile rank and tensor rank must be the same");
+
+    const auto strides = tensor.GetLayout().GetStrides();
+
+    index_t offset = 0;
+    static_for<0, Shape::Size(), 1>{}([&](auto d) {
+        offset += tile_coords.At(d) * tile_shape.At(d) * strides.At(d);
+    });
+
+    return make_tensor<TensorType::TensorBufferAddressSpace>(
+        tensor.GetPointer() + offset, make_layout(tile_shape, strides));
+}
+
+/**
+ * \brief Part of the tensor owned by the given thread. The threads are laid
+ *        out column-major over the tensor and every thread takes each
+ *        thread_lengths-th element in every dimension.
+ *
+ * Example, 4x4 tensor over 2x2 threads:
+ * thread_id 1 -> thread coordinates (1, 0) -> elements (1, 0), (3, 0), (1, 2), (3, 2)
+ *
+ * \param tensor Tensor to partition, with a flat (not nested) shape.
+ * \param thread_lengths Number of threads in every dimension.
+ * \param thread_id Id of the thread.
+ * \return Partition tensor.
+ */
+template <typename TensorType, typename... ThreadDims>
+__host__ __device__ constexpr auto local_partition(const TensorType& tensor,
+                                                   const Tuple<ThreadDims...>& thread_lengths,
+                                                   const index_t thread_id)
+{
+    using Shape = remove_cvref_t<decltype(tensor.GetLayout().GetShape())>;
+    static_assert(!IsNestedTuple(Shape{}) && !IsNestedTuple(Tuple<ThreadDims...>{}),
+                  "Partitioning of nested shapes is not supported");
+    static_assert(Shape::Size() == sizeof...(ThreadDims),
+                  "Thread rank and tensor rank must be the same");
+
+    const auto shape   = tensor.GetLayout().GetShape();
+    const auto strides = tensor.GetLayout().GetStrides();
+
+    const auto new_shape = generate_tuple(
+        [&](auto d) { return shape.At(d) / thread_lengths.At(d); }, Number<Shape::Size()>{});
+    const auto new_strides = generate_tuple(
+        [&](auto d) { return strides.At(d) * thread_lengths.At(d); }, Number<Shape::Size()>{});
+
+    // Column-major thread coordinates
+    index_t offset       = 0;
+    index_t remaining_id = thread_id;
+    static_for<0, Shape::Size(), 1>{}([&](auto d) {
+        offset += (remaining_id % thread_lengths.At(d)) * strides.At(d);
+        remaining_id /= thread_lengths.At(d);
+    });
+
+    return make_tensor<TensorType::TensorBufferAddressSpace>(tensor.GetPointer() + offset,
+                                                             make_layout(new_shape, new_strides));
+}
+
+// Disable from doxygen docs generation
+/// @cond
+namespace detail {
+
+// Length of a shape dim, the product if the dim is nested (Number<> if known at compile time)
+template <typename Dim>
+__host__ __device__ constexpr auto GetDimLength(const Dim& dim)
+{
+    if constexpr(is_detected<is_tuple, Dim>::value)
+    {
+        const auto unrolled_dim = UnrollNestedTuple(dim);
+        return TupleReduce<0, unrolled_dim.Size()>([](auto x, auto y) { return x * y; },
+                                                   unrolled_dim);
+    }
+    else
+    {
+        return dim;
+    }
+}
+
+// Calls f(idx) for every index of lengths, idx is a Tuple with one element per dim and dim 0
+// is the innermost loop. Dim VectorDim is stepped by ScalarPerVector. Dims of compile-time
+// length are iterated with static_for (Number<> index, as needed by register tensors), the
+// others with a runtime loop.
+template <index_t VectorDim,
+          index_t ScalarPerVector,
+          index_t IDim,
+          typename Lengths,
+          typename Idx,
+          typename F>
+__host__ __device__ constexpr void for_each_index(const Lengths& lengths, const Idx& idx, F&& f)
+{
+    if constexpr(IDim < 0)
+    {
+        f(idx);
+    }
+    else
+    {
+        constexpr index_t step = IDim == VectorDim ? ScalarPerVector : 1;
+        using Length           = remove_cvref_t<decltype(lengths.At(Number<IDim>{}))>;
+
+        if constexpr(is_known_at_compile_time<Length>::value)
+        {
+            static_for<0, Length::value, step>{}([&](auto i) {
+                for_each_index<VectorDim, ScalarPerVector, IDim - 1>(
+                    lengths, concat_tuple(make_tuple(i), idx), f);
+            });
+        }
+        else
+        {
+            for(index_t i = 0; i < lengths.At(Number<IDim>{}); i += step)
+            {
+                for_each_index<VectorDim, ScalarPerVector, IDim - 1>(
+                    lengths, concat_tuple(make_tuple(i), idx), f);
+            }
+        }
+    }
+}
+
+template <index_t VectorDim, index_t ScalarPerVector, typename... Ls, typename F>
+__host__ __device__ constexpr void for_each_index(const Tuple<Ls...>& lengths, F&& f)
+{
+    for_each_index<VectorDim, ScalarPerVector, sizeof...(Ls) - 1>(lengths, Tuple<>{}, f);
+}
+
+} // namespace detail
+/// @endcond
+
+} // namespace wrapper
+} // namespace ck
@@ -7,6 +7,7 @@
 #include <sstream>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/error_bound.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 
 namespace ck {
@@ -30,10 +31,14 @@ struct ReferenceBatchedGemm : public device::BaseOperator
                  Tensor<CDataType>& c_g_m_n,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
-                 CElementwiseOperation c_element_op)
+                 CElementwiseOperation c_element_op,
+                 Tensor<double>* p_c_g_m_n_err_bound  = nullptr,
+                 utils::ErrorBoundMode err_bound_mode = utils::ErrorBoundMode::Probabilistic)
             : a_g_m_k_{a_g_m_k},
               b_g_k_n_{b_g_k_n},
               c_g_m_n_{c_g_m_n},
+              p_c_g_m_n_err_bound_{p_c_g_m_n_err_bound},
+              err_bound_mode_{err_bound_mode},
               a_element_op_{a_element_op},
               b_element_op_{b_element_op},
               c_element_op_{c_element_op}
@@ -44,6 +49,10 @@ struct ReferenceBatchedGemm : public device::BaseOperator
         const Tensor<BDataType>& b_g_k_n_;
         Tensor<CDataType>& c_g_m_n_;
 
+        // oracle mode: accumulate with compensation in double and emit per-element error bounds
+        Tensor<double>* p_c_g_m_n_err_bound_;
+        utils::ErrorBoundMode err_bound_mode_;
+
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
         CElementwiseOperation c_element_op_;
@@ -60,6 +69,7 @@ struct ReferenceBatchedGemm : public device::BaseOperator
                 const int K = arg.a_g_m_k_.mDesc.GetLengths()[2];
 
                 AccDataType v_acc = 0;
+                utils::CompensatedDotProduct oracle_acc;
 
                 for(int k = 0; k < K; ++k)
                 {
@@ -69,8 +79,36 @@ struct ReferenceBatchedGemm : public device::BaseOperator
                     arg.a_element_op_(v_a, arg.a_g_m_k_(g, m, k));
                     arg.b_element_op_(v_b, arg.b_g_k_n_(g, k, n));
 
-                    v_acc +=
-                        ck::type_convert<AccDataType>(v_a) * ck::type_convert<AccDataType>(v_b);
+                    if(arg.p_c_g_m_n_err_bound_ != nullptr)
+                    {
+                        oracle_acc.Add(utils::to_double(ck::type_convert<AccDataType>(v_a)),
+                                       utils::to_double(ck::type_convert<AccDataType>(v_b)));
+                    }
+                    else
+                    {
+                        v_acc += ck::type_convert<AccDataType>(v_a) *
+                                 ck::type_convert<AccDataType>(v_b);
+                    }
+                }
+
+                if(arg.p_c_g_m_n_err_bound_ != nullptr)
+                {
+                    auto f_out = [&](double acc) {
+                        AccDataType v_out;
+                        arg.c_element_op_(v_out, utils::from_double<AccDataType>(acc));
+                        return ck::type_convert<CDataType>(v_out);
+                    };
+
+                    const double acc_bound = utils::get_accumulation_error_bound(
+                        oracle_acc.GetLength(),
+                        oracle_acc.GetAbsValue(),
+                        utils::get_unit_roundoff<AccDataType>(),
+                        arg.err_bound_mode_);
+
+                    (*arg.p_c_g_m_n_err_bound_)(g, m, n) = utils::get_output_error_bound<CDataType>(
+                        f_out, oracle_acc.GetValue(), acc_bound);
+
+                    v_acc = utils::from_double<AccDataType>(oracle_acc.GetValue());
                 }
 
                 AccDataType v_c;
@@ -113,6 +151,27 @@ struct ReferenceBatchedGemm : public device::BaseOperator
         return Argument{a_g_m_k, b_g_k_n, c_g_m_n, a_element_op, b_element_op, c_element_op};
     }
 
+    // oracle mode, c_g_m_n_err_bound receives the bound of |c_device - c_g_m_n| for every element
+    static auto
+    MakeArgument(const Tensor<ADataType>& a_g_m_k,
+                 const Tensor<BDataType>& b_g_k_n,
+                 Tensor<CDataType>& c_g_m_n,
+                 Tensor<double>& c_g_m_n_err_bound,
+                 AElementwiseOperation a_element_op,
+                 BElementwiseOperation b_element_op,
+                 CElementwiseOperation c_element_op,
+                 utils::ErrorBoundMode err_bound_mode = utils::ErrorBoundMode::Probabilistic)
+    {
+        return Argument{a_g_m_k,
+                        b_g_k_n,
+                        c_g_m_n,
+                        a_element_op,
+                        b_element_op,
+                        c_element_op,
+                        &c_g_m_n_err_bound,
+                        err_bound_mode};
+    }
+
     static auto MakeInvoker() { return Invoker{}; }
 
     virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
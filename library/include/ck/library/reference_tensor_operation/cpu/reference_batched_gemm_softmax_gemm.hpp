@@ -0,0 +1,349 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/masking_specialization.hpp"
+#include "ck/tensor_operation/gpu/element/binary_element_wise_operation.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// Host reference of C = COp(Softmax(Acc0Op(AOp(A) * B0Op(B0)) [+ D0]) * B1Op(B1)), with
+//   A [G, M, K], B0 [G, K, N], B1 [G, N, O], optional bias D0 [G, M, N] and C [G, M, O].
+// The scores are processed one MPerBlock x NPerBlock tile at a time with the online softmax of
+// the device kernel (running row max and sum, Dao et al., section 3.1), so the [G, M, N] score
+// matrix is never materialized. Tiles that are entirely masked out are skipped through
+// C0MatrixMask_impl::IsTileSkippable(), and the work is split over G x (M / MPerBlock).
+template <typename ADataType,
+          typename B0DataType,
+          typename B1DataType,
+          typename CDataType,
+          typename AccDataType,
+          typename AElementOperation,
+          typename B0ElementOperation,
+          typename Acc0ElementOperation,
+          typename B1ElementOperation,
+          typename CElementOperation,
+          device::MaskingSpecialization MaskingSpec,
+          typename D0DataType           = AccDataType,
+          typename C0DEElementOperation = element_wise::Add,
+          index_t MPerBlock             = 128,
+          index_t NPerBlock             = 128>
+struct ReferenceBatchedGemmSoftmaxGemm : public device::BaseOperator
+{
+    using C0MatrixMask = device::C0MatrixMask_impl<
+        conditional_t<MaskingSpec == device::MaskingSpecialization::MaskOutUpperTriangle,
+                      device::MaskOutUpperTrianglePredicate,
+                      device::MaskDisabledPredicate>>;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<ADataType>& a_g_m_k,
+                 const Tensor<B0DataType>& b0_g_k_n,
+                 const Tensor<B1DataType>& b1_g_n_o,
+                 Tensor<CDataType>& c_g_m_o,
+                 const Tensor<D0DataType>* p_d0_g_m_n,
+                 AElementOperation a_element_op,
+                 B0ElementOperation b0_element_op,
+                 Acc0ElementOperation acc0_element_op,
+                 C0DEElementOperation c0de_element_op,
+                 B1ElementOperation b1_element_op,
+                 CElementOperation c_element_op)
+            : a_g_m_k_{a_g_m_k},
+              b0_g_k_n_{b0_g_k_n},
+              b1_g_n_o_{b1_g_n_o},
+              c_g_m_o_{c_g_m_o},
+              p_d0_g_m_n_{p_d0_g_m_n},
+              a_element_op_{a_element_op},
+              b0_element_op_{b0_element_op},
+              acc0_element_op_{acc0_element_op},
+              c0de_element_op_{c0de_element_op},
+              b1_element_op_{b1_element_op},
+              c_element_op_{c_element_op}
+        {
+        }
+
+        const Tensor<ADataType>& a_g_m_k_;
+        const Tensor<B0DataType>& b0_g_k_n_;
+        const Tensor<B1DataType>& b1_g_n_o_;
+        Tensor<CDataType>& c_g_m_o_;
+
+        // nullptr if there is no bias
+        const Tensor<D0DataType>* p_d0_g_m_n_;
+
+        AElementOperation a_element_op_;
+        B0ElementOperation b0_element_op_;
+        Acc0ElementOperation acc0_element_op_;
+        C0DEElementOperation c0de_element_op_;
+        B1ElementOperation b1_element_op_;
+        CElementOperation c_element_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceBatchedGemmSoftmaxGemm::Argument;
+
+        float Run(const Argument& arg)
+        {
+            const auto& a_strides  = arg.a_g_m_k_.mDesc.GetStrides();
+            const auto& b0_strides = arg.b0_g_k_n_.mDesc.GetStrides();
+            const auto& b1_strides = arg.b1_g_n_o_.mDesc.GetStrides();
+
+            const index_t G = arg.c_g_m_o_.mDesc.GetLengths()[0];
+            const index_t M = arg.c_g_m_o_.mDesc.GetLengths()[1];
+            const index_t O = arg.c_g_m_o_.mDesc.GetLengths()[2];
+            const index_t K = arg.a_g_m_k_.mDesc.GetLengths()[2];
+            const index_t N = arg.b0_g_k_n_.mDesc.GetLengths()[2];
+
+            const C0MatrixMask c0_matrix_mask(N);
+
+            const index_t num_m_block = (M + MPerBlock - 1) / MPerBlock;
+
+            auto f_g_mblock = [&](auto g, auto m_block) {
+                const index_t m_begin = m_block * MPerBlock;
+                const index_t m_tile  = std::min(MPerBlock, M - m_begin);
+
+                // scores of the current tile, then P = exp(S - max)
+                std::vector<AccDataType> s(m_tile * NPerBlock);
+                // P * B1 of the current tile
+                std::vector<AccDataType> acc1(m_tile * O);
+                // running output
+                std::vector<AccDataType> c(m_tile * O, 0);
+
+                std::vector<AccDataType> running_max(m_tile,
+                                                     NumericLimits<AccDataType>::Lowest());
+                std::vector<AccDataType> running_sum(m_tile, 0);
+
+                const ADataType* p_a   = arg.a_g_m_k_.mData.data() + g * a_strides[0];
+                const B0DataType* p_b0 = arg.b0_g_k_n_.mData.data() + g * b0_strides[0];
+                const B1DataType* p_b1 = arg.b1_g_n_o_.mData.data() + g * b1_strides[0];
+
+                for(index_t n_begin = 0; n_begin < N; n_begin += NPerBlock)
+                {
+                    if(c0_matrix_mask.IsTileSkippable(m_begin, n_begin, m_tile, NPerBlock))
+                        continue;
+
+                    const index_t n_tile = std::min(NPerBlock, N - n_begin);
+
+                    // gemm0
+                    std::fill(s.begin(), s.end(), AccDataType{0});
+
+                    for(index_t im = 0; im < m_tile; ++im)
+                    {
+                        AccDataType* p_s = &s[im * NPerBlock];
+
+                        for(index_t k = 0; k < K; ++k)
+                        {
+                            ADataType v_a;
+                            arg.a_element_op_(
+                                v_a, p_a[(m_begin + im) * a_strides[1] + k * a_strides[2]]);
+
+                            for(index_t in = 0; in < n_tile; ++in)
+                            {
+                                B0DataType v_b0;
+                                arg.b0_element_op_(
+                                    v_b0, p_b0[k * b0_strides[1] + (n_begin + in) * b0_strides[2]]);
+
+                                p_s[in] += ck::type_convert<AccDataType>(v_a) *
+                                           ck::type_convert<AccDataType>(v_b0);
+                            }
+                        }
+                    }
+
+                    // elementwise, bias, masking and softmax of the tile
+                    for(index_t im = 0; im < m_tile; ++im)
+                    {
+                        const index_t m = m_begin + im;
+                        AccDataType* p_s = &s[im * NPerBlock];
+
+                        AccDataType max = NumericLimits<AccDataType>::Lowest();
+
+                        for(index_t in = 0; in < n_tile; ++in)
+                        {
+                            const index_t n = n_begin + in;
+
+                            if(c0_matrix_mask.IsMaskedElement(m, n))
+                            {
+                                p_s[in] = -NumericLimits<AccDataType>::Infinity();
+                                continue;
+                            }
+
+                            arg.acc0_element_op_(p_s[in], p_s[in]);
+
+                            if(arg.p_d0_g_m_n_ != nullptr)
+                            {
+                                arg.c0de_element_op_(
+                                    p_s[in], p_s[in], (*arg.p_d0_g_m_n_)(g, m, n));
+                            }
+
+                            max = std::max(max, p_s[in]);
+                        }
+
+                        AccDataType sum = 0;
+
+                        for(index_t in = 0; in < n_tile; ++in)
+                        {
+                            p_s[in] = std::exp(p_s[in] - max);
+                            sum += p_s[in];
+                        }
+
+                        const AccDataType running_max_new = std::max(max, running_max[im]);
+                        const AccDataType running_sum_new =
+                            std::exp(running_max[im] - running_max_new) * running_sum[im] +
+                            std::exp(max - running_max_new) * sum;
+
+                        // gemm1, P is rounded to ADataType like the A1 operand of the kernel
+                        AccDataType* p_acc1 = &acc1[im * O];
+
+                        std::fill(p_acc1, p_acc1 + O, AccDataType{0});
+
+                        for(index_t in = 0; in < n_tile; ++in)
+                        {
+                            const AccDataType v_p =
+                                ck::type_convert<AccDataType>(ck::type_convert<ADataType>(p_s[in]));
+
+                            const B1DataType* p_b1_n = p_b1 + (n_begin + in) * b1_strides[1];
+
+                            for(index_t o = 0; o < O; ++o)
+                            {
+                                B1DataType v_b1;
+                                arg.b1_element_op_(v_b1, p_b1_n[o * b1_strides[2]]);
+
+                                p_acc1[o] += v_p * ck::type_convert<AccDataType>(v_b1);
+                            }
+                        }
+
+                        // O_new, rows without any unmasked element so far stay zero
+                        if(running_sum_new > 0)
+                        {
+                            AccDataType* p_c = &c[im * O];
+
+                            const AccDataType c_scale =
+                                running_sum[im] * std::exp(running_max[im] - running_max_new) /
+                                running_sum_new;
+                            const AccDataType acc1_scale =
+                                std::exp(max - running_max_new) / running_sum_new;
+
+                            for(index_t o = 0; o < O; ++o)
+                                p_c[o] = c_scale * p_c[o] + acc1_scale * p_acc1[o];
+                        }
+
+                        running_max[im] = running_max_new;
+                        running_sum[im] = running_sum_new;
+                    }
+                }
+
+                for(index_t im = 0; im < m_tile; ++im)
+                {
+                    for(index_t o = 0; o < O; ++o)
+                    {
+                        AccDataType v_c;
+                        arg.c_element_op_(v_c, c[im * O + o]);
+
+                        arg.c_g_m_o_(g, m_begin + im, o) = ck::type_convert<CDataType>(v_c);
+                    }
+                }
+            };
+
+            make_ParallelTensorFunctor(f_g_mblock, G, num_m_block)(
+                std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const Tensor<ADataType>& a_g_m_k,
+                             const Tensor<B0DataType>& b0_g_k_n,
+                             const Tensor<B1DataType>& b1_g_n_o,
+                             Tensor<CDataType>& c_g_m_o,
+                             AElementOperation a_element_op,
+                             B0ElementOperation b0_element_op,
+                             Acc0ElementOperation acc0_element_op,
+                             B1ElementOperation b1_element_op,
+                             CElementOperation c_element_op)
+    {
+        return Argument{a_g_m_k,
+                        b0_g_k_n,
+                        b1_g_n_o,
+                        c_g_m_o,
+                        nullptr,
+                        a_element_op,
+                        b0_element_op,
+                        acc0_element_op,
+                        C0DEElementOperation{},
+                        b1_element_op,
+                        c_element_op};
+    }
+
+    // with bias, the scores are c0de_element_op(acc0_element_op(A * B0), D0)
+    static auto MakeArgument(const Tensor<ADataType>& a_g_m_k,
+                             const Tensor<B0DataType>& b0_g_k_n,
+                             const Tensor<B1DataType>& b1_g_n_o,
+                             Tensor<CDataType>& c_g_m_o,
+                             const Tensor<D0DataType>& d0_g_m_n,
+                             AElementOperation a_element_op,
+                             B0ElementOperation b0_element_op,
+                             Acc0ElementOperation acc0_element_op,
+                             C0DEElementOperation c0de_element_op,
+                             B1ElementOperation b1_element_op,
+                             CElementOperation c_element_op)
+    {
+        return Argument{a_g_m_k,
+                        b0_g_k_n,
+                        b1_g_n_o,
+                        c_g_m_o,
+                        &d0_g_m_n,
+                        a_element_op,
+                        b0_element_op,
+                        acc0_element_op,
+                        c0de_element_op,
+                        b1_element_op,
+                        c_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceBatchedGemmSoftmaxGemm"
+            << "<" << MPerBlock << ", " << NPerBlock << ", "
+            << device::getMaskingSpecializationString(MaskingSpec) << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
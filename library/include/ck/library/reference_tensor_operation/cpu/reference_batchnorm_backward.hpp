@@ -11,6 +11,7 @@
 #include "ck/utility/math_v2.hpp"
 #include "ck/utility/ignore.hpp"
 #include "ck/library/utility/host_common_util.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_batchnorm_common.hpp"
 #include "ck/tensor_operation/gpu/device/device_batchnorm_backward.hpp"
 
 namespace ck {
@@ -177,88 +178,108 @@ struct ReferenceBatchNormBwd : public device::DeviceBatchNormBwd<XDataType,
         {
             using ck::host_common::get_offset_from_index;
 
-            auto thread_reduce_func = [&](auto invariant_index) {
-                size_t x_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.x_invariant_strides_, invariant_index);
-                size_t dy_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.dy_invariant_strides_, invariant_index);
-                size_t dx_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.dx_invariant_strides_, invariant_index);
+            const auto x_invariant_offsets =
+                get_offset_set<NumInvariantDim>(arg.x_invariant_strides_, arg.invariant_index_set_);
+            const auto dy_invariant_offsets = get_offset_set<NumInvariantDim>(
+                arg.dy_invariant_strides_, arg.invariant_index_set_);
+            const auto dx_invariant_offsets = get_offset_set<NumInvariantDim>(
+                arg.dx_invariant_strides_, arg.invariant_index_set_);
+            const auto x_reduce_offsets = get_offset_set<NumBatchNormReduceDim>(
+                arg.x_reduce_strides_, arg.reduce_index_set_);
+            const auto dy_reduce_offsets = get_offset_set<NumBatchNormReduceDim>(
+                arg.dy_reduce_strides_, arg.reduce_index_set_);
+            const auto dx_reduce_offsets = get_offset_set<NumBatchNormReduceDim>(
+                arg.dx_reduce_strides_, arg.reduce_index_set_);
 
-                AccDataType mean     = type_convert<AccDataType>(0.0f);
-                AccDataType variance = type_convert<AccDataType>(0.0f);
-                AccDataType invVar;
-                int32_t curr_count = 0;
+            const bool invariant_innermost = is_invariant_innermost<NumInvariantDim,
+                                                                    NumBatchNormReduceDim>(
+                arg.x_invariant_strides_, arg.x_reduce_strides_);
 
-                if(arg.haveSavedMeanInvVar_)
+            const std::size_t invariant_size = arg.invariant_index_set_.size();
+            const std::size_t reduce_size    = arg.reduce_index_set_.size();
+
+            const auto plan = get_batchnorm_thread_plan(invariant_size, reduce_size);
+
+            std::vector<AccDataType> means(invariant_size);
+            std::vector<AccDataType> invVars(invariant_size);
+
+            if(arg.haveSavedMeanInvVar_)
+            {
+                for(std::size_t i = 0; i < invariant_size; ++i)
                 {
                     size_t mean_invVar_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                        arg.bnMeanVarStrides_, invariant_index);
+                        arg.bnMeanVarStrides_, arg.invariant_index_set_[i]);
 
-                    mean =
+                    means[i] =
                         type_convert<AccDataType>(arg.p_savedMean_[mean_invVar_invariant_offset]);
-                    invVar =
+                    invVars[i] =
                         type_convert<AccDataType>(arg.p_savedInvVar_[mean_invVar_invariant_offset]);
                 }
-                else
-                {
-                    // compute mean, variance using welford method
-                    for(const auto& reduce_index : arg.reduce_index_set_)
-                    {
-                        size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                            arg.x_reduce_strides_, reduce_index);
-
-                        auto x_offset = x_invariant_offset + x_reduce_offset;
-
-                        curr_count++;
-
-                        AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
-
-                        AccDataType delta = x - mean;
-
-                        mean += delta / curr_count;
-
-                        AccDataType delta2 = x - mean;
-
-                        variance += delta * delta2;
-                    };
+            }
+            else
+            {
+                // compute mean, variance using blocked welford method
+                const auto welford = batchnorm_welford_reduce<AccDataType>(
+                    arg.p_x_, x_invariant_offsets, x_reduce_offsets, invariant_innermost);
 
-                    // actual variance
-                    variance = variance / curr_count;
+                for(std::size_t i = 0; i < invariant_size; ++i)
+                {
+                    means[i] = welford[i].GetMean();
 
                     // inv-variance defined as 1/sqrt(epsilon+variance)
-                    invVar =
-                        type_convert<AccDataType>(1.0f) / ck::math::sqrt(arg.epsilon_ + variance);
-                };
+                    invVars[i] = type_convert<AccDataType>(1.0f) /
+                                 ck::math::sqrt(arg.epsilon_ + welford[i].GetVariance());
+                }
+            };
 
-                AccDataType dbias =
-                    type_convert<AccDataType>(0.0f); // Sum on reduced dimensions of dy
-                AccDataType dscale =
-                    type_convert<AccDataType>(0.0f); // Sum on reduced dimensions of dy * norm_x
+            // 1) calculate dy * (x - mean) * inv-variance
+            // 2) calculate sum(dy) on reduced dimensions
+            // 3) calculate sum(dy * norm_x) on reduced dimensions
+            // the sums are kept in thread-local partials and merged afterwards
+            std::vector<std::vector<AccDataType>> dbias_partials(
+                plan.GetNumPartial(),
+                std::vector<AccDataType>(invariant_size, type_convert<AccDataType>(0)));
+            std::vector<std::vector<AccDataType>> dscale_partials(
+                plan.GetNumPartial(),
+                std::vector<AccDataType>(invariant_size, type_convert<AccDataType>(0)));
+
+            batchnorm_blocked_for_each(
+                invariant_size,
+                reduce_size,
+                plan,
+                invariant_innermost,
+                [&](std::size_t it, std::size_t i, std::size_t j) {
+                    AccDataType x = type_convert<AccDataType>(
+                        arg.p_x_[x_invariant_offsets[i] + x_reduce_offsets[j]]);
+
+                    AccDataType norm_x = (x - means[i]) * invVars[i];
+                    AccDataType dy     = type_convert<AccDataType>(
+                        arg.p_dy_[dy_invariant_offsets[i] + dy_reduce_offsets[j]]);
 
-                // 1) calculate dy * (x - mean) * inv-variance
-                // 2) calculate sum(dy) on reduced dimensions
-                // 3) calculate sum(dy * norm_x) on reduced dimensions
-                for(const auto& reduce_index : arg.reduce_index_set_)
-                {
-                    size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.x_reduce_strides_, reduce_index);
-                    size_t dy_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.dy_reduce_strides_, reduce_index);
+                    arg.dy_elementwise_op_(dy, dy);
 
-                    auto x_offset  = x_invariant_offset + x_reduce_offset;
-                    auto dy_offset = dy_invariant_offset + dy_reduce_offset;
+                    dbias_partials[it][i] += dy;
+                    dscale_partials[it][i] += norm_x * dy;
+                });
 
-                    AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
+            std::vector<AccDataType> dbiases(invariant_size);
+            std::vector<AccDataType> dscales(invariant_size);
+            std::vector<AccDataType> multipliers(invariant_size);
 
-                    AccDataType norm_x = (x - mean) * invVar;
-                    AccDataType dy     = type_convert<AccDataType>(arg.p_dy_[dy_offset]);
+            for(std::size_t i = 0; i < invariant_size; ++i)
+            {
+                const auto& invariant_index = arg.invariant_index_set_[i];
 
-                    arg.dy_elementwise_op_(dy, dy);
+                // Sum on reduced dimensions of dy
+                AccDataType dbias = type_convert<AccDataType>(0.0f);
+                // Sum on reduced dimensions of dy * norm_x
+                AccDataType dscale = type_convert<AccDataType>(0.0f);
 
-                    dbias += dy;
-                    dscale += norm_x * dy;
-                };
+                for(std::size_t it = 0; it < plan.GetNumPartial(); ++it)
+                {
+                    dbias += dbias_partials[it][i];
+                    dscale += dscale_partials[it][i];
+                }
 
                 size_t dscale_offset = get_offset_from_index<NumInvariantDim>(
                     arg.bnDscaleDbiasStrides_, invariant_index);
@@ -273,63 +294,39 @@ struct ReferenceBatchNormBwd : public device::DeviceBatchNormBwd<XDataType,
 
                 AccDataType scale = type_convert<AccDataType>(arg.p_scale_[scale_offset]);
 
-                AccDataType multiplier = type_convert<AccDataType>(1.0f) /
-                                         type_convert<AccDataType>(arg.reduceSize_) * invVar *
-                                         scale;
-
-                // 1) calculate tmp = dscale * (x - mean) * inv-variance
-                // 2) calculate dx = 1/reduceSize * inv-variance * scale * (reduceSize * dy - dbias
-                // - tmp)
-                for(const auto& reduce_index : arg.reduce_index_set_)
-                {
-                    size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.x_reduce_strides_, reduce_index);
-                    size_t dy_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.dy_reduce_strides_, reduce_index);
-                    size_t dx_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.dx_reduce_strides_, reduce_index);
-
-                    auto x_offset  = x_invariant_offset + x_reduce_offset;
-                    auto dy_offset = dy_invariant_offset + dy_reduce_offset;
-                    auto dx_offset = dx_invariant_offset + dx_reduce_offset;
-
-                    AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
+                dbiases[i]     = dbias;
+                dscales[i]     = dscale;
+                multipliers[i] = type_convert<AccDataType>(1.0f) /
+                                 type_convert<AccDataType>(arg.reduceSize_) * invVars[i] * scale;
+            }
 
-                    AccDataType norm_x = (x - mean) * invVar;
-                    AccDataType dy     = type_convert<AccDataType>(arg.p_dy_[dy_offset]);
+            // 1) calculate tmp = dscale * (x - mean) * inv-variance
+            // 2) calculate dx = 1/reduceSize * inv-variance * scale * (reduceSize * dy - dbias
+            // - tmp)
+            batchnorm_blocked_for_each(
+                invariant_size,
+                reduce_size,
+                plan,
+                invariant_innermost,
+                [&](std::size_t, std::size_t i, std::size_t j) {
+                    AccDataType x = type_convert<AccDataType>(
+                        arg.p_x_[x_invariant_offsets[i] + x_reduce_offsets[j]]);
+
+                    AccDataType norm_x = (x - means[i]) * invVars[i];
+                    AccDataType dy     = type_convert<AccDataType>(
+                        arg.p_dy_[dy_invariant_offsets[i] + dy_reduce_offsets[j]]);
 
                     arg.dy_elementwise_op_(dy, dy);
 
-                    AccDataType tmpVal = norm_x * dscale;
+                    AccDataType tmpVal = norm_x * dscales[i];
 
-                    AccDataType dx = multiplier * (type_convert<AccDataType>(arg.reduceSize_) * dy -
-                                                   dbias - tmpVal);
+                    AccDataType dx =
+                        multipliers[i] *
+                        (type_convert<AccDataType>(arg.reduceSize_) * dy - dbiases[i] - tmpVal);
 
-                    arg.p_dx_[dx_offset] = type_convert<DxDataType>(dx);
-                };
-            };
-
-            std::size_t num_thread = std::thread::hardware_concurrency();
-            std::size_t work_per_thread =
-                (arg.invariant_index_set_.size() + num_thread - 1) / num_thread;
-
-            std::vector<joinable_thread> threads(num_thread);
-
-            for(std::size_t it = 0; it < num_thread; ++it)
-            {
-                std::size_t i_begin = it * work_per_thread;
-                std::size_t i_end   = std::min(static_cast<size_t>((it + 1) * work_per_thread),
-                                             arg.invariant_index_set_.size());
-
-                auto f = [=] {
-                    for(std::size_t i = i_begin; i < i_end; ++i)
-                    {
-                        thread_reduce_func(arg.invariant_index_set_[i]);
-                    }
-                };
-
-                threads[it] = joinable_thread(f);
-            }
+                    arg.p_dx_[dx_invariant_offsets[i] + dx_reduce_offsets[j]] =
+                        type_convert<DxDataType>(dx);
+                });
 
             return (0.0f);
         };
@@ -0,0 +1,200 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/type_convert.hpp"
+#include "ck/library/utility/host_common_util.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// Host counterpart of ThreadwiseWelford::Update() and BlockwiseWelford::Merge(), var_ keeps the
+// sum of squared differences (M2) until GetVariance() is called
+template <typename AccDataType>
+struct HostWelford
+{
+    void Update(AccDataType x)
+    {
+        if(std::isnan(x))
+        {
+            mean_ = x;
+            var_  = x;
+        }
+        else
+        {
+            ++count_;
+
+            AccDataType delta = x - mean_;
+            mean_ += delta / type_convert<AccDataType>(count_);
+            AccDataType delta2 = x - mean_;
+            var_ += delta * delta2;
+        }
+    }
+
+    void Merge(const HostWelford& other)
+    {
+        int count = count_ + other.count_;
+        AccDataType count_b_over_count =
+            count == 0 ? type_convert<AccDataType>(0)
+                       : type_convert<AccDataType>(other.count_) / type_convert<AccDataType>(count);
+        AccDataType delta = other.mean_ - mean_;
+        mean_ += delta * count_b_over_count;
+        var_ += other.var_ + delta * delta * type_convert<AccDataType>(count_) * count_b_over_count;
+        count_ = count;
+    }
+
+    AccDataType GetMean() const { return mean_; }
+
+    AccDataType GetVariance() const
+    {
+        return count_ == 0 ? type_convert<AccDataType>(0)
+                           : var_ / type_convert<AccDataType>(count_);
+    }
+
+    AccDataType mean_ = type_convert<AccDataType>(0);
+    AccDataType var_  = type_convert<AccDataType>(0);
+    int count_        = 0;
+};
+
+// offset of every index in index_set, precomputed once so the hot loops only add two offsets
+template <int NDim>
+std::vector<size_t> get_offset_set(const std::array<index_t, NDim>& strides,
+                                   const std::vector<std::array<index_t, NDim>>& index_set)
+{
+    std::vector<size_t> offsets(index_set.size());
+
+    std::transform(index_set.begin(), index_set.end(), offsets.begin(), [&](const auto& index) {
+        return ck::host_common::get_offset_from_index<NDim>(strides, index);
+    });
+
+    return offsets;
+}
+
+// true if the fastest changing dimension of x is an invariant one (eg. C of NHWC), in which case
+// the channels are visited in the inner loop to stream x in memory order
+template <int NumInvariantDim, int NumReduceDim>
+bool is_invariant_innermost(const std::array<index_t, NumInvariantDim>& invariant_strides,
+                            const std::array<index_t, NumReduceDim>& reduce_strides)
+{
+    return *std::min_element(invariant_strides.begin(), invariant_strides.end()) <
+           *std::min_element(reduce_strides.begin(), reduce_strides.end());
+}
+
+// Threads of the blocked batchnorm loops. The invariant indices are split over the threads when
+// there are enough of them, otherwise the reduce indices are, and every thread then keeps
+// partials of all invariant indices.
+struct BatchNormThreadPlan
+{
+    std::size_t num_thread_;
+    bool split_reduce_;
+
+    // thread-local partials of every invariant index
+    std::size_t GetNumPartial() const { return split_reduce_ ? num_thread_ : 1; }
+};
+
+inline BatchNormThreadPlan
+get_batchnorm_thread_plan(std::size_t invariant_size,
+                          std::size_t reduce_size,
+                          std::size_t max_num_thread = std::thread::hardware_concurrency())
+{
+    max_num_thread = std::max<std::size_t>(1, max_num_thread);
+
+    if(invariant_size >= max_num_thread)
+        return {max_num_thread, false};
+
+    return {std::max<std::size_t>(1, std::min(max_num_thread, reduce_size)), true};
+}
+
+// Blocked iteration over the [invariant, reduce] index space. The dimension chosen by the plan is
+// split into one contiguous chunk per thread, and partial_id tells the thread-local partials
+// apart when the reduce indices are split (it is always 0 otherwise).
+// f(partial_id, invariant_id, reduce_id)
+template <typename F>
+void batchnorm_blocked_for_each(std::size_t invariant_size,
+                                std::size_t reduce_size,
+                                const BatchNormThreadPlan& plan,
+                                bool invariant_innermost,
+                                F f)
+{
+    const std::size_t split_size      = plan.split_reduce_ ? reduce_size : invariant_size;
+    const std::size_t work_per_thread = (split_size + plan.num_thread_ - 1) / plan.num_thread_;
+
+    std::vector<joinable_thread> threads(plan.num_thread_);
+
+    for(std::size_t it = 0; it < plan.num_thread_; ++it)
+    {
+        const std::size_t begin = std::min(it * work_per_thread, split_size);
+        const std::size_t end   = std::min((it + 1) * work_per_thread, split_size);
+
+        const std::size_t i_begin    = plan.split_reduce_ ? 0 : begin;
+        const std::size_t i_end      = plan.split_reduce_ ? invariant_size : end;
+        const std::size_t j_begin    = plan.split_reduce_ ? begin : 0;
+        const std::size_t j_end      = plan.split_reduce_ ? end : reduce_size;
+        const std::size_t partial_id = plan.split_reduce_ ? it : 0;
+
+        auto thread_func = [=, &f] {
+            if(invariant_innermost)
+            {
+                for(std::size_t j = j_begin; j < j_end; ++j)
+                    for(std::size_t i = i_begin; i < i_end; ++i)
+                        f(partial_id, i, j);
+            }
+            else
+            {
+                for(std::size_t i = i_begin; i < i_end; ++i)
+                    for(std::size_t j = j_begin; j < j_end; ++j)
+                        f(partial_id, i, j);
+            }
+        };
+
+        threads[it] = joinable_thread(thread_func);
+    }
+}
+
+// Single pass mean/variance of every channel: thread-local Welford partials over blocks of the
+// reduce dimensions followed by a merge step
+template <typename AccDataType, typename XDataType>
+std::vector<HostWelford<AccDataType>>
+batchnorm_welford_reduce(const XDataType* p_x,
+                         const std::vector<size_t>& x_invariant_offsets,
+                         const std::vector<size_t>& x_reduce_offsets,
+                         bool invariant_innermost)
+{
+    const std::size_t invariant_size = x_invariant_offsets.size();
+    const std::size_t reduce_size    = x_reduce_offsets.size();
+    const auto plan                  = get_batchnorm_thread_plan(invariant_size, reduce_size);
+
+    std::vector<std::vector<HostWelford<AccDataType>>> partials(
+        plan.GetNumPartial(), std::vector<HostWelford<AccDataType>>(invariant_size));
+
+    batchnorm_blocked_for_each(
+        invariant_size,
+        reduce_size,
+        plan,
+        invariant_innermost,
+        [&](std::size_t it, std::size_t i, std::size_t j) {
+            partials[it][i].Update(
+                type_convert<AccDataType>(p_x[x_invariant_offsets[i] + x_reduce_offsets[j]]));
+        });
+
+    for(std::size_t it = 1; it < plan.GetNumPartial(); ++it)
+        for(std::size_t i = 0; i < invariant_size; ++i)
+            partials[0][i].Merge(partials[it][i]);
+
+    return partials[0];
+}
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -11,6 +11,7 @@
 #include "ck/utility/math_v2.hpp"
 #include "ck/utility/ignore.hpp"
 #include "ck/library/utility/host_common_util.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_batchnorm_common.hpp"
 #include "ck/tensor_operation/gpu/device/device_batchnorm_forward.hpp"
 
 namespace ck {
@@ -170,38 +171,37 @@ struct ReferenceBatchNormFwd : public device::DeviceBatchNormFwd<XDataType,
         {
             using ck::host_common::get_offset_from_index;
 
-            auto thread_reduce_func = [&](auto invariant_index) {
-                size_t x_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.x_invariant_strides_, invariant_index);
-                size_t y_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.y_invariant_strides_, invariant_index);
-                AccDataType mean     = type_convert<AccDataType>(0.0f);
-                AccDataType variance = type_convert<AccDataType>(0.0f);
-                int32_t curr_count   = 0;
-
-                // compute mean, variance using welford method
-                for(const auto& reduce_index : arg.reduce_index_set_)
-                {
-                    size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.x_reduce_strides_, reduce_index);
-
-                    auto x_offset = x_invariant_offset + x_reduce_offset;
-
-                    curr_count++;
+            const auto x_invariant_offsets =
+                get_offset_set<NumInvariantDim>(arg.x_invariant_strides_, arg.invariant_index_set_);
+            const auto y_invariant_offsets =
+                get_offset_set<NumInvariantDim>(arg.y_invariant_strides_, arg.invariant_index_set_);
+            const auto x_reduce_offsets = get_offset_set<NumBatchNormReduceDim>(
+                arg.x_reduce_strides_, arg.reduce_index_set_);
+            const auto y_reduce_offsets = get_offset_set<NumBatchNormReduceDim>(
+                arg.y_reduce_strides_, arg.reduce_index_set_);
 
-                    AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
+            const bool invariant_innermost = is_invariant_innermost<NumInvariantDim,
+                                                                    NumBatchNormReduceDim>(
+                arg.x_invariant_strides_, arg.x_reduce_strides_);
 
-                    AccDataType delta = x - mean;
+            const std::size_t invariant_size = arg.invariant_index_set_.size();
+            const std::size_t reduce_size    = arg.reduce_index_set_.size();
 
-                    mean += delta / curr_count;
+            // compute mean, variance using blocked welford method
+            const auto welford = batchnorm_welford_reduce<AccDataType>(
+                arg.p_x_, x_invariant_offsets, x_reduce_offsets, invariant_innermost);
 
-                    AccDataType delta2 = x - mean;
+            std::vector<AccDataType> means(invariant_size);
+            std::vector<AccDataType> invVariances(invariant_size);
+            std::vector<AccDataType> scales(invariant_size);
+            std::vector<AccDataType> biases(invariant_size);
 
-                    variance += delta * delta2;
-                };
+            for(std::size_t i = 0; i < invariant_size; ++i)
+            {
+                const auto& invariant_index = arg.invariant_index_set_[i];
 
-                // actual variance
-                variance = variance / curr_count;
+                AccDataType mean     = welford[i].GetMean();
+                AccDataType variance = welford[i].GetVariance();
 
                 // inv-variance defined as 1/sqrt(epsilon+variance)
                 AccDataType invVariance =
@@ -230,7 +230,8 @@ struct ReferenceBatchNormFwd : public device::DeviceBatchNormFwd<XDataType,
                             oneMinusAverageFactor +
                         mean * arg.averageFactor_);
                     arg.resultRunningVariance_[offset] = type_convert<MeanVarDataType>(
-                        arg.resultRunningVariance_[offset] * oneMinusAverageFactor +
+                        type_convert<AccDataType>(arg.resultRunningVariance_[offset]) *
+                            oneMinusAverageFactor +
                         variance * arg.averageFactor_);
                 };
 
@@ -239,53 +240,31 @@ struct ReferenceBatchNormFwd : public device::DeviceBatchNormFwd<XDataType,
                 size_t bias_offset =
                     get_offset_from_index<NumInvariantDim>(arg.bnBiasStrides_, invariant_index);
 
-                AccDataType scale = type_convert<AccDataType>(arg.bnScale_[scale_offset]);
-                AccDataType bias  = type_convert<AccDataType>(arg.bnBias_[bias_offset]);
-
-                // Normalization
-                for(const auto& reduce_index : arg.reduce_index_set_)
-                {
-                    size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.x_reduce_strides_, reduce_index);
-                    size_t y_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.y_reduce_strides_, reduce_index);
-
-                    auto x_offset = x_invariant_offset + x_reduce_offset;
-                    auto y_offset = y_invariant_offset + y_reduce_offset;
+                means[i]        = mean;
+                invVariances[i] = invVariance;
+                scales[i]       = type_convert<AccDataType>(arg.bnScale_[scale_offset]);
+                biases[i]       = type_convert<AccDataType>(arg.bnBias_[bias_offset]);
+            }
 
-                    AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
+            // Normalization
+            batchnorm_blocked_for_each(
+                invariant_size,
+                reduce_size,
+                get_batchnorm_thread_plan(invariant_size, reduce_size),
+                invariant_innermost,
+                [&](std::size_t, std::size_t i, std::size_t j) {
+                    AccDataType x = type_convert<AccDataType>(
+                        arg.p_x_[x_invariant_offsets[i] + x_reduce_offsets[j]]);
 
-                    AccDataType norm_x = (x - mean) * invVariance;
+                    AccDataType norm_x = (x - means[i]) * invVariances[i];
 
-                    AccDataType y = scale * norm_x + bias;
+                    AccDataType y = scales[i] * norm_x + biases[i];
 
                     arg.y_elementwise_op_(y, y);
 
-                    arg.p_y_[y_offset] = type_convert<YDataType>(y);
-                };
-            };
-
-            std::size_t num_thread = std::thread::hardware_concurrency();
-            std::size_t work_per_thread =
-                (arg.invariant_index_set_.size() + num_thread - 1) / num_thread;
-
-            std::vector<joinable_thread> threads(num_thread);
-
-            for(std::size_t it = 0; it < num_thread; ++it)
-            {
-                std::size_t i_begin = it * work_per_thread;
-                std::size_t i_end   = std::min(static_cast<size_t>((it + 1) * work_per_thread),
-                                             arg.invariant_index_set_.size());
-
-                auto f = [=] {
-                    for(std::size_t i = i_begin; i < i_end; ++i)
-                    {
-                        thread_reduce_func(arg.invariant_index_set_[i]);
-                    }
-                };
-
-                threads[it] = joinable_thread(f);
-            }
+                    arg.p_y_[y_invariant_offsets[i] + y_reduce_offsets[j]] =
+                        type_convert<YDataType>(y);
+                });
 
             return (0.0f);
         };
@@ -9,6 +9,7 @@
 #include <algorithm>
 
 #include "ck/library/utility/host_common_util.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_batchnorm_common.hpp"
 #include "ck/tensor_operation/gpu/device/device_batchnorm_infer.hpp"
 
 namespace ck {
@@ -156,11 +157,30 @@ struct ReferenceBatchNormInfer : public device::DeviceBatchNormInfer<XDataType,
         {
             using ck::host_common::get_offset_from_index;
 
-            auto thread_reduce_func = [&](auto invariant_index) {
-                size_t x_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.x_invariant_strides_, invariant_index);
-                size_t y_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.y_invariant_strides_, invariant_index);
+            const auto x_invariant_offsets =
+                get_offset_set<NumInvariantDim>(arg.x_invariant_strides_, arg.invariant_index_set_);
+            const auto y_invariant_offsets =
+                get_offset_set<NumInvariantDim>(arg.y_invariant_strides_, arg.invariant_index_set_);
+            const auto x_reduce_offsets = get_offset_set<NumBatchNormReduceDim>(
+                arg.x_reduce_strides_, arg.reduce_index_set_);
+            const auto y_reduce_offsets = get_offset_set<NumBatchNormReduceDim>(
+                arg.y_reduce_strides_, arg.reduce_index_set_);
+
+            const bool invariant_innermost = is_invariant_innermost<NumInvariantDim,
+                                                                    NumBatchNormReduceDim>(
+                arg.x_invariant_strides_, arg.x_reduce_strides_);
+
+            const std::size_t invariant_size = arg.invariant_index_set_.size();
+            const std::size_t reduce_size    = arg.reduce_index_set_.size();
+
+            std::vector<AccDataType> means(invariant_size);
+            std::vector<AccDataType> invVariances(invariant_size);
+            std::vector<AccDataType> scales(invariant_size);
+            std::vector<AccDataType> biases(invariant_size);
+
+            for(std::size_t i = 0; i < invariant_size; ++i)
+            {
+                const auto& invariant_index = arg.invariant_index_set_[i];
 
                 size_t mean_variance_offset =
                     get_offset_from_index<NumInvariantDim>(arg.bnMeanVarStrides_, invariant_index);
@@ -168,62 +188,38 @@ struct ReferenceBatchNormInfer : public device::DeviceBatchNormInfer<XDataType,
                 AccDataType mean     = arg.estimatedMean_[mean_variance_offset];
                 AccDataType variance = arg.estimatedVariance_[mean_variance_offset];
 
-                // inv-variance defined as 1/sqrt(epsilon+variance)
-                AccDataType invVariance =
-                    type_convert<AccDataType>(1.0f) / std::sqrt(arg.epsilon_ + variance);
-
                 size_t scale_offset =
                     get_offset_from_index<NumInvariantDim>(arg.bnScaleStrides_, invariant_index);
                 size_t bias_offset =
                     get_offset_from_index<NumInvariantDim>(arg.bnBiasStrides_, invariant_index);
 
-                AccDataType scale = type_convert<AccDataType>(arg.bnScale_[scale_offset]);
-                AccDataType bias  = type_convert<AccDataType>(arg.bnBias_[bias_offset]);
-
-                // normalization
-                for(const auto& reduce_index : arg.reduce_index_set_)
-                {
-                    size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.x_reduce_strides_, reduce_index);
-                    size_t y_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.y_reduce_strides_, reduce_index);
-
-                    auto x_offset = x_invariant_offset + x_reduce_offset;
-                    auto y_offset = y_invariant_offset + y_reduce_offset;
+                means[i] = mean;
+                // inv-variance defined as 1/sqrt(epsilon+variance)
+                invVariances[i] =
+                    type_convert<AccDataType>(1.0f) / std::sqrt(arg.epsilon_ + variance);
+                scales[i] = type_convert<AccDataType>(arg.bnScale_[scale_offset]);
+                biases[i] = type_convert<AccDataType>(arg.bnBias_[bias_offset]);
+            }
 
-                    AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
+            // normalization
+            batchnorm_blocked_for_each(
+                invariant_size,
+                reduce_size,
+                get_batchnorm_thread_plan(invariant_size, reduce_size),
+                invariant_innermost,
+                [&](std::size_t, std::size_t i, std::size_t j) {
+                    AccDataType x = type_convert<AccDataType>(
+                        arg.p_x_[x_invariant_offsets[i] + x_reduce_offsets[j]]);
 
-                    AccDataType norm_x = (x - mean) * invVariance;
+                    AccDataType norm_x = (x - means[i]) * invVariances[i];
 
-                    AccDataType y = scale * norm_x + bias;
+                    AccDataType y = scales[i] * norm_x + biases[i];
 
                     arg.y_elementwise_op_(y, y);
 
-                    arg.p_y_[y_offset] = type_convert<YDataType>(y);
-                };
-            };
-
-            std::size_t num_thread = std::thread::hardware_concurrency();
-            std::size_t work_per_thread =
-                (arg.invariant_index_set_.size() + num_thread - 1) / num_thread;
-
-            std::vector<joinable_thread> threads(num_thread);
-
-            for(std::size_t it = 0; it < num_thread; ++it)
-            {
-                std::size_t i_begin = it * work_per_thread;
-                std::size_t i_end   = std::min(static_cast<size_t>((it + 1) * work_per_thread),
-                                             arg.invariant_index_set_.size());
-
-                auto f = [=] {
-                    for(std::size_t i = i_begin; i < i_end; ++i)
-                    {
-                        thread_reduce_func(arg.invariant_index_set_[i]);
-                    }
-                };
-
-                threads[it] = joinable_thread(f);
-            }
+                    arg.p_y_[y_invariant_offsets[i] + y_reduce_offsets[j]] =
+                        type_convert<YDataType>(y);
+                });
 
             return (0.0f);
         };
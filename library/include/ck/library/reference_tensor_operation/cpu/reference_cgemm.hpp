@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
 
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm_common.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 
@@ -14,6 +17,17 @@ namespace ck {
 namespace tensor_operation {
 namespace host {
 
+// FourM: Cr = Ar * Br - Ai * Bi, Ci = Ar * Bi + Ai * Br, four real products
+// ThreeM: Cr = Ar * Br - Ai * Bi, Ci = (Ar + Ai) * (Br + Bi) - Ar * Br - Ai * Bi, one real product
+//         less but larger rounding errors in Ci when |A| |B| is much larger than |Ci|
+enum struct CGemmAlgorithm
+{
+    FourM,
+    ThreeM
+};
+
+// The real products of the selected algorithm are computed in a single pass of the blocked host
+// GEMM, which then combines them into the real and imaginary parts of C.
 // FIXME: support arbitrary elementwise operation for A/B/C
 template <
     typename ADataType,
@@ -40,7 +54,8 @@ struct ReferenceCGemm : public device::BaseOperator
                  Tensor<CDataType>& c_m_n_imag,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
-                 CElementwiseOperation c_element_op)
+                 CElementwiseOperation c_element_op,
+                 CGemmAlgorithm algorithm)
             : a_m_k_real_{a_m_k_real},
               a_m_k_imag_{a_m_k_imag},
               b_k_n_real_{b_k_n_real},
@@ -49,7 +64,8 @@ struct ReferenceCGemm : public device::BaseOperator
               c_m_n_imag_{c_m_n_imag},
               a_element_op_{a_element_op},
               b_element_op_{b_element_op},
-              c_element_op_{c_element_op}
+              c_element_op_{c_element_op},
+              algorithm_{algorithm}
         {
         }
 
@@ -63,6 +79,8 @@ struct ReferenceCGemm : public device::BaseOperator
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
         CElementwiseOperation c_element_op_;
+
+        CGemmAlgorithm algorithm_;
     };
 
     // Invoker
@@ -79,46 +97,59 @@ struct ReferenceCGemm : public device::BaseOperator
                 throw std::runtime_error("wrong! Incompatible real and imag sizes in CGEMM");
             }
 
-            auto f_mk_kn_mn_real = [&](auto m, auto n) {
-                float v_c_real = 0;
-
-                for(std::size_t k = 0; k < K; ++k)
-                {
-                    float v_a_real = ck::type_convert<float>(arg.a_m_k_real_(m, k));
-                    float v_a_imag = ck::type_convert<float>(arg.a_m_k_imag_(m, k));
-                    float v_b_real = ck::type_convert<float>(arg.b_k_n_real_(k, n));
-                    float v_b_imag = ck::type_convert<float>(arg.b_k_n_imag_(k, n));
+            const std::size_t M = arg.c_m_n_real_.mDesc.GetLengths()[0];
+            const std::size_t N = arg.c_m_n_real_.mDesc.GetLengths()[1];
 
-                    v_c_real += v_a_real * v_b_real - v_a_imag * v_b_imag;
-                }
-
-                arg.c_m_n_real_(m, n) = ck::type_convert<CDataType>(v_c_real);
+            auto a_real = [&](std::size_t m, std::size_t k) {
+                return ck::type_convert<float>(arg.a_m_k_real_(m, k));
+            };
+            auto a_imag = [&](std::size_t m, std::size_t k) {
+                return ck::type_convert<float>(arg.a_m_k_imag_(m, k));
+            };
+            auto b_real = [&](std::size_t n, std::size_t k) {
+                return ck::type_convert<float>(arg.b_k_n_real_(k, n));
+            };
+            auto b_imag = [&](std::size_t n, std::size_t k) {
+                return ck::type_convert<float>(arg.b_k_n_imag_(k, n));
             };
 
-            auto f_mk_kn_mn_imag = [&](auto m, auto n) {
-                float v_c_imag = 0;
-
-                for(std::size_t k = 0; k < K; ++k)
-                {
-                    float v_a_real = ck::type_convert<float>(arg.a_m_k_real_(m, k));
-                    float v_a_imag = ck::type_convert<float>(arg.a_m_k_imag_(m, k));
-                    float v_b_real = ck::type_convert<float>(arg.b_k_n_real_(k, n));
-                    float v_b_imag = ck::type_convert<float>(arg.b_k_n_imag_(k, n));
-
-                    v_c_imag += v_a_real * v_b_imag + v_a_imag * v_b_real;
-                }
-
+            auto store = [&](std::size_t m, std::size_t n, float v_c_real, float v_c_imag) {
+                arg.c_m_n_real_(m, n) = ck::type_convert<CDataType>(v_c_real);
                 arg.c_m_n_imag_(m, n) = ck::type_convert<CDataType>(v_c_imag);
             };
 
-            make_ParallelTensorFunctor(f_mk_kn_mn_real,
-                                       arg.c_m_n_real_.mDesc.GetLengths()[0],
-                                       arg.c_m_n_real_.mDesc.GetLengths()[1])(
-                std::thread::hardware_concurrency());
-            make_ParallelTensorFunctor(f_mk_kn_mn_imag,
-                                       arg.c_m_n_imag_.mDesc.GetLengths()[0],
-                                       arg.c_m_n_imag_.mDesc.GetLengths()[1])(
-                std::thread::hardware_concurrency());
+            if(arg.algorithm_ == CGemmAlgorithm::ThreeM)
+            {
+                // Ar * Br, Ai * Bi, (Ar + Ai) * (Br + Bi)
+                auto get_a = [&](index_t p, std::size_t m, std::size_t k) {
+                    return p == 0 ? a_real(m, k)
+                                  : p == 1 ? a_imag(m, k) : a_real(m, k) + a_imag(m, k);
+                };
+                auto get_b = [&](index_t p, std::size_t n, std::size_t k) {
+                    return p == 0 ? b_real(n, k)
+                                  : p == 1 ? b_imag(n, k) : b_real(n, k) + b_imag(n, k);
+                };
+                auto store_c = [&](std::size_t m, std::size_t n, const std::array<float, 3>& acc) {
+                    store(m, n, acc[0] - acc[1], acc[2] - acc[0] - acc[1]);
+                };
+
+                blocked_gemm<float, 3>(M, N, K, get_a, get_b, store_c);
+            }
+            else
+            {
+                // Ar * Br, Ai * Bi, Ar * Bi, Ai * Br
+                auto get_a = [&](index_t p, std::size_t m, std::size_t k) {
+                    return p % 2 == 0 ? a_real(m, k) : a_imag(m, k);
+                };
+                auto get_b = [&](index_t p, std::size_t n, std::size_t k) {
+                    return p == 0 || p == 3 ? b_real(n, k) : b_imag(n, k);
+                };
+                auto store_c = [&](std::size_t m, std::size_t n, const std::array<float, 4>& acc) {
+                    store(m, n, acc[0] - acc[1], acc[2] + acc[3]);
+                };
+
+                blocked_gemm<float, 4>(M, N, K, get_a, get_b, store_c);
+            }
 
             return 0;
         }
@@ -146,7 +177,8 @@ struct ReferenceCGemm : public device::BaseOperator
                              Tensor<CDataType>& c_m_n_imag,
                              AElementwiseOperation a_element_op,
                              BElementwiseOperation b_element_op,
-                             CElementwiseOperation c_element_op)
+                             CElementwiseOperation c_element_op,
+                             CGemmAlgorithm algorithm = CGemmAlgorithm::FourM)
     {
         return Argument{a_m_k_real,
                         a_m_k_imag,
@@ -156,7 +188,8 @@ struct ReferenceCGemm : public device::BaseOperator
                         c_m_n_imag,
                         a_element_op,
                         b_element_op,
-                        c_element_op};
+                        c_element_op,
+                        algorithm};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
@@ -3,11 +3,14 @@
 
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm_common.hpp"
 
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 
@@ -15,7 +18,8 @@ namespace ck {
 namespace tensor_operation {
 namespace host {
 
-// hardcoded for NumDimM == NumDimN == NumDimK == 2
+// C[ms, ns] = sum_ks A[ms, ks] * B[ns, ks] for any number of M, N and K modes. The modes are
+// flattened into strided M, N and K dimensions which are handed to the blocked host GEMM.
 template <ck::index_t NumDimM,
           ck::index_t NumDimN,
           ck::index_t NumDimK,
@@ -25,9 +29,8 @@ template <ck::index_t NumDimM,
           typename AccDataType,
           typename ComputeDataType,
           typename AElementwiseOperation,
-          typename BElementwiseOperation,
-          ck::enable_if_t<NumDimM == 2 && NumDimN == 2 && NumDimK == 2, bool> = false>
-struct ReferenceContraction_M2_N2_K2 : public ck::tensor_operation::device::BaseOperator
+          typename BElementwiseOperation>
+struct ReferenceContraction : public ck::tensor_operation::device::BaseOperator
 {
     // Argument
     struct Argument : public ck::tensor_operation::device::BaseArgument
@@ -56,46 +59,64 @@ struct ReferenceContraction_M2_N2_K2 : public ck::tensor_operation::device::Base
     // Invoker
     struct Invoker : public ck::tensor_operation::device::BaseInvoker
     {
-        using Argument = ReferenceContraction_M2_N2_K2::Argument;
+        using Argument = ReferenceContraction::Argument;
 
         float Run(const Argument& arg)
         {
-            auto f_ms_ns = [&](auto m0, auto m1, auto n0, auto n1) {
-                const ck::index_t K0 = arg.a_ms_ks_.mDesc.GetLengths()[2];
-                const ck::index_t K1 = arg.a_ms_ks_.mDesc.GetLengths()[3];
-
-                AccDataType v_acc = 0;
-
-                for(ck::index_t k0 = 0; k0 < K0; ++k0)
-                {
-                    for(ck::index_t k1 = 0; k1 < K1; ++k1)
-                    {
-                        // Simulate the possible casting when ComputeDataType is different than the
-                        // A/B data types
-                        ComputeDataType v_a_compute_input =
-                            ck::type_convert<ComputeDataType>(arg.a_ms_ks_(m0, m1, k0, k1));
-                        ComputeDataType v_b_compute_input =
-                            ck::type_convert<ComputeDataType>(arg.b_ns_ks_(n0, n1, k0, k1));
-
-                        AccDataType v_a;
-                        AccDataType v_b;
-
-                        arg.a_element_op_(v_a, ck::type_convert<AccDataType>(v_a_compute_input));
-                        arg.b_element_op_(v_b, ck::type_convert<AccDataType>(v_b_compute_input));
-
-                        v_acc += v_a * v_b;
-                    }
-                }
-
-                arg.c_ms_ns_(m0, m1, n0, n1) = ck::type_convert<CDataType>(v_acc);
+            const auto& a_desc = arg.a_ms_ks_.mDesc;
+            const auto& b_desc = arg.b_ns_ks_.mDesc;
+            const auto& c_desc = arg.c_ms_ns_.mDesc;
+
+            constexpr std::size_t NumDimMK = NumDimM + NumDimK;
+            constexpr std::size_t NumDimNK = NumDimN + NumDimK;
+            constexpr std::size_t NumDimMN = NumDimM + NumDimN;
+
+            if(a_desc.GetNumOfDimension() != NumDimMK || b_desc.GetNumOfDimension() != NumDimNK ||
+               c_desc.GetNumOfDimension() != NumDimMN)
+            {
+                throw std::runtime_error("wrong! Inconsistent number of modes in contraction");
+            }
+
+            const auto a_m_offsets = get_mode_offsets(a_desc, 0, NumDimM);
+            const auto a_k_offsets = get_mode_offsets(a_desc, NumDimM, NumDimMK);
+            const auto b_n_offsets = get_mode_offsets(b_desc, 0, NumDimN);
+            const auto b_k_offsets = get_mode_offsets(b_desc, NumDimN, NumDimNK);
+            const auto c_m_offsets = get_mode_offsets(c_desc, 0, NumDimM);
+            const auto c_n_offsets = get_mode_offsets(c_desc, NumDimM, NumDimMN);
+
+            const ADataType* p_a = arg.a_ms_ks_.mData.data();
+            const BDataType* p_b = arg.b_ns_ks_.mData.data();
+            CDataType* p_c       = arg.c_ms_ns_.mData.data();
+
+            // Simulate the possible casting when ComputeDataType is different than the A/B data
+            // types
+            auto get_a = [&](index_t, std::size_t m, std::size_t k) {
+                AccDataType v_a;
+
+                arg.a_element_op_(v_a,
+                                  ck::type_convert<AccDataType>(ck::type_convert<ComputeDataType>(
+                                      p_a[a_m_offsets[m] + a_k_offsets[k]])));
+
+                return v_a;
+            };
+
+            auto get_b = [&](index_t, std::size_t n, std::size_t k) {
+                AccDataType v_b;
+
+                arg.b_element_op_(v_b,
+                                  ck::type_convert<AccDataType>(ck::type_convert<ComputeDataType>(
+                                      p_b[b_n_offsets[n] + b_k_offsets[k]])));
+
+                return v_b;
             };
 
-            make_ParallelTensorFunctor(f_ms_ns,
-                                       arg.c_ms_ns_.mDesc.GetLengths()[0],
-                                       arg.c_ms_ns_.mDesc.GetLengths()[1],
-                                       arg.c_ms_ns_.mDesc.GetLengths()[2],
-                                       arg.c_ms_ns_.mDesc.GetLengths()[3])(
-                std::thread::hardware_concurrency());
+            auto store_c =
+                [&](std::size_t m, std::size_t n, const std::array<AccDataType, 1>& acc) {
+                    p_c[c_m_offsets[m] + c_n_offsets[n]] = ck::type_convert<CDataType>(acc[0]);
+                };
+
+            blocked_gemm<AccDataType, 1>(
+                c_m_offsets.size(), c_n_offsets.size(), a_k_offsets.size(), get_a, get_b, store_c);
 
             return 0;
         }
@@ -139,7 +160,8 @@ struct ReferenceContraction_M2_N2_K2 : public ck::tensor_operation::device::Base
         auto str = std::stringstream();
 
         // clang-format off
-        str << "ReferenceContraction_M2_N2_K2"
+        str << "ReferenceContraction"
+            << "<" << NumDimM << ", " << NumDimN << ", " << NumDimK << ">"
             << std::endl;
         // clang-format on
 
@@ -147,6 +169,28 @@ struct ReferenceContraction_M2_N2_K2 : public ck::tensor_operation::device::Base
     }
 };
 
+template <ck::index_t NumDimM,
+          ck::index_t NumDimN,
+          ck::index_t NumDimK,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AccDataType,
+          typename ComputeDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          ck::enable_if_t<NumDimM == 2 && NumDimN == 2 && NumDimK == 2, bool> = false>
+using ReferenceContraction_M2_N2_K2 = ReferenceContraction<NumDimM,
+                                                           NumDimN,
+                                                           NumDimK,
+                                                           ADataType,
+                                                           BDataType,
+                                                           CDataType,
+                                                           AccDataType,
+                                                           ComputeDataType,
+                                                           AElementwiseOperation,
+                                                           BElementwiseOperation>;
+
 } // namespace host
 } // namespace tensor_operation
 } // namespace ck
@@ -16,6 +16,7 @@
 
 #include "ck/library/utility/algorithm.hpp"
 #include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/error_bound.hpp"
 #include "ck/library/utility/fill.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/convolution_parameter.hpp"
@@ -78,10 +79,14 @@ struct ReferenceConvFwd : public device::BaseOperator
             OutElementwiseOperation out_element_op,
             const std::array<Tensor<InDataType>, NumAElementwiseTensor>& elementwise_a_tensors,
             const std::array<Tensor<WeiDataType>, NumBElementwiseTensor>& elementwise_b_tensors,
-            const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors)
+            const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors,
+            Tensor<double>* p_output_err_bound   = nullptr,
+            utils::ErrorBoundMode err_bound_mode = utils::ErrorBoundMode::Probabilistic)
             : input_{input},
               weight_{weight},
               output_{output},
+              p_output_err_bound_{p_output_err_bound},
+              err_bound_mode_{err_bound_mode},
               elementwise_a_tensors_{elementwise_a_tensors},
               elementwise_b_tensors_{elementwise_b_tensors},
               elementwise_d_tensors_{elementwise_d_tensors},
@@ -99,6 +104,10 @@ struct ReferenceConvFwd : public device::BaseOperator
         const Tensor<WeiDataType>& weight_;
         Tensor<OutDataType>& output_;
 
+        // oracle mode: accumulate with compensation in double and emit per-element error bounds
+        Tensor<double>* p_output_err_bound_;
+        utils::ErrorBoundMode err_bound_mode_;
+
         const std::array<Tensor<InDataType>, NumAElementwiseTensor>& elementwise_a_tensors_;
         const std::array<Tensor<WeiDataType>, NumBElementwiseTensor>& elementwise_b_tensors_;
         const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors_;
@@ -130,6 +139,7 @@ struct ReferenceConvFwd : public device::BaseOperator
             {
                 auto func = [&](auto g, auto n, auto k, auto wo) {
                     float v_acc = 0;
+                    utils::CompensatedDotProduct oracle_acc;
 
                     for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
                     {
@@ -163,11 +173,14 @@ struct ReferenceConvFwd : public device::BaseOperator
                                                      k,
                                                      c,
                                                      x);
-                                v_acc +=
-                                    ck::type_convert<float>(v_in) * ck::type_convert<float>(v_wei);
+                                AccumulateProduct(arg, v_acc, oracle_acc, v_in, v_wei);
                             }
                         }
                     }
+                    if(arg.p_output_err_bound_ != nullptr)
+                    {
+                        StoreErrorBound(arg, oracle_acc, v_acc, g, n, k, wo);
+                    }
                     OutDataType v_acc_converted = ck::type_convert<OutDataType>(v_acc);
                     OutDataType& v_out          = arg.output_(g, n, k, wo);
                     ExecuteElementwiseOp(arg.out_element_op_,
@@ -194,6 +207,7 @@ struct ReferenceConvFwd : public device::BaseOperator
             {
                 auto func = [&](auto g, auto n, auto k, auto ho, auto wo) {
                     float v_acc = 0;
+                    utils::CompensatedDotProduct oracle_acc;
 
                     for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
                     {
@@ -238,12 +252,15 @@ struct ReferenceConvFwd : public device::BaseOperator
                                                          c,
                                                          y,
                                                          x);
-                                    v_acc += ck::type_convert<float>(v_in) *
-                                             ck::type_convert<float>(v_wei);
+                                    AccumulateProduct(arg, v_acc, oracle_acc, v_in, v_wei);
                                 }
                             }
                         }
                     }
+                    if(arg.p_output_err_bound_ != nullptr)
+                    {
+                        StoreErrorBound(arg, oracle_acc, v_acc, g, n, k, ho, wo);
+                    }
                     OutDataType v_acc_converted = ck::type_convert<OutDataType>(v_acc);
                     OutDataType& v_out          = arg.output_(g, n, k, ho, wo);
                     ExecuteElementwiseOp(arg.out_element_op_,
@@ -272,6 +289,7 @@ struct ReferenceConvFwd : public device::BaseOperator
             {
                 auto func = [&](auto g, auto n, auto k, auto d_o, auto ho, auto wo) {
                     float v_acc = 0;
+                    utils::CompensatedDotProduct oracle_acc;
 
                     for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
                     {
@@ -327,13 +345,16 @@ struct ReferenceConvFwd : public device::BaseOperator
                                                              z,
                                                              y,
                                                              x);
-                                        v_acc += ck::type_convert<float>(v_in) *
-                                                 ck::type_convert<float>(v_wei);
+                                        AccumulateProduct(arg, v_acc, oracle_acc, v_in, v_wei);
                                     }
                                 }
                             }
                         }
                     }
+                    if(arg.p_output_err_bound_ != nullptr)
+                    {
+                        StoreErrorBound(arg, oracle_acc, v_acc, g, n, k, d_o, ho, wo);
+                    }
                     OutDataType v_acc_converted = ck::type_convert<OutDataType>(v_acc);
                     OutDataType& v_out          = arg.output_(g, n, k, d_o, ho, wo);
                     ExecuteElementwiseOp(arg.out_element_op_,
@@ -367,6 +388,56 @@ struct ReferenceConvFwd : public device::BaseOperator
         {
             return Run(*dynamic_cast<const Argument*>(p_arg));
         }
+
+        private:
+        static void AccumulateProduct(const Argument& arg,
+                                      float& v_acc,
+                                      utils::CompensatedDotProduct& oracle_acc,
+                                      const InDataType& v_in,
+                                      const WeiDataType& v_wei)
+        {
+            if(arg.p_output_err_bound_ != nullptr)
+            {
+                oracle_acc.Add(utils::to_double(ck::type_convert<float>(v_in)),
+                               utils::to_double(ck::type_convert<float>(v_wei)));
+            }
+            else
+            {
+                v_acc += ck::type_convert<float>(v_in) * ck::type_convert<float>(v_wei);
+            }
+        }
+
+        // write the error bound of output(dims...) and replace v_acc by the oracle result
+        template <typename... Dims>
+        static void StoreErrorBound(const Argument& arg,
+                                    const utils::CompensatedDotProduct& oracle_acc,
+                                    float& v_acc,
+                                    Dims... dims)
+        {
+            auto f_out = [&](double acc) {
+                OutDataType v_acc_converted =
+                    ck::type_convert<OutDataType>(static_cast<float>(acc));
+                OutDataType v_out;
+                ExecuteElementwiseOp(arg.out_element_op_,
+                                     arg.elementwise_d_tensors_,
+                                     Number<NumDElementwiseTensor>{},
+                                     v_out,
+                                     v_acc_converted,
+                                     dims...);
+                return v_out;
+            };
+
+            const double acc_bound =
+                utils::get_accumulation_error_bound(oracle_acc.GetLength(),
+                                                    oracle_acc.GetAbsValue(),
+                                                    utils::get_unit_roundoff<float>(),
+                                                    arg.err_bound_mode_);
+
+            (*arg.p_output_err_bound_)(dims...) =
+                utils::get_output_error_bound<OutDataType>(f_out, oracle_acc.GetValue(), acc_bound);
+
+            v_acc = static_cast<float>(oracle_acc.GetValue());
+        }
     };
 
     template <typename... Args,
@@ -440,6 +511,41 @@ struct ReferenceConvFwd : public device::BaseOperator
                         elementwise_d_tensors};
     }
 
+    // oracle mode, output_err_bound receives the bound of |out_device - output| for every element
+    static auto MakeArgument(
+        const Tensor<InDataType>& input,
+        const Tensor<WeiDataType>& weight,
+        Tensor<OutDataType>& output,
+        Tensor<double>& output_err_bound,
+        std::vector<ck::index_t> conv_filter_strides,
+        std::vector<ck::index_t> conv_filter_dilations,
+        std::vector<ck::index_t> input_left_pads,
+        std::vector<ck::index_t> input_right_pads,
+        InElementwiseOperation in_element_op,
+        WeiElementwiseOperation wei_element_op,
+        OutElementwiseOperation out_element_op,
+        const std::array<Tensor<InDataType>, NumAElementwiseTensor>& elementwise_a_tensors  = {},
+        const std::array<Tensor<WeiDataType>, NumBElementwiseTensor>& elementwise_b_tensors = {},
+        const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors = {},
+        utils::ErrorBoundMode err_bound_mode = utils::ErrorBoundMode::Probabilistic)
+    {
+        return Argument{input,
+                        weight,
+                        output,
+                        conv_filter_strides,
+                        conv_filter_dilations,
+                        input_left_pads,
+                        input_right_pads,
+                        in_element_op,
+                        wei_element_op,
+                        out_element_op,
+                        elementwise_a_tensors,
+                        elementwise_b_tensors,
+                        elementwise_d_tensors,
+                        &output_err_bound,
+                        err_bound_mode};
+    }
+
     static auto MakeInvoker() { return Invoker{}; }
 
     virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
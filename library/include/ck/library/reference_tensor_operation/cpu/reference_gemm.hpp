@@ -8,6 +8,7 @@
 
 #include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/error_bound.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 
 namespace ck {
@@ -33,10 +34,14 @@ struct ReferenceGemm : public device::BaseOperator
                  Tensor<CDataType>& c_m_n,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
-                 CElementwiseOperation c_element_op)
+                 CElementwiseOperation c_element_op,
+                 Tensor<double>* p_c_m_n_err_bound    = nullptr,
+                 utils::ErrorBoundMode err_bound_mode = utils::ErrorBoundMode::Probabilistic)
             : a_m_k_{a_m_k},
               b_k_n_{b_k_n},
               c_m_n_{c_m_n},
+              p_c_m_n_err_bound_{p_c_m_n_err_bound},
+              err_bound_mode_{err_bound_mode},
               a_element_op_{a_element_op},
               b_element_op_{b_element_op},
               c_element_op_{c_element_op}
@@ -47,6 +52,10 @@ struct ReferenceGemm : public device::BaseOperator
         const Tensor<BDataType>& b_k_n_;
         Tensor<CDataType>& c_m_n_;
 
+        // oracle mode: accumulate with compensation in double and emit per-element error bounds
+        Tensor<double>* p_c_m_n_err_bound_;
+        utils::ErrorBoundMode err_bound_mode_;
+
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
         CElementwiseOperation c_element_op_;
@@ -63,6 +72,7 @@ struct ReferenceGemm : public device::BaseOperator
                 const int K = arg.a_m_k_.mDesc.GetLengths()[1];
 
                 AccDataType v_acc = 0;
+                utils::CompensatedDotProduct oracle_acc;
 
                 for(int k = 0; k < K; ++k)
                 {
@@ -90,8 +100,36 @@ struct ReferenceGemm : public device::BaseOperator
                         arg.b_element_op_(v_b, arg.b_k_n_(k, n));
                     }
 
-                    v_acc +=
-                        ck::type_convert<AccDataType>(v_a) * ck::type_convert<AccDataType>(v_b);
+                    if(arg.p_c_m_n_err_bound_ != nullptr)
+                    {
+                        oracle_acc.Add(utils::to_double(ck::type_convert<AccDataType>(v_a)),
+                                       utils::to_double(ck::type_convert<AccDataType>(v_b)));
+                    }
+                    else
+                    {
+                        v_acc += ck::type_convert<AccDataType>(v_a) *
+                                 ck::type_convert<AccDataType>(v_b);
+                    }
+                }
+
+                if(arg.p_c_m_n_err_bound_ != nullptr)
+                {
+                    auto f_out = [&](double acc) {
+                        CDataType v_out;
+                        arg.c_element_op_(v_out, utils::from_double<AccDataType>(acc));
+                        return v_out;
+                    };
+
+                    const double acc_bound = utils::get_accumulation_error_bound(
+                        oracle_acc.GetLength(),
+                        oracle_acc.GetAbsValue(),
+                        utils::get_unit_roundoff<AccDataType>(),
+                        arg.err_bound_mode_);
+
+                    (*arg.p_c_m_n_err_bound_)(m, n) = utils::get_output_error_bound<CDataType>(
+                        f_out, oracle_acc.GetValue(), acc_bound);
+
+                    v_acc = utils::from_double<AccDataType>(oracle_acc.GetValue());
                 }
 
                 CDataType v_c;
@@ -133,6 +171,27 @@ struct ReferenceGemm : public device::BaseOperator
         return Argument{a_m_k, b_k_n, c_m_n, a_element_op, b_element_op, c_element_op};
     }
 
+    // oracle mode, c_m_n_err_bound receives the bound of |c_device - c_m_n| for every element
+    static auto
+    MakeArgument(const Tensor<ADataType>& a_m_k,
+                 const Tensor<BDataType>& b_k_n,
+                 Tensor<CDataType>& c_m_n,
+                 Tensor<double>& c_m_n_err_bound,
+                 AElementwiseOperation a_element_op,
+                 BElementwiseOperation b_element_op,
+                 CElementwiseOperation c_element_op,
+                 utils::ErrorBoundMode err_bound_mode = utils::ErrorBoundMode::Probabilistic)
+    {
+        return Argument{a_m_k,
+                        b_k_n,
+                        c_m_n,
+                        a_element_op,
+                        b_element_op,
+                        c_element_op,
+                        &c_m_n_err_bound,
+                        err_bound_mode};
+    }
+
     static auto MakeInvoker() { return Invoker{}; }
 
     virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <thread>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// offset of every index of the modes [dim_begin, dim_end) of a tensor, in row-major order of the
+// modes. A group of contraction modes (ms, ns or ks) is flattened into a single strided GEMM
+// dimension this way, whatever the number of modes and their strides.
+inline std::vector<std::size_t>
+get_mode_offsets(const HostTensorDescriptor& desc, std::size_t dim_begin, std::size_t dim_end)
+{
+    const auto& lengths = desc.GetLengths();
+    const auto& strides = desc.GetStrides();
+
+    std::vector<std::size_t> offsets{0};
+
+    for(std::size_t i = dim_begin; i < dim_end; ++i)
+    {
+        std::vector<std::size_t> new_offsets;
+        new_offsets.reserve(offsets.size() * lengths[i]);
+
+        for(std::size_t offset : offsets)
+            for(std::size_t j = 0; j < lengths[i]; ++j)
+                new_offsets.push_back(offset + j * strides[i]);
+
+        offsets = std::move(new_offsets);
+    }
+
+    return offsets;
+}
+
+// Blocked host GEMM: NumProduct products C_p[m, n] = sum_k A_p[m, k] * B_p[n, k] that share the
+// same M, N and K. The C tiles are split over threads, and for every KPerBlock slice the A and
+// B panels are packed once into AccDataType (get_a(p, m, k) and get_b(p, n, k) do the type
+// conversions and elementwise operations) and multiplied by a register-blocked MR x NR
+// micro-kernel with unit-stride loads. Every C element still accumulates its products in
+// increasing k order, like a naive triple loop. store_c(m, n, acc) receives the NumProduct
+// results of every element, so products that are combined (eg. the real and imaginary parts
+// of a complex GEMM) are computed in a single pass.
+template <typename AccDataType, index_t NumProduct, typename GetA, typename GetB, typename StoreC>
+void blocked_gemm(std::size_t M,
+                  std::size_t N,
+                  std::size_t K,
+                  GetA get_a,
+                  GetB get_b,
+                  StoreC store_c)
+{
+    constexpr std::size_t MR        = 4;
+    constexpr std::size_t NR        = 16;
+    constexpr std::size_t MPerBlock = 64;
+    constexpr std::size_t NPerBlock = 128;
+    constexpr std::size_t KPerBlock = 256;
+
+    const std::size_t num_m_block = (M + MPerBlock - 1) / MPerBlock;
+    const std::size_t num_n_block = (N + NPerBlock - 1) / NPerBlock;
+
+    auto f_mblock_nblock = [&](std::size_t m_block, std::size_t n_block) {
+        const std::size_t m_begin = m_block * MPerBlock;
+        const std::size_t n_begin = n_block * NPerBlock;
+        const std::size_t m_tile  = std::min(MPerBlock, M - m_begin);
+        const std::size_t n_tile  = std::min(NPerBlock, N - n_begin);
+
+        // padded to multiples of MR and NR, the padding is zero and never stored
+        const std::size_t m_tile_pad = (m_tile + MR - 1) / MR * MR;
+        const std::size_t n_tile_pad = (n_tile + NR - 1) / NR * NR;
+
+        thread_local std::vector<AccDataType> a_pack, b_pack, c_tile;
+
+        a_pack.resize(NumProduct * m_tile_pad * KPerBlock);
+        b_pack.resize(NumProduct * n_tile_pad * KPerBlock);
+        c_tile.assign(NumProduct * m_tile_pad * n_tile_pad, AccDataType{0});
+
+        for(std::size_t k_begin = 0; k_begin < K; k_begin += KPerBlock)
+        {
+            const std::size_t k_tile = std::min(KPerBlock, K - k_begin);
+
+            // A panel [m_tile_pad / MR, k_tile, MR], B panel [n_tile_pad / NR, k_tile, NR]
+            for(index_t p = 0; p < NumProduct; ++p)
+            {
+                AccDataType* p_a = &a_pack[p * m_tile_pad * KPerBlock];
+                AccDataType* p_b = &b_pack[p * n_tile_pad * KPerBlock];
+
+                for(std::size_t im = 0; im < m_tile_pad; ++im)
+                    for(std::size_t k = 0; k < k_tile; ++k)
+                        p_a[((im / MR) * k_tile + k) * MR + im % MR] =
+                            im < m_tile ? get_a(p, m_begin + im, k_begin + k) : AccDataType{0};
+
+                for(std::size_t in = 0; in < n_tile_pad; ++in)
+                    for(std::size_t k = 0; k < k_tile; ++k)
+                        p_b[((in / NR) * k_tile + k) * NR + in % NR] =
+                            in < n_tile ? get_b(p, n_begin + in, k_begin + k) : AccDataType{0};
+            }
+
+            // micro-kernel
+            for(index_t p = 0; p < NumProduct; ++p)
+            {
+                for(std::size_t im = 0; im < m_tile_pad; im += MR)
+                {
+                    for(std::size_t in = 0; in < n_tile_pad; in += NR)
+                    {
+                        const AccDataType* p_a = &a_pack[p * m_tile_pad * KPerBlock + im * k_tile];
+                        const AccDataType* p_b = &b_pack[p * n_tile_pad * KPerBlock + in * k_tile];
+                        AccDataType* p_c       = &c_tile[(p * m_tile_pad + im) * n_tile_pad + in];
+
+                        std::array<std::array<AccDataType, NR>, MR> acc;
+
+                        for(std::size_t r = 0; r < MR; ++r)
+                            for(std::size_t c = 0; c < NR; ++c)
+                                acc[r][c] = p_c[r * n_tile_pad + c];
+
+                        for(std::size_t k = 0; k < k_tile; ++k)
+                            for(std::size_t r = 0; r < MR; ++r)
+                                for(std::size_t c = 0; c < NR; ++c)
+                                    acc[r][c] += p_a[k * MR + r] * p_b[k * NR + c];
+
+                        for(std::size_t r = 0; r < MR; ++r)
+                            for(std::size_t c = 0; c < NR; ++c)
+                                p_c[r * n_tile_pad + c] = acc[r][c];
+                    }
+                }
+            }
+        }
+
+        std::array<AccDataType, NumProduct> acc;
+
+        for(std::size_t im = 0; im < m_tile; ++im)
+            for(std::size_t in = 0; in < n_tile; ++in)
+            {
+                for(index_t p = 0; p < NumProduct; ++p)
+                    acc[p] = c_tile[(p * m_tile_pad + im) * n_tile_pad + in];
+
+                store_c(m_begin + im, n_begin + in, acc);
+            }
+    };
+
+    make_ParallelTensorFunctor(f_mblock_nblock, num_m_block, num_n_block)(
+        std::thread::hardware_concurrency());
+}
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
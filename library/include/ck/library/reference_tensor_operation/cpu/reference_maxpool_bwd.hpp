@@ -5,6 +5,8 @@
 
 #include <iostream>
 #include <sstream>
+#include <algorithm>
+#include <thread>
 #include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
@@ -43,30 +45,81 @@ struct ReferenceMaxPoolBwd : public device::BaseOperator
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
+        // Scatter-free formulation: every thread owns a contiguous range of din. The dout
+        // elements are first sorted into per-range buckets (in parallel over dout), then every
+        // thread gathers its buckets in the original dout order, so the sums do not depend on the
+        // number of threads.
         float Run(const Argument& arg)
         {
-            int din_length  = arg.din_.GetElementSpaceSize();
-            int dout_length = arg.dout_.GetElementSpaceSize();
-            std::vector<ConputeDataType> buf(din_length, 0);
+            const std::size_t din_length  = arg.din_.GetElementSpaceSize();
+            const std::size_t dout_length = arg.dout_.GetElementSpaceSize();
+
+            const std::size_t num_thread = std::max<std::size_t>(
+                1, std::min<std::size_t>(std::thread::hardware_concurrency(), din_length));
+
+            const std::size_t din_per_thread  = (din_length + num_thread - 1) / num_thread;
+            const std::size_t dout_per_thread = (dout_length + num_thread - 1) / num_thread;
+
+            // buckets[dout range][din range]
+            std::vector<std::vector<std::vector<std::size_t>>> buckets(
+                num_thread, std::vector<std::vector<std::size_t>>(num_thread));
 
-            for(int i = 0; i < dout_length; ++i)
             {
-                int index = arg.indices_.mData[i];
-                if(index >= 0 && index < din_length)
+                std::vector<joinable_thread> threads(num_thread);
+
+                for(std::size_t it = 0; it < num_thread; ++it)
                 {
-                    if constexpr(is_same_v<ConputeDataType, bhalf_t>)
+                    std::size_t i_begin = std::min(it * dout_per_thread, dout_length);
+                    std::size_t i_end   = std::min((it + 1) * dout_per_thread, dout_length);
+
+                    auto f = [=, &arg, &buckets] {
+                        for(std::size_t i = i_begin; i < i_end; ++i)
+                        {
+                            auto index = arg.indices_.mData[i];
+
+                            if(index >= 0 && static_cast<std::size_t>(index) < din_length)
+                                buckets[it][index / din_per_thread].push_back(i);
+                        }
+                    };
+
+                    threads[it] = joinable_thread(f);
+                }
+            }
+
+            std::vector<joinable_thread> threads(num_thread);
+
+            for(std::size_t it = 0; it < num_thread; ++it)
+            {
+                std::size_t j_begin = std::min(it * din_per_thread, din_length);
+                std::size_t j_end   = std::min((it + 1) * din_per_thread, din_length);
+
+                auto f = [=, &arg, &buckets] {
+                    std::vector<ConputeDataType> buf(j_end - j_begin, 0);
+
+                    for(std::size_t src = 0; src < num_thread; ++src)
                     {
-                        float buf_val = ck::type_convert<float>(buf[index]);
-                        buf_val += ck::type_convert<float>(arg.dout_.mData[i]);
-                        buf[index] = ck::type_convert<ConputeDataType>(buf_val);
+                        for(std::size_t i : buckets[src][it])
+                        {
+                            std::size_t index = arg.indices_.mData[i] - j_begin;
+
+                            if constexpr(is_same_v<ConputeDataType, bhalf_t>)
+                            {
+                                float buf_val = ck::type_convert<float>(buf[index]);
+                                buf_val += ck::type_convert<float>(arg.dout_.mData[i]);
+                                buf[index] = ck::type_convert<ConputeDataType>(buf_val);
+                            }
+                            else
+                                buf[index] += ck::type_convert<ConputeDataType>(arg.dout_.mData[i]);
+                        }
                     }
-                    else
-                        buf[index] += ck::type_convert<ConputeDataType>(arg.dout_.mData[i]);
-                }
+
+                    for(std::size_t j = j_begin; j < j_end; ++j)
+                        arg.din_.mData[j] = ck::type_convert<DInDataType>(buf[j - j_begin]);
+                };
+
+                threads[it] = joinable_thread(f);
             }
 
-            for(int i = 0; i < din_length; ++i)
-                arg.din_.mData[i] = ck::type_convert<DInDataType>(buf[i]);
             return 0;
         }
 
@@ -0,0 +1,268 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// The pooling references keep intermediate results in a channel-last working layout
+// [N, spatial..., C], independent of the strides of the host tensors. A pass over spatial
+// dimension k views the buffer as [outer, length_k, inner] and handles a chunk of the inner
+// elements (the following spatial dimensions and C) at once, so the innermost loops have unit
+// stride and can be vectorized.
+
+// f(outer_id, inner_begin, inner_end), in parallel over lines and chunks of inner elements
+template <typename F>
+void pool_for_each_line(std::size_t outer, std::size_t inner, F f)
+{
+    constexpr std::size_t inner_chunk = 64;
+
+    const std::size_t num_chunk = (inner + inner_chunk - 1) / inner_chunk;
+
+    auto f_line = [&](auto o, auto ic) {
+        f(o, ic * inner_chunk, std::min((ic + 1) * inner_chunk, inner));
+    };
+
+    make_ParallelTensorFunctor(f_line, outer, num_chunk)(std::thread::hardware_concurrency());
+}
+
+// f(id, offset) for every element of a [N, C, spatial...] tensor, where id is the position of
+// the element in the channel-last working layout and offset its position in the tensor
+template <typename F>
+void pool_for_each_channel_last(const HostTensorDescriptor& desc, F f)
+{
+    const auto& lengths = desc.GetLengths();
+    const auto& strides = desc.GetStrides();
+
+    const std::size_t rank = lengths.size();
+    const std::size_t C    = lengths[1];
+
+    std::size_t num_pixel = lengths[0];
+    for(std::size_t i = 2; i < rank; ++i)
+        num_pixel *= lengths[i];
+
+    auto f_pixel = [&](auto pixel) {
+        std::size_t offset = 0;
+        std::size_t rest   = pixel;
+
+        for(std::size_t i = rank - 1; i >= 2; --i)
+        {
+            offset += (rest % lengths[i]) * strides[i];
+            rest /= lengths[i];
+        }
+        offset += rest * strides[0];
+
+        for(std::size_t c = 0; c < C; ++c)
+            f(pixel * C + c, offset + c * strides[1]);
+    };
+
+    make_ParallelTensorFunctor(f_pixel, num_pixel)(std::thread::hardware_concurrency());
+}
+
+// Sliding window reduction along one dimension of the working layout,
+// [outer, in_length, inner] -> [outer, out_length, inner]. Output o reduces the input positions
+// o * stride + k * dilation - left_pad, k = 0 ... window - 1, positions in the padding are
+// skipped. accumulate(acc_val, acc_idx, val, idx) combines an earlier and a later (partial)
+// result, the indices are only carried if OutputIndex is set.
+//
+// van Herk/Gil-Werman scheme: every residue class (modulo dilation) of the padded line is split
+// into blocks of `window` elements and the block prefix and suffix reductions are computed. A
+// window then is the suffix of one block combined with the prefix of the next one, so the cost
+// per output does not depend on the window length. Unlike a monotonic deque it works for any
+// reduction and the same operations are applied to all inner elements, which vectorizes.
+template <bool OutputIndex, typename ComputeDataType, typename IndexDataType, typename Accumulate>
+void pool_sliding_window_reduce(const std::vector<ComputeDataType>& in_val,
+                                const std::vector<IndexDataType>& in_idx,
+                                std::vector<ComputeDataType>& out_val,
+                                std::vector<IndexDataType>& out_idx,
+                                std::size_t outer,
+                                std::size_t in_length,
+                                std::size_t out_length,
+                                std::size_t inner,
+                                index_t window,
+                                index_t stride,
+                                index_t dilation,
+                                index_t left_pad,
+                                ComputeDataType identity,
+                                Accumulate accumulate)
+{
+    out_val.resize(outer * out_length * inner);
+    out_idx.resize(OutputIndex ? outer * out_length * inner : 0);
+
+    if(out_length == 0)
+        return;
+
+    const std::size_t padded_length = (out_length - 1) * stride + (window - 1) * dilation + 1;
+
+    auto f_line = [&](std::size_t o, std::size_t i_begin, std::size_t i_end) {
+        const std::size_t n = i_end - i_begin;
+
+        thread_local std::vector<ComputeDataType> prefix_val, suffix_val;
+        thread_local std::vector<IndexDataType> prefix_idx, suffix_idx;
+
+        prefix_val.resize(padded_length * n);
+        suffix_val.resize(padded_length * n);
+        prefix_idx.resize(OutputIndex ? padded_length * n : 0);
+        suffix_idx.resize(OutputIndex ? padded_length * n : 0);
+
+        IndexDataType dummy_idx = 0;
+
+        // offset of the padded position p in the input line, or -1 if p is in the padding
+        auto get_in_offset = [&](std::size_t p) -> long_index_t {
+            long_index_t wi = static_cast<long_index_t>(p) - left_pad;
+
+            if(wi < 0 || wi >= static_cast<long_index_t>(in_length))
+                return -1;
+
+            return (o * in_length + wi) * inner + i_begin;
+        };
+
+        auto combine = [&](ComputeDataType& acc_val,
+                           IndexDataType& acc_idx,
+                           const std::vector<ComputeDataType>& val,
+                           const std::vector<IndexDataType>& idx,
+                           std::size_t offset) {
+            if constexpr(OutputIndex)
+                accumulate(acc_val, acc_idx, val[offset], idx[offset]);
+            else
+                accumulate(acc_val, dummy_idx, val[offset], dummy_idx);
+        };
+
+        // block prefixes, front to back
+        for(std::size_t p = 0; p < padded_length; ++p)
+        {
+            const bool block_begin       = (p / dilation) % window == 0;
+            const long_index_t in_offset = get_in_offset(p);
+
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                ComputeDataType v = identity;
+                IndexDataType v_idx = 0;
+
+                if(!block_begin)
+                {
+                    v = prefix_val[(p - dilation) * n + i];
+                    if constexpr(OutputIndex)
+                        v_idx = prefix_idx[(p - dilation) * n + i];
+                }
+
+                if(in_offset >= 0)
+                    combine(v, v_idx, in_val, in_idx, in_offset + i);
+
+                prefix_val[p * n + i] = v;
+                if constexpr(OutputIndex)
+                    prefix_idx[p * n + i] = v_idx;
+            }
+        }
+
+        // block suffixes, back to front
+        for(std::size_t p = padded_length; p-- > 0;)
+        {
+            const bool block_end =
+                (p / dilation) % window == window - 1u || p + dilation >= padded_length;
+            const long_index_t in_offset = get_in_offset(p);
+
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                ComputeDataType v = identity;
+                IndexDataType v_idx = 0;
+
+                if(in_offset >= 0)
+                    combine(v, v_idx, in_val, in_idx, in_offset + i);
+
+                if(!block_end)
+                    combine(v, v_idx, suffix_val, suffix_idx, (p + dilation) * n + i);
+
+                suffix_val[p * n + i] = v;
+                if constexpr(OutputIndex)
+                    suffix_idx[p * n + i] = v_idx;
+            }
+        }
+
+        for(std::size_t wo = 0; wo < out_length; ++wo)
+        {
+            const std::size_t first = wo * stride;
+            const std::size_t last  = first + (window - 1) * dilation;
+
+            // the window is a whole block if it starts on a block boundary
+            const bool whole_block = (first / dilation) % window == 0;
+
+            const std::size_t out_offset = (o * out_length + wo) * inner + i_begin;
+
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                ComputeDataType v = suffix_val[first * n + i];
+                IndexDataType v_idx = OutputIndex ? suffix_idx[first * n + i] : 0;
+
+                if(!whole_block)
+                    combine(v, v_idx, prefix_val, prefix_idx, last * n + i);
+
+                out_val[out_offset + i] = v;
+                if constexpr(OutputIndex)
+                    out_idx[out_offset + i] = v_idx;
+            }
+        }
+    };
+
+    pool_for_each_line(outer, inner, f_line);
+}
+
+// Adjoint of a sliding window sum along one dimension of the working layout,
+// [outer, out_length, inner] -> [outer, in_length, inner]. Input position wi gathers the
+// outputs wo of all windows containing it, wi + left_pad = wo * stride + k * dilation.
+template <typename ComputeDataType>
+void pool_sliding_window_transpose_sum(const std::vector<ComputeDataType>& dout,
+                                       std::vector<ComputeDataType>& din,
+                                       std::size_t outer,
+                                       std::size_t out_length,
+                                       std::size_t in_length,
+                                       std::size_t inner,
+                                       index_t window,
+                                       index_t stride,
+                                       index_t dilation,
+                                       index_t left_pad)
+{
+    din.assign(outer * in_length * inner, type_convert<ComputeDataType>(0));
+
+    auto f_line = [&](std::size_t o, std::size_t i_begin, std::size_t i_end) {
+        for(std::size_t wi = 0; wi < in_length; ++wi)
+        {
+            ComputeDataType* p_din = &din[(o * in_length + wi) * inner];
+
+            for(index_t k = 0; k < window; ++k)
+            {
+                // Out_Position = (In_Position + pad - k * dilation) / stride
+                long_index_t w_tmp = static_cast<long_index_t>(wi) + left_pad -
+                                     static_cast<long_index_t>(k) * dilation;
+
+                if(w_tmp < 0 || w_tmp % stride != 0)
+                    continue;
+
+                long_index_t wo = w_tmp / stride;
+
+                if(wo >= static_cast<long_index_t>(out_length))
+                    continue;
+
+                const ComputeDataType* p_dout = &dout[(o * out_length + wo) * inner];
+
+                for(std::size_t i = i_begin; i < i_end; ++i)
+                    p_din[i] += p_dout[i];
+            }
+        }
+    };
+
+    pool_for_each_line(outer, inner, f_line);
+}
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -10,9 +10,11 @@
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/tensor_operation/gpu/device/reduction_operator_mapping.hpp"
+#include "ck/utility/ignore.hpp"
 #include "ck/utility/reduction_functions_accumulate.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_pool_common.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -68,8 +70,13 @@ struct ReferencePoolingFwd : public device::BaseOperator
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
-        float RunPooling3dFwd(const Argument& arg)
+        // Separable pooling: one sliding window pass per spatial dimension, from the innermost
+        // to the outermost one. Combining the per-line results in this order visits the window
+        // in the same (z, y, x) order as a direct evaluation, so ties and NaNs select the same
+        // index.
+        float RunPoolingFwd(const Argument& arg)
         {
+            constexpr index_t NDimSpatial = WindowRank;
 
             auto elementwise_ops =
                 ck::reduce_unary_operator<ReduceOpId, true, true>::GetElementwiseOperator(
@@ -78,233 +85,107 @@ struct ReferencePoolingFwd : public device::BaseOperator
             auto in_elementwise_op  = std::get<0>(elementwise_ops);
             auto acc_elementwise_op = std::get<1>(elementwise_ops);
 
-            if constexpr(!OutputIndex)
-            {
-                using Accumulation = ck::detail::
-                    AccumulateWithNanCheck<PropagateNan, ReduceOperation, ComputeDataType>;
-
-                auto f_ncdhw = [&](auto n, auto c, auto do_, auto ho, auto wo) {
-                    auto accuVal = ReduceOperation::template GetIdentityValue<ComputeDataType>();
-
-                    for(ck::index_t z = 0; z < arg.window_spatial_lengths_[0]; ++z)
-                    {
-                        ck::index_t di = do_ * arg.window_strides_[0] +
-                                         z * arg.window_dilations_[0] - arg.in_left_pads_[0];
-                        for(ck::index_t y = 0; y < arg.window_spatial_lengths_[1]; ++y)
-                        {
-                            ck::index_t hi = ho * arg.window_strides_[1] +
-                                             y * arg.window_dilations_[1] - arg.in_left_pads_[1];
-                            for(ck::index_t x = 0; x < arg.window_spatial_lengths_[2]; ++x)
-                            {
-                                ck::index_t wi = wo * arg.window_strides_[2] +
-                                                 x * arg.window_dilations_[2] -
-                                                 arg.in_left_pads_[2];
-                                if(di >= 0 &&
-                                   di < static_cast<ck::index_t>(arg.in_.mDesc.GetLengths()[2]) &&
-                                   hi >= 0 &&
-                                   hi < static_cast<ck::index_t>(arg.in_.mDesc.GetLengths()[3]) &&
-                                   wi >= 0 &&
-                                   wi < static_cast<ck::index_t>(arg.in_.mDesc.GetLengths()[4]))
-                                {
-                                    ComputeDataType currVal = ck::type_convert<ComputeDataType>(
-                                        arg.in_(n, c, di, hi, wi));
-
-                                    in_elementwise_op(currVal, currVal);
-
-                                    Accumulation::Calculate(accuVal, currVal);
-                                }
-                            }
-                        }
-                    }
-                    acc_elementwise_op(accuVal, accuVal);
-
-                    arg.out_(n, c, do_, ho, wo) = ck::type_convert<OutDataType>(accuVal);
-                };
-
-                make_ParallelTensorFunctor(f_ncdhw,
-                                           arg.out_.mDesc.GetLengths()[0],
-                                           arg.out_.mDesc.GetLengths()[1],
-                                           arg.out_.mDesc.GetLengths()[2],
-                                           arg.out_.mDesc.GetLengths()[3],
-                                           arg.out_.mDesc.GetLengths()[4])(
-                    std::thread::hardware_concurrency());
-            }
-            else
-            {
-                using Accumulation = ck::detail::AccumulateWithIndexAndNanCheck<PropagateNan,
-                                                                                ReduceOperation,
-                                                                                ComputeDataType,
-                                                                                IndexDataType>;
-
-                auto f_ncdhw = [&](auto n, auto c, auto do_, auto ho, auto wo) {
-                    auto accuVal = ReduceOperation::template GetIdentityValue<ComputeDataType>();
-                    IndexDataType accuIndex = 0;
-
-                    for(ck::index_t z = 0; z < arg.window_spatial_lengths_[0]; ++z)
-                    {
-                        ck::index_t di = do_ * arg.window_strides_[0] +
-                                         z * arg.window_dilations_[0] - arg.in_left_pads_[0];
-                        for(ck::index_t y = 0; y < arg.window_spatial_lengths_[1]; ++y)
-                        {
-                            ck::index_t hi = ho * arg.window_strides_[1] +
-                                             y * arg.window_dilations_[1] - arg.in_left_pads_[1];
-                            for(ck::index_t x = 0; x < arg.window_spatial_lengths_[2]; ++x)
-                            {
-                                ck::index_t wi = wo * arg.window_strides_[2] +
-                                                 x * arg.window_dilations_[2] -
-                                                 arg.in_left_pads_[2];
-                                if(di >= 0 &&
-                                   di < static_cast<ck::index_t>(arg.in_.mDesc.GetLengths()[2]) &&
-                                   hi >= 0 &&
-                                   hi < static_cast<ck::index_t>(arg.in_.mDesc.GetLengths()[3]) &&
-                                   wi >= 0 &&
-                                   wi < static_cast<ck::index_t>(arg.in_.mDesc.GetLengths()[4]))
-                                {
-                                    ComputeDataType currVal = ck::type_convert<ComputeDataType>(
-                                        arg.in_(n, c, di, hi, wi));
-                                    IndexDataType currIndex =
-                                        arg.in_.GetOffsetFromMultiIndex(n, c, di, hi, wi);
-
-                                    in_elementwise_op(currVal, currVal);
-
-                                    Accumulation::Calculate(accuVal, currVal, accuIndex, currIndex);
-                                }
-                            }
-                        }
-                    }
-
-                    acc_elementwise_op(accuVal, accuVal);
-
-                    arg.out_(n, c, do_, ho, wo)         = ck::type_convert<OutDataType>(accuVal);
-                    arg.out_indices_(n, c, do_, ho, wo) = accuIndex;
-                };
-
-                make_ParallelTensorFunctor(f_ncdhw,
-                                           arg.out_.mDesc.GetLengths()[0],
-                                           arg.out_.mDesc.GetLengths()[1],
-                                           arg.out_.mDesc.GetLengths()[2],
-                                           arg.out_.mDesc.GetLengths()[3],
-                                           arg.out_.mDesc.GetLengths()[4])(
-                    std::thread::hardware_concurrency());
+            auto accumulate = [](ComputeDataType& accuVal,
+                                 IndexDataType& accuIndex,
+                                 ComputeDataType currVal,
+                                 IndexDataType currIndex) {
+                if constexpr(OutputIndex)
+                {
+                    ck::detail::AccumulateWithIndexAndNanCheck<PropagateNan,
+                                                               ReduceOperation,
+                                                               ComputeDataType,
+                                                               IndexDataType>::
+                        Calculate(accuVal, currVal, accuIndex, currIndex);
+                }
+                else
+                {
+                    ck::ignore = accuIndex;
+                    ck::ignore = currIndex;
+
+                    ck::detail::AccumulateWithNanCheck<PropagateNan,
+                                                       ReduceOperation,
+                                                       ComputeDataType>::Calculate(accuVal,
+                                                                                   currVal);
+                }
             };
 
-            return 0;
-        }
+            const auto& in_lengths  = arg.in_.mDesc.GetLengths();
+            const auto& out_lengths = arg.out_.mDesc.GetLengths();
 
-        float RunPooling2dFwd(const Argument& arg)
-        {
+            // [N, spatial..., C] working layout
+            std::vector<ComputeDataType> val(arg.in_.mDesc.GetElementSize());
+            std::vector<IndexDataType> idx(OutputIndex ? val.size() : 0);
 
-            auto elementwise_ops =
-                ck::reduce_unary_operator<ReduceOpId, true, true>::GetElementwiseOperator(
-                    arg.reduceLength_);
+            pool_for_each_channel_last(arg.in_.mDesc, [&](std::size_t i, std::size_t offset) {
+                ComputeDataType currVal = ck::type_convert<ComputeDataType>(arg.in_.mData[offset]);
 
-            auto in_elementwise_op  = std::get<0>(elementwise_ops);
-            auto acc_elementwise_op = std::get<1>(elementwise_ops);
+                in_elementwise_op(currVal, currVal);
+
+                val[i] = currVal;
+                if constexpr(OutputIndex)
+                    idx[i] = offset;
+            });
+
+            std::vector<std::size_t> spatial_lengths(in_lengths.begin() + 2, in_lengths.end());
+            std::vector<ComputeDataType> next_val;
+            std::vector<IndexDataType> next_idx;
 
-            if constexpr(!OutputIndex)
+            for(index_t k = NDimSpatial - 1; k >= 0; --k)
             {
-                using Accumulation = ck::detail::
-                    AccumulateWithNanCheck<PropagateNan, ReduceOperation, ComputeDataType>;
-
-                auto f_nchw = [&](auto n, auto c, auto ho, auto wo) {
-                    auto accuVal = ReduceOperation::template GetIdentityValue<ComputeDataType>();
-
-                    for(ck::index_t y = 0; y < arg.window_spatial_lengths_[0]; ++y)
-                    {
-                        ck::index_t hi = ho * arg.window_strides_[0] +
-                                         y * arg.window_dilations_[0] - arg.in_left_pads_[0];
-                        for(ck::index_t x = 0; x < arg.window_spatial_lengths_[1]; ++x)
-                        {
-                            ck::index_t wi = wo * arg.window_strides_[1] +
-                                             x * arg.window_dilations_[1] - arg.in_left_pads_[1];
-                            if(hi >= 0 &&
-                               hi < static_cast<ck::index_t>(arg.in_.mDesc.GetLengths()[2]) &&
-                               wi >= 0 &&
-                               wi < static_cast<ck::index_t>(arg.in_.mDesc.GetLengths()[3]))
-                            {
-                                ComputeDataType currVal =
-                                    ck::type_convert<ComputeDataType>(arg.in_(n, c, hi, wi));
-
-                                in_elementwise_op(currVal, currVal);
-
-                                Accumulation::Calculate(accuVal, currVal);
-                            }
-                        }
-                    }
-
-                    acc_elementwise_op(accuVal, accuVal);
-                    arg.out_(n, c, ho, wo) = ck::type_convert<OutDataType>(accuVal);
-                };
-
-                make_ParallelTensorFunctor(f_nchw,
-                                           arg.out_.mDesc.GetLengths()[0],
-                                           arg.out_.mDesc.GetLengths()[1],
-                                           arg.out_.mDesc.GetLengths()[2],
-                                           arg.out_.mDesc.GetLengths()[3])(
-                    std::thread::hardware_concurrency());
+                std::size_t outer = in_lengths[0];
+                std::size_t inner = in_lengths[1];
+
+                for(index_t j = 0; j < k; ++j)
+                    outer *= spatial_lengths[j];
+                for(index_t j = k + 1; j < NDimSpatial; ++j)
+                    inner *= spatial_lengths[j];
+
+                pool_sliding_window_reduce<OutputIndex>(
+                    val,
+                    idx,
+                    next_val,
+                    next_idx,
+                    outer,
+                    spatial_lengths[k],
+                    out_lengths[k + 2],
+                    inner,
+                    arg.window_spatial_lengths_[k],
+                    arg.window_strides_[k],
+                    arg.window_dilations_[k],
+                    arg.in_left_pads_[k],
+                    ReduceOperation::template GetIdentityValue<ComputeDataType>(),
+                    accumulate);
+
+                std::swap(val, next_val);
+                std::swap(idx, next_idx);
+                spatial_lengths[k] = out_lengths[k + 2];
             }
-            else
+
+            pool_for_each_channel_last(arg.out_.mDesc, [&](std::size_t i, std::size_t offset) {
+                ComputeDataType accuVal = val[i];
+
+                acc_elementwise_op(accuVal, accuVal);
+
+                arg.out_.mData[offset] = ck::type_convert<OutDataType>(accuVal);
+            });
+
+            if constexpr(OutputIndex)
             {
-                using Accumulation = ck::detail::AccumulateWithIndexAndNanCheck<PropagateNan,
-                                                                                ReduceOperation,
-                                                                                ComputeDataType,
-                                                                                IndexDataType>;
-
-                auto f_nchw = [&](auto n, auto c, auto ho, auto wo) {
-                    auto accuVal = ReduceOperation::template GetIdentityValue<ComputeDataType>();
-                    IndexDataType accuIndex = 0;
-
-                    for(ck::index_t y = 0; y < arg.window_spatial_lengths_[0]; ++y)
-                    {
-                        ck::index_t hi = ho * arg.window_strides_[0] +
-                                         y * arg.window_dilations_[0] - arg.in_left_pads_[0];
-                        for(ck::index_t x = 0; x < arg.window_spatial_lengths_[1]; ++x)
-                        {
-                            ck::index_t wi = wo * arg.window_strides_[1] +
-                                             x * arg.window_dilations_[1] - arg.in_left_pads_[1];
-                            if(hi >= 0 &&
-                               hi < static_cast<ck::index_t>(arg.in_.mDesc.GetLengths()[2]) &&
-                               wi >= 0 &&
-                               wi < static_cast<ck::index_t>(arg.in_.mDesc.GetLengths()[3]))
-                            {
-                                ComputeDataType currVal =
-                                    ck::type_convert<ComputeDataType>(arg.in_(n, c, hi, wi));
-
-                                IndexDataType currIndex =
-                                    arg.in_.GetOffsetFromMultiIndex(n, c, hi, wi);
-
-                                in_elementwise_op(currVal, currVal);
-
-                                Accumulation::Calculate(accuVal, currVal, accuIndex, currIndex);
-                            }
-                        }
-                    }
-
-                    acc_elementwise_op(accuVal, accuVal);
-                    arg.out_(n, c, ho, wo)         = ck::type_convert<OutDataType>(accuVal);
-                    arg.out_indices_(n, c, ho, wo) = accuIndex;
-                };
-
-                make_ParallelTensorFunctor(f_nchw,
-                                           arg.out_.mDesc.GetLengths()[0],
-                                           arg.out_.mDesc.GetLengths()[1],
-                                           arg.out_.mDesc.GetLengths()[2],
-                                           arg.out_.mDesc.GetLengths()[3])(
-                    std::thread::hardware_concurrency());
-            };
+                pool_for_each_channel_last(arg.out_indices_.mDesc,
+                                           [&](std::size_t i, std::size_t offset) {
+                                               arg.out_indices_.mData[offset] = idx[i];
+                                           });
+            }
 
             return 0;
         }
 
         float Run(const Argument& arg)
         {
-            // TODO - support generic pooling
-            if constexpr(InOutRank == 5 && WindowRank == 3)
-                return RunPooling3dFwd(arg);
-            else if constexpr(InOutRank == 4 && WindowRank == 2)
-                return RunPooling2dFwd(arg);
+            if constexpr(InOutRank == WindowRank + 2)
+                return RunPoolingFwd(arg);
             else
-                throw std::runtime_error("Only support pooling3d or pooling2d so far");
+                throw std::runtime_error("wrong! inconsistent dimension");
         }
 
         float Run(const device::BaseArgument* p_arg,
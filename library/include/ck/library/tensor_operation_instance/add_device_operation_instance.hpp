@@ -3,16 +3,99 @@
 
 #pragma once
 
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <vector>
 #include <type_traits>
 
 #include "ck/utility/functional2.hpp"
 
+#ifdef CK_INSTANCE_MANIFEST
+// generated by the instance CMake from CK_INSTANCE_MANIFEST, defines instance_manifest
+#include "ck_instance_manifest.hpp"
+#endif
+
 namespace ck {
 namespace tensor_operation {
 namespace device {
 namespace instance {
 
+// Id of a device operation instance, the FNV-1a hash of its full type name. Unlike
+// GetTypeString(), it is known at compile time, which lets the instance library be pruned to the
+// ids listed in a manifest. It is stable for a given compiler version.
+template <typename Op>
+constexpr uint64_t get_instance_id()
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    for(const char* p = __PRETTY_FUNCTION__; *p != '\0'; ++p)
+    {
+        hash = (hash ^ static_cast<unsigned char>(*p)) * 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+// ids of the instances added so far, so that they can be looked up from a base class pointer
+struct InstanceIdRegistry
+{
+    std::mutex mutex;
+    std::unordered_map<std::type_index, uint64_t> ids;
+};
+
+inline InstanceIdRegistry& get_instance_id_registry()
+{
+    static InstanceIdRegistry registry;
+    return registry;
+}
+
+// registers the id of Op once, later calls from repeated GetInstances() are a no-op
+template <typename Op>
+void register_instance_id()
+{
+    static const bool registered = [] {
+        auto& registry = get_instance_id_registry();
+
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.ids.emplace(std::type_index(typeid(Op)), get_instance_id<Op>());
+
+        return true;
+    }();
+
+    (void)registered;
+}
+
+// id of an instance returned by DeviceOperationInstanceFactory, 0 if it is unknown
+template <typename BaseOp>
+uint64_t get_instance_id(const BaseOp& op)
+{
+    auto& registry = get_instance_id_registry();
+
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    const auto it = registry.ids.find(std::type_index(typeid(op)));
+
+    return it == registry.ids.end() ? 0 : it->second;
+}
+
+// the id as printed by ckProfiler and read back from instance manifests
+template <typename BaseOp>
+std::string get_instance_id_string(const BaseOp& op)
+{
+    std::ostringstream oss;
+
+    oss << std::hex << std::setw(16) << std::setfill('0') << get_instance_id(op);
+
+    return oss.str();
+}
+
 template <typename BaseOp, typename NewOpInstances>
 void add_device_operation_instances(std::vector<std::unique_ptr<BaseOp>>& op_instances,
                                     const NewOpInstances& new_op_instances)
@@ -25,10 +108,50 @@ void add_device_operation_instances(std::vector<std::unique_ptr<BaseOp>>& op_ins
         static_assert(std::is_base_of_v<BaseOp, NewOpInstance>,
                       "wrong! NewOpInstance should be derived from BaseOp");
 
+        register_instance_id<NewOpInstance>();
         op_instances.push_back(std::make_unique<NewOpInstance>(new_op_instance));
     });
 }
 
+#ifdef CK_INSTANCE_MANIFEST
+template <typename Op>
+constexpr bool is_instance_in_manifest()
+{
+    for(const uint64_t id : instance_manifest)
+    {
+        if(id == get_instance_id<Op>())
+            return true;
+    }
+
+    return false;
+}
+
+// Adds the instances of the tuple type which are listed in the manifest. The others are never
+// constructed, so that their kernels are not instantiated at all.
+template <typename NewOpInstances, typename BaseOp>
+void add_device_operation_instances_in_manifest(std::vector<std::unique_ptr<BaseOp>>& op_instances)
+{
+    ck::static_for<0, std::tuple_size_v<NewOpInstances>, 1>{}([&](auto i) {
+        using NewOpInstance = std::tuple_element_t<decltype(i)::value, NewOpInstances>;
+
+        static_assert(std::is_base_of_v<BaseOp, NewOpInstance>,
+                      "wrong! NewOpInstance should be derived from BaseOp");
+
+        if constexpr(is_instance_in_manifest<NewOpInstance>())
+        {
+            register_instance_id<NewOpInstance>();
+            op_instances.push_back(std::make_unique<NewOpInstance>());
+        }
+    });
+}
+
+// the instance sources pass a temporary of the tuple, which would construct every instance, so
+// the call is redirected to only name the tuple type
+#define add_device_operation_instances(op_instances, ...)                                  \
+    add_device_operation_instances_in_manifest<ck::remove_cvref_t<decltype(__VA_ARGS__)>>( \
+        op_instances)
+#endif
+
 } // namespace instance
 } // namespace device
 } // namespace tensor_operation
@@ -18,6 +18,7 @@
 #include "ck/utility/type.hpp"
 #include "ck/host_utility/io.hpp"
 
+#include "ck/library/utility/error_bound.hpp"
 #include "ck/library/utility/ranges.hpp"
 
 namespace ck {
@@ -320,5 +321,63 @@ check_err(const Range& out,
     return res;
 }
 
+// Compare against a reference computed in oracle mode, each element is checked against its own
+// absolute error bound instead of a fixed rtol/atol pair (see error_bound.hpp)
+template <typename Range, typename RefRange, typename BoundRange>
+std::enable_if_t<(std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
+                  std::is_same_v<ranges::range_value_t<BoundRange>, double>),
+                 bool>
+check_err(const Range& out,
+          const RefRange& ref,
+          const BoundRange& err_bound,
+          const std::string& msg = "Error: Incorrect results!")
+{
+    if(out.size() != ref.size() || out.size() != err_bound.size())
+    {
+        std::cerr << msg << " out.size() != ref.size() or err_bound.size(), :" << out.size()
+                  << " != " << ref.size() << " or " << err_bound.size() << std::endl;
+        return false;
+    }
+
+    bool res{true};
+    int err_count          = 0;
+    double err             = 0;
+    double max_err         = 0;
+    double max_bound_ratio = 0;
+    for(std::size_t i = 0; i < ref.size(); ++i)
+    {
+        const double o = to_double(*std::next(std::begin(out), i));
+        const double r = to_double(*std::next(std::begin(ref), i));
+        const double b = *std::next(std::begin(err_bound), i);
+        err            = std::abs(o - r);
+        if(b > 0)
+        {
+            max_bound_ratio = std::max(max_bound_ratio, err / b);
+        }
+        if(err > b || !std::isfinite(o) || !std::isfinite(r))
+        {
+            max_err = err > max_err ? err : max_err;
+            err_count++;
+            if(err_count < 5)
+            {
+                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
+                          << "] != ref[" << i << "]: " << o << " != " << r << ", bound: " << b
+                          << std::endl;
+            }
+            res = false;
+        }
+    }
+    if(!res)
+    {
+        const float error_percent =
+            static_cast<float>(err_count) / static_cast<float>(out.size()) * 100.f;
+        std::cerr << "max err: " << max_err;
+        std::cerr << ", max err / bound: " << max_bound_ratio;
+        std::cerr << ", number of errors: " << err_count;
+        std::cerr << ", " << error_percent << "% wrong values" << std::endl;
+    }
+    return res;
+}
+
 } // namespace utils
 } // namespace ck
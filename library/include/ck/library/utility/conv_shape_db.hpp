@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/convolution_parameter.hpp"
+
+namespace ck {
+namespace utils {
+namespace conv {
+
+enum struct ConvDirection
+{
+    Forward,
+    BackwardData,
+    BackwardWeight,
+};
+
+// "fwd", "bwd_data" or "bwd_weight"
+std::string get_conv_direction_string(ConvDirection direction);
+
+bool is_same_conv_param(const ConvParam& a, const ConvParam& b);
+
+// the arguments of parse_conv_param, space-separated
+std::string get_conv_param_string(const ConvParam& param);
+
+// a problem and how many times a model runs it
+struct ConvShape
+{
+    ConvParam param_;
+    ConvDirection direction_;
+    std::size_t count_;
+};
+
+// de-duplicated convolution problems of one or more models, in order of first occurrence
+class ConvShapeDb
+{
+    public:
+    // adds count occurrences of a problem, merged with an equal problem of the same direction
+    void Add(const ConvParam& param,
+             ConvDirection direction = ConvDirection::Forward,
+             std::size_t count       = 1);
+
+    void Add(const ConvShapeDb& other);
+
+    // adds the backward data and backward weight problems of every forward one, with its count,
+    // as a training step runs them
+    void AddBackward();
+
+    const std::vector<ConvShape>& GetShapes() const { return shapes_; }
+
+    // sum of the counts
+    std::size_t GetNumLayers() const;
+
+    // sum of the flops weighted by the counts
+    std::size_t GetFlops() const;
+
+    // adds the shapes of a file of lines "<direction> <count> <arguments of parse_conv_param>",
+    // '#' starts a comment, returns the number of shapes read
+    std::size_t Load(std::istream& is);
+
+    // in the format read by Load
+    void Save(std::ostream& os) const;
+
+    private:
+    std::vector<ConvShape> shapes_;
+};
+
+// "resnet50", "mobilenet_v2", "vit_b16", "bert_base" and "dlrm"
+std::vector<std::string> get_conv_shape_db_model_names();
+
+// the forward problems of a model at batch size N, all 2-D. Linear layers of S tokens are 1x1
+// convolutions over an S x 1 image, which make_conv_fwd_plan dispatches to GEMM.
+ConvShapeDb make_model_conv_shape_db(const std::string& model, ck::index_t N);
+
+} // namespace conv
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/convolution_forward_specialization.hpp"
+
+#include "ck/library/utility/convolution_parameter.hpp"
+
+namespace ck {
+namespace utils {
+namespace conv {
+
+// device operation family a forward convolution is dispatched to
+enum struct ConvFwdFamily
+{
+    Gemm,           // DeviceGemmMultipleD<Row, Col, Tuple<>, Row, ...>
+    BatchedGemm,    // DeviceBatchedGemm<Row, Col, Row, ...>
+    GroupedConvFwd, // DeviceGroupedConvFwdMultipleABD
+};
+
+std::string get_conv_fwd_family_string(ConvFwdFamily family);
+
+// GEMM view of a forward convolution with NWGC/NHWGC/NDHWGC input, GKXC/GKYXC/GKZYXC weight and
+// NWGK/NHWGK/NDHWGK output, all packed. For b < Batch_:
+//   E[b * BatchStrideE_ + m * StrideE_ + n] =
+//       sum_k A[b * BatchStrideA_ + m * StrideA_ + k] * B[b * BatchStrideB_ + n * StrideB_ + k]
+// A is the input (row-major M x K), B the weight (column-major K x N), E the output (row-major
+// M x N)
+struct ConvFwdGemmView
+{
+    ck::index_t Batch_;
+    ck::index_t M_;
+    ck::index_t N_;
+    ck::index_t K_;
+
+    ck::index_t StrideA_;
+    ck::index_t StrideB_;
+    ck::index_t StrideE_;
+
+    ck::long_index_t BatchStrideA_;
+    ck::long_index_t BatchStrideB_;
+    ck::long_index_t BatchStrideE_;
+};
+
+struct ConvFwdPlan
+{
+    ConvFwdFamily family_;
+
+    // the problem with the dilation of length-1 filters reset to 1 and the right pads trimmed to
+    // those actually read, the tensors are the same as the ones of the original problem
+    ConvParam param_;
+
+    // only valid for the Gemm and BatchedGemm families
+    ConvFwdGemmView gemm_;
+
+    // GroupedConvFwd instances to try, most specialized first
+    std::vector<ck::tensor_operation::device::ConvolutionForwardSpecialization>
+        conv_fwd_specializations_;
+};
+
+// drops the dilations and the right pads that do not change which inputs are read
+ConvParam canonicalize_conv_fwd_param(const ConvParam& param);
+
+// rewrites the problem onto the cheapest family: unpadded 1x1 convolutions which are a (batched)
+// GEMM, possibly over a strided view of the input, go to the GEMM families, all others go to
+// grouped convolution with the matching specializations
+ConvFwdPlan make_conv_fwd_plan(const ConvParam& param);
+
+// whether a GroupedConvFwd instance with the given GetTypeString() belongs to the plan
+bool is_conv_fwd_instance_in_plan(const ConvFwdPlan& plan, const std::string& type_string);
+
+} // namespace conv
+} // namespace utils
+} // namespace ck
+
+std::ostream& operator<<(std::ostream& os, const ck::utils::conv::ConvFwdPlan& plan);
@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/type_convert.hpp"
+
+namespace ck {
+namespace utils {
+
+// How the rounding error of a length-n accumulation is bounded.
+//  - Deterministic: worst case gamma_n = n * u / (1 - n * u) (Higham, Theorem 3.1)
+//  - Probabilistic: lambda * sqrt(n) * u, holds with probability close to one for independent
+//                   rounding errors (Higham & Mary, 2019), much tighter for large K
+enum struct ErrorBoundMode
+{
+    Deterministic,
+    Probabilistic
+};
+
+// unit roundoff u = 2^-p of a type with p bits of significand, 0 for exact integer types
+template <typename T>
+constexpr double get_unit_roundoff()
+{
+    if constexpr(std::is_same_v<T, double>)
+        return 0x1p-53;
+    else if constexpr(std::is_same_v<T, float>)
+        return 0x1p-24;
+    else if constexpr(std::is_same_v<T, half_t>)
+        return 0x1p-11;
+    else if constexpr(std::is_same_v<T, bhalf_t>)
+        return 0x1p-8;
+    else if constexpr(std::is_same_v<T, f8_t>)
+        return 0x1p-4;
+    else if constexpr(std::is_same_v<T, bf8_t>)
+        return 0x1p-3;
+    else
+        return 0;
+}
+
+// smallest positive normal value, below it the relative error model breaks down
+template <typename T>
+constexpr double get_min_normal()
+{
+    if constexpr(std::is_same_v<T, double>)
+        return std::numeric_limits<double>::min();
+    else if constexpr(std::is_same_v<T, float> || std::is_same_v<T, bhalf_t>)
+        return std::numeric_limits<float>::min();
+    else if constexpr(std::is_same_v<T, half_t>)
+        return 0x1p-14;
+    else if constexpr(std::is_same_v<T, f8_t>)
+        return 0x1p-7;
+    else if constexpr(std::is_same_v<T, bf8_t>)
+        return 0x1p-15;
+    else
+        return 0;
+}
+
+// integer types converted with static_cast, bhalf_t and the fp8 types are stored as integers
+// (f8_t and bf8_t are _BitInt(8) under clang) but encode floating point values
+template <typename T>
+inline constexpr bool is_plain_integral_v =
+    std::is_integral_v<T> && !std::is_same_v<T, bhalf_t> && !std::is_same_v<T, f8_t> &&
+    !std::is_same_v<T, bf8_t>;
+
+template <typename T>
+double to_double(const T& x)
+{
+    if constexpr(std::is_same_v<T, double>)
+        return x;
+    else if constexpr(is_plain_integral_v<T>)
+        return static_cast<double>(x);
+    else
+        return static_cast<double>(ck::type_convert<float>(x));
+}
+
+template <typename T>
+T from_double(double x)
+{
+    if constexpr(std::is_same_v<T, double>)
+        return x;
+    else if constexpr(is_plain_integral_v<T>)
+        return static_cast<T>(x);
+    else
+        return ck::type_convert<T>(static_cast<float>(x));
+}
+
+// Dot product accumulated with the error-free transformations TwoProduct/TwoSum
+// (Ogita, Rump & Oishi, "Accurate sum and dot product", Algorithm Dot2). The result is as
+// accurate as if computed in twice the working (double) precision, so it can serve as an
+// oracle for any accumulation type up to fp32. The sum of |a_k * b_k| is tracked as well,
+// as it is the scale of the accumulation error of the tested implementation.
+struct CompensatedDotProduct
+{
+    void Add(double a, double b)
+    {
+        const double p  = a * b;
+        const double ep = std::fma(a, b, -p);
+        const double s  = sum_ + p;
+        const double z  = s - sum_;
+        const double es = (sum_ - (s - z)) + (p - z);
+
+        sum_ = s;
+        compensation_ += ep + es;
+        abs_sum_ += std::abs(p);
+        ++length_;
+    }
+
+    double GetValue() const { return sum_ + compensation_; }
+
+    double GetAbsValue() const { return abs_sum_; }
+
+    std::size_t GetLength() const { return length_; }
+
+    private:
+    double sum_          = 0;
+    double compensation_ = 0;
+    double abs_sum_      = 0;
+    std::size_t length_  = 0;
+};
+
+// bound of |fl(sum) - sum| for a length-n accumulation with unit roundoff u, where abs_sum is
+// the sum of the magnitudes of the accumulated terms
+inline double get_accumulation_error_bound(std::size_t n,
+                                           double abs_sum,
+                                           double u,
+                                           ErrorBoundMode mode = ErrorBoundMode::Probabilistic)
+{
+    if(u <= 0 || n == 0)
+        return 0;
+
+    // one extra rounding for each product and for the final store of the accumulator
+    const double nu = static_cast<double>(n + 1) * u;
+
+    if(mode == ErrorBoundMode::Deterministic)
+    {
+        return nu < 1 ? nu / (1 - nu) * abs_sum : std::numeric_limits<double>::infinity();
+    }
+    else
+    {
+        // lambda = 6 gives a failure probability below 1e-7 per element
+        constexpr double lambda = 6;
+
+        return (lambda * std::sqrt(static_cast<double>(n + 1)) * u) * abs_sum;
+    }
+}
+
+// Propagate the accumulation error acc_bound of the exact value acc through the output stage
+// f_out (type conversion, elementwise operation) and add the rounding of the output type.
+// The output stage is evaluated at both ends of the interval, which is exact for monotonic
+// elementwise operations and a good estimate for smooth ones. The reference result itself is
+// rounded to OutDataType as well, hence the output rounding is counted twice.
+template <typename OutDataType, typename OutputFunc>
+double get_output_error_bound(OutputFunc f_out, double acc, double acc_bound)
+{
+    const double y0 = to_double(f_out(acc));
+    const double yp = to_double(f_out(acc + acc_bound));
+    const double ym = to_double(f_out(acc - acc_bound));
+
+    const double propagated = std::max(std::abs(yp - y0), std::abs(ym - y0));
+
+    return propagated + 2 * get_unit_roundoff<OutDataType>() * std::abs(y0) +
+           get_min_normal<OutDataType>();
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+
+namespace ck {
+namespace utils {
+namespace fusion {
+
+enum struct FusionOpKind
+{
+    Gemm,        // [M, K] x [K, N]
+    BatchedGemm, // [G, M, K] x [G, K, N]
+    Conv,        // forward convolution
+    Add,
+    Multiply,
+    Scale, // by a scalar
+    Relu,
+    FastGelu,
+    LayerNorm, // over the last dim
+    Softmax,   // over the last dim
+};
+
+std::string get_fusion_op_kind_string(FusionOpKind kind);
+
+struct FusionTensor
+{
+    std::vector<ck::long_index_t> lengths_;
+    std::size_t element_size_;
+
+    std::size_t GetNumBytes() const;
+};
+
+struct FusionNode
+{
+    FusionOpKind kind_;
+    std::vector<ck::index_t> inputs_;
+    ck::index_t output_;
+};
+
+// Host graph of tensor operations. Tensors are either inputs of the graph, e.g. weights, biases
+// and residuals, or the output of a single node. Nodes are added in topological order, a node
+// output read by no other node is an output of the graph.
+class FusionGraph
+{
+    public:
+    ck::index_t AddTensor(const std::vector<ck::long_index_t>& lengths, std::size_t element_size);
+
+    // [M, K] x [K, N] -> [M, N], batched over the outer dim of 3-D operands
+    ck::index_t AddGemm(ck::index_t a, ck::index_t b);
+
+    ck::index_t
+    AddConv(ck::index_t in, ck::index_t wei, const std::vector<ck::long_index_t>& out_lengths);
+
+    // y is broadcast to the lengths of x, e.g. a bias
+    ck::index_t AddAdd(ck::index_t x, ck::index_t y);
+    ck::index_t AddMultiply(ck::index_t x, ck::index_t y);
+
+    ck::index_t AddScale(ck::index_t x);
+    ck::index_t AddRelu(ck::index_t x);
+    ck::index_t AddFastGelu(ck::index_t x);
+
+    ck::index_t AddLayerNorm(ck::index_t x, ck::index_t gamma, ck::index_t beta);
+    ck::index_t AddSoftmax(ck::index_t x);
+
+    const std::vector<FusionTensor>& GetTensors() const { return tensors_; }
+    const std::vector<FusionNode>& GetNodes() const { return nodes_; }
+
+    // the nodes reading a tensor
+    std::vector<ck::index_t> GetConsumers(ck::index_t tensor) const;
+
+    private:
+    ck::index_t AddNode(FusionOpKind kind,
+                        const std::vector<ck::index_t>& inputs,
+                        const std::vector<ck::long_index_t>& out_lengths);
+
+    std::vector<FusionTensor> tensors_;
+    std::vector<FusionNode> nodes_;
+};
+
+// a device operation invocation computing a chain of nodes
+struct FusionDeviceOp
+{
+    std::string device_op_; // e.g. "DeviceGemmMultipleD<AddFastGelu>"
+
+    std::vector<ck::index_t> nodes_;
+    std::vector<ck::index_t> inputs_; // tensors read
+    ck::index_t output_;              // tensor written
+
+    // intermediates written to and read back from a workspace
+    std::size_t workspace_bytes_;
+
+    // compulsory memory traffic: inputs and output once, plus the workspace
+    std::size_t bytes_;
+};
+
+struct FusionPlan
+{
+    // in execution order
+    std::vector<FusionDeviceOp> ops_;
+
+    std::size_t bytes_;
+    std::size_t unfused_bytes_;
+};
+
+// Maps the graph onto the fused device operations of CK, matching from every node the longest
+// chain of single-consumer intermediates among:
+//   Gemm, Add, Relu, Add, LayerNorm           DeviceGemmMultipleDLayernorm<AddReluAdd>
+//   Gemm, Add, Add, FastGelu                  DeviceGemmMultipleD<AddAddFastGelu>
+//   Gemm, Add, FastGelu                       DeviceGemmMultipleD<AddFastGelu>
+//   Gemm, Add, Multiply                       DeviceGemmMultipleD<AddMultiply>
+//   Gemm, Multiply, Add                       DeviceGemmMultipleD<MultiplyAdd>
+//   Gemm, Scale, Add / Gemm, Add              DeviceGemmMultipleD<Bilinear>
+//   Gemm, FastGelu                            DeviceGemmMultipleD<FastGelu>
+//   BatchedGemm, Scale, Softmax, BatchedGemm  DeviceBatchedGemmSoftmaxGemmPermute
+//   Conv, Scale, Add, Add, Relu               DeviceGroupedConvFwdMultipleABD<ScaleAddScaleAddRelu>
+//   Add, LayerNorm                            DeviceElementwiseNormalization<Add>
+// Remaining chains of elementwise nodes go to a single DeviceElementwise, all other nodes to
+// their own device operation.
+FusionPlan make_fusion_plan(const FusionGraph& graph);
+
+// a device operation per node
+FusionPlan make_unfused_plan(const FusionGraph& graph);
+
+} // namespace fusion
+} // namespace utils
+} // namespace ck
+
+std::ostream& operator<<(std::ostream& os, const ck::utils::fusion::FusionPlan& plan);
@@ -0,0 +1,423 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__) && !defined(__HIP_DEVICE_COMPILE__)
+#include <emmintrin.h>
+#define CK_HOST_PERMUTE_USE_SSE2 1
+#else
+#define CK_HOST_PERMUTE_USE_SSE2 0
+#endif
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
+
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+namespace detail {
+
+// tiles of the recursion small enough to stay in L1
+inline constexpr std::size_t HostPermuteBlockSize = 32;
+
+// elements below which the permutation runs on a single thread
+inline constexpr std::size_t HostPermuteMinElementsPerThread = 1 << 16;
+
+// in-register transpose of a Width x Width tile of ElementSize-byte elements, the strides are in
+// bytes, Width is 0 if there is none
+template <std::size_t ElementSize>
+struct HostTransposeTile
+{
+    static constexpr std::size_t Width = 0;
+
+    static void Run(const char*, std::size_t, char*, std::size_t) {}
+};
+
+#if CK_HOST_PERMUTE_USE_SSE2
+template <>
+struct HostTransposeTile<2>
+{
+    static constexpr std::size_t Width = 8;
+
+    static void Run(const char* p_a, std::size_t a_stride, char* p_b, std::size_t b_stride)
+    {
+        __m128i r[8];
+
+        for(std::size_t k = 0; k < 8; ++k)
+            r[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_a + k * a_stride));
+
+        __m128i t[8];
+
+        for(std::size_t k = 0; k < 8; k += 4)
+        {
+            t[k + 0] = _mm_unpacklo_epi16(r[k + 0], r[k + 1]);
+            t[k + 1] = _mm_unpackhi_epi16(r[k + 0], r[k + 1]);
+            t[k + 2] = _mm_unpacklo_epi16(r[k + 2], r[k + 3]);
+            t[k + 3] = _mm_unpackhi_epi16(r[k + 2], r[k + 3]);
+
+            r[k + 0] = _mm_unpacklo_epi32(t[k + 0], t[k + 2]);
+            r[k + 1] = _mm_unpackhi_epi32(t[k + 0], t[k + 2]);
+            r[k + 2] = _mm_unpacklo_epi32(t[k + 1], t[k + 3]);
+            r[k + 3] = _mm_unpackhi_epi32(t[k + 1], t[k + 3]);
+        }
+
+        for(std::size_t k = 0; k < 4; ++k)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p_b + (2 * k) * b_stride),
+                             _mm_unpacklo_epi64(r[k], r[k + 4]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p_b + (2 * k + 1) * b_stride),
+                             _mm_unpackhi_epi64(r[k], r[k + 4]));
+        }
+    }
+};
+
+template <>
+struct HostTransposeTile<4>
+{
+    static constexpr std::size_t Width = 4;
+
+    static void Run(const char* p_a, std::size_t a_stride, char* p_b, std::size_t b_stride)
+    {
+        const __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_a));
+        const __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_a + a_stride));
+        const __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_a + 2 * a_stride));
+        const __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_a + 3 * a_stride));
+
+        const __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+        const __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+        const __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+        const __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_b), _mm_unpacklo_epi64(t0, t1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_b + b_stride), _mm_unpackhi_epi64(t0, t1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_b + 2 * b_stride),
+                         _mm_unpacklo_epi64(t2, t3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_b + 3 * b_stride),
+                         _mm_unpackhi_epi64(t2, t3));
+    }
+};
+
+template <>
+struct HostTransposeTile<8>
+{
+    static constexpr std::size_t Width = 2;
+
+    static void Run(const char* p_a, std::size_t a_stride, char* p_b, std::size_t b_stride)
+    {
+        const __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_a));
+        const __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_a + a_stride));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_b), _mm_unpacklo_epi64(r0, r1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_b + b_stride), _mm_unpackhi_epi64(r0, r1));
+    }
+};
+#endif
+
+// b[i * b_stride_i + j * b_stride_j] = op(a[i * a_stride_i + j * a_stride_j]) over an ni x nj
+// tile, where a is contiguous along i and b along j in the transposing case
+template <typename ADataType, typename BDataType, typename ElementwiseOperation>
+struct HostPermuteTile
+{
+    static constexpr bool IsBitCopy =
+        std::is_same_v<ADataType, BDataType> &&
+        std::is_same_v<ElementwiseOperation, ck::tensor_operation::element_wise::PassThrough>;
+
+    static constexpr std::size_t TileWidth =
+        IsBitCopy ? HostTransposeTile<sizeof(ADataType)>::Width : 0;
+
+    const ADataType* p_a_;
+    BDataType* p_b_;
+    std::size_t a_stride_i_;
+    std::size_t a_stride_j_;
+    std::size_t b_stride_i_;
+    std::size_t b_stride_j_;
+    ElementwiseOperation op_;
+
+    void RunScalar(std::size_t i_begin, std::size_t i_end, std::size_t j_begin, std::size_t j_end)
+        const
+    {
+        for(std::size_t i = i_begin; i < i_end; ++i)
+        {
+            for(std::size_t j = j_begin; j < j_end; ++j)
+            {
+                BDataType& b  = p_b_[i * b_stride_i_ + j * b_stride_j_];
+                const auto& a = p_a_[i * a_stride_i_ + j * a_stride_j_];
+
+                // a copy of any type
+                if constexpr(IsBitCopy)
+                    b = a;
+                else
+                    op_(b, a);
+            }
+        }
+    }
+
+    void RunBlock(std::size_t i_begin, std::size_t i_end, std::size_t j_begin, std::size_t j_end)
+        const
+    {
+        if constexpr(TileWidth > 0)
+        {
+            if(a_stride_i_ == 1 && b_stride_j_ == 1)
+            {
+                constexpr std::size_t W = TileWidth;
+
+                const std::size_t i_tile_end = i_begin + (i_end - i_begin) / W * W;
+                const std::size_t j_tile_end = j_begin + (j_end - j_begin) / W * W;
+
+                for(std::size_t j = j_begin; j < j_tile_end; j += W)
+                {
+                    for(std::size_t i = i_begin; i < i_tile_end; i += W)
+                    {
+                        HostTransposeTile<sizeof(ADataType)>::Run(
+                            reinterpret_cast<const char*>(p_a_ + i + j * a_stride_j_),
+                            a_stride_j_ * sizeof(ADataType),
+                            reinterpret_cast<char*>(p_b_ + i * b_stride_i_ + j),
+                            b_stride_i_ * sizeof(BDataType));
+                    }
+                }
+
+                RunScalar(i_tile_end, i_end, j_begin, j_end);
+                RunScalar(i_begin, i_tile_end, j_tile_end, j_end);
+
+                return;
+            }
+        }
+
+        RunScalar(i_begin, i_end, j_begin, j_end);
+    }
+
+    // halves the longer side until the tile fits in the cache, whatever its size
+    void Run(std::size_t i_begin, std::size_t i_end, std::size_t j_begin, std::size_t j_end) const
+    {
+        const std::size_t ni = i_end - i_begin;
+        const std::size_t nj = j_end - j_begin;
+
+        if(ni <= HostPermuteBlockSize && nj <= HostPermuteBlockSize)
+        {
+            RunBlock(i_begin, i_end, j_begin, j_end);
+        }
+        else if(ni >= nj)
+        {
+            // keeping the halves aligned to the in-register tiles
+            const std::size_t i_mid = i_begin + ni / 2 / 8 * 8;
+
+            Run(i_begin, i_mid, j_begin, j_end);
+            Run(i_mid, i_end, j_begin, j_end);
+        }
+        else
+        {
+            const std::size_t j_mid = j_begin + nj / 2 / 8 * 8;
+
+            Run(i_begin, i_end, j_begin, j_mid);
+            Run(i_begin, i_end, j_mid, j_end);
+        }
+    }
+};
+
+} // namespace detail
+
+// b(idx) = op(a(idx)) for every multi-index of a and b, which have the same lengths but any
+// strides, e.g. a is the view transpose_host_tensor_descriptor_given_new2old(a.mDesc, new2old)
+// of a permutation and b is packed. After dropping unit dims and merging dims contiguous in both,
+// the fastest dims of a and b are transposed by cache-oblivious recursive blocking, with
+// in-register transposes of 2, 4 and 8-byte elements, and the other dims are split between
+// threads.
+template <typename ADataType, typename BDataType, typename ElementwiseOperation>
+void host_permute(const HostTensorDescriptor& a_desc,
+                  const ADataType* p_a,
+                  const HostTensorDescriptor& b_desc,
+                  BDataType* p_b,
+                  ElementwiseOperation op,
+                  std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    if(a_desc.GetLengths() != b_desc.GetLengths())
+        throw std::runtime_error("wrong! lengths of a and b of a permutation do not match");
+
+    if(a_desc.GetElementSize() == 0)
+        return;
+
+    // dims by decreasing stride of b, without unit dims
+    std::vector<std::size_t> dims;
+
+    for(std::size_t i = 0; i < a_desc.GetNumOfDimension(); ++i)
+    {
+        if(a_desc.GetLengths()[i] > 1)
+            dims.push_back(i);
+    }
+
+    std::stable_sort(dims.begin(), dims.end(), [&](std::size_t x, std::size_t y) {
+        return b_desc.GetStrides()[x] > b_desc.GetStrides()[y];
+    });
+
+    std::vector<std::size_t> lengths;
+    std::vector<std::size_t> a_strides;
+    std::vector<std::size_t> b_strides;
+
+    for(const std::size_t dim : dims)
+    {
+        const std::size_t length   = a_desc.GetLengths()[dim];
+        const std::size_t a_stride = a_desc.GetStrides()[dim];
+        const std::size_t b_stride = b_desc.GetStrides()[dim];
+
+        if(!lengths.empty() && a_strides.back() == a_stride * length &&
+           b_strides.back() == b_stride * length)
+        {
+            lengths.back() *= length;
+            a_strides.back() = a_stride;
+            b_strides.back() = b_stride;
+        }
+        else
+        {
+            lengths.push_back(length);
+            a_strides.push_back(a_stride);
+            b_strides.push_back(b_stride);
+        }
+    }
+
+    // j is the fastest dim of b, i the fastest other dim of a if it is faster than j
+    if(lengths.empty())
+    {
+        lengths.push_back(1);
+        a_strides.push_back(1);
+        b_strides.push_back(1);
+    }
+
+    const std::size_t j_dim = lengths.size() - 1;
+    std::size_t i_dim       = j_dim;
+
+    for(std::size_t d = 0; d < j_dim; ++d)
+    {
+        if(a_strides[d] < a_strides[i_dim])
+            i_dim = d;
+    }
+
+    const std::size_t ni = i_dim == j_dim ? 1 : lengths[i_dim];
+    const std::size_t nj = lengths[j_dim];
+
+    std::vector<std::size_t> outer_dims;
+
+    for(std::size_t d = 0; d < j_dim; ++d)
+    {
+        if(d != i_dim)
+            outer_dims.push_back(d);
+    }
+
+    const std::size_t num_outer = std::accumulate(
+        outer_dims.begin(), outer_dims.end(), std::size_t{1}, [&](std::size_t n, std::size_t d) {
+            return n * lengths[d];
+        });
+
+    // the work is split along the outer dims, then along the longer of i and j
+    num_thread = std::clamp<std::size_t>(
+        std::min(num_thread, a_desc.GetElementSize() / detail::HostPermuteMinElementsPerThread),
+        1,
+        a_desc.GetElementSize());
+
+    const bool split_i         = ni >= nj;
+    const std::size_t num_part = std::min((num_thread + num_outer - 1) / num_outer,
+                                          ((split_i ? ni : nj) + 7) / 8);
+    const std::size_t num_task = num_outer * num_part;
+
+    auto run_tasks = [&](std::size_t task_begin, std::size_t task_end) {
+        for(std::size_t task = task_begin; task < task_end; ++task)
+        {
+            std::size_t outer  = task / num_part;
+            std::size_t a_base = 0;
+            std::size_t b_base = 0;
+
+            for(auto d = outer_dims.rbegin(); d != outer_dims.rend(); ++d)
+            {
+                a_base += outer % lengths[*d] * a_strides[*d];
+                b_base += outer % lengths[*d] * b_strides[*d];
+                outer /= lengths[*d];
+            }
+
+            const detail::HostPermuteTile<ADataType, BDataType, ElementwiseOperation> tile{
+                p_a + a_base,
+                p_b + b_base,
+                i_dim == j_dim ? 0 : a_strides[i_dim],
+                a_strides[j_dim],
+                i_dim == j_dim ? 0 : b_strides[i_dim],
+                b_strides[j_dim],
+                op};
+
+            // parts aligned to the in-register tiles
+            const std::size_t n          = split_i ? ni : nj;
+            const std::size_t part       = task % num_part;
+            const std::size_t part_size  = (n + num_part * 8 - 1) / (num_part * 8) * 8;
+            const std::size_t part_begin = std::min(part * part_size, n);
+            const std::size_t part_end   = std::min(part_begin + part_size, n);
+
+            if(split_i)
+                tile.Run(part_begin, part_end, 0, nj);
+            else
+                tile.Run(0, ni, part_begin, part_end);
+        }
+    };
+
+    if(num_thread == 1 || num_task == 1)
+    {
+        run_tasks(0, num_task);
+        return;
+    }
+
+    const std::size_t num_worker      = std::min(num_thread, num_task);
+    const std::size_t task_per_worker = (num_task + num_worker - 1) / num_worker;
+
+    std::vector<joinable_thread> threads(num_worker);
+
+    for(std::size_t it = 0; it < num_worker; ++it)
+    {
+        const std::size_t task_begin = std::min(it * task_per_worker, num_task);
+        const std::size_t task_end   = std::min(task_begin + task_per_worker, num_task);
+
+        threads[it] = joinable_thread(run_tasks, task_begin, task_end);
+    }
+}
+
+// b = op(a) permuted by new2old: dim i of b is dim new2old[i] of a, b may have any strides
+template <typename ADataType,
+          typename BDataType,
+          typename New2Old,
+          typename ElementwiseOperation = ck::tensor_operation::element_wise::PassThrough>
+void host_permute(const Tensor<ADataType>& a,
+                  const New2Old& new2old,
+                  Tensor<BDataType>& b,
+                  ElementwiseOperation op = {},
+                  std::size_t num_thread  = std::thread::hardware_concurrency())
+{
+    host_permute(transpose_host_tensor_descriptor_given_new2old(a.mDesc, new2old),
+                 a.mData.data(),
+                 b.mDesc,
+                 b.mData.data(),
+                 op,
+                 num_thread);
+}
+
+// a permuted by new2old into a packed tensor
+template <typename DataType, typename New2Old>
+Tensor<DataType> make_permuted_host_tensor(const Tensor<DataType>& a,
+                                           const New2Old& new2old,
+                                           std::size_t num_thread =
+                                               std::thread::hardware_concurrency())
+{
+    Tensor<DataType> b(
+        transpose_host_tensor_descriptor_given_new2old(a.mDesc, new2old).GetLengths());
+
+    host_permute(a, new2old, b, ck::tensor_operation::element_wise::PassThrough{}, num_thread);
+
+    return b;
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,289 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/span.hpp"
+#include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
+
+#include "ck/library/utility/host_permute.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+
+enum struct TensorFileDataType
+{
+    F64,
+    F32,
+    F16,
+    BF16,
+    I32,
+    I8,
+    F8,
+    BF8,
+};
+
+std::size_t get_tensor_file_data_type_size(TensorFileDataType data_type);
+
+std::string get_tensor_file_data_type_string(TensorFileDataType data_type);
+
+template <typename T>
+struct tensor_file_data_type;
+
+template <>
+struct tensor_file_data_type<double>
+{
+    static constexpr auto value = TensorFileDataType::F64;
+};
+
+template <>
+struct tensor_file_data_type<float>
+{
+    static constexpr auto value = TensorFileDataType::F32;
+};
+
+template <>
+struct tensor_file_data_type<ck::half_t>
+{
+    static constexpr auto value = TensorFileDataType::F16;
+};
+
+template <>
+struct tensor_file_data_type<ck::bhalf_t>
+{
+    static constexpr auto value = TensorFileDataType::BF16;
+};
+
+template <>
+struct tensor_file_data_type<int32_t>
+{
+    static constexpr auto value = TensorFileDataType::I32;
+};
+
+template <>
+struct tensor_file_data_type<int8_t>
+{
+    static constexpr auto value = TensorFileDataType::I8;
+};
+
+template <>
+struct tensor_file_data_type<ck::f8_t>
+{
+    static constexpr auto value = TensorFileDataType::F8;
+};
+
+template <>
+struct tensor_file_data_type<ck::bf8_t>
+{
+    static constexpr auto value = TensorFileDataType::BF8;
+};
+
+enum struct TensorFileFormat
+{
+    // "CKTENSOR", uint32 version, data type, rank and layout size, uint64 lengths and strides,
+    // the layout, then the element space of the data at a multiple of 64 bytes, little-endian
+    CK,
+    // NumPy .npy, packed in C or Fortran order
+    Npy,
+};
+
+struct TensorFileInfo
+{
+    TensorFileDataType data_type_;
+    HostTensorDescriptor desc_;
+    std::string layout_; // e.g. "NHWGC", may be empty
+
+    // bytes before the data
+    std::size_t data_offset_;
+
+    std::size_t GetDataSize() const
+    {
+        return desc_.GetElementSpaceSize() * get_tensor_file_data_type_size(data_type_);
+    }
+};
+
+// the header of a tensor file, sets the data offset of info
+std::string make_tensor_file_header(TensorFileInfo& info, TensorFileFormat format);
+
+// the header at the start of a file of size bytes, .npy if it starts with its magic string, the
+// CK format otherwise, the file must hold all of the data
+TensorFileInfo parse_tensor_file_header(const char* p_file, std::size_t size);
+
+// read-only memory mapping of a tensor file
+class MappedTensorFile
+{
+    public:
+    explicit MappedTensorFile(const std::string& file_name);
+
+    MappedTensorFile(const MappedTensorFile&) = delete;
+    MappedTensorFile& operator=(const MappedTensorFile&) = delete;
+
+    MappedTensorFile(MappedTensorFile&& other) noexcept;
+    MappedTensorFile& operator=(MappedTensorFile&& other) noexcept;
+
+    ~MappedTensorFile();
+
+    const TensorFileInfo& GetInfo() const { return info_; }
+
+    const void* GetData() const { return static_cast<const char*>(p_map_) + info_.data_offset_; }
+
+    private:
+    void Unmap();
+
+    TensorFileInfo info_;
+    void* p_map_;
+    std::size_t map_size_;
+};
+
+// read-only view of a mapped tensor file, nothing is copied, pages are read on first access
+template <typename T>
+class MappedTensor
+{
+    public:
+    explicit MappedTensor(const std::string& file_name) : file_(file_name)
+    {
+        if(file_.GetInfo().data_type_ != tensor_file_data_type<T>::value)
+        {
+            throw std::runtime_error(
+                "wrong! " + file_name + " holds " +
+                get_tensor_file_data_type_string(file_.GetInfo().data_type_) + ", not " +
+                get_tensor_file_data_type_string(tensor_file_data_type<T>::value));
+        }
+    }
+
+    const HostTensorDescriptor& GetDesc() const { return file_.GetInfo().desc_; }
+
+    const std::string& GetLayout() const { return file_.GetInfo().layout_; }
+
+    decltype(auto) GetLengths() const { return GetDesc().GetLengths(); }
+
+    decltype(auto) GetStrides() const { return GetDesc().GetStrides(); }
+
+    std::size_t GetElementSpaceSize() const { return GetDesc().GetElementSpaceSize(); }
+
+    const T* data() const { return static_cast<const T*>(file_.GetData()); }
+
+    template <typename... Is>
+    const T& operator()(Is... is) const
+    {
+        return data()[GetDesc().GetOffsetFromMultiIndex(is...)];
+    }
+
+    ck::span<const T> AsSpan() const { return {data(), GetElementSpaceSize()}; }
+
+    private:
+    MappedTensorFile file_;
+};
+
+// copies a tensor file into a tensor of the same lengths, the strides of both may differ
+template <typename T>
+void load_tensor(const std::string& file_name,
+                 Tensor<T>& tensor,
+                 std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    const MappedTensor<T> mapped(file_name);
+
+    if(mapped.GetLengths() != tensor.GetLengths())
+    {
+        throw std::runtime_error("wrong! lengths of " + file_name +
+                                 " do not match those of the tensor");
+    }
+
+    host_permute(mapped.GetDesc(),
+                 mapped.data(),
+                 tensor.mDesc,
+                 tensor.data(),
+                 ck::tensor_operation::element_wise::PassThrough{},
+                 num_thread);
+}
+
+// a tensor with the descriptor of the file
+template <typename T>
+Tensor<T> load_tensor(const std::string& file_name)
+{
+    const MappedTensor<T> mapped(file_name);
+
+    Tensor<T> tensor(mapped.GetDesc());
+
+    std::copy(mapped.data(), mapped.data() + mapped.GetElementSpaceSize(), tensor.data());
+
+    return tensor;
+}
+
+// writes the header, then the data in any number of chunks
+class TensorFileWriter
+{
+    public:
+    TensorFileWriter(const std::string& file_name, TensorFileInfo info, TensorFileFormat format);
+
+    // appends num_bytes of the data
+    void Write(const void* p_data, std::size_t num_bytes);
+
+    // throws unless all of the data is written
+    void Close();
+
+    std::size_t GetNumBytesLeft() const { return info_.GetDataSize() - num_bytes_written_; }
+
+    private:
+    std::string file_name_;
+    TensorFileInfo info_;
+    std::ofstream os_;
+    std::size_t num_bytes_written_;
+};
+
+// .npy if the file name ends with it, the CK format otherwise, .npy tensors are written packed in
+// C order
+template <typename T>
+void save_tensor(const std::string& file_name,
+                 const Tensor<T>& tensor,
+                 const std::string& layout = "",
+                 std::size_t chunk_size    = std::size_t{64} << 20)
+{
+    const bool is_npy = file_name.size() >= 4 && file_name.substr(file_name.size() - 4) == ".npy";
+
+    if(is_npy && tensor.GetStrides() != HostTensorDescriptor(tensor.GetLengths()).GetStrides())
+    {
+        Tensor<T> packed(tensor.GetLengths());
+
+        host_permute(tensor.mDesc,
+                     tensor.data(),
+                     packed.mDesc,
+                     packed.data(),
+                     ck::tensor_operation::element_wise::PassThrough{});
+
+        save_tensor(file_name, packed, layout, chunk_size);
+
+        return;
+    }
+
+    const TensorFileInfo info{tensor_file_data_type<T>::value, tensor.mDesc, layout, 0};
+
+    TensorFileWriter writer(
+        file_name, info, is_npy ? TensorFileFormat::Npy : TensorFileFormat::CK);
+
+    const char* p_data = reinterpret_cast<const char*>(tensor.data());
+
+    while(writer.GetNumBytesLeft() > 0)
+    {
+        const std::size_t num_bytes = std::min(chunk_size, writer.GetNumBytesLeft());
+
+        writer.Write(p_data, num_bytes);
+        p_data += num_bytes;
+    }
+
+    writer.Close();
+}
+
+} // namespace utils
+} // namespace ck
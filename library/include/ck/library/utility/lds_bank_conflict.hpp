@@ -0,0 +1,333 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <ostream>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+#include "ck/tensor_description/cluster_descriptor.hpp"
+
+namespace ck {
+namespace utils {
+
+// an LDS instruction moves at most 16 bytes per lane, longer vectors are split
+constexpr index_t max_lds_access_bytes = 16;
+
+// byte addresses of the lanes of a wave for one LDS instruction, every lane accesses
+// vector_bytes_ consecutive bytes. A negative address is a lane without an access.
+struct LdsWaveAccess
+{
+    index_t vector_bytes_;
+    std::vector<long_index_t> lane_addresses_;
+};
+
+// LDS instructions of every wave of a workgroup, [wave][instruction]
+using LdsAccessPattern = std::vector<std::vector<LdsWaveAccess>>;
+
+struct LdsBankConflicts
+{
+    // LDS instructions
+    index_t accesses_ = 0;
+    // cycles the banks take to serve the instructions
+    index_t cycles_ = 0;
+    // cycles in excess of one per phase, caused by bank conflicts
+    index_t conflict_cycles_ = 0;
+
+    LdsBankConflicts& operator+=(const LdsBankConflicts& rhs)
+    {
+        accesses_ += rhs.accesses_;
+        cycles_ += rhs.cycles_;
+        conflict_cycles_ += rhs.conflict_cycles_;
+
+        return *this;
+    }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const LdsBankConflicts& conflicts)
+{
+    os << "access " << conflicts.accesses_ << ", cycle " << conflicts.cycles_
+       << ", conflict cycle " << conflicts.conflict_cycles_;
+
+    return os;
+}
+
+// An instruction is served in phases of as many lanes as their words fill the banks once,
+// num_bank * bank_bytes / vector_bytes lanes. In a phase a bank serves one word per cycle, lanes
+// accessing the same word are served together.
+inline LdsBankConflicts
+get_lds_bank_conflicts(const LdsWaveAccess& access, index_t num_bank, index_t bank_bytes = 4)
+{
+    const index_t num_lane        = static_cast<index_t>(access.lane_addresses_.size());
+    const index_t words_per_lane  = std::max(access.vector_bytes_ / bank_bytes, 1);
+    const index_t lanes_per_phase = std::max(num_bank / words_per_lane, 1);
+
+    LdsBankConflicts conflicts;
+    conflicts.accesses_ = 1;
+
+    std::vector<std::vector<long_index_t>> bank_words(num_bank);
+
+    for(index_t phase_begin = 0; phase_begin < num_lane; phase_begin += lanes_per_phase)
+    {
+        for(auto& words : bank_words)
+            words.clear();
+
+        const index_t phase_end = std::min(phase_begin + lanes_per_phase, num_lane);
+
+        for(index_t lane = phase_begin; lane < phase_end; ++lane)
+        {
+            const long_index_t address = access.lane_addresses_[lane];
+
+            if(address < 0)
+                continue;
+
+            for(index_t w = 0; w < words_per_lane; ++w)
+            {
+                const long_index_t word = address / bank_bytes + w;
+
+                bank_words[word % num_bank].push_back(word);
+            }
+        }
+
+        // a phase without accesses takes no cycle
+        index_t phase_cycles = 0;
+
+        for(auto& words : bank_words)
+        {
+            std::sort(words.begin(), words.end());
+
+            const auto num_distinct_word =
+                std::distance(words.begin(), std::unique(words.begin(), words.end()));
+
+            phase_cycles = std::max(phase_cycles, static_cast<index_t>(num_distinct_word));
+        }
+
+        conflicts.cycles_ += phase_cycles;
+        conflicts.conflict_cycles_ += std::max(phase_cycles - 1, 0);
+    }
+
+    return conflicts;
+}
+
+// bank conflicts of every wave
+inline std::vector<LdsBankConflicts>
+get_lds_bank_conflicts(const LdsAccessPattern& pattern, index_t num_bank, index_t bank_bytes = 4)
+{
+    std::vector<LdsBankConflicts> wave_conflicts(pattern.size());
+
+    for(std::size_t wave = 0; wave < pattern.size(); ++wave)
+        for(const auto& access : pattern[wave])
+            wave_conflicts[wave] += get_lds_bank_conflicts(access, num_bank, bank_bytes);
+
+    return wave_conflicts;
+}
+
+namespace detail {
+
+inline index_t get_lds_access_bytes(index_t vector_bytes)
+{
+    return std::min(vector_bytes, max_lds_access_bytes);
+}
+
+// appends the instructions of num_vector vector accesses of vector_bytes
+inline void append_lds_accesses(std::vector<LdsWaveAccess>& wave_accesses,
+                                index_t num_vector,
+                                index_t vector_bytes,
+                                index_t wave_size)
+{
+    const index_t access_bytes = get_lds_access_bytes(vector_bytes);
+
+    for(index_t i = 0; i < num_vector * (vector_bytes / access_bytes); ++i)
+        wave_accesses.push_back(
+            LdsWaveAccess{access_bytes, std::vector<long_index_t>(wave_size, -1)});
+}
+
+// sets the address of a lane in the instructions of the i-th vector access
+inline void set_lane_address(std::vector<LdsWaveAccess>& wave_accesses,
+                             index_t i,
+                             index_t vector_bytes,
+                             index_t lane,
+                             long_index_t address)
+{
+    const index_t access_bytes = get_lds_access_bytes(vector_bytes);
+    const index_t num_access   = vector_bytes / access_bytes;
+
+    for(index_t j = 0; j < num_access; ++j)
+        wave_accesses[i * num_access + j].lane_addresses_[lane] = address + j * access_bytes;
+}
+
+// row-major index of the i-th access of a slice with lengths
+template <typename Index>
+Index get_access_index(index_t i, const Index& lengths)
+{
+    Index idx;
+
+    static_for<Index::Size() - 1, -1, -1>{}([&](auto d) {
+        idx(d) = i % lengths[d];
+        i /= lengths[d];
+    });
+
+    return idx;
+}
+
+} // namespace detail
+
+// LDS writes of ThreadGroupTensorSliceTransfer_v4r1 with the same template arguments: a thread
+// writes vectors of DstScalarPerVector along DstVectorDim of its slice of the block slice, the
+// thread slices are assigned by the cluster descriptor of ThreadClusterArrangeOrder
+template <typename DstData,
+          typename BlockSliceLengths,
+          typename ThreadClusterLengths,
+          typename ThreadClusterArrangeOrder,
+          index_t DstVectorDim,
+          index_t DstScalarPerVector,
+          typename DstDesc>
+LdsAccessPattern get_thread_group_slice_transfer_write_pattern(const DstDesc& dst_desc,
+                                                               index_t block_size,
+                                                               index_t wave_size = 64)
+{
+    constexpr index_t nDim = DstDesc::GetNumOfDimension();
+
+    constexpr auto thread_slice_lengths = BlockSliceLengths{} / ThreadClusterLengths{};
+
+    constexpr auto thread_cluster_desc =
+        make_cluster_descriptor(ThreadClusterLengths{}, ThreadClusterArrangeOrder{});
+
+    static_assert(thread_slice_lengths[Number<DstVectorDim>{}] % DstScalarPerVector == 0,
+                  "wrong! cannot evenly divide");
+
+    MultiIndex<nDim> scalar_per_access;
+    MultiIndex<nDim> access_lengths;
+
+    index_t num_access = 1;
+
+    static_for<0, nDim, 1>{}([&](auto i) {
+        scalar_per_access(i) = i == DstVectorDim ? DstScalarPerVector : 1;
+        access_lengths(i)    = thread_slice_lengths[i] / scalar_per_access[i];
+        num_access *= access_lengths[i];
+    });
+
+    const index_t num_thread =
+        std::min(block_size, static_cast<index_t>(thread_cluster_desc.GetElementSize()));
+
+    constexpr index_t vector_bytes = DstScalarPerVector * sizeof(DstData);
+
+    LdsAccessPattern pattern((block_size + wave_size - 1) / wave_size);
+
+    for(auto& wave_accesses : pattern)
+        detail::append_lds_accesses(wave_accesses, num_access, vector_bytes, wave_size);
+
+    for(index_t thread = 0; thread < num_thread; ++thread)
+    {
+        const auto thread_cluster_idx =
+            thread_cluster_desc.CalculateBottomIndex(make_multi_index(thread));
+
+        const auto thread_data_idx_begin = thread_cluster_idx * thread_slice_lengths;
+
+        for(index_t i = 0; i < num_access; ++i)
+        {
+            const auto access_idx = detail::get_access_index(i, access_lengths);
+
+            MultiIndex<nDim> data_idx;
+
+            static_for<0, nDim, 1>{}([&](auto d) {
+                data_idx(d) = thread_data_idx_begin[d] + access_idx[d] * scalar_per_access[d];
+            });
+
+            detail::set_lane_address(pattern[thread / wave_size],
+                                     i,
+                                     vector_bytes,
+                                     thread % wave_size,
+                                     dst_desc.CalculateOffset(data_idx) * sizeof(DstData));
+        }
+    }
+
+    return pattern;
+}
+
+namespace detail {
+
+// reads of BlockwiseGemmXdlops from the M0_M1_M2_K (N0_N1_N2_K) descriptor: for every M0, a
+// lane reads KPerThread values of K in vectors of K1 from its origin. The wave index of the M1
+// dimension is wave / waves_per_wave_id % M1.
+template <typename Data, typename XdlopsGemm, index_t KPerThread, index_t K1, typename Desc>
+LdsAccessPattern get_blockwise_gemm_xdlops_read_pattern(const Desc& desc,
+                                                        index_t num_wave,
+                                                        index_t waves_per_wave_id)
+{
+    constexpr auto mfma_instr = XdlopsGemm::mfma_instr;
+
+    constexpr index_t wave_size    = mfma_instr.wave_size;
+    constexpr index_t num_repeat   = Desc{}.GetLength(Number<0>{});
+    constexpr index_t num_wave_id  = Desc{}.GetLength(Number<1>{});
+    constexpr index_t num_vector   = num_repeat * (KPerThread / K1);
+    constexpr index_t vector_bytes = K1 * sizeof(Data);
+
+    LdsAccessPattern pattern(num_wave);
+
+    for(auto& wave_accesses : pattern)
+        append_lds_accesses(wave_accesses, num_vector, vector_bytes, wave_size);
+
+    for(index_t wave = 0; wave < num_wave; ++wave)
+    {
+        const index_t wave_id = wave / waves_per_wave_id % num_wave_id;
+
+        for(index_t lane = 0; lane < wave_size; ++lane)
+        {
+            const index_t blk_id =
+                (lane / mfma_instr.num_threads_per_blk) % mfma_instr.num_input_blks;
+            const index_t blk_td = lane % mfma_instr.num_threads_per_blk;
+
+            // XdlopsGemm::CalculateAThreadOriginDataIndex()
+            const index_t origin_k  = mfma_instr.is_k_reduction ? KPerThread * blk_id : 0;
+            const index_t origin_mn = mfma_instr.is_k_reduction ? blk_td : lane;
+
+            for(index_t i = 0; i < num_vector; ++i)
+            {
+                const index_t repeat = i / (KPerThread / K1);
+                const index_t k      = i % (KPerThread / K1) * K1;
+
+                const auto offset = desc.CalculateOffset(
+                    make_multi_index(repeat, wave_id, origin_mn, origin_k + k));
+
+                set_lane_address(pattern[wave], i, vector_bytes, lane, offset * sizeof(Data));
+            }
+        }
+    }
+
+    return pattern;
+}
+
+} // namespace detail
+
+// LDS reads of A by one Run() of BlockwiseGemmXdlops_k0mk1_k0nk1_m0n0m1n1m2m3m4n2_v1
+template <typename FloatA, typename BlockwiseGemm>
+LdsAccessPattern get_blockwise_gemm_xdlops_a_read_pattern()
+{
+    using Gemm       = BlockwiseGemm;
+    using XdlopsGemm = remove_cvref_t<decltype(Gemm::xdlops_gemm)>;
+
+    return detail::
+        get_blockwise_gemm_xdlops_read_pattern<FloatA, XdlopsGemm, Gemm::KPerThread, Gemm::A_K1>(
+            Gemm::a_block_desc_m0_m1_m2_k, Gemm::MWaves * Gemm::NWaves, Gemm::NWaves);
+}
+
+// LDS reads of B by BlockwiseGemmXdlops_k0mk1_k0nk1_m0n0m1n1m2m3m4n2_v1, one read of every n0.
+// Run() reads them once per m0.
+template <typename FloatB, typename BlockwiseGemm>
+LdsAccessPattern get_blockwise_gemm_xdlops_b_read_pattern()
+{
+    using Gemm       = BlockwiseGemm;
+    using XdlopsGemm = remove_cvref_t<decltype(Gemm::xdlops_gemm)>;
+
+    return detail::
+        get_blockwise_gemm_xdlops_read_pattern<FloatB, XdlopsGemm, Gemm::KPerThread, Gemm::B_K1>(
+            Gemm::b_block_desc_n0_n1_n2_k, Gemm::MWaves * Gemm::NWaves, 1);
+}
+
+} // namespace utils
+} // namespace ck
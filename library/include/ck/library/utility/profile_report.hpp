@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+
+namespace ck {
+namespace utils {
+
+// time of the best instance on a problem
+struct ProfileRecord
+{
+    std::string family_;  // e.g. "gemm", "conv_fwd", "layernorm" or "softmax"
+    std::string problem_; // identifies the problem across runs, e.g. "f16 MK_KN_MN 256 1024 512"
+    std::size_t count_;   // times a model runs the problem
+    float ave_time_;      // ms
+    std::size_t flop_;
+};
+
+// results of a profiler run, one record per family and problem
+class ProfileResults
+{
+    public:
+    // merged with the record of the same family and problem, the counts add up and the lower
+    // time is kept
+    void Add(const ProfileRecord& record);
+
+    const std::vector<ProfileRecord>& GetRecords() const { return records_; }
+
+    // nullptr if there is none
+    const ProfileRecord* Find(const std::string& family, const std::string& problem) const;
+
+    // adds the records of lines "<family>\t<problem>\t<count>\t<ave_time>\t<flop>", '#' starts a
+    // comment line, returns the number of records read
+    std::size_t Load(std::istream& is);
+
+    // in the format read by Load
+    void Save(std::ostream& os) const;
+
+    private:
+    std::vector<ProfileRecord> records_;
+};
+
+// appends a record to a results file, so that any number of profiler invocations make up a run.
+// A problem recorded twice counts twice, so a run repeated into the same file doubles its weight.
+void append_profile_record(const std::string& file_name, const ProfileRecord& record);
+
+struct ProfileFamilyReport
+{
+    std::string family_;
+    std::size_t num_problems_;
+    std::size_t count_;
+
+    // weighted by the counts
+    double time_;
+    std::size_t flop_;
+
+    // of the time of the model
+    double share_;
+};
+
+// time of a model: the sum over its problems of the best time times the count
+struct ProfileReport
+{
+    double time_;
+    std::size_t flop_;
+
+    // most time first
+    std::vector<ProfileFamilyReport> families_;
+};
+
+ProfileReport make_profile_report(const ProfileResults& results);
+
+struct ProfileDiffRecord
+{
+    std::string family_;
+    std::string problem_;
+    std::size_t count_;
+    float base_ave_time_;
+    float ave_time_;
+};
+
+// comparison of a run with a base run over the problems of both
+struct ProfileDiff
+{
+    double threshold_;
+
+    // weighted by the counts of the run
+    double base_time_;
+    double time_;
+
+    // slower or faster by more than the threshold, largest change of weighted time first
+    std::vector<ProfileDiffRecord> regressions_;
+    std::vector<ProfileDiffRecord> improvements_;
+
+    std::vector<ProfileRecord> missing_; // in the base run only
+    std::vector<ProfileRecord> added_;   // in the run only
+
+    // a problem or the model is slower by more than the threshold
+    bool HasRegression() const;
+};
+
+// threshold is relative, e.g. 0.05 for 5%
+ProfileDiff
+diff_profile_results(const ProfileResults& base, const ProfileResults& results, double threshold);
+
+} // namespace utils
+} // namespace ck
+
+std::ostream& operator<<(std::ostream& os, const ck::utils::ProfileReport& report);
+
+std::ostream& operator<<(std::ostream& os, const ck::utils::ProfileDiff& diff);
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/split_k_selector.hpp"
+
+namespace ck {
+namespace utils {
+
+using ck::tensor_operation::device::SplitKCostModel;
+using ck::tensor_operation::device::SplitKProblem;
+using ck::tensor_operation::device::SplitKTile;
+
+// time of an instance, named by its GetTypeString(), on an M x N x K problem split k_batch_ times
+struct SplitKSweepRecord
+{
+    ck::index_t M_;
+    ck::index_t N_;
+    ck::index_t K_;
+    std::string op_name_;
+    ck::index_t k_batch_;
+    float ave_time_;
+};
+
+// split-K sweeps recorded by ckProfiler
+class SplitKTuningDb
+{
+    public:
+    // adds the sweeps of a gemm_splitk log, the "Perf:" lines of a problem precede its
+    // "Best Perf" line, returns the number of records added
+    std::size_t Load(std::istream& is);
+
+    void Add(const SplitKSweepRecord& record) { records_.push_back(record); }
+
+    const std::vector<SplitKSweepRecord>& GetRecords() const { return records_; }
+
+    // the fastest recorded k_batch of the instance on the problem, 0 if there is none
+    ck::index_t
+    FindBestKBatch(ck::index_t M, ck::index_t N, ck::index_t K, const std::string& op_name) const;
+
+    private:
+    std::vector<SplitKSweepRecord> records_;
+};
+
+// the tile and K padding of a DeviceGemmXdlSplitKCShuffle GetTypeString(), false if there is none
+bool get_split_k_tile(const std::string& op_name, SplitKTile& tile);
+
+// the k_batch of the cost model, refined by the fastest recorded one of the instance on the
+// problem if there is one
+ck::index_t select_k_batch(const SplitKTuningDb& db,
+                           const std::string& op_name,
+                           const SplitKProblem& problem,
+                           const SplitKTile& tile,
+                           const SplitKCostModel& model);
+
+struct SplitKModelReport
+{
+    std::size_t num_sweeps_;
+    std::size_t num_best_; // sweeps where the model picks the fastest k_batch
+
+    // time of the k_batch picked by the model over the fastest time
+    float mean_slowdown_;
+    float max_slowdown_;
+};
+
+// picks, for every recorded sweep of an instance with a known tile, the k_batch of the lowest
+// modeled cost among the recorded ones and compares its time with the fastest
+SplitKModelReport evaluate_split_k_model(const SplitKTuningDb& db, const SplitKCostModel& model);
+
+} // namespace utils
+} // namespace ck
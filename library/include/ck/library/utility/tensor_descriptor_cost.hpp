@@ -0,0 +1,442 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <ostream>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+#include "ck/utility/is_static_value.hpp"
+
+namespace ck {
+namespace utils {
+
+// integer operations done by the index math of a tensor descriptor. Multiplications by a Number<1>
+// are not counted, divisions and modulos are the ones with a runtime divisor.
+struct IndexMathCost
+{
+    index_t transforms_      = 0;
+    index_t adds_            = 0;
+    index_t multiplies_      = 0;
+    index_t magic_divisions_ = 0;
+    index_t divisions_       = 0;
+    index_t modulos_         = 0;
+    index_t branches_        = 0;
+
+    IndexMathCost& operator+=(const IndexMathCost& rhs)
+    {
+        transforms_ += rhs.transforms_;
+        adds_ += rhs.adds_;
+        multiplies_ += rhs.multiplies_;
+        magic_divisions_ += rhs.magic_divisions_;
+        divisions_ += rhs.divisions_;
+        modulos_ += rhs.modulos_;
+        branches_ += rhs.branches_;
+
+        return *this;
+    }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const IndexMathCost& cost)
+{
+    os << "transform " << cost.transforms_ << ", add " << cost.adds_ << ", mul "
+       << cost.multiplies_ << ", magic div " << cost.magic_divisions_ << ", div "
+       << cost.divisions_ << ", mod " << cost.modulos_ << ", branch " << cost.branches_;
+
+    return os;
+}
+
+// cost of a transform for lowering a whole index (CalculateLowerIndex), for lowering an index
+// step (UpdateLowerIndex) and for checking the validity of the upper index
+struct TransformCost
+{
+    IndexMathCost calculate_;
+    IndexMathCost update_;
+    IndexMathCost check_;
+};
+
+namespace detail {
+
+inline IndexMathCost make_index_math_cost(index_t adds,
+                                          index_t multiplies,
+                                          index_t magic_divisions = 0,
+                                          index_t divisions       = 0,
+                                          index_t modulos         = 0,
+                                          index_t branches        = 0)
+{
+    return IndexMathCost{1, adds, multiplies, magic_divisions, divisions, modulos, branches};
+}
+
+inline IndexMathCost make_check_cost(index_t branches)
+{
+    return IndexMathCost{0, 0, 0, 0, 0, 0, branches};
+}
+
+template <typename Coefficients>
+index_t get_num_of_non_unit_coefficients(const Coefficients&)
+{
+    index_t n = 0;
+
+    static_for<0, Coefficients::Size(), 1>{}([&](auto i) {
+        using Coefficient = remove_cvref_t<decltype(Coefficients{}[i])>;
+
+        n += ck::is_static_value<Coefficient, 1>::value ? 0 : 1;
+    });
+
+    return n;
+}
+
+template <index_t NDimLow>
+TransformCost get_merge_cost(index_t magic_divisions, index_t divisions, index_t modulos)
+{
+    // one division, and a multiply-subtract or a modulo, per lower dimension but the first. The
+    // update does the same on the new upper index.
+    const index_t multiply_subtracts = modulos > 0 ? 0 : NDimLow - 1;
+
+    const auto cost = make_index_math_cost(
+        multiply_subtracts, multiply_subtracts, magic_divisions, divisions, modulos);
+
+    return TransformCost{cost, cost, IndexMathCost{}};
+}
+
+} // namespace detail
+
+// transforms without a cost of their own, e.g. added after this file: a division, a modulo and a
+// multiply-add per lower dimension, so that a descriptor using them is not taken as cheaper
+template <typename Tran>
+TransformCost get_transform_cost(const Tran&)
+{
+    constexpr index_t NDimLow = Tran::GetNumOfLowerDimension();
+
+    const auto cost = detail::make_index_math_cost(NDimLow, NDimLow, 0, NDimLow, NDimLow);
+
+    return TransformCost{
+        cost,
+        cost,
+        detail::make_check_cost(Tran::IsValidUpperIndexAlwaysMappedToValidLowerIndex() ? 0 : 1)};
+}
+
+template <typename LowerIndex>
+TransformCost get_transform_cost(const Freeze<LowerIndex>&)
+{
+    return TransformCost{detail::make_index_math_cost(0, 0), IndexMathCost{}, IndexMathCost{}};
+}
+
+template <typename UpperLength>
+TransformCost get_transform_cost(const Insert<UpperLength>&)
+{
+    return TransformCost{detail::make_index_math_cost(0, 0), IndexMathCost{}, IndexMathCost{}};
+}
+
+template <typename LowLength>
+TransformCost get_transform_cost(const PassThrough<LowLength>&)
+{
+    return TransformCost{
+        detail::make_index_math_cost(0, 0), detail::make_index_math_cost(1, 0), IndexMathCost{}};
+}
+
+template <typename LowLength, typename LeftPadLength, typename RightPadLength, bool SkipCheck>
+TransformCost get_transform_cost(const Pad<LowLength, LeftPadLength, RightPadLength, SkipCheck>&)
+{
+    return TransformCost{detail::make_index_math_cost(1, 0),
+                         detail::make_index_math_cost(1, 0),
+                         detail::make_check_cost(SkipCheck ? 0 : 2)};
+}
+
+template <typename LowLength, typename LeftPadLength, bool SkipCheck>
+TransformCost get_transform_cost(const LeftPad<LowLength, LeftPadLength, SkipCheck>&)
+{
+    return TransformCost{detail::make_index_math_cost(1, 0),
+                         detail::make_index_math_cost(1, 0),
+                         detail::make_check_cost(SkipCheck ? 0 : 1)};
+}
+
+template <typename LowLength, typename RightPadLength, bool SkipCheck>
+TransformCost get_transform_cost(const RightPad<LowLength, RightPadLength, SkipCheck>&)
+{
+    return TransformCost{detail::make_index_math_cost(0, 0),
+                         detail::make_index_math_cost(1, 0),
+                         detail::make_check_cost(SkipCheck ? 0 : 1)};
+}
+
+template <typename UpLengths, typename Coefficients>
+TransformCost get_transform_cost(const Embed<UpLengths, Coefficients>& tran)
+{
+    constexpr index_t NDimUp = UpLengths::Size();
+
+    const index_t multiplies = detail::get_num_of_non_unit_coefficients(tran.coefficients_);
+
+    return TransformCost{detail::make_index_math_cost(NDimUp - 1, multiplies),
+                         detail::make_index_math_cost(NDimUp, multiplies),
+                         IndexMathCost{}};
+}
+
+template <typename UpLengths, bool Use24BitIntegerCalculation>
+TransformCost get_transform_cost(const UnMerge<UpLengths, Use24BitIntegerCalculation>& tran)
+{
+    constexpr index_t NDimUp = UpLengths::Size();
+
+    const index_t multiplies = detail::get_num_of_non_unit_coefficients(tran.up_lengths_scan_);
+
+    return TransformCost{detail::make_index_math_cost(NDimUp - 1, multiplies),
+                         detail::make_index_math_cost(NDimUp, multiplies),
+                         IndexMathCost{}};
+}
+
+template <typename LowLengths>
+TransformCost get_transform_cost(const Merge_v1_carry_check<LowLengths>&)
+{
+    constexpr index_t NDimLow = LowLengths::Size();
+
+    // the step is divided once into a constant lower step, then every lower dimension but the
+    // first one checks for a carry and a borrow
+    return TransformCost{
+        detail::make_index_math_cost(NDimLow - 1, NDimLow - 1, 0, NDimLow - 1),
+        detail::make_index_math_cost(
+            3 * NDimLow, NDimLow - 1, 0, NDimLow - 1, 0, 2 * (NDimLow - 1)),
+        IndexMathCost{}};
+}
+
+template <typename LowLengths>
+TransformCost get_transform_cost(const Merge_v2_magic_division<LowLengths>&)
+{
+    constexpr index_t NDimLow = LowLengths::Size();
+
+    return detail::get_merge_cost<NDimLow>(NDimLow - 1, 0, 0);
+}
+
+template <typename LowLengths>
+TransformCost get_transform_cost(const Merge_v2r2_magic_division<LowLengths>&)
+{
+    constexpr index_t NDimLow = LowLengths::Size();
+
+    return detail::get_merge_cost<NDimLow>(NDimLow - 1, 0, 0);
+}
+
+template <typename LowLengths>
+TransformCost get_transform_cost(const Merge_v3_division_mod<LowLengths>&)
+{
+    constexpr index_t NDimLow = LowLengths::Size();
+
+    return detail::get_merge_cost<NDimLow>(0, NDimLow - 1, NDimLow - 1);
+}
+
+template <typename VectorSize, typename UpLength>
+TransformCost get_transform_cost(const Vectorize<VectorSize, UpLength>&)
+{
+    return TransformCost{
+        detail::make_index_math_cost(0, 1), detail::make_index_math_cost(1, 1), IndexMathCost{}};
+}
+
+template <typename LowLength, typename SliceBegin, typename SliceEnd>
+TransformCost get_transform_cost(const Slice<LowLength, SliceBegin, SliceEnd>&)
+{
+    return TransformCost{detail::make_index_math_cost(1, 0),
+                         detail::make_index_math_cost(1, 0),
+                         detail::make_check_cost(2)};
+}
+
+template <typename Modulus, typename UpLength>
+TransformCost get_transform_cost(const Modulo<Modulus, UpLength>&)
+{
+    return TransformCost{detail::make_index_math_cost(0, 0, 0, 0, 1),
+                         detail::make_index_math_cost(2, 0, 0, 0, 1),
+                         IndexMathCost{}};
+}
+
+template <typename LowLengths, typename Multiplier>
+TransformCost get_transform_cost(const Xor<LowLengths, Multiplier>&)
+{
+    using ColumnLength = remove_cvref_t<decltype(LowLengths{}[Number<1>{}])>;
+
+    // the XOR is counted as an add, and so is the modulo by a compile-time power of 2
+    const index_t multiplies = ck::is_static_value<Multiplier, 1>::value ? 0 : 1;
+    const index_t modulos    = is_known_at_compile_time<ColumnLength>::value ? 0 : 1;
+
+    // the update computes the lower index again and subtracts the old one
+    return TransformCost{
+        detail::make_index_math_cost(2 - modulos, multiplies, 0, 0, modulos),
+        detail::make_index_math_cost(4 - modulos, multiplies, 0, 0, modulos),
+        IndexMathCost{}};
+}
+
+struct TensorDescriptorCost
+{
+    // CalculateOffset() or make_tensor_coordinate()
+    IndexMathCost offset_;
+    // coordinate_has_valid_offset_assuming_visible_index_is_valid()
+    IndexMathCost check_;
+    // move_tensor_coordinate() along each visible dimension
+    std::vector<IndexMathCost> steps_;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const TensorDescriptorCost& cost)
+{
+    os << "offset: " << cost.offset_ << std::endl;
+    os << "validity check: branch " << cost.check_.branches_ << std::endl;
+
+    for(std::size_t i = 0; i < cost.steps_.size(); ++i)
+        os << "step of dim " << i << ": " << cost.steps_[i] << std::endl;
+
+    return os;
+}
+
+// walks the transforms of desc, a step only goes through the transforms that
+// make_tensor_coordinate_step() selects for a non-zero difference of that dimension
+template <typename Desc>
+TensorDescriptorCost get_tensor_descriptor_cost(const Desc& desc)
+{
+    constexpr index_t NTransform = Desc::GetNumOfTransform();
+    constexpr index_t NDim       = Desc::GetNumOfDimension();
+
+    TensorDescriptorCost cost;
+
+    static_for<0, NTransform, 1>{}([&](auto itran) {
+        const auto tran_cost = get_transform_cost(desc.GetTransforms()[itran]);
+
+        cost.offset_ += tran_cost.calculate_;
+        cost.check_ += tran_cost.check_;
+    });
+
+    static_for<0, NDim, 1>{}([&](auto idim) {
+        auto idx_diff = make_zero_multi_index<NDim>();
+        idx_diff(idim) = 1;
+
+        const auto step = make_tensor_coordinate_step(desc, idx_diff);
+
+        IndexMathCost step_cost;
+
+        static_for<0, NTransform, 1>{}([&](auto itran) {
+            if(step.do_transforms_[itran])
+                step_cost += get_transform_cost(desc.GetTransforms()[itran]).update_;
+        });
+
+        cost.steps_.push_back(step_cost);
+    });
+
+    return cost;
+}
+
+// host time of CalculateOffset() and move_tensor_coordinate() in ns per index, over the first
+// max_num_index indices of the visible index space in row-major order
+struct TensorDescriptorTime
+{
+    double calculate_offset_ns_;
+    double move_coordinate_ns_;
+};
+
+template <typename Desc>
+TensorDescriptorTime
+time_tensor_descriptor(const Desc& desc, long_index_t max_num_index, index_t nrepeat = 5)
+{
+    using clock = std::chrono::steady_clock;
+
+    constexpr index_t NDim = Desc::GetNumOfDimension();
+
+    MultiIndex<NDim> lengths;
+
+    long_index_t num_index = 1;
+
+    static_for<0, NDim, 1>{}([&](auto i) {
+        lengths(i) = desc.GetLength(i);
+        num_index *= lengths[i];
+    });
+
+    num_index = std::min(num_index, max_num_index);
+
+    // carry_steps[d] moves to the next index when dimensions d + 1, ... wrap around
+    std::vector<decltype(make_tensor_coordinate_step(desc, make_zero_multi_index<NDim>()))>
+        carry_steps;
+
+    static_for<0, NDim, 1>{}([&](auto d) {
+        auto idx_diff = make_zero_multi_index<NDim>();
+
+        idx_diff(d) = 1;
+
+        static_for<d.value + 1, NDim, 1>{}([&](auto j) { idx_diff(j) = 1 - lengths[j]; });
+
+        carry_steps.push_back(make_tensor_coordinate_step(desc, idx_diff));
+    });
+
+    // row-major increment of idx, returns the dimension that is incremented
+    auto next_index = [&](auto& idx) {
+        index_t d_incremented = 0;
+        bool carry            = true;
+
+        static_for<NDim - 1, -1, -1>{}([&](auto d) {
+            if(carry)
+            {
+                if(d > 0 && idx[d] + 1 == lengths[d])
+                {
+                    idx(d) = 0;
+                }
+                else
+                {
+                    idx(d)++;
+                    d_incremented = d;
+                    carry         = false;
+                }
+            }
+        });
+
+        return d_incremented;
+    };
+
+    // the sums keep the offsets alive
+    long_index_t sum_calculate = 0;
+    long_index_t sum_move      = 0;
+
+    double calculate_ns = 0;
+    double move_ns      = 0;
+
+    for(index_t r = 0; r < nrepeat; ++r)
+    {
+        auto idx = make_zero_multi_index<NDim>();
+
+        const auto t0 = clock::now();
+
+        for(long_index_t i = 0; i < num_index; ++i)
+        {
+            sum_calculate += desc.CalculateOffset(idx);
+
+            next_index(idx);
+        }
+
+        const auto t1 = clock::now();
+
+        auto coord = make_tensor_coordinate(desc, make_zero_multi_index<NDim>());
+
+        idx = make_zero_multi_index<NDim>();
+
+        const auto t2 = clock::now();
+
+        for(long_index_t i = 0; i < num_index; ++i)
+        {
+            sum_move += coord.GetOffset();
+
+            move_tensor_coordinate(desc, coord, carry_steps[next_index(idx)]);
+        }
+
+        const auto t3 = clock::now();
+
+        calculate_ns += std::chrono::duration<double, std::nano>(t1 - t0).count();
+        move_ns += std::chrono::duration<double, std::nano>(t3 - t2).count();
+    }
+
+    if(sum_calculate != sum_move)
+        std::cerr << "warning: CalculateOffset() and move_tensor_coordinate() disagree"
+                  << std::endl;
+
+    const double n = static_cast<double>(num_index) * nrepeat;
+
+    return TensorDescriptorTime{calculate_ns / n, move_ns / n};
+}
+
+} // namespace utils
+} // namespace ck
@@ -9,7 +9,7 @@ namespace device {
 namespace instance {
 
 // Compilation parameters for a[k, m] * b[k, n] = c[m, n]
-using Instances =
+using km_kn_mn_default_pipeline_v1_instances =
     std::tuple<
         // clang-format off
         // pipeline v1, 1 wave
@@ -31,7 +31,7 @@ using Instances =
 void add_device_gemm_xdl_f16_f16_f16_km_kn_mn_default_pipeline_v1_instances(
     OwnerList<InstanceNT>& instances)
 {
-    add_device_operation_instances(instances, Instances{});
+    add_device_operation_instances(instances, km_kn_mn_default_pipeline_v1_instances{});
 }
 
 } // namespace instance
@@ -9,7 +9,7 @@ namespace device {
 namespace instance {
 
 // Compilation parameters for a[k, m] * b[k, n] = c[m, n]
-using Instances =
+using km_kn_mn_default_pipeline_v2_instances =
     std::tuple<
 // clang-format off
 #if CK_EXPERIMENTAL_PIPELINE_V2_INSTANCES        
@@ -33,7 +33,7 @@ using Instances =
 void add_device_gemm_xdl_f16_f16_f16_km_kn_mn_default_pipeline_v2_instances(
     OwnerList<InstanceNT>& instances)
 {
-    add_device_operation_instances(instances, Instances{});
+    add_device_operation_instances(instances, km_kn_mn_default_pipeline_v2_instances{});
 }
 
 } // namespace instance
@@ -9,7 +9,7 @@ namespace device {
 namespace instance {
 
 // irregular tile size
-using Instances = std::tuple<
+using km_kn_mn_irregular_interwave_pipeline_v1_instances = std::tuple<
 // clang-format off
 #if CK_EXPERIMENTAL_INTER_WAVE_INSTANCES        
         // pipeline v1, 2 waves
@@ -25,7 +25,7 @@ using Instances = std::tuple<
 void add_device_gemm_xdl_f16_f16_f16_km_kn_mn_irregular_interwave_pipeline_v1_instances(
     OwnerList<InstanceNT>& instances)
 {
-    add_device_operation_instances(instances, Instances{});
+    add_device_operation_instances(instances, km_kn_mn_irregular_interwave_pipeline_v1_instances{});
 }
 
 } // namespace instance
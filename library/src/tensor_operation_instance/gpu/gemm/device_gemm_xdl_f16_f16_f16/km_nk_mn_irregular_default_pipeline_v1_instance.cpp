@@ -9,7 +9,7 @@ namespace device {
 namespace instance {
 
 // irregular tile size
-using Instances = std::tuple<
+using km_nk_mn_irregular_default_pipeline_v1_instances = std::tuple<
     // clang-format off
         // pipeline v1, 1 wave
         //###########| AData| BData| CData| AccData| ALayout| BLayout| CLayout|           A|           B|           C|          GEMM| Block|  MPer|  NPer| K0Per| K1| MPer| NPer| MXdl| NXdl|  ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockLds|  BBlockTransfer| BBlockTransfer| BBlockTransfer| BlockTransfer| BBlockTransfer| BBlockTransfer| BBlockLds| CThreadTransfer| CThreadTransfer| NumPrefetch|          LoopScheduler|                     Pipeline|
@@ -23,7 +23,7 @@ using Instances = std::tuple<
 void add_device_gemm_xdl_f16_f16_f16_km_nk_mn_irregular_default_pipeline_v1_instances(
     OwnerList<InstanceNN>& instances)
 {
-    add_device_operation_instances(instances, Instances{});
+    add_device_operation_instances(instances, km_nk_mn_irregular_default_pipeline_v1_instances{});
 }
 
 } // namespace instance
@@ -9,7 +9,7 @@ namespace device {
 namespace instance {
 
 // Compilation parameters for a[m, k] * b[k, n] = c[m, n]
-using Instances =
+using mk_kn_mn_default_pipeline_v1_instances =
     std::tuple<
         // clang-format off
         // pipeline v1, 1 wave
@@ -40,7 +40,7 @@ using Instances =
 void add_device_gemm_xdl_f16_f16_f16_mk_kn_mn_default_pipeline_v1_instances(
     OwnerList<InstanceTT>& instances)
 {
-    add_device_operation_instances(instances, Instances{});
+    add_device_operation_instances(instances, mk_kn_mn_default_pipeline_v1_instances{});
 }
 
 } // namespace instance
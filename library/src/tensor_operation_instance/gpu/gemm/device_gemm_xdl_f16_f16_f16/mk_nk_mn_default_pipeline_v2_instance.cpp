@@ -9,7 +9,7 @@ namespace device {
 namespace instance {
 
 // Compilation parameters for a[m, k] * b[n, k] = c[m, n]
-using Instances = std::tuple<
+using mk_nk_mn_default_pipeline_v2_instances = std::tuple<
 // clang-format off
 #if CK_EXPERIMENTAL_PIPELINE_V2_INSTANCES        
         // pipeline v2, 1 wave
@@ -37,7 +37,7 @@ using Instances = std::tuple<
 void add_device_gemm_xdl_f16_f16_f16_mk_nk_mn_default_pipeline_v2_instances(
     OwnerList<InstanceTN>& instances)
 {
-    add_device_operation_instances(instances, Instances{});
+    add_device_operation_instances(instances, mk_nk_mn_default_pipeline_v2_instances{});
 }
 
 } // namespace instance
@@ -0,0 +1,369 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <sstream>
+#include <stdexcept>
+
+#include "ck/library/utility/conv_shape_db.hpp"
+
+namespace ck {
+namespace utils {
+namespace conv {
+
+std::string get_conv_direction_string(ConvDirection direction)
+{
+    switch(direction)
+    {
+    case ConvDirection::Forward: return "fwd";
+    case ConvDirection::BackwardData: return "bwd_data";
+    case ConvDirection::BackwardWeight: return "bwd_weight";
+    default: return "unknown";
+    }
+}
+
+bool is_same_conv_param(const ConvParam& a, const ConvParam& b)
+{
+    return a.num_dim_spatial_ == b.num_dim_spatial_ && a.G_ == b.G_ && a.N_ == b.N_ &&
+           a.K_ == b.K_ && a.C_ == b.C_ && a.filter_spatial_lengths_ == b.filter_spatial_lengths_ &&
+           a.input_spatial_lengths_ == b.input_spatial_lengths_ &&
+           a.conv_filter_strides_ == b.conv_filter_strides_ &&
+           a.conv_filter_dilations_ == b.conv_filter_dilations_ &&
+           a.input_left_pads_ == b.input_left_pads_ && a.input_right_pads_ == b.input_right_pads_;
+}
+
+std::string get_conv_param_string(const ConvParam& param)
+{
+    std::ostringstream ss;
+
+    ss << param.num_dim_spatial_ << " " << param.G_ << " " << param.N_ << " " << param.K_ << " "
+       << param.C_;
+
+    for(const auto* lengths : {&param.filter_spatial_lengths_,
+                               &param.input_spatial_lengths_,
+                               &param.conv_filter_strides_,
+                               &param.conv_filter_dilations_,
+                               &param.input_left_pads_,
+                               &param.input_right_pads_})
+    {
+        for(const ck::index_t length : *lengths)
+            ss << " " << length;
+    }
+
+    return ss.str();
+}
+
+void ConvShapeDb::Add(const ConvParam& param, ConvDirection direction, std::size_t count)
+{
+    for(auto& shape : shapes_)
+    {
+        if(shape.direction_ == direction && is_same_conv_param(shape.param_, param))
+        {
+            shape.count_ += count;
+            return;
+        }
+    }
+
+    shapes_.push_back({param, direction, count});
+}
+
+void ConvShapeDb::Add(const ConvShapeDb& other)
+{
+    for(const auto& shape : other.GetShapes())
+        Add(shape.param_, shape.direction_, shape.count_);
+}
+
+void ConvShapeDb::AddBackward()
+{
+    const auto shapes = shapes_;
+
+    for(const auto& shape : shapes)
+    {
+        if(shape.direction_ == ConvDirection::Forward)
+        {
+            Add(shape.param_, ConvDirection::BackwardData, shape.count_);
+            Add(shape.param_, ConvDirection::BackwardWeight, shape.count_);
+        }
+    }
+}
+
+std::size_t ConvShapeDb::GetNumLayers() const
+{
+    std::size_t num_layers = 0;
+
+    for(const auto& shape : shapes_)
+        num_layers += shape.count_;
+
+    return num_layers;
+}
+
+std::size_t ConvShapeDb::GetFlops() const
+{
+    std::size_t flops = 0;
+
+    for(const auto& shape : shapes_)
+        flops += shape.count_ * shape.param_.GetFlops();
+
+    return flops;
+}
+
+std::size_t ConvShapeDb::Load(std::istream& is)
+{
+    std::size_t num_shapes = 0;
+    std::string line;
+
+    while(std::getline(is, line))
+    {
+        std::istringstream line_is(line.substr(0, line.find('#')));
+
+        std::vector<std::string> args;
+
+        for(std::string arg; line_is >> arg;)
+            args.push_back(arg);
+
+        if(args.empty())
+            continue;
+
+        // direction, count, num_dim_spatial, G/N/K/C and 6 * num_dim_spatial
+        const int num_dim_spatial = args.size() > 2 ? std::stoi(args[2]) : 0;
+
+        if(num_dim_spatial < 1 || num_dim_spatial > 3 ||
+           args.size() != static_cast<std::size_t>(3 + 4 + 6 * num_dim_spatial))
+        {
+            throw std::runtime_error("wrong! invalid conv shape \"" + line + "\"");
+        }
+
+        ConvDirection direction;
+
+        if(args[0] == "fwd")
+            direction = ConvDirection::Forward;
+        else if(args[0] == "bwd_data")
+            direction = ConvDirection::BackwardData;
+        else if(args[0] == "bwd_weight")
+            direction = ConvDirection::BackwardWeight;
+        else
+            throw std::runtime_error("wrong! invalid conv direction \"" + args[0] + "\"");
+
+        std::vector<char*> argv;
+
+        for(auto& arg : args)
+            argv.push_back(arg.data());
+
+        Add(parse_conv_param(num_dim_spatial, 3, argv.data()), direction, std::stoull(args[1]));
+
+        ++num_shapes;
+    }
+
+    return num_shapes;
+}
+
+void ConvShapeDb::Save(std::ostream& os) const
+{
+    for(const auto& shape : shapes_)
+    {
+        os << get_conv_direction_string(shape.direction_) << " " << shape.count_ << " "
+           << get_conv_param_string(shape.param_) << "\n";
+    }
+}
+
+namespace {
+
+ConvParam make_conv2d(ck::index_t N,
+                      ck::index_t G,
+                      ck::index_t K,
+                      ck::index_t C,
+                      ck::index_t filter_length,
+                      ck::index_t input_length,
+                      ck::index_t stride,
+                      ck::index_t pad)
+{
+    return ConvParam(2,
+                     G,
+                     N,
+                     K,
+                     C,
+                     {filter_length, filter_length},
+                     {input_length, input_length},
+                     {stride, stride},
+                     {1, 1},
+                     {pad, pad},
+                     {pad, pad});
+}
+
+// [N * num_token, C] x [C, K]
+ConvParam make_linear(ck::index_t N, ck::index_t num_token, ck::index_t K, ck::index_t C)
+{
+    return ConvParam(2, 1, N, K, C, {1, 1}, {num_token, 1}, {1, 1}, {1, 1}, {0, 0}, {0, 0});
+}
+
+// torchvision ResNet-50, stride on the 3x3 convolutions
+ConvShapeDb make_resnet50(ck::index_t N)
+{
+    ConvShapeDb db;
+
+    db.Add(make_conv2d(N, 1, 64, 3, 7, 224, 2, 3));
+
+    // after the 3x3 max pooling of stride 2
+    ck::index_t hw = 56;
+    ck::index_t C  = 64;
+
+    const std::array<ck::index_t, 4> num_blocks{3, 4, 6, 3};
+
+    for(ck::index_t stage = 0; stage < 4; ++stage)
+    {
+        const ck::index_t width = 64 << stage;
+
+        for(ck::index_t block = 0; block < num_blocks[stage]; ++block)
+        {
+            const ck::index_t stride = block == 0 && stage > 0 ? 2 : 1;
+
+            const auto conv2 = make_conv2d(N, 1, width, width, 3, hw, stride, 1);
+
+            db.Add(make_conv2d(N, 1, width, C, 1, hw, 1, 0));
+            db.Add(conv2);
+            db.Add(make_conv2d(N, 1, 4 * width, width, 1, conv2.output_spatial_lengths_[0], 1, 0));
+
+            // projection shortcut
+            if(block == 0)
+                db.Add(make_conv2d(N, 1, 4 * width, C, 1, hw, stride, 0));
+
+            hw = conv2.output_spatial_lengths_[0];
+            C  = 4 * width;
+        }
+    }
+
+    db.Add(make_linear(N, 1, 1000, 2048));
+
+    return db;
+}
+
+// inverted residual blocks with depthwise 3x3 convolutions, G channels of one input and one
+// output channel each
+ConvShapeDb make_mobilenet_v2(ck::index_t N)
+{
+    ConvShapeDb db;
+
+    const auto stem = make_conv2d(N, 1, 32, 3, 3, 224, 2, 1);
+    db.Add(stem);
+
+    ck::index_t hw = stem.output_spatial_lengths_[0];
+    ck::index_t C  = 32;
+
+    // expansion, output channels, number of blocks, stride of the first one
+    const std::array<std::array<ck::index_t, 4>, 7> stages{{{1, 16, 1, 1},
+                                                            {6, 24, 2, 2},
+                                                            {6, 32, 3, 2},
+                                                            {6, 64, 4, 2},
+                                                            {6, 96, 3, 1},
+                                                            {6, 160, 3, 2},
+                                                            {6, 320, 1, 1}}};
+
+    for(const auto& stage : stages)
+    {
+        for(ck::index_t block = 0; block < stage[2]; ++block)
+        {
+            const ck::index_t hidden = C * stage[0];
+
+            if(stage[0] != 1)
+                db.Add(make_conv2d(N, 1, hidden, C, 1, hw, 1, 0));
+
+            const ck::index_t stride = block == 0 ? stage[3] : 1;
+            const auto depthwise     = make_conv2d(N, hidden, 1, 1, 3, hw, stride, 1);
+
+            db.Add(depthwise);
+
+            hw = depthwise.output_spatial_lengths_[0];
+
+            db.Add(make_conv2d(N, 1, stage[1], hidden, 1, hw, 1, 0));
+
+            C = stage[1];
+        }
+    }
+
+    db.Add(make_conv2d(N, 1, 1280, C, 1, hw, 1, 0));
+    db.Add(make_linear(N, 1, 1000, 1280));
+
+    return db;
+}
+
+// the linear layers of a transformer encoder layer: fused QKV, attention output and MLP
+void add_transformer_layers(ConvShapeDb& db,
+                            ck::index_t N,
+                            ck::index_t num_token,
+                            ck::index_t hidden,
+                            ck::index_t mlp_hidden,
+                            std::size_t num_layer)
+{
+    db.Add(make_linear(N, num_token, 3 * hidden, hidden), ConvDirection::Forward, num_layer);
+    db.Add(make_linear(N, num_token, hidden, hidden), ConvDirection::Forward, num_layer);
+    db.Add(make_linear(N, num_token, mlp_hidden, hidden), ConvDirection::Forward, num_layer);
+    db.Add(make_linear(N, num_token, hidden, mlp_hidden), ConvDirection::Forward, num_layer);
+}
+
+// ViT-B/16 at 224x224: 16x16 patches, the class token and 12 layers
+ConvShapeDb make_vit_b16(ck::index_t N)
+{
+    ConvShapeDb db;
+
+    db.Add(make_conv2d(N, 1, 768, 3, 16, 224, 16, 0));
+    add_transformer_layers(db, N, 14 * 14 + 1, 768, 3072, 12);
+    db.Add(make_linear(N, 1, 1000, 768));
+
+    return db;
+}
+
+// BERT-base at a sequence length of 384, pooler included
+ConvShapeDb make_bert_base(ck::index_t N)
+{
+    ConvShapeDb db;
+
+    add_transformer_layers(db, N, 384, 768, 3072, 12);
+    db.Add(make_linear(N, 1, 768, 768));
+
+    return db;
+}
+
+// MLPerf DLRM: bottom MLP on 13 dense features, top MLP on the 479 interaction features of 26
+// sparse embeddings of 128
+ConvShapeDb make_dlrm(ck::index_t N)
+{
+    ConvShapeDb db;
+
+    const std::array<ck::index_t, 4> bottom_mlp{13, 512, 256, 128};
+    const std::array<ck::index_t, 6> top_mlp{479, 1024, 1024, 512, 256, 1};
+
+    for(std::size_t i = 1; i < bottom_mlp.size(); ++i)
+        db.Add(make_linear(N, 1, bottom_mlp[i], bottom_mlp[i - 1]));
+
+    for(std::size_t i = 1; i < top_mlp.size(); ++i)
+        db.Add(make_linear(N, 1, top_mlp[i], top_mlp[i - 1]));
+
+    return db;
+}
+
+} // namespace
+
+std::vector<std::string> get_conv_shape_db_model_names()
+{
+    return {"resnet50", "mobilenet_v2", "vit_b16", "bert_base", "dlrm"};
+}
+
+ConvShapeDb make_model_conv_shape_db(const std::string& model, ck::index_t N)
+{
+    if(model == "resnet50")
+        return make_resnet50(N);
+    else if(model == "mobilenet_v2")
+        return make_mobilenet_v2(N);
+    else if(model == "vit_b16")
+        return make_vit_b16(N);
+    else if(model == "bert_base")
+        return make_bert_base(N);
+    else if(model == "dlrm")
+        return make_dlrm(N);
+    else
+        throw std::runtime_error("wrong! unknown model " + model);
+}
+
+} // namespace conv
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <array>
+#include <ostream>
+#include <string>
+
+#include "ck/tensor_operation/gpu/device/dims_canonicalizer.hpp"
+
+#include "ck/library/utility/convolution_forward_planner.hpp"
+
+namespace ck {
+namespace utils {
+namespace conv {
+
+using ck::tensor_operation::device::ConvolutionForwardSpecialization;
+
+std::string get_conv_fwd_family_string(ConvFwdFamily family)
+{
+    switch(family)
+    {
+    case ConvFwdFamily::Gemm: return "Gemm";
+    case ConvFwdFamily::BatchedGemm: return "BatchedGemm";
+    case ConvFwdFamily::GroupedConvFwd: return "GroupedConvFwd";
+    default: return "Unrecognized family!";
+    }
+}
+
+ConvParam canonicalize_conv_fwd_param(const ConvParam& param)
+{
+    std::vector<ck::index_t> dilations(param.conv_filter_dilations_);
+    std::vector<ck::index_t> right_pads(param.input_right_pads_);
+
+    for(ck::index_t i = 0; i < param.num_dim_spatial_; ++i)
+    {
+        const ck::index_t x  = param.filter_spatial_lengths_[i];
+        const ck::index_t wi = param.input_spatial_lengths_[i];
+        const ck::index_t wo = param.output_spatial_lengths_[i];
+
+        // the dilation of a length-1 filter has no effect
+        if(x == 1)
+            dilations[i] = 1;
+
+        // the last input read is at (Wo - 1) * stride + XEff - 1 - left_pad
+        const ck::index_t x_eff = (x - 1) * dilations[i] + 1;
+        const ck::index_t last  = (wo - 1) * param.conv_filter_strides_[i] + x_eff - 1;
+
+        right_pads[i] =
+            std::min(right_pads[i], std::max(0, last + 1 - wi - param.input_left_pads_[i]));
+    }
+
+    return ConvParam{param.num_dim_spatial_,
+                     param.G_,
+                     param.N_,
+                     param.K_,
+                     param.C_,
+                     param.filter_spatial_lengths_,
+                     param.input_spatial_lengths_,
+                     param.conv_filter_strides_,
+                     dilations,
+                     param.input_left_pads_,
+                     right_pads};
+}
+
+namespace {
+
+constexpr ck::index_t MaxNumDim = 4; // N and up to 3 spatial dims
+
+// merges N and the output spatial dims of an unpadded 1x1 convolution into GEMM M dims, returns
+// the number of M dims left, the innermost at MaxNumDim - 1
+ck::index_t get_gemm_m_dims(const ConvParam& param,
+                            std::array<ck::index_t, MaxNumDim>& lengths,
+                            std::array<ck::index_t, MaxNumDim>& in_strides,
+                            std::array<ck::index_t, MaxNumDim>& out_strides)
+{
+    const ck::index_t num_dim = param.num_dim_spatial_ + 1;
+    const ck::index_t pad     = MaxNumDim - num_dim;
+
+    lengths.fill(1);
+    in_strides.fill(1);
+    out_strides.fill(1);
+
+    // packed NHWGC input and NHWGK output, o-th output pixel reads the (o * stride)-th input pixel
+    ck::index_t in_stride  = param.G_ * param.C_;
+    ck::index_t out_stride = param.G_ * param.K_;
+
+    for(ck::index_t i = param.num_dim_spatial_ - 1; i >= 0; --i)
+    {
+        lengths[pad + i + 1]     = param.output_spatial_lengths_[i];
+        in_strides[pad + i + 1]  = in_stride * param.conv_filter_strides_[i];
+        out_strides[pad + i + 1] = out_stride;
+
+        in_stride *= param.input_spatial_lengths_[i];
+        out_stride *= param.output_spatial_lengths_[i];
+    }
+
+    lengths[pad]     = param.N_;
+    in_strides[pad]  = in_stride;
+    out_strides[pad] = out_stride;
+
+    // the dims already are in the order of the output
+    return ck::tensor_operation::device::canonicalize_dims<2>(
+        lengths.data(), {in_strides.data(), out_strides.data()}, MaxNumDim, 1, false);
+}
+
+} // namespace
+
+ConvFwdPlan make_conv_fwd_plan(const ConvParam& param)
+{
+    ConvFwdPlan plan{ConvFwdFamily::GroupedConvFwd, canonicalize_conv_fwd_param(param), {}, {}};
+
+    const ConvParam& p = plan.param_;
+
+    bool is_1x1     = true;
+    bool is_pad0    = true;
+    bool is_stride1 = true;
+
+    for(ck::index_t i = 0; i < p.num_dim_spatial_; ++i)
+    {
+        is_1x1     = is_1x1 && p.filter_spatial_lengths_[i] == 1;
+        is_pad0    = is_pad0 && p.input_left_pads_[i] == 0 && p.input_right_pads_[i] == 0;
+        is_stride1 = is_stride1 && p.conv_filter_strides_[i] == 1;
+    }
+
+    if(is_1x1 && is_pad0 && p.num_dim_spatial_ < MaxNumDim)
+    {
+        std::array<ck::index_t, MaxNumDim> lengths;
+        std::array<ck::index_t, MaxNumDim> in_strides;
+        std::array<ck::index_t, MaxNumDim> out_strides;
+
+        const ck::index_t num_m_dim = get_gemm_m_dims(p, lengths, in_strides, out_strides);
+
+        constexpr ck::index_t M = MaxNumDim - 1;
+        constexpr ck::index_t B = MaxNumDim - 2;
+
+        ConvFwdGemmView& gemm = plan.gemm_;
+
+        gemm.M_ = lengths[M];
+        gemm.N_ = p.K_;
+        gemm.K_ = p.C_;
+
+        // the leading dimension of a single row is arbitrary, use the packed one
+        gemm.StrideA_ = gemm.M_ == 1 ? p.G_ * p.C_ : in_strides[M];
+        gemm.StrideB_ = p.C_;
+        gemm.StrideE_ = gemm.M_ == 1 ? p.G_ * p.K_ : out_strides[M];
+
+        if(p.G_ == 1 && num_m_dim <= 1)
+        {
+            plan.family_ = ConvFwdFamily::Gemm;
+
+            gemm.Batch_        = 1;
+            gemm.BatchStrideA_ = 0;
+            gemm.BatchStrideB_ = 0;
+            gemm.BatchStrideE_ = 0;
+
+            return plan;
+        }
+        else if(p.G_ == 1 && num_m_dim == 2)
+        {
+            // strided view of the input, the batch is the outer output dim sharing the weight
+            plan.family_ = ConvFwdFamily::BatchedGemm;
+
+            gemm.Batch_        = lengths[B];
+            gemm.BatchStrideA_ = in_strides[B];
+            gemm.BatchStrideB_ = 0;
+            gemm.BatchStrideE_ = out_strides[B];
+
+            return plan;
+        }
+        else if(num_m_dim <= 1)
+        {
+            // the batch is the group
+            plan.family_ = ConvFwdFamily::BatchedGemm;
+
+            gemm.Batch_        = p.G_;
+            gemm.BatchStrideA_ = p.C_;
+            gemm.BatchStrideB_ = static_cast<ck::long_index_t>(p.K_) * p.C_;
+            gemm.BatchStrideE_ = p.K_;
+
+            return plan;
+        }
+
+        plan.gemm_ = {};
+    }
+
+    if(is_1x1 && is_pad0)
+    {
+        plan.conv_fwd_specializations_.push_back(
+            is_stride1 ? ConvolutionForwardSpecialization::Filter1x1Stride1Pad0
+                       : ConvolutionForwardSpecialization::Filter1x1Pad0);
+    }
+
+    // without a vector of 8 elements along C, e.g. depthwise convolutions, only the instances
+    // with scalar access of the input are supported
+    if(p.C_ % 8 != 0)
+        plan.conv_fwd_specializations_.push_back(ConvolutionForwardSpecialization::OddC);
+
+    plan.conv_fwd_specializations_.push_back(ConvolutionForwardSpecialization::Default);
+
+    return plan;
+}
+
+bool is_conv_fwd_instance_in_plan(const ConvFwdPlan& plan, const std::string& type_string)
+{
+    if(plan.family_ != ConvFwdFamily::GroupedConvFwd)
+        return false;
+
+    return std::any_of(plan.conv_fwd_specializations_.begin(),
+                       plan.conv_fwd_specializations_.end(),
+                       [&](ConvolutionForwardSpecialization s) {
+                           const auto name = ck::tensor_operation::device::
+                               getConvForwardSpecializationString(s);
+
+                           return type_string.find(", " + name + ",") != std::string::npos;
+                       });
+}
+
+} // namespace conv
+} // namespace utils
+} // namespace ck
+
+std::ostream& operator<<(std::ostream& os, const ck::utils::conv::ConvFwdPlan& plan)
+{
+    os << "ConvFwdPlan {"
+       << "\nfamily: " << ck::utils::conv::get_conv_fwd_family_string(plan.family_);
+
+    if(plan.family_ == ck::utils::conv::ConvFwdFamily::GroupedConvFwd)
+    {
+        os << "\nspecializations:";
+
+        for(const auto s : plan.conv_fwd_specializations_)
+            os << " " << ck::tensor_operation::device::getConvForwardSpecializationString(s);
+    }
+    else
+    {
+        const auto& gemm = plan.gemm_;
+
+        os << "\nBatch: " << gemm.Batch_ << "\nM: " << gemm.M_ << "\nN: " << gemm.N_
+           << "\nK: " << gemm.K_ << "\nStrideA: " << gemm.StrideA_
+           << "\nStrideB: " << gemm.StrideB_ << "\nStrideE: " << gemm.StrideE_
+           << "\nBatchStrideA: " << gemm.BatchStrideA_ << "\nBatchStrideB: " << gemm.BatchStrideB_
+           << "\nBatchStrideE: " << gemm.BatchStrideE_;
+    }
+
+    os << "\n}\n";
+
+    return os;
+}
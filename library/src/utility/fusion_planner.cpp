@@ -0,0 +1,440 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#include "ck/library/utility/fusion_planner.hpp"
+
+namespace ck {
+namespace utils {
+namespace fusion {
+
+std::string get_fusion_op_kind_string(FusionOpKind kind)
+{
+    switch(kind)
+    {
+    case FusionOpKind::Gemm: return "Gemm";
+    case FusionOpKind::BatchedGemm: return "BatchedGemm";
+    case FusionOpKind::Conv: return "Conv";
+    case FusionOpKind::Add: return "Add";
+    case FusionOpKind::Multiply: return "Multiply";
+    case FusionOpKind::Scale: return "Scale";
+    case FusionOpKind::Relu: return "Relu";
+    case FusionOpKind::FastGelu: return "FastGelu";
+    case FusionOpKind::LayerNorm: return "LayerNorm";
+    case FusionOpKind::Softmax: return "Softmax";
+    default: return "Unrecognized kind!";
+    }
+}
+
+std::size_t FusionTensor::GetNumBytes() const
+{
+    return element_size_ * std::accumulate(lengths_.begin(),
+                                           lengths_.end(),
+                                           std::size_t{1},
+                                           std::multiplies<std::size_t>{});
+}
+
+ck::index_t FusionGraph::AddTensor(const std::vector<ck::long_index_t>& lengths,
+                                   std::size_t element_size)
+{
+    tensors_.push_back({lengths, element_size});
+
+    return static_cast<ck::index_t>(tensors_.size()) - 1;
+}
+
+ck::index_t FusionGraph::AddNode(FusionOpKind kind,
+                                 const std::vector<ck::index_t>& inputs,
+                                 const std::vector<ck::long_index_t>& out_lengths)
+{
+    for(const ck::index_t input : inputs)
+    {
+        if(input < 0 || input >= static_cast<ck::index_t>(tensors_.size()))
+            throw std::runtime_error("wrong! invalid tensor of a " +
+                                     get_fusion_op_kind_string(kind) + " node");
+    }
+
+    const ck::index_t output = AddTensor(out_lengths, tensors_[inputs[0]].element_size_);
+
+    nodes_.push_back({kind, inputs, output});
+
+    return output;
+}
+
+ck::index_t FusionGraph::AddGemm(ck::index_t a, ck::index_t b)
+{
+    const ck::index_t num_tensor = static_cast<ck::index_t>(tensors_.size());
+
+    if(a < 0 || a >= num_tensor || b < 0 || b >= num_tensor)
+        throw std::runtime_error("wrong! invalid tensor of a Gemm node");
+
+    const auto& a_lengths  = tensors_[a].lengths_;
+    const auto& b_lengths  = tensors_[b].lengths_;
+    const std::size_t rank = a_lengths.size();
+
+    if(rank < 2 || rank > 3 || b_lengths.size() != rank ||
+       a_lengths[rank - 1] != b_lengths[rank - 2] || (rank == 3 && a_lengths[0] != b_lengths[0]))
+    {
+        throw std::runtime_error("wrong! mismatched lengths of a Gemm node");
+    }
+
+    std::vector<ck::long_index_t> out_lengths(a_lengths.begin(), a_lengths.end() - 1);
+    out_lengths.push_back(b_lengths[rank - 1]);
+
+    return AddNode(
+        rank == 2 ? FusionOpKind::Gemm : FusionOpKind::BatchedGemm, {a, b}, out_lengths);
+}
+
+ck::index_t FusionGraph::AddConv(ck::index_t in,
+                                 ck::index_t wei,
+                                 const std::vector<ck::long_index_t>& out_lengths)
+{
+    return AddNode(FusionOpKind::Conv, {in, wei}, out_lengths);
+}
+
+ck::index_t FusionGraph::AddAdd(ck::index_t x, ck::index_t y)
+{
+    return AddNode(FusionOpKind::Add, {x, y}, tensors_.at(x).lengths_);
+}
+
+ck::index_t FusionGraph::AddMultiply(ck::index_t x, ck::index_t y)
+{
+    return AddNode(FusionOpKind::Multiply, {x, y}, tensors_.at(x).lengths_);
+}
+
+ck::index_t FusionGraph::AddScale(ck::index_t x)
+{
+    return AddNode(FusionOpKind::Scale, {x}, tensors_.at(x).lengths_);
+}
+
+ck::index_t FusionGraph::AddRelu(ck::index_t x)
+{
+    return AddNode(FusionOpKind::Relu, {x}, tensors_.at(x).lengths_);
+}
+
+ck::index_t FusionGraph::AddFastGelu(ck::index_t x)
+{
+    return AddNode(FusionOpKind::FastGelu, {x}, tensors_.at(x).lengths_);
+}
+
+ck::index_t FusionGraph::AddLayerNorm(ck::index_t x, ck::index_t gamma, ck::index_t beta)
+{
+    return AddNode(FusionOpKind::LayerNorm, {x, gamma, beta}, tensors_.at(x).lengths_);
+}
+
+ck::index_t FusionGraph::AddSoftmax(ck::index_t x)
+{
+    return AddNode(FusionOpKind::Softmax, {x}, tensors_.at(x).lengths_);
+}
+
+std::vector<ck::index_t> FusionGraph::GetConsumers(ck::index_t tensor) const
+{
+    std::vector<ck::index_t> consumers;
+
+    for(ck::index_t i = 0; i < static_cast<ck::index_t>(nodes_.size()); ++i)
+    {
+        const auto& inputs = nodes_[i].inputs_;
+
+        if(std::find(inputs.begin(), inputs.end(), tensor) != inputs.end())
+            consumers.push_back(i);
+    }
+
+    return consumers;
+}
+
+namespace {
+
+struct FusionPattern
+{
+    std::vector<FusionOpKind> kinds_;
+    std::string device_op_;
+
+    // the node whose input is materialized in a workspace, -1 if none
+    ck::index_t workspace_node_;
+};
+
+const std::vector<FusionPattern>& get_fusion_patterns()
+{
+    using K = FusionOpKind;
+
+    // longest first
+    static const std::vector<FusionPattern> patterns{
+        {{K::Gemm, K::Add, K::Relu, K::Add, K::LayerNorm},
+         "DeviceGemmMultipleDLayernorm<AddReluAdd>",
+         4},
+        {{K::Conv, K::Scale, K::Add, K::Add, K::Relu},
+         "DeviceGroupedConvFwdMultipleABD<ScaleAddScaleAddRelu>",
+         -1},
+        {{K::BatchedGemm, K::Scale, K::Softmax, K::BatchedGemm},
+         "DeviceBatchedGemmSoftmaxGemmPermute",
+         -1},
+        {{K::Conv, K::Add, K::Add, K::Relu},
+         "DeviceGroupedConvFwdMultipleABD<ScaleAddScaleAddRelu>",
+         -1},
+        {{K::Gemm, K::Add, K::Add, K::FastGelu}, "DeviceGemmMultipleD<AddAddFastGelu>", -1},
+        {{K::BatchedGemm, K::Softmax, K::BatchedGemm}, "DeviceBatchedGemmSoftmaxGemmPermute", -1},
+        {{K::Gemm, K::Add, K::FastGelu}, "DeviceGemmMultipleD<AddFastGelu>", -1},
+        {{K::Gemm, K::Add, K::Multiply}, "DeviceGemmMultipleD<AddMultiply>", -1},
+        {{K::Gemm, K::Multiply, K::Add}, "DeviceGemmMultipleD<MultiplyAdd>", -1},
+        {{K::Gemm, K::Scale, K::Add}, "DeviceGemmMultipleD<Bilinear>", -1},
+        {{K::Gemm, K::Add}, "DeviceGemmMultipleD<Bilinear>", -1},
+        {{K::Gemm, K::FastGelu}, "DeviceGemmMultipleD<FastGelu>", -1},
+        {{K::Add, K::LayerNorm}, "DeviceElementwiseNormalization<Add>", -1},
+    };
+
+    return patterns;
+}
+
+bool is_elementwise(FusionOpKind kind)
+{
+    return kind == FusionOpKind::Add || kind == FusionOpKind::Multiply ||
+           kind == FusionOpKind::Scale || kind == FusionOpKind::Relu ||
+           kind == FusionOpKind::FastGelu;
+}
+
+std::string get_single_node_device_op(FusionOpKind kind)
+{
+    switch(kind)
+    {
+    case FusionOpKind::Gemm: return "DeviceGemm";
+    case FusionOpKind::BatchedGemm: return "DeviceBatchedGemm";
+    case FusionOpKind::Conv: return "DeviceGroupedConvFwdMultipleABD";
+    case FusionOpKind::LayerNorm: return "DeviceNormalization";
+    case FusionOpKind::Softmax: return "DeviceSoftmax";
+    default: return "DeviceElementwise";
+    }
+}
+
+// the node continuing a chain after the given node: the only reader of its output, not yet
+// planned, reading it as the operand the device operations fuse, -1 if none
+ck::index_t get_next_chain_node(const FusionGraph& graph,
+                                const std::vector<bool>& is_planned,
+                                ck::index_t node)
+{
+    const ck::index_t output = graph.GetNodes()[node].output_;
+    const auto consumers     = graph.GetConsumers(output);
+
+    if(consumers.size() != 1 || is_planned[consumers[0]])
+        return -1;
+
+    const auto& next = graph.GetNodes()[consumers[0]];
+
+    // the normalized input of a LayerNorm, the A matrix of a GEMM
+    if((next.kind_ == FusionOpKind::LayerNorm || next.kind_ == FusionOpKind::BatchedGemm ||
+        next.kind_ == FusionOpKind::Gemm || next.kind_ == FusionOpKind::Conv) &&
+       next.inputs_[0] != output)
+    {
+        return -1;
+    }
+
+    return consumers[0];
+}
+
+// the chain of nodes from the given one matching the pattern
+bool match_fusion_pattern(const FusionGraph& graph,
+                          const std::vector<bool>& is_planned,
+                          const FusionPattern& pattern,
+                          ck::index_t node,
+                          std::vector<ck::index_t>& chain)
+{
+    chain.assign(1, node);
+
+    for(std::size_t k = 0; k < pattern.kinds_.size(); ++k)
+    {
+        if(graph.GetNodes()[chain.back()].kind_ != pattern.kinds_[k])
+            return false;
+
+        if(k + 1 < pattern.kinds_.size())
+        {
+            const ck::index_t next = get_next_chain_node(graph, is_planned, chain.back());
+
+            if(next < 0)
+                return false;
+
+            chain.push_back(next);
+        }
+    }
+
+    return true;
+}
+
+FusionDeviceOp make_device_op(const FusionGraph& graph,
+                              const std::string& device_op,
+                              const std::vector<ck::index_t>& nodes,
+                              ck::index_t workspace_node)
+{
+    const auto& tensors = graph.GetTensors();
+
+    FusionDeviceOp op{device_op, nodes, {}, graph.GetNodes()[nodes.back()].output_, 0, 0};
+
+    for(const ck::index_t node : nodes)
+    {
+        for(const ck::index_t input : graph.GetNodes()[node].inputs_)
+        {
+            const bool is_intermediate =
+                std::any_of(nodes.begin(), nodes.end(), [&](ck::index_t n) {
+                    return graph.GetNodes()[n].output_ == input;
+                });
+
+            if(!is_intermediate &&
+               std::find(op.inputs_.begin(), op.inputs_.end(), input) == op.inputs_.end())
+            {
+                op.inputs_.push_back(input);
+            }
+        }
+    }
+
+    if(workspace_node >= 0)
+    {
+        // written once and read back once
+        op.workspace_bytes_ =
+            2 * tensors[graph.GetNodes()[nodes[workspace_node]].inputs_[0]].GetNumBytes();
+    }
+
+    op.bytes_ = tensors[op.output_].GetNumBytes() + op.workspace_bytes_;
+
+    for(const ck::index_t input : op.inputs_)
+        op.bytes_ += tensors[input].GetNumBytes();
+
+    return op;
+}
+
+// orders the device operations so that every one runs after those writing its inputs
+FusionPlan make_plan(const FusionGraph& graph, std::vector<FusionDeviceOp> ops)
+{
+    FusionPlan plan{{}, 0, 0};
+
+    std::vector<bool> is_written(graph.GetTensors().size(), true);
+
+    for(const auto& node : graph.GetNodes())
+        is_written[node.output_] = false;
+
+    while(!ops.empty())
+    {
+        const auto op = std::find_if(ops.begin(), ops.end(), [&](const FusionDeviceOp& o) {
+            return std::all_of(o.inputs_.begin(), o.inputs_.end(), [&](ck::index_t t) {
+                return is_written[t];
+            });
+        });
+
+        if(op == ops.end())
+            throw std::runtime_error("wrong! cyclic dependency between fused device ops");
+
+        is_written[op->output_] = true;
+        plan.bytes_ += op->bytes_;
+        plan.ops_.push_back(*op);
+        ops.erase(op);
+    }
+
+    plan.unfused_bytes_ = 0;
+
+    for(ck::index_t i = 0; i < static_cast<ck::index_t>(graph.GetNodes().size()); ++i)
+    {
+        plan.unfused_bytes_ +=
+            make_device_op(graph, get_single_node_device_op(graph.GetNodes()[i].kind_), {i}, -1)
+                .bytes_;
+    }
+
+    return plan;
+}
+
+} // namespace
+
+FusionPlan make_fusion_plan(const FusionGraph& graph)
+{
+    const auto& nodes          = graph.GetNodes();
+    const ck::index_t num_node = static_cast<ck::index_t>(nodes.size());
+
+    std::vector<bool> is_planned(num_node, false);
+    std::vector<FusionDeviceOp> ops;
+
+    for(ck::index_t i = 0; i < num_node; ++i)
+    {
+        if(is_planned[i])
+            continue;
+
+        std::vector<ck::index_t> chain;
+
+        for(const auto& pattern : get_fusion_patterns())
+        {
+            if(match_fusion_pattern(graph, is_planned, pattern, i, chain))
+            {
+                ops.push_back(
+                    make_device_op(graph, pattern.device_op_, chain, pattern.workspace_node_));
+                break;
+            }
+
+            chain.clear();
+        }
+
+        if(chain.empty())
+        {
+            // a chain of elementwise nodes, or a single node
+            chain.assign(1, i);
+
+            if(is_elementwise(nodes[i].kind_))
+            {
+                for(ck::index_t next = get_next_chain_node(graph, is_planned, i);
+                    next >= 0 && is_elementwise(nodes[next].kind_);
+                    next = get_next_chain_node(graph, is_planned, next))
+                {
+                    chain.push_back(next);
+                }
+            }
+
+            ops.push_back(
+                make_device_op(graph, get_single_node_device_op(nodes[i].kind_), chain, -1));
+        }
+
+        for(const ck::index_t node : chain)
+            is_planned[node] = true;
+    }
+
+    return make_plan(graph, ops);
+}
+
+FusionPlan make_unfused_plan(const FusionGraph& graph)
+{
+    std::vector<FusionDeviceOp> ops;
+
+    for(ck::index_t i = 0; i < static_cast<ck::index_t>(graph.GetNodes().size()); ++i)
+    {
+        ops.push_back(make_device_op(
+            graph, get_single_node_device_op(graph.GetNodes()[i].kind_), {i}, -1));
+    }
+
+    return make_plan(graph, ops);
+}
+
+} // namespace fusion
+} // namespace utils
+} // namespace ck
+
+std::ostream& operator<<(std::ostream& os, const ck::utils::fusion::FusionPlan& plan)
+{
+    os << "FusionPlan {";
+
+    for(const auto& op : plan.ops_)
+    {
+        os << "\n" << op.device_op_ << ": nodes";
+
+        for(const auto node : op.nodes_)
+            os << " " << node;
+
+        os << ", inputs";
+
+        for(const auto input : op.inputs_)
+            os << " " << input;
+
+        os << ", output " << op.output_ << ", " << op.bytes_ << " bytes";
+    }
+
+    os << "\nbytes: " << plan.bytes_ << "\nunfused bytes: " << plan.unfused_bytes_ << "\n}\n";
+
+    return os;
+}
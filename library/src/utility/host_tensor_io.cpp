@@ -0,0 +1,450 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstring>
+#include <limits>
+#include <regex>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ck/library/utility/host_tensor_io.hpp"
+
+namespace ck {
+namespace utils {
+
+std::size_t get_tensor_file_data_type_size(TensorFileDataType data_type)
+{
+    switch(data_type)
+    {
+    case TensorFileDataType::F64: return 8;
+    case TensorFileDataType::F32: return 4;
+    case TensorFileDataType::F16: return 2;
+    case TensorFileDataType::BF16: return 2;
+    case TensorFileDataType::I32: return 4;
+    case TensorFileDataType::I8: return 1;
+    case TensorFileDataType::F8: return 1;
+    case TensorFileDataType::BF8: return 1;
+    default: throw std::runtime_error("wrong! unknown tensor file data type");
+    }
+}
+
+std::string get_tensor_file_data_type_string(TensorFileDataType data_type)
+{
+    switch(data_type)
+    {
+    case TensorFileDataType::F64: return "f64";
+    case TensorFileDataType::F32: return "f32";
+    case TensorFileDataType::F16: return "f16";
+    case TensorFileDataType::BF16: return "bf16";
+    case TensorFileDataType::I32: return "i32";
+    case TensorFileDataType::I8: return "i8";
+    case TensorFileDataType::F8: return "f8";
+    case TensorFileDataType::BF8: return "bf8";
+    default: return "unknown";
+    }
+}
+
+namespace {
+
+constexpr char ck_magic[]            = "CKTENSOR";
+constexpr std::size_t ck_magic_size  = sizeof(ck_magic) - 1;
+constexpr std::uint32_t ck_version   = 1;
+constexpr char npy_magic[]           = "\x93NUMPY";
+constexpr std::size_t npy_magic_size = sizeof(npy_magic) - 1;
+
+// of the data, in both formats
+constexpr std::size_t data_alignment = 64;
+
+std::size_t align_data_offset(std::size_t offset)
+{
+    return (offset + data_alignment - 1) / data_alignment * data_alignment;
+}
+
+template <typename T>
+void append(std::string& header, T value)
+{
+    header.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T read(const char* p_file, std::size_t size, std::size_t& pos)
+{
+    if(pos + sizeof(T) > size)
+        throw std::runtime_error("wrong! truncated tensor file header");
+
+    T value;
+    std::memcpy(&value, p_file + pos, sizeof(T));
+    pos += sizeof(T);
+
+    return value;
+}
+
+bool is_packed(const HostTensorDescriptor& desc, bool is_fortran_order)
+{
+    std::size_t stride = 1;
+
+    for(std::size_t i = 0; i < desc.GetNumOfDimension(); ++i)
+    {
+        const std::size_t dim = is_fortran_order ? i : desc.GetNumOfDimension() - 1 - i;
+
+        if(desc.GetLengths()[dim] > 1 && desc.GetStrides()[dim] != stride)
+            return false;
+
+        stride *= desc.GetLengths()[dim];
+    }
+
+    return true;
+}
+
+std::string get_npy_descr(TensorFileDataType data_type)
+{
+    switch(data_type)
+    {
+    case TensorFileDataType::F64: return "<f8";
+    case TensorFileDataType::F32: return "<f4";
+    case TensorFileDataType::F16: return "<f2";
+    case TensorFileDataType::I32: return "<i4";
+    case TensorFileDataType::I8: return "|i1";
+    case TensorFileDataType::BF16:
+    case TensorFileDataType::F8:
+    case TensorFileDataType::BF8:
+    default:
+        throw std::runtime_error("wrong! .npy has no " +
+                                 get_tensor_file_data_type_string(data_type) + " data type");
+    }
+}
+
+TensorFileDataType get_npy_data_type(const std::string& descr)
+{
+    if(descr == "<f8")
+        return TensorFileDataType::F64;
+    else if(descr == "<f4")
+        return TensorFileDataType::F32;
+    else if(descr == "<f2")
+        return TensorFileDataType::F16;
+    else if(descr == "<i4")
+        return TensorFileDataType::I32;
+    else if(descr == "|i1" || descr == "<i1")
+        return TensorFileDataType::I8;
+    else
+        throw std::runtime_error("wrong! unsupported .npy data type " + descr);
+}
+
+std::string make_npy_header(TensorFileInfo& info)
+{
+    const auto& desc = info.desc_;
+
+    bool is_fortran_order = false;
+
+    if(!is_packed(desc, false))
+    {
+        if(!is_packed(desc, true))
+            throw std::runtime_error("wrong! a .npy tensor must be packed in C or Fortran order");
+
+        is_fortran_order = true;
+    }
+
+    std::string dict = "{'descr': '" + get_npy_descr(info.data_type_) +
+                       "', 'fortran_order': " + (is_fortran_order ? "True" : "False") +
+                       ", 'shape': (";
+
+    for(const std::size_t length : desc.GetLengths())
+        dict += std::to_string(length) + ", ";
+
+    // a 1-tuple keeps its comma
+    if(desc.GetNumOfDimension() > 1)
+        dict.resize(dict.size() - 2);
+    else if(desc.GetNumOfDimension() == 1)
+        dict.pop_back();
+
+    dict += "), }";
+
+    // version 1.0 has a 2-byte header length, 2.0 a 4-byte one
+    const bool is_v1         = align_data_offset(npy_magic_size + 4 + dict.size() + 1) <=
+                       std::numeric_limits<std::uint16_t>::max();
+    const std::size_t prefix = npy_magic_size + (is_v1 ? 4 : 6);
+
+    info.data_offset_ = align_data_offset(prefix + dict.size() + 1);
+
+    dict.resize(info.data_offset_ - prefix - 1, ' ');
+    dict += '\n';
+
+    std::string header(npy_magic, npy_magic_size);
+
+    header += static_cast<char>(is_v1 ? 1 : 2);
+    header += static_cast<char>(0);
+
+    if(is_v1)
+        append(header, static_cast<std::uint16_t>(dict.size()));
+    else
+        append(header, static_cast<std::uint32_t>(dict.size()));
+
+    return header + dict;
+}
+
+TensorFileInfo parse_npy_header(const char* p_file, std::size_t size)
+{
+    std::size_t pos = npy_magic_size;
+
+    const auto major_version = read<std::uint8_t>(p_file, size, pos);
+    read<std::uint8_t>(p_file, size, pos);
+
+    const std::size_t dict_size = major_version == 1
+                                      ? read<std::uint16_t>(p_file, size, pos)
+                                      : read<std::uint32_t>(p_file, size, pos);
+
+    if(pos + dict_size > size)
+        throw std::runtime_error("wrong! truncated tensor file header");
+
+    const std::string dict(p_file + pos, dict_size);
+
+    const std::regex descr_regex(R"('descr'\s*:\s*'([^']*)')");
+    const std::regex fortran_order_regex(R"('fortran_order'\s*:\s*(True|False))");
+    const std::regex shape_regex(R"('shape'\s*:\s*\(([0-9,\s]*)\))");
+
+    std::smatch descr_match;
+    std::smatch fortran_order_match;
+    std::smatch shape_match;
+
+    if(!std::regex_search(dict, descr_match, descr_regex) ||
+       !std::regex_search(dict, fortran_order_match, fortran_order_regex) ||
+       !std::regex_search(dict, shape_match, shape_regex))
+    {
+        throw std::runtime_error("wrong! invalid .npy header " + dict);
+    }
+
+    std::vector<std::size_t> lengths;
+
+    const std::string shape = shape_match[1];
+    const std::regex length_regex("[0-9]+");
+
+    for(auto it = std::sregex_iterator(shape.begin(), shape.end(), length_regex);
+        it != std::sregex_iterator();
+        ++it)
+    {
+        lengths.push_back(std::stoull(it->str()));
+    }
+
+    // packed in C or Fortran order
+    std::vector<std::size_t> strides(lengths.size());
+    std::size_t stride = 1;
+
+    for(std::size_t i = 0; i < lengths.size(); ++i)
+    {
+        const std::size_t dim =
+            fortran_order_match[1] == "True" ? i : lengths.size() - 1 - i;
+
+        strides[dim] = stride;
+        stride *= lengths[dim];
+    }
+
+    return {get_npy_data_type(descr_match[1]),
+            HostTensorDescriptor(lengths, strides),
+            "",
+            pos + dict_size};
+}
+
+std::string make_ck_header(TensorFileInfo& info)
+{
+    const auto& desc = info.desc_;
+
+    std::string header(ck_magic, ck_magic_size);
+
+    append(header, ck_version);
+    append(header, static_cast<std::uint32_t>(info.data_type_));
+    append(header, static_cast<std::uint32_t>(desc.GetNumOfDimension()));
+    append(header, static_cast<std::uint32_t>(info.layout_.size()));
+
+    for(const std::size_t length : desc.GetLengths())
+        append(header, static_cast<std::uint64_t>(length));
+
+    for(const std::size_t stride : desc.GetStrides())
+        append(header, static_cast<std::uint64_t>(stride));
+
+    header += info.layout_;
+
+    info.data_offset_ = align_data_offset(header.size());
+    header.resize(info.data_offset_, '\0');
+
+    return header;
+}
+
+TensorFileInfo parse_ck_header(const char* p_file, std::size_t size)
+{
+    std::size_t pos = ck_magic_size;
+
+    if(read<std::uint32_t>(p_file, size, pos) != ck_version)
+        throw std::runtime_error("wrong! unsupported tensor file version");
+
+    const auto data_type   = read<std::uint32_t>(p_file, size, pos);
+    const auto num_dim     = read<std::uint32_t>(p_file, size, pos);
+    const auto layout_size = read<std::uint32_t>(p_file, size, pos);
+
+    if(data_type > static_cast<std::uint32_t>(TensorFileDataType::BF8))
+        throw std::runtime_error("wrong! unknown tensor file data type");
+
+    std::vector<std::size_t> lengths(num_dim);
+    std::vector<std::size_t> strides(num_dim);
+
+    for(auto& length : lengths)
+        length = read<std::uint64_t>(p_file, size, pos);
+
+    for(auto& stride : strides)
+        stride = read<std::uint64_t>(p_file, size, pos);
+
+    if(pos + layout_size > size)
+        throw std::runtime_error("wrong! truncated tensor file header");
+
+    std::string layout(p_file + pos, layout_size);
+
+    return {static_cast<TensorFileDataType>(data_type),
+            HostTensorDescriptor(lengths, strides),
+            std::move(layout),
+            align_data_offset(pos + layout_size)};
+}
+
+} // namespace
+
+std::string make_tensor_file_header(TensorFileInfo& info, TensorFileFormat format)
+{
+    return format == TensorFileFormat::Npy ? make_npy_header(info) : make_ck_header(info);
+}
+
+TensorFileInfo parse_tensor_file_header(const char* p_file, std::size_t size)
+{
+    TensorFileInfo info;
+
+    if(size >= npy_magic_size && std::memcmp(p_file, npy_magic, npy_magic_size) == 0)
+        info = parse_npy_header(p_file, size);
+    else if(size >= ck_magic_size && std::memcmp(p_file, ck_magic, ck_magic_size) == 0)
+        info = parse_ck_header(p_file, size);
+    else
+        throw std::runtime_error("wrong! not a .npy or CK tensor file");
+
+    if(info.data_offset_ + info.GetDataSize() > size)
+        throw std::runtime_error("wrong! truncated tensor file data");
+
+    return info;
+}
+
+MappedTensorFile::MappedTensorFile(const std::string& file_name)
+    : info_{}, p_map_(nullptr), map_size_(0)
+{
+    const int fd = open(file_name.c_str(), O_RDONLY);
+
+    if(fd < 0)
+        throw std::runtime_error("wrong! cannot open " + file_name);
+
+    struct stat file_stat;
+
+    if(fstat(fd, &file_stat) != 0 || file_stat.st_size == 0)
+    {
+        close(fd);
+        throw std::runtime_error("wrong! cannot map " + file_name);
+    }
+
+    map_size_ = static_cast<std::size_t>(file_stat.st_size);
+    p_map_    = mmap(nullptr, map_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // the mapping outlives the descriptor
+    close(fd);
+
+    if(p_map_ == MAP_FAILED)
+    {
+        p_map_ = nullptr;
+        throw std::runtime_error("wrong! cannot map " + file_name);
+    }
+
+    try
+    {
+        info_ = parse_tensor_file_header(static_cast<const char*>(p_map_), map_size_);
+    }
+    catch(...)
+    {
+        Unmap();
+        throw;
+    }
+}
+
+MappedTensorFile::MappedTensorFile(MappedTensorFile&& other) noexcept
+    : info_(std::move(other.info_)), p_map_(other.p_map_), map_size_(other.map_size_)
+{
+    other.p_map_    = nullptr;
+    other.map_size_ = 0;
+}
+
+MappedTensorFile& MappedTensorFile::operator=(MappedTensorFile&& other) noexcept
+{
+    if(this != &other)
+    {
+        Unmap();
+
+        info_     = std::move(other.info_);
+        p_map_    = other.p_map_;
+        map_size_ = other.map_size_;
+
+        other.p_map_    = nullptr;
+        other.map_size_ = 0;
+    }
+
+    return *this;
+}
+
+MappedTensorFile::~MappedTensorFile() { Unmap(); }
+
+void MappedTensorFile::Unmap()
+{
+    if(p_map_ != nullptr)
+        munmap(p_map_, map_size_);
+
+    p_map_    = nullptr;
+    map_size_ = 0;
+}
+
+TensorFileWriter::TensorFileWriter(const std::string& file_name,
+                                   TensorFileInfo info,
+                                   TensorFileFormat format)
+    : file_name_(file_name),
+      info_(std::move(info)),
+      os_(file_name, std::ios::binary),
+      num_bytes_written_(0)
+{
+    if(!os_)
+        throw std::runtime_error("wrong! cannot open " + file_name + " for writing");
+
+    const std::string header = make_tensor_file_header(info_, format);
+
+    os_.write(header.data(), static_cast<std::streamsize>(header.size()));
+}
+
+void TensorFileWriter::Write(const void* p_data, std::size_t num_bytes)
+{
+    if(num_bytes > GetNumBytesLeft())
+        throw std::runtime_error("wrong! more data than the tensor of " + file_name_ + " holds");
+
+    os_.write(static_cast<const char*>(p_data), static_cast<std::streamsize>(num_bytes));
+
+    if(!os_)
+        throw std::runtime_error("wrong! cannot write to " + file_name_);
+
+    num_bytes_written_ += num_bytes;
+}
+
+void TensorFileWriter::Close()
+{
+    if(GetNumBytesLeft() != 0)
+        throw std::runtime_error("wrong! missing data of the tensor of " + file_name_);
+
+    os_.close();
+
+    if(os_.fail())
+        throw std::runtime_error("wrong! cannot write to " + file_name_);
+}
+
+} // namespace utils
+} // namespace ck
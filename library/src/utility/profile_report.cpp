@@ -0,0 +1,252 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+#include "ck/library/utility/profile_report.hpp"
+
+namespace ck {
+namespace utils {
+
+void ProfileResults::Add(const ProfileRecord& record)
+{
+    for(auto& r : records_)
+    {
+        if(r.family_ == record.family_ && r.problem_ == record.problem_)
+        {
+            r.count_ += record.count_;
+            r.ave_time_ = std::min(r.ave_time_, record.ave_time_);
+            return;
+        }
+    }
+
+    records_.push_back(record);
+}
+
+const ProfileRecord* ProfileResults::Find(const std::string& family,
+                                          const std::string& problem) const
+{
+    for(const auto& r : records_)
+    {
+        if(r.family_ == family && r.problem_ == problem)
+            return &r;
+    }
+
+    return nullptr;
+}
+
+std::size_t ProfileResults::Load(std::istream& is)
+{
+    std::size_t num_records = 0;
+    std::string line;
+
+    while(std::getline(is, line))
+    {
+        if(line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream line_is(line);
+
+        std::vector<std::string> fields;
+
+        for(std::string field; std::getline(line_is, field, '\t');)
+            fields.push_back(field);
+
+        if(fields.size() != 5)
+            throw std::runtime_error("wrong! invalid profile record \"" + line + "\"");
+
+        Add({fields[0],
+             fields[1],
+             std::stoull(fields[2]),
+             std::stof(fields[3]),
+             static_cast<std::size_t>(std::stoull(fields[4]))});
+
+        ++num_records;
+    }
+
+    return num_records;
+}
+
+void ProfileResults::Save(std::ostream& os) const
+{
+    os << "# family\tproblem\tcount\tave_time\tflop\n";
+
+    for(const auto& r : records_)
+    {
+        os << r.family_ << "\t" << r.problem_ << "\t" << r.count_ << "\t" << r.ave_time_ << "\t"
+           << r.flop_ << "\n";
+    }
+}
+
+void append_profile_record(const std::string& file_name, const ProfileRecord& record)
+{
+    std::ofstream os(file_name, std::ios::app);
+
+    if(!os)
+        throw std::runtime_error("wrong! cannot open " + file_name + " for writing");
+
+    os << record.family_ << "\t" << record.problem_ << "\t" << record.count_ << "\t"
+       << record.ave_time_ << "\t" << record.flop_ << "\n";
+}
+
+ProfileReport make_profile_report(const ProfileResults& results)
+{
+    ProfileReport report{0, 0, {}};
+
+    for(const auto& r : results.GetRecords())
+    {
+        auto family = std::find_if(report.families_.begin(),
+                                   report.families_.end(),
+                                   [&](const auto& f) { return f.family_ == r.family_; });
+
+        if(family == report.families_.end())
+            family = report.families_.insert(family, {r.family_, 0, 0, 0, 0, 0});
+
+        family->num_problems_ += 1;
+        family->count_ += r.count_;
+        family->time_ += r.count_ * static_cast<double>(r.ave_time_);
+        family->flop_ += r.count_ * r.flop_;
+
+        report.time_ += r.count_ * static_cast<double>(r.ave_time_);
+        report.flop_ += r.count_ * r.flop_;
+    }
+
+    for(auto& family : report.families_)
+        family.share_ = report.time_ > 0 ? family.time_ / report.time_ : 0;
+
+    std::stable_sort(report.families_.begin(),
+                     report.families_.end(),
+                     [](const auto& a, const auto& b) { return a.time_ > b.time_; });
+
+    return report;
+}
+
+bool ProfileDiff::HasRegression() const
+{
+    return !regressions_.empty() || time_ > base_time_ * (1 + threshold_);
+}
+
+ProfileDiff
+diff_profile_results(const ProfileResults& base, const ProfileResults& results, double threshold)
+{
+    ProfileDiff diff{threshold, 0, 0, {}, {}, {}, {}};
+
+    for(const auto& r : results.GetRecords())
+    {
+        const ProfileRecord* base_r = base.Find(r.family_, r.problem_);
+
+        if(base_r == nullptr)
+        {
+            diff.added_.push_back(r);
+            continue;
+        }
+
+        diff.base_time_ += r.count_ * static_cast<double>(base_r->ave_time_);
+        diff.time_ += r.count_ * static_cast<double>(r.ave_time_);
+
+        const ProfileDiffRecord d{r.family_, r.problem_, r.count_, base_r->ave_time_, r.ave_time_};
+
+        if(r.ave_time_ > base_r->ave_time_ * (1 + threshold))
+            diff.regressions_.push_back(d);
+        else if(r.ave_time_ < base_r->ave_time_ * (1 - threshold))
+            diff.improvements_.push_back(d);
+    }
+
+    for(const auto& base_r : base.GetRecords())
+    {
+        if(results.Find(base_r.family_, base_r.problem_) == nullptr)
+            diff.missing_.push_back(base_r);
+    }
+
+    auto get_weighted_change = [](const ProfileDiffRecord& d) {
+        return d.count_ * std::abs(static_cast<double>(d.ave_time_) - d.base_ave_time_);
+    };
+
+    for(auto* records : {&diff.regressions_, &diff.improvements_})
+    {
+        std::stable_sort(records->begin(), records->end(), [&](const auto& a, const auto& b) {
+            return get_weighted_change(a) > get_weighted_change(b);
+        });
+    }
+
+    return diff;
+}
+
+} // namespace utils
+} // namespace ck
+
+namespace {
+
+std::string get_percent_string(double ratio, bool show_sign = false)
+{
+    std::ostringstream ss;
+
+    ss << std::fixed << std::setprecision(1) << (show_sign ? std::showpos : std::noshowpos)
+       << 100 * ratio << "%";
+
+    return ss.str();
+}
+
+} // namespace
+
+std::ostream& operator<<(std::ostream& os, const ck::utils::ProfileReport& report)
+{
+    os << "ProfileReport {";
+
+    for(const auto& family : report.families_)
+    {
+        os << "\n"
+           << family.family_ << ": " << family.num_problems_ << " problems, " << family.count_
+           << " runs, " << family.time_ << " ms, " << get_percent_string(family.share_);
+
+        if(family.time_ > 0 && family.flop_ > 0)
+            os << ", " << family.flop_ / 1.E9 / family.time_ << " TFlops";
+    }
+
+    os << "\ntime: " << report.time_ << " ms";
+
+    if(report.time_ > 0)
+        os << "\ntflops: " << report.flop_ / 1.E9 / report.time_;
+
+    os << "\n}\n";
+
+    return os;
+}
+
+std::ostream& operator<<(std::ostream& os, const ck::utils::ProfileDiff& diff)
+{
+    auto print_records = [&](const char* name, const auto& records) {
+        for(const auto& d : records)
+        {
+            os << "\n"
+               << name << ": " << d.family_ << " " << d.problem_ << " x" << d.count_ << ", "
+               << d.base_ave_time_ << " ms -> " << d.ave_time_ << " ms";
+        }
+    };
+
+    os << "ProfileDiff {";
+
+    print_records("regression", diff.regressions_);
+    print_records("improvement", diff.improvements_);
+
+    for(const auto& r : diff.missing_)
+        os << "\nmissing: " << r.family_ << " " << r.problem_;
+
+    for(const auto& r : diff.added_)
+        os << "\nadded: " << r.family_ << " " << r.problem_;
+
+    os << "\ntime: " << diff.base_time_ << " ms -> " << diff.time_ << " ms";
+
+    if(diff.base_time_ > 0)
+        os << " (" << get_percent_string(diff.time_ / diff.base_time_ - 1, true) << ")";
+
+    os << "\nthreshold: " << get_percent_string(diff.threshold_)
+       << "\nregression: " << (diff.HasRegression() ? "yes" : "no") << "\n}\n";
+
+    return os;
+}
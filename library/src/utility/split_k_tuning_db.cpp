@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <regex>
+#include <tuple>
+
+#include "ck/library/utility/split_k_tuning_db.hpp"
+
+namespace ck {
+namespace utils {
+
+std::size_t SplitKTuningDb::Load(std::istream& is)
+{
+    // "Perf: <time> ms, <tflops> TFlops, <bandwidth> GB/s, <op name>, KBatch <k_batch>", the op
+    // name may be followed by ", instance id <id>"
+    const std::regex perf_regex(R"(^Perf:\s*(\S+) ms, .* GB/s, (.*), KBatch (-?[0-9]+)\s*$)");
+    const std::regex best_regex(R"(^Best Perf .* M = ([0-9]+) N = ([0-9]+) K = ([0-9]+) )");
+
+    const std::string instance_id = ", instance id ";
+
+    std::vector<SplitKSweepRecord> pending;
+    std::size_t num_added = 0;
+    std::string line;
+
+    while(std::getline(is, line))
+    {
+        std::smatch match;
+
+        if(std::regex_search(line, match, perf_regex))
+        {
+            std::string op_name = match[2];
+
+            op_name = op_name.substr(0, op_name.find(instance_id));
+
+            pending.push_back({0, 0, 0, op_name, std::stoi(match[3]), std::stof(match[1].str())});
+        }
+        else if(std::regex_search(line, match, best_regex))
+        {
+            for(auto& record : pending)
+            {
+                record.M_ = std::stoi(match[1]);
+                record.N_ = std::stoi(match[2]);
+                record.K_ = std::stoi(match[3]);
+
+                Add(record);
+            }
+
+            num_added += pending.size();
+            pending.clear();
+        }
+    }
+
+    return num_added;
+}
+
+ck::index_t SplitKTuningDb::FindBestKBatch(ck::index_t M,
+                                           ck::index_t N,
+                                           ck::index_t K,
+                                           const std::string& op_name) const
+{
+    ck::index_t best_k_batch = 0;
+    float best_time          = std::numeric_limits<float>::max();
+
+    for(const auto& record : records_)
+    {
+        if(record.M_ == M && record.N_ == N && record.K_ == K && record.op_name_ == op_name &&
+           record.k_batch_ > 0 && record.ave_time_ < best_time)
+        {
+            best_k_batch = record.k_batch_;
+            best_time    = record.ave_time_;
+        }
+    }
+
+    return best_k_batch;
+}
+
+bool get_split_k_tile(const std::string& op_name, SplitKTile& tile)
+{
+    // "..._<MPerBlock>x<NPerBlock>x<K0PerBlock>x<K1> LoopScheduler: ..."
+    const std::regex tile_regex(R"(_([0-9]+)x([0-9]+)x([0-9]+)x([0-9]+) LoopScheduler)");
+
+    std::smatch match;
+
+    if(!std::regex_search(op_name, match, tile_regex))
+        return false;
+
+    tile.MPerBlock_ = std::stoi(match[1]);
+    tile.NPerBlock_ = std::stoi(match[2]);
+    tile.KPerBlock_ = std::stoi(match[3]) * std::stoi(match[4]);
+    // "GemmXdlSplitKCShuffle_<GemmSpec>_..."
+    tile.PadK_ = std::regex_search(op_name, std::regex("^GemmXdlSplitKCShuffle_[A-Z]*KPadding_"));
+
+    return true;
+}
+
+ck::index_t select_k_batch(const SplitKTuningDb& db,
+                           const std::string& op_name,
+                           const SplitKProblem& problem,
+                           const SplitKTile& tile,
+                           const SplitKCostModel& model)
+{
+    if(problem.G_ == 1)
+    {
+        const ck::index_t k_batch = db.FindBestKBatch(problem.M_, problem.N_, problem.K_, op_name);
+
+        if(k_batch > 0)
+            return k_batch;
+    }
+
+    return ck::tensor_operation::device::select_k_batch(problem, tile, model);
+}
+
+SplitKModelReport evaluate_split_k_model(const SplitKTuningDb& db, const SplitKCostModel& model)
+{
+    // the recorded times of every (problem, instance) sweep, by k_batch
+    std::map<std::tuple<ck::index_t, ck::index_t, ck::index_t, std::string>,
+             std::map<ck::index_t, float>>
+        sweeps;
+
+    for(const auto& record : db.GetRecords())
+    {
+        if(record.k_batch_ > 0)
+        {
+            sweeps[std::make_tuple(record.M_, record.N_, record.K_, record.op_name_)]
+                  [record.k_batch_] = record.ave_time_;
+        }
+    }
+
+    SplitKModelReport report{0, 0, 0.f, 0.f};
+
+    for(const auto& [key, times] : sweeps)
+    {
+        SplitKTile tile;
+
+        if(!get_split_k_tile(std::get<3>(key), tile))
+            continue;
+
+        const SplitKProblem problem{1, std::get<0>(key), std::get<1>(key), std::get<2>(key)};
+
+        ck::index_t model_k_batch = 0;
+        float model_cost          = std::numeric_limits<float>::max();
+        float best_time           = std::numeric_limits<float>::max();
+
+        for(const auto& [k_batch, time] : times)
+        {
+            const float cost =
+                ck::tensor_operation::device::get_split_k_cost(problem, tile, model, k_batch);
+
+            if(cost < model_cost)
+            {
+                model_k_batch = k_batch;
+                model_cost    = cost;
+            }
+
+            best_time = std::min(best_time, time);
+        }
+
+        const float slowdown = times.at(model_k_batch) / best_time;
+
+        report.num_sweeps_++;
+        report.num_best_ += slowdown <= 1.f ? 1 : 0;
+        report.mean_slowdown_ += slowdown;
+        report.max_slowdown_ = std::max(report.max_slowdown_, slowdown);
+    }
+
+    if(report.num_sweeps_ > 0)
+        report.mean_slowdown_ /= static_cast<float>(report.num_sweeps_);
+
+    return report;
+}
+
+} // namespace utils
+} // namespace ck
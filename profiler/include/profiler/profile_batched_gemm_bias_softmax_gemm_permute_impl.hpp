@@ -17,8 +17,7 @@
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
-#include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
-#include "ck/library/reference_tensor_operation/cpu/reference_softmax.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm_softmax_gemm.hpp"
 
 namespace ck {
 namespace profiler {
@@ -61,27 +60,21 @@ bool profile_batched_gemm_bias_softmax_gemm_permute_impl(bool do_verification,
     using D0DataType    = tuple_element_t<0, Acc0BiasesDataType>;
     using tensor_operation::device::MaskingSpecialization;
 
-    // Ref Gemm0: various type in, fp32 out
-    using ReferenceGemm0Instance = tensor_operation::host::ReferenceBatchedGemm<ADataType,
-                                                                                B0DataType,
-                                                                                AccDataType,
-                                                                                AccDataType,
-                                                                                AElementOp,
-                                                                                B0ElementOp,
-                                                                                Acc0ElementOp>;
-
-    // Ref Softmax: fp32 in, various type out
-    using ReferenceSoftmaxInstance =
-        tensor_operation::host::ReferenceSoftmax<AccDataType, ADataType, AccDataType>;
-
-    // Ref Gemm1: various type in, various type out
-    using ReferenceGemm1Instance = tensor_operation::host::ReferenceBatchedGemm<ADataType,
-                                                                                B1DataType,
-                                                                                CDataType,
-                                                                                AccDataType,
-                                                                                AElementOp,
-                                                                                B1ElementOp,
-                                                                                CElementOp>;
+    // Ref Gemm0 + bias + Softmax + Gemm1, blocked online softmax
+    using ReferenceInstance =
+        tensor_operation::host::ReferenceBatchedGemmSoftmaxGemm<ADataType,
+                                                                B0DataType,
+                                                                B1DataType,
+                                                                CDataType,
+                                                                AccDataType,
+                                                                AElementOp,
+                                                                B0ElementOp,
+                                                                Acc0ElementOp,
+                                                                B1ElementOp,
+                                                                CElementOp,
+                                                                MaskingSpec,
+                                                                D0DataType,
+                                                                C0DEElementOp>;
 
     bool pass = true;
 
@@ -210,9 +203,7 @@ bool profile_batched_gemm_bias_softmax_gemm_permute_impl(bool do_verification,
         Tensor<ADataType> a_g_m_k({BatchCount, M, K});
         Tensor<B0DataType> b0_g_k_n({BatchCount, K, N});
         Tensor<B1DataType> b1_g_n_o({BatchCount, N, O});
-        Tensor<AccDataType> acc0_g_m_n({BatchCount, M, N});        // scratch object after gemm0
-        Tensor<ADataType> a1_g_m_n({BatchCount, M, N});            // scratch object after softmax
-        Tensor<CDataType> c_g_m_o_host_result({BatchCount, M, O}); // scratch object after gemm1
+        Tensor<CDataType> c_g_m_o_host_result({BatchCount, M, O});
         Tensor<D0DataType> d0_g_m_n({BatchCount, M, N});
 
         // permute
@@ -229,34 +220,21 @@ bool profile_batched_gemm_bias_softmax_gemm_permute_impl(bool do_verification,
             d0_g_m_n(idx[0] * G1 + idx[1], idx[2], idx[3]) = self(idx);
         });
 
-        auto ref_gemm0          = ReferenceGemm0Instance{};
-        auto ref_gemm0_invoker  = ref_gemm0.MakeInvoker();
-        auto ref_gemm0_argument = ref_gemm0.MakeArgument(
-            a_g_m_k, b0_g_k_n, acc0_g_m_n, a_element_op, b0_element_op, acc0_element_op);
-
-        ref_gemm0_invoker.Run(ref_gemm0_argument);
-
-        acc0_g_m_n.ForEach([&](auto&, auto idx) {
-            c0de_element_op(acc0_g_m_n(idx), acc0_g_m_n(idx), d0_g_m_n(idx));
-        });
-        // mask out upper triangle
-        acc0_g_m_n.ForEach([&](auto& self, auto idx) {
-            if(MaskingSpec == MaskingSpecialization::MaskOutUpperTriangle && idx[1] < idx[2])
-                self(idx) = -ck::NumericLimits<float>::Infinity();
-        });
-
-        auto ref_softmax          = ReferenceSoftmaxInstance{};
-        auto ref_softmax_invoker  = ref_softmax.MakeInvoker();
-        auto ref_softmax_argument = ref_softmax.MakeArgument(acc0_g_m_n, a1_g_m_n, 1, 0, {2});
-
-        ref_softmax_invoker.Run(ref_softmax_argument);
-
-        auto ref_gemm1          = ReferenceGemm1Instance{};
-        auto ref_gemm1_invoker  = ref_gemm1.MakeInvoker();
-        auto ref_gemm1_argument = ref_gemm1.MakeArgument(
-            a1_g_m_n, b1_g_n_o, c_g_m_o_host_result, PassThrough{}, b1_element_op, c_element_op);
-
-        ref_gemm1_invoker.Run(ref_gemm1_argument);
+        auto ref_attention          = ReferenceInstance{};
+        auto ref_attention_invoker  = ref_attention.MakeInvoker();
+        auto ref_attention_argument = ref_attention.MakeArgument(a_g_m_k,
+                                                                 b0_g_k_n,
+                                                                 b1_g_n_o,
+                                                                 c_g_m_o_host_result,
+                                                                 d0_g_m_n,
+                                                                 a_element_op,
+                                                                 b0_element_op,
+                                                                 acc0_element_op,
+                                                                 c0de_element_op,
+                                                                 b1_element_op,
+                                                                 c_element_op);
+
+        ref_attention_invoker.Run(ref_attention_argument);
 
         // permute
         c_gs_ms_os_host_result.ForEach([&](auto& self, auto idx) {
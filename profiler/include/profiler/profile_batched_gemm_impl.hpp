@@ -13,6 +13,7 @@
 
 #include "ck/library/tensor_operation_instance/gpu/batched_gemm.hpp"
 #include "ck/library/tensor_operation_instance/gpu/batched_gemm_multi_d.hpp"
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
 
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
@@ -77,6 +78,8 @@ bool profile_batched_gemm_impl(int do_verification,
         f_host_tensor_descriptor(BatchCount, M, N, StrideC, BatchStrideC, CLayout{}));
     Tensor<CDataType> c_g_m_n_device_result(
         f_host_tensor_descriptor(BatchCount, M, N, StrideC, BatchStrideC, CLayout{}));
+    Tensor<double> c_g_m_n_err_bound(
+        f_host_tensor_descriptor(BatchCount, M, N, StrideC, BatchStrideC, CLayout{}));
 
     std::cout << "a_g_m_k: " << a_g_m_k.mDesc << std::endl;
     std::cout << "b_g_k_n: " << b_g_k_n.mDesc << std::endl;
@@ -112,8 +115,13 @@ bool profile_batched_gemm_impl(int do_verification,
         auto ref_batched_gemm = ReferenceBatchedGemmInstance{};
         auto ref_invoker      = ref_batched_gemm.MakeInvoker();
 
-        auto ref_argument = ref_batched_gemm.MakeArgument(
-            a_g_m_k, b_g_k_n, c_g_m_n_host_result, a_element_op, b_element_op, c_element_op);
+        auto ref_argument = ref_batched_gemm.MakeArgument(a_g_m_k,
+                                                          b_g_k_n,
+                                                          c_g_m_n_host_result,
+                                                          c_g_m_n_err_bound,
+                                                          a_element_op,
+                                                          b_element_op,
+                                                          c_element_op);
 
         ref_invoker.Run(ref_argument);
     }
@@ -204,7 +212,9 @@ bool profile_batched_gemm_impl(int do_verification,
             // re-init C to zero before profiling next kernel
             c_device_buf.SetZero();
 
-            std::string op_name = op_ptr->GetTypeString();
+            std::string op_name =
+                op_ptr->GetTypeString() + ", instance id " +
+                ck::tensor_operation::device::instance::get_instance_id_string(*op_ptr);
 
             float ave_time =
                 invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
@@ -234,7 +244,8 @@ bool profile_batched_gemm_impl(int do_verification,
             {
                 c_device_buf.FromDevice(c_g_m_n_device_result.mData.data());
 
-                pass = pass & ck::utils::check_err(c_g_m_n_device_result, c_g_m_n_host_result);
+                pass = pass & ck::utils::check_err(
+                                  c_g_m_n_device_result, c_g_m_n_host_result, c_g_m_n_err_bound);
 
                 if(do_log)
                 {
@@ -5,6 +5,7 @@
 
 #include <iomanip>
 #include <iostream>
+#include <string>
 #include <typeinfo>
 #include <unistd.h>
 
@@ -14,11 +15,13 @@
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 
 #include "ck/library/tensor_operation_instance/gpu/gemm.hpp"
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
 
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_tensor_io.hpp"
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 #include "ck/library/utility/fill.hpp"
@@ -42,7 +45,10 @@ int profile_gemm_impl(int do_verification,
                       int K,
                       int StrideA,
                       int StrideB,
-                      int StrideC)
+                      int StrideC,
+                      const std::string& a_file_name = "",
+                      const std::string& b_file_name = "",
+                      float* p_best_avg_time         = nullptr)
 {
     bool pass = true;
 
@@ -64,25 +70,32 @@ int profile_gemm_impl(int do_verification,
     Tensor<BDataType> b_k_n(f_host_tensor_descriptor(K, N, StrideB, BLayout{}));
     Tensor<CDataType> c_m_n_host_result(f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
     Tensor<CDataType> c_m_n_device_result(f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
+    Tensor<double> c_m_n_err_bound(f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
 
     std::cout << "a_m_k: " << a_m_k.mDesc << std::endl;
     std::cout << "b_k_n: " << b_k_n.mDesc << std::endl;
     std::cout << "c_m_n: " << c_m_n_device_result.mDesc << std::endl;
 
-    switch(init_method)
-    {
-    case 0:
-        ck::utils::FillConstant<ADataType>{static_cast<ADataType>(1.f)}(a_m_k);
-        ck::utils::FillConstant<BDataType>{static_cast<BDataType>(1.f)}(b_k_n);
-        break;
-    case 1:
-        ck::utils::FillUniformDistributionIntegerValue<ADataType>{-5.f, 5.f}(a_m_k);
-        ck::utils::FillUniformDistributionIntegerValue<BDataType>{-5.f, 5.f}(b_k_n);
-        break;
-    default:
-        ck::utils::FillUniformDistribution<ADataType>{-1.f, 1.f}(a_m_k);
-        ck::utils::FillUniformDistribution<BDataType>{-1.f, 1.f}(b_k_n);
-    }
+    // recorded [M, K] and [K, N] operands, in any memory layout, replace the initialization
+    auto init_tensor = [&](auto& tensor, const std::string& file_name) {
+        using DataType = typename decltype(tensor.mData)::value_type;
+
+        if(!file_name.empty())
+        {
+            ck::utils::load_tensor(file_name, tensor);
+            return;
+        }
+
+        switch(init_method)
+        {
+        case 0: ck::utils::FillConstant<DataType>{static_cast<DataType>(1.f)}(tensor); break;
+        case 1: ck::utils::FillUniformDistributionIntegerValue<DataType>{-5.f, 5.f}(tensor); break;
+        default: ck::utils::FillUniformDistribution<DataType>{-1.f, 1.f}(tensor);
+        }
+    };
+
+    init_tensor(a_m_k, a_file_name);
+    init_tensor(b_k_n, b_file_name);
 
     using AElementOp = ck::tensor_operation::element_wise::PassThrough;
     using BElementOp = ck::tensor_operation::element_wise::PassThrough;
@@ -129,8 +142,13 @@ int profile_gemm_impl(int do_verification,
         auto ref_op      = ReferenceGemmInstance{};
         auto ref_invoker = ref_op.MakeInvoker();
 
-        auto ref_argument = ref_op.MakeArgument(
-            a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
+        auto ref_argument = ref_op.MakeArgument(a_m_k,
+                                                b_k_n,
+                                                c_m_n_host_result,
+                                                c_m_n_err_bound,
+                                                a_element_op,
+                                                b_element_op,
+                                                c_element_op);
 
         ref_invoker.Run(ref_argument);
     }
@@ -163,7 +181,9 @@ int profile_gemm_impl(int do_verification,
             // re-init C to zero before profiling next kernel
             c_device_buf.SetZero();
 
-            std::string op_name = op_ptr->GetTypeString();
+            std::string op_name =
+                op_ptr->GetTypeString() + ", instance id " +
+                ck::tensor_operation::device::instance::get_instance_id_string(*op_ptr);
 
             float avg_time =
                 invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel, 0, 10, 50});
@@ -190,7 +210,8 @@ int profile_gemm_impl(int do_verification,
             {
                 c_device_buf.FromDevice(c_m_n_device_result.mData.data());
 
-                pass = pass & ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
+                pass = pass & ck::utils::check_err(
+                                  c_m_n_device_result, c_m_n_host_result, c_m_n_err_bound);
 
                 if(do_log)
                 {
@@ -234,7 +255,9 @@ int profile_gemm_impl(int do_verification,
 
         if(op_ptr->IsSupportedArgument(argument_ptr.get()))
         {
-            std::string op_name = op_ptr->GetTypeString();
+            std::string op_name =
+                op_ptr->GetTypeString() + ", instance id " +
+                ck::tensor_operation::device::instance::get_instance_id_string(*op_ptr);
 
             float avg_time = invoker_ptr->Run(argument_ptr.get(),
                                               StreamConfig{nullptr, time_kernel, 0, 50, 200});
@@ -293,6 +316,9 @@ int profile_gemm_impl(int do_verification,
                       << " StrideB = " << StrideB << " StrideC = " << StrideC << " : " << avg_time
                       << " ms, " << tflops << " TFlops, " << gb_per_sec << " GB/s, " << op_name
                       << std::endl;
+
+            if(p_best_avg_time != nullptr)
+                *p_best_avg_time = avg_time;
         }
     }
 
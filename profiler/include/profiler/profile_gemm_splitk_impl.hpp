@@ -13,6 +13,7 @@
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 
 #include "ck/library/tensor_operation_instance/gpu/gemm_splitk.hpp"
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
 
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
@@ -145,7 +146,7 @@ bool profile_gemm_splitk_impl(int do_verification,
     {
         std::vector<int> kbatch_list = {1, 2, 4, 8, 12, 16, 20, 32, 36, 40, 64, 96, 128};
 
-        if(KBatch > 0)
+        if(KBatch > 0 || KBatch == ck::tensor_operation::device::KBatchAuto)
         {
             kbatch_list = {KBatch};
         }
@@ -173,6 +174,8 @@ bool profile_gemm_splitk_impl(int do_verification,
 
             if(op_ptr->IsSupportedArgument(argument_ptr.get()))
             {
+                // the split actually run, KBatchAuto is resolved by the instance
+                kbatch_curr = op_ptr->GetKBatch(argument_ptr.get());
 
                 // re-init C to zero before profiling next kernel
                 c_device_buf.SetZero();
@@ -198,7 +201,9 @@ bool profile_gemm_splitk_impl(int do_verification,
                     }
                 }
 
-                std::string op_name = op_ptr->GetTypeString();
+                std::string op_name =
+                    op_ptr->GetTypeString() + ", instance id " +
+                    ck::tensor_operation::device::instance::get_instance_id_string(*op_ptr);
 
                 float ave_time =
                     invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
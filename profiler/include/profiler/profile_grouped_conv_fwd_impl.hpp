@@ -12,6 +12,7 @@
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 
 #include "ck/library/tensor_operation_instance/gpu/grouped_convolution_forward.hpp"
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
 
 #include "ck/library/utility/algorithm.hpp"
 #include "ck/library/utility/check_err.hpp"
@@ -36,7 +37,8 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
                                    int init_method,
                                    bool do_log,
                                    bool time_kernel,
-                                   const ck::utils::conv::ConvParam& conv_param)
+                                   const ck::utils::conv::ConvParam& conv_param,
+                                   float* p_best_avg_time = nullptr)
 {
     using InElementOp  = ck::tensor_operation::element_wise::PassThrough;
     using WeiElementOp = ck::tensor_operation::element_wise::PassThrough;
@@ -83,6 +85,7 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
     Tensor<WeiDataType> weight(wei_g_k_c_xs_desc);
     Tensor<OutDataType> host_output(out_g_n_k_wos_desc);
     Tensor<OutDataType> device_output(out_g_n_k_wos_desc);
+    Tensor<double> output_err_bound(out_g_n_k_wos_desc);
 
     std::cout << "input: " << input.mDesc << std::endl;
     std::cout << "weight: " << weight.mDesc << std::endl;
@@ -122,6 +125,7 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
         auto ref_argument = ref_conv.MakeArgument(input,
                                                   weight,
                                                   host_output,
+                                                  output_err_bound,
                                                   conv_param.conv_filter_strides_,
                                                   conv_param.conv_filter_dilations_,
                                                   conv_param.input_left_pads_,
@@ -150,7 +154,9 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
             // re-init output to zero before profiling next kernel
             out_device_buf.SetZero();
 
-            std::string op_name = op_ptr->GetTypeString();
+            std::string op_name =
+                op_ptr->GetTypeString() + ", instance id " +
+                ck::tensor_operation::device::instance::get_instance_id_string(*op_ptr);
 
             auto invoker_ptr = op_ptr->MakeInvokerPointer();
 
@@ -179,7 +185,7 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
             {
                 out_device_buf.FromDevice(device_output.mData.data());
 
-                pass = pass & ck::utils::check_err(device_output, host_output);
+                pass = pass & ck::utils::check_err(device_output, host_output, output_err_bound);
 
                 if(do_log)
                 {
@@ -246,6 +252,9 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
               << "\nname: " << best_op_name << "\navg_time: " << best_avg_time
               << "\ntflops: " << best_tflops << "\nGB/s: " << best_gb_per_sec << std::endl;
 
+    if(p_best_avg_time != nullptr)
+        *p_best_avg_time = best_avg_time;
+
     return pass;
 }
 
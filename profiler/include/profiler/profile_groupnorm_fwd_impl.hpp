@@ -29,7 +29,8 @@ bool profile_groupnorm_impl(int do_verification,
                             int init_method,
                             bool do_log,
                             bool time_kernel,
-                            std::vector<index_t> length)
+                            std::vector<index_t> length,
+                            float* p_best_avg_time = nullptr)
 {
     using PassThrough = ck::tensor_operation::element_wise::PassThrough;
 
@@ -267,6 +268,9 @@ bool profile_groupnorm_impl(int do_verification,
         return false;
     }
 
+    if(p_best_avg_time != nullptr && time_kernel)
+        *p_best_avg_time = best_avg_time;
+
     return true;
 }
 
@@ -53,7 +53,8 @@ bool profile_softmax_impl(int do_verification,
                           std::vector<index_t> in_strides,
                           std::vector<index_t> reduce_dims,
                           double alpha,
-                          double beta)
+                          double beta,
+                          float* p_best_avg_time = nullptr)
 {
     if(Rank != in_length.size())
     {
@@ -218,6 +219,9 @@ bool profile_softmax_impl(int do_verification,
         std::cout << "alpha = " << alpha << ", "
                   << "beta = " << beta << ", " << best_avg_time << " ms, " << best_gb_per_sec
                   << " GB/s, " << best_instance_name << std::endl;
+
+        if(p_best_avg_time != nullptr && !best_instance_name.empty())
+            *p_best_avg_time = best_avg_time;
     }
     return std::all_of(
         std::begin(instance_pass), std::end(instance_pass), [](bool p) { return p; });
@@ -17,6 +17,7 @@
 
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_permute.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
@@ -24,20 +25,6 @@
 namespace ck {
 namespace profiler {
 
-template <typename HostTensorA, typename HostTensorB, typename Functor>
-void host_elementwise4D(HostTensorB& B_nchwd, const HostTensorA& A_ncdhw, Functor functor)
-{
-    for(std::size_t n = 0; n < A_ncdhw.mDesc.GetLengths()[0]; ++n)
-        for(std::size_t c = 0; c < A_ncdhw.mDesc.GetLengths()[1]; ++c)
-            for(std::size_t d = 0; d < A_ncdhw.mDesc.GetLengths()[2]; ++d)
-                for(std::size_t h = 0; h < A_ncdhw.mDesc.GetLengths()[3]; ++h)
-                    for(std::size_t w = 0; w < A_ncdhw.mDesc.GetLengths()[4]; ++w)
-                    {
-                        auto a_val = A_ncdhw(n, c, d, h, w);
-                        functor(B_nchwd(n, c, h, w, d), a_val);
-                    }
-}
-
 template <typename ADataType, typename BDataType, index_t NumDim>
 bool profile_transpose_impl(int do_verification,
                             int init_method,
@@ -57,7 +44,7 @@ bool profile_transpose_impl(int do_verification,
     std::vector<ck::index_t> ndhwc = {N, D, H, W, C};
     Tensor<ADataType> a(ncdhw);
     Tensor<BDataType> b(ndhwc);
-    Tensor<BDataType> host_b(ndhwc);
+    Tensor<BDataType> host_b(std::vector<ck::index_t>{N, C, H, W, D});
 
     // a.GenerateTensorValue(GeneratorTensor_3<ADataType>{0.0, 1.0});
 
@@ -97,7 +84,8 @@ bool profile_transpose_impl(int do_verification,
 
     if(do_verification)
     {
-        host_elementwise4D(host_b, a, ElementOp{});
+        // NCDHW to NCHWD, the layout of b_strides
+        ck::utils::host_permute(a, std::array<std::size_t, 5>{0, 1, 3, 4, 2}, host_b, ElementOp{});
     }
 
     std::string best_op_name;
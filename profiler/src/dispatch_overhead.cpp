@@ -0,0 +1,657 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+// Host cost of dispatching a device operation: GetInstances(), and MakeArgumentPointer(),
+// IsSupportedArgument(), GetWorkSpaceSize() and MakeInvokerPointer() on every instance of the
+// factory, for a representative inference problem per instance family. Reports ns and heap
+// allocations per call. No kernel is launched and the pointers are never dereferenced, a GPU is
+// only queried by the IsSupportedArgument() of instances that check the device.
+//
+// --output <file> writes "<family> <call> <ns> <allocations>" lines, --baseline <file> compares
+// against such a file and returns non-zero if a call allocates more often. Calls slower by more
+// than --tolerance are only reported, timings are too noisy on shared machines to fail on.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/batched_gemm.hpp"
+#include "ck/library/tensor_operation_instance/gpu/gemm.hpp"
+#include "ck/library/tensor_operation_instance/gpu/gemm_splitk.hpp"
+#include "ck/library/tensor_operation_instance/gpu/grouped_convolution_backward_data.hpp"
+#include "ck/library/tensor_operation_instance/gpu/grouped_convolution_backward_weight.hpp"
+#include "ck/library/tensor_operation_instance/gpu/grouped_convolution_forward.hpp"
+#include "ck/library/tensor_operation_instance/gpu/normalization_fwd.hpp"
+#include "ck/library/tensor_operation_instance/gpu/softmax.hpp"
+#ifdef CK_ENABLE_FP16
+#include "ck/library/tensor_operation_instance/gpu/gemm_add_add_fastgelu.hpp"
+#endif
+
+// heap allocations of the whole executable, operator new is replaced below
+static std::atomic<std::size_t> num_allocation{0};
+
+void* operator new(std::size_t size)
+{
+    num_allocation.fetch_add(1, std::memory_order_relaxed);
+
+    if(void* p = std::malloc(size == 0 ? 1 : size))
+        return p;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+using ck::index_t;
+
+using F16 = ck::half_t;
+using F32 = float;
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+using ck::tensor_layout::convolution::GKYXC;
+using ck::tensor_layout::convolution::GNHWC;
+using ck::tensor_layout::convolution::GNHWK;
+using ck::tensor_layout::convolution::NHWGC;
+using ck::tensor_layout::convolution::NHWGK;
+
+using PassThrough    = ck::tensor_operation::element_wise::PassThrough;
+using AddAddFastGelu = ck::tensor_operation::element_wise::AddAddFastGelu;
+
+namespace device = ck::tensor_operation::device;
+
+struct CallOverhead
+{
+    double ns_         = 0;
+    double allocation_ = 0;
+
+    CallOverhead& operator+=(const CallOverhead& rhs)
+    {
+        ns_ += rhs.ns_;
+        allocation_ += rhs.allocation_;
+
+        return *this;
+    }
+};
+
+constexpr std::array<const char*, 5> call_names = {"GetInstances",
+                                                   "MakeArgumentPointer",
+                                                   "IsSupportedArgument",
+                                                   "GetWorkSpaceSize",
+                                                   "MakeInvokerPointer"};
+
+struct FamilyOverhead
+{
+    std::string family_;
+    std::size_t num_instance_  = 0;
+    std::size_t num_supported_ = 0;
+
+    // per call, averaged over the instances, in the order of call_names
+    std::array<CallOverhead, 5> calls_;
+};
+
+template <typename F>
+CallOverhead measure(F f, int num_iter)
+{
+    // warm up
+    f();
+
+    const std::size_t start_allocation = num_allocation.load();
+    const auto start                   = std::chrono::steady_clock::now();
+
+    for(int i = 0; i < num_iter; ++i)
+        f();
+
+    const auto end                   = std::chrono::steady_clock::now();
+    const std::size_t end_allocation = num_allocation.load();
+
+    return {std::chrono::duration<double, std::nano>(end - start).count() / num_iter,
+            static_cast<double>(end_allocation - start_allocation) / num_iter};
+}
+
+template <typename DeviceOp, typename MakeArgument>
+FamilyOverhead
+profile_dispatch_overhead(const std::string& family, MakeArgument make_argument, int num_iter)
+{
+    using Factory = device::instance::DeviceOperationInstanceFactory<DeviceOp>;
+
+    FamilyOverhead overhead{family, 0, 0, {}};
+
+    // a factory call constructs every instance, a few calls are enough
+    overhead.calls_[0] = measure([] { const auto op_ptrs = Factory::GetInstances(); },
+                                 std::max(num_iter / 100, 1));
+
+    const auto op_ptrs = Factory::GetInstances();
+
+    overhead.num_instance_ = op_ptrs.size();
+
+    for(const auto& op_ptr : op_ptrs)
+    {
+        auto& op = *op_ptr;
+
+        overhead.calls_[1] +=
+            measure([&] { const auto argument_ptr = make_argument(op); }, num_iter);
+
+        const auto argument_ptr = make_argument(op);
+
+        bool is_supported = false;
+
+        overhead.calls_[2] +=
+            measure([&] { is_supported = op.IsSupportedArgument(argument_ptr.get()); }, num_iter);
+
+        std::size_t workspace_size = 0;
+
+        overhead.calls_[3] +=
+            measure([&] { workspace_size += op.GetWorkSpaceSize(argument_ptr.get()); }, num_iter);
+
+        overhead.calls_[4] +=
+            measure([&] { const auto invoker_ptr = op.MakeInvokerPointer(); }, num_iter);
+
+        if(is_supported)
+            ++overhead.num_supported_;
+    }
+
+    for(std::size_t i = 1; i < overhead.calls_.size() && !op_ptrs.empty(); ++i)
+    {
+        overhead.calls_[i].ns_ /= op_ptrs.size();
+        overhead.calls_[i].allocation_ /= op_ptrs.size();
+    }
+
+    return overhead;
+}
+
+// a 3x3 convolution of a ResNet-50 stage at batch 1, 256 -> 256 channels on 14x14
+struct ConvProblem
+{
+    static constexpr index_t G  = 1;
+    static constexpr index_t N  = 1;
+    static constexpr index_t K  = 256;
+    static constexpr index_t C  = 256;
+    static constexpr index_t Y  = 3;
+    static constexpr index_t X  = 3;
+    static constexpr index_t Hi = 14;
+    static constexpr index_t Wi = 14;
+    static constexpr index_t Ho = 14;
+    static constexpr index_t Wo = 14;
+
+    // G, N, C, H, W lengths of NHWGC / GNHWC
+    std::array<index_t, 5> in_lengths_{G, N, C, Hi, Wi};
+    std::array<index_t, 5> nhwgc_in_strides_{C, Hi * Wi * G * C, 1, Wi * G * C, G * C};
+    std::array<index_t, 5> gnhwc_in_strides_{N * Hi * Wi * C, Hi * Wi * C, 1, Wi * C, C};
+    std::array<index_t, 5> wei_lengths_{G, K, C, Y, X};
+    std::array<index_t, 5> wei_strides_{K * Y * X * C, Y * X * C, 1, X * C, C};
+    std::array<index_t, 5> out_lengths_{G, N, K, Ho, Wo};
+    std::array<index_t, 5> nhwgk_out_strides_{K, Ho * Wo * G * K, 1, Wo * G * K, G * K};
+    std::array<index_t, 5> gnhwk_out_strides_{N * Ho * Wo * K, Ho * Wo * K, 1, Wo * K, K};
+
+    std::array<index_t, 2> filter_strides_{1, 1};
+    std::array<index_t, 2> filter_dilations_{1, 1};
+    std::array<index_t, 2> input_left_pads_{1, 1};
+    std::array<index_t, 2> input_right_pads_{1, 1};
+};
+
+std::vector<FamilyOverhead> profile_all_families(int num_iter)
+{
+    std::vector<FamilyOverhead> overheads;
+
+    // buffers of up to 5 tensors, never dereferenced
+    std::array<char, 5> buffers{};
+
+    void* p0 = &buffers[0];
+    void* p1 = &buffers[1];
+    void* p2 = &buffers[2];
+    void* p3 = &buffers[3];
+    void* p4 = &buffers[4];
+
+    // small-batch GEMM of a linear layer
+    constexpr index_t M = 16;
+    constexpr index_t N = 4096;
+    constexpr index_t K = 4096;
+
+    {
+        using DeviceOp =
+            device::DeviceGemm<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>;
+
+        overheads.push_back(profile_dispatch_overhead<DeviceOp>(
+            "gemm",
+            [&](DeviceOp& op) {
+                return op.MakeArgumentPointer(
+                    p0, p1, p2, M, N, K, K, N, N, PassThrough{}, PassThrough{}, PassThrough{});
+            },
+            num_iter));
+    }
+
+    {
+        using DeviceOp = device::
+            DeviceGemmSplitK<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>;
+
+        overheads.push_back(profile_dispatch_overhead<DeviceOp>(
+            "gemm_splitk",
+            [&](DeviceOp& op) {
+                return op.MakeArgumentPointer(
+                    p0, p1, p2, M, N, K, K, N, N, PassThrough{}, PassThrough{}, PassThrough{}, 4);
+            },
+            num_iter));
+    }
+
+#ifdef CK_ENABLE_FP16
+    {
+        using DeviceOp =
+            device::DeviceGemmMultipleD<Row,
+                                        Col,
+                                        ck::Tuple<Row, Row>,
+                                        Row,
+                                        F16,
+                                        F16,
+                                        ck::Tuple<F16, F16>,
+                                        F16,
+                                        PassThrough,
+                                        PassThrough,
+                                        AddAddFastGelu>;
+
+        overheads.push_back(profile_dispatch_overhead<DeviceOp>(
+            "gemm_add_add_fastgelu",
+            [&](DeviceOp& op) {
+                return op.MakeArgumentPointer(p0,
+                                              p1,
+                                              {p2, p3},
+                                              p4,
+                                              M,
+                                              N,
+                                              K,
+                                              K,
+                                              K,
+                                              {0, N},
+                                              N,
+                                              PassThrough{},
+                                              PassThrough{},
+                                              AddAddFastGelu{});
+            },
+            num_iter));
+    }
+#endif
+
+    {
+        using DeviceOp = device::
+            DeviceBatchedGemm<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>;
+
+        // attention scores of 16 heads, 128 tokens, head dimension 64
+        constexpr index_t Batch = 16;
+        constexpr index_t S     = 128;
+        constexpr index_t D     = 64;
+
+        overheads.push_back(profile_dispatch_overhead<DeviceOp>(
+            "batched_gemm",
+            [&](DeviceOp& op) {
+                return op.MakeArgumentPointer(p0,
+                                              p1,
+                                              p2,
+                                              S,
+                                              S,
+                                              D,
+                                              D,
+                                              S,
+                                              S,
+                                              S * D,
+                                              D * S,
+                                              S * S,
+                                              Batch,
+                                              PassThrough{},
+                                              PassThrough{},
+                                              PassThrough{});
+            },
+            num_iter));
+    }
+
+    const ConvProblem conv;
+
+    {
+        using DeviceOp = device::DeviceGroupedConvFwdMultipleABD<2,
+                                                                 NHWGC,
+                                                                 GKYXC,
+                                                                 ck::Tuple<>,
+                                                                 NHWGK,
+                                                                 F16,
+                                                                 F16,
+                                                                 ck::Tuple<>,
+                                                                 F16,
+                                                                 PassThrough,
+                                                                 PassThrough,
+                                                                 PassThrough>;
+
+        overheads.push_back(profile_dispatch_overhead<DeviceOp>(
+            "grouped_conv2d_fwd",
+            [&](DeviceOp& op) {
+                return op.MakeArgumentPointer(p0,
+                                              p1,
+                                              {},
+                                              p2,
+                                              conv.in_lengths_,
+                                              conv.nhwgc_in_strides_,
+                                              conv.wei_lengths_,
+                                              conv.wei_strides_,
+                                              {},
+                                              {},
+                                              conv.out_lengths_,
+                                              conv.nhwgk_out_strides_,
+                                              conv.filter_strides_,
+                                              conv.filter_dilations_,
+                                              conv.input_left_pads_,
+                                              conv.input_right_pads_,
+                                              PassThrough{},
+                                              PassThrough{},
+                                              PassThrough{});
+            },
+            num_iter));
+    }
+
+    {
+        using DeviceOp = device::DeviceGroupedConvBwdDataMultipleD<2,
+                                                                   GNHWK,
+                                                                   GKYXC,
+                                                                   ck::Tuple<>,
+                                                                   GNHWC,
+                                                                   F16,
+                                                                   F16,
+                                                                   ck::Tuple<>,
+                                                                   F16,
+                                                                   PassThrough,
+                                                                   PassThrough,
+                                                                   PassThrough>;
+
+        overheads.push_back(profile_dispatch_overhead<DeviceOp>(
+            "grouped_conv2d_bwd_data",
+            [&](DeviceOp& op) {
+                return op.MakeArgumentPointer(p0,
+                                              p1,
+                                              {},
+                                              p2,
+                                              conv.out_lengths_,
+                                              conv.gnhwk_out_strides_,
+                                              conv.wei_lengths_,
+                                              conv.wei_strides_,
+                                              {},
+                                              {},
+                                              conv.in_lengths_,
+                                              conv.gnhwc_in_strides_,
+                                              conv.filter_strides_,
+                                              conv.filter_dilations_,
+                                              conv.input_left_pads_,
+                                              conv.input_right_pads_,
+                                              PassThrough{},
+                                              PassThrough{},
+                                              PassThrough{});
+            },
+            num_iter));
+    }
+
+    {
+        using DeviceOp = device::DeviceGroupedConvBwdWeight<2,
+                                                            GNHWC,
+                                                            GKYXC,
+                                                            GNHWK,
+                                                            F16,
+                                                            F16,
+                                                            F16,
+                                                            PassThrough,
+                                                            PassThrough,
+                                                            PassThrough>;
+
+        overheads.push_back(profile_dispatch_overhead<DeviceOp>(
+            "grouped_conv2d_bwd_weight",
+            [&](DeviceOp& op) {
+                return op.MakeArgumentPointer(p0,
+                                              p1,
+                                              p2,
+                                              conv.in_lengths_,
+                                              conv.gnhwc_in_strides_,
+                                              conv.wei_lengths_,
+                                              conv.wei_strides_,
+                                              conv.out_lengths_,
+                                              conv.gnhwk_out_strides_,
+                                              conv.filter_strides_,
+                                              conv.filter_dilations_,
+                                              conv.input_left_pads_,
+                                              conv.input_right_pads_,
+                                              PassThrough{},
+                                              PassThrough{},
+                                              PassThrough{},
+                                              1);
+            },
+            num_iter));
+    }
+
+    {
+        using DeviceOp = device::DeviceSoftmax<F16, F32, F16, PassThrough, PassThrough, 3, 1>;
+
+        // attention probabilities of 16 heads, 128 tokens
+        const std::vector<index_t> lengths{16, 128, 128};
+        const std::vector<index_t> strides{128 * 128, 128, 1};
+        const std::vector<int> reduce_dims{2};
+
+        overheads.push_back(profile_dispatch_overhead<DeviceOp>(
+            "softmax",
+            [&](DeviceOp& op) {
+                return op.MakeArgumentPointer(
+                    lengths, strides, reduce_dims, 1, 0, p0, p1, PassThrough{}, PassThrough{});
+            },
+            num_iter));
+    }
+
+    {
+        using DeviceOp = device::DeviceNormalizationFwd<F16, F16, F16, F16, F32, PassThrough, 2, 1>;
+
+        // layernorm of 16 tokens of 4096
+        const std::vector<index_t> lengths{M, N};
+        const std::vector<index_t> x_strides{N, 1};
+        const std::vector<index_t> gamma_beta_strides{0, 1};
+        const std::vector<index_t> save_strides{1};
+        const std::vector<index_t> reduce_dims{1};
+
+        overheads.push_back(profile_dispatch_overhead<DeviceOp>(
+            "layernorm2d_fwd",
+            [&](DeviceOp& op) {
+                return op.MakeArgumentPointer(lengths,
+                                              x_strides,
+                                              gamma_beta_strides,
+                                              gamma_beta_strides,
+                                              x_strides,
+                                              save_strides,
+                                              save_strides,
+                                              reduce_dims,
+                                              1e-5,
+                                              p0,
+                                              p1,
+                                              p2,
+                                              p3,
+                                              p4,
+                                              p4,
+                                              PassThrough{});
+            },
+            num_iter));
+    }
+
+    return overheads;
+}
+
+void print_overheads(const std::vector<FamilyOverhead>& overheads)
+{
+    std::cout << std::left << std::setw(28) << "family" << std::right << std::setw(10)
+              << "instances" << std::setw(10) << "supported";
+
+    for(const auto& call_name : call_names)
+        std::cout << std::setw(22) << call_name;
+
+    std::cout << std::endl;
+
+    std::cout << std::left << std::setw(48) << "" << std::right;
+
+    for(std::size_t i = 0; i < call_names.size(); ++i)
+        std::cout << std::setw(14) << "ns" << std::setw(8) << "allocs";
+
+    std::cout << std::endl;
+
+    for(const auto& overhead : overheads)
+    {
+        std::cout << std::left << std::setw(28) << overhead.family_ << std::right << std::setw(10)
+                  << overhead.num_instance_ << std::setw(10) << overhead.num_supported_;
+
+        for(const auto& call : overhead.calls_)
+            std::cout << std::setw(14) << call.ns_ << std::setw(8) << call.allocation_;
+
+        std::cout << std::endl;
+    }
+}
+
+void write_overheads(const std::string& file_name, const std::vector<FamilyOverhead>& overheads)
+{
+    std::ofstream file(file_name);
+
+    file << std::setprecision(9);
+
+    for(const auto& overhead : overheads)
+    {
+        for(std::size_t i = 0; i < call_names.size(); ++i)
+        {
+            file << overhead.family_ << " " << call_names[i] << " " << overhead.calls_[i].ns_
+                 << " " << overhead.calls_[i].allocation_ << "\n";
+        }
+    }
+}
+
+// number of calls allocating more often than in the baseline, slower calls are only reported
+int compare_overheads(const std::string& file_name,
+                      const std::vector<FamilyOverhead>& overheads,
+                      double tolerance)
+{
+    std::ifstream file(file_name);
+
+    if(!file)
+    {
+        std::cerr << "cannot open baseline " << file_name << std::endl;
+        return 1;
+    }
+
+    std::map<std::pair<std::string, std::string>, CallOverhead> baseline;
+
+    std::string family;
+    std::string call_name;
+    CallOverhead call;
+
+    while(file >> family >> call_name >> call.ns_ >> call.allocation_)
+        baseline[{family, call_name}] = call;
+
+    int num_regression = 0;
+
+    for(const auto& overhead : overheads)
+    {
+        for(std::size_t i = 0; i < call_names.size(); ++i)
+        {
+            const auto found = baseline.find({overhead.family_, call_names[i]});
+
+            if(found == baseline.end())
+                continue;
+
+            const auto& base    = found->second;
+            const auto& current = overhead.calls_[i];
+
+            // allocation counts are deterministic, a fraction of an allocation per call is noise
+            // of the averaging over the instances
+            const bool slower    = current.ns_ > base.ns_ * (1 + tolerance);
+            const bool allocates = current.allocation_ > base.allocation_ + 0.5;
+
+            if(slower || allocates)
+            {
+                std::cout << (allocates ? "regression: " : "slower: ") << overhead.family_ << " "
+                          << call_names[i] << " " << base.ns_ << " -> " << current.ns_ << " ns, "
+                          << base.allocation_ << " -> " << current.allocation_ << " allocations"
+                          << std::endl;
+            }
+
+            if(allocates)
+                ++num_regression;
+        }
+    }
+
+    if(num_regression == 0)
+        std::cout << "no regressions found" << std::endl;
+
+    return num_regression;
+}
+
+void print_help()
+{
+    std::cout << "--iterations <n>: calls per instance (default 1000)\n"
+              << "--output <file>: write the overheads as a baseline\n"
+              << "--baseline <file>: compare against a baseline, non-zero exit on new allocations\n"
+              << "--tolerance <x>: relative time regression reported (default 0.25)"
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    int num_iter     = 1000;
+    double tolerance = 0.25;
+    std::string output;
+    std::string baseline;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+
+        if(i + 1 == argc)
+        {
+            print_help();
+            return EXIT_FAILURE;
+        }
+
+        if(arg == "--iterations")
+            num_iter = std::stoi(argv[++i]);
+        else if(arg == "--output")
+            output = argv[++i];
+        else if(arg == "--baseline")
+            baseline = argv[++i];
+        else if(arg == "--tolerance")
+            tolerance = std::stod(argv[++i]);
+        else
+        {
+            print_help();
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(1);
+
+    const auto overheads = profile_all_families(num_iter);
+
+    print_overheads(overheads);
+
+    if(!output.empty())
+        write_overheads(output, overheads);
+
+    if(!baseline.empty() && compare_overheads(baseline, overheads, tolerance) > 0)
+        return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,273 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ck/library/utility/conv_shape_db.hpp"
+#include "ck/library/utility/profile_report.hpp"
+
+#include "profiler/profile_grouped_conv_fwd_impl.hpp"
+#include "profiler/profile_grouped_conv_bwd_data_impl.hpp"
+#include "profiler/profile_grouped_conv_bwd_weight_impl.hpp"
+#include "profiler_operation_registry.hpp"
+
+namespace {
+
+enum struct ConvLayout
+{
+    GNHWC_GKYXC_GNHWK, // 0
+    NHWGC_GKYXC_NHWGK, // 1
+};
+
+enum struct ConvDataType
+{
+    F32_F32_F32,    // 0
+    F16_F16_F16,    // 1
+    BF16_BF16_BF16, // 2
+};
+
+#define OP_NAME "conv_model"
+#define OP_DESC "Model-level Grouped Convolution"
+
+static void print_helper_msg()
+{
+    std::cout
+        // clang-format off
+        << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+        << "arg2: data type (0: Input fp32, Weight fp32, Output fp32\n"
+        << "                 1: Input fp16, Weight fp16, Output fp16\n"
+        << "                 2: Input bf16, Weight bf16, Output bf16)\n"
+        << "arg3: tensor layout (0: Input[G, N, Hi, Wi, C], Weight[G, K, Y, X, C], Output[G, N, Ho, Wo, K]\n"
+        << "                     1: Input[N, Hi, Wi, G, C], Weight[G, K, Y, X, C], Output[N, Ho, Wo, G, K])\n"
+        << "arg4: verification (0: no, 1: yes)\n"
+        << "arg5: initialization (0: no init, 1: integer value, 2: decimal value)\n"
+        << "arg6: print tensor value (0: no; 1: yes)\n"
+        << "arg7: time kernel (0: no, 1: yes)\n"
+        << "arg8: model (resnet50, mobilenet_v2, vit_b16, bert_base, dlrm) or a file of lines\n"
+        << "      \"<fwd|bwd_data|bwd_weight> <count> <num_dim_spatial> <G, N, K, C, ...>\"\n"
+        << "      with the conv arguments below\n"
+        << "arg9: batch size N of the model, ignored for a file\n"
+        << "arg10: directions (0: forward; 1: forward, backward data and backward weight)\n"
+        << "optional:\n"
+        << "arg11: results file the best times are appended to, see ckProfiler report\n"
+        << ck::utils::conv::get_conv_param_parser_helper_msg() << std::endl;
+    // clang-format on
+}
+
+} // namespace
+
+int profile_conv_model(int argc, char* argv[])
+{
+    if(argc != 11 && argc != 12)
+    {
+        print_helper_msg();
+        return 1;
+    }
+
+    const auto data_type       = static_cast<ConvDataType>(std::stoi(argv[2]));
+    const auto layout          = static_cast<ConvLayout>(std::stoi(argv[3]));
+    const bool do_verification = std::stoi(argv[4]);
+    const int init_method      = std::stoi(argv[5]);
+    const bool do_log          = std::stoi(argv[6]);
+    const bool time_kernel     = std::stoi(argv[7]);
+    const std::string model    = argv[8];
+    const int N                = std::stoi(argv[9]);
+    const bool is_training     = std::stoi(argv[10]);
+
+    const std::string results_file_name = argc == 12 ? argv[11] : "";
+
+    using ck::utils::conv::ConvDirection;
+    using ck::utils::conv::ConvShapeDb;
+
+    ConvShapeDb db;
+
+    const auto model_names = ck::utils::conv::get_conv_shape_db_model_names();
+
+    if(std::find(model_names.begin(), model_names.end(), model) != model_names.end())
+    {
+        db = ck::utils::conv::make_model_conv_shape_db(model, N);
+    }
+    else
+    {
+        std::ifstream is(model);
+
+        if(!is)
+        {
+            print_helper_msg();
+            return 1;
+        }
+
+        db.Load(is);
+    }
+
+    if(is_training)
+        db.AddBackward();
+
+    std::cout << model << ": " << db.GetNumLayers() << " layers, " << db.GetShapes().size()
+              << " shapes" << std::endl;
+
+    using F32  = float;
+    using F16  = ck::half_t;
+    using BF16 = ck::bhalf_t;
+
+    using namespace ck::tensor_layout::convolution;
+
+    // the weight of bf16 backward weight is fp32
+    auto profile = [&](auto in_layout,
+                       auto wei_layout,
+                       auto out_layout,
+                       auto in_type,
+                       auto wei_type,
+                       auto out_type,
+                       auto bwd_weight_wei_type) {
+        using InLayout  = decltype(in_layout);
+        using WeiLayout = decltype(wei_layout);
+        using OutLayout = decltype(out_layout);
+
+        using InDataType           = decltype(in_type);
+        using WeiDataType          = decltype(wei_type);
+        using OutDataType          = decltype(out_type);
+        using BwdWeightWeiDataType = decltype(bwd_weight_wei_type);
+
+        bool pass = true;
+
+        std::vector<float> ave_times(db.GetShapes().size(), 0);
+
+        for(std::size_t i = 0; i < db.GetShapes().size(); ++i)
+        {
+            const auto& shape = db.GetShapes()[i];
+
+            std::cout << "shape " << i << ": "
+                      << ck::utils::conv::get_conv_direction_string(shape.direction_) << " x"
+                      << shape.count_ << std::endl;
+
+            if(shape.param_.num_dim_spatial_ != 2)
+            {
+                std::cout << "skipped, only 2-D problems are supported" << std::endl;
+                continue;
+            }
+
+            bool shape_pass = true;
+
+            if(shape.direction_ == ConvDirection::Forward)
+            {
+                shape_pass = ck::profiler::profile_grouped_conv_fwd_impl<2,
+                                                                         InLayout,
+                                                                         WeiLayout,
+                                                                         OutLayout,
+                                                                         InDataType,
+                                                                         WeiDataType,
+                                                                         OutDataType>(
+                    do_verification, init_method, do_log, time_kernel, shape.param_, &ave_times[i]);
+            }
+            else if(shape.direction_ == ConvDirection::BackwardData)
+            {
+                shape_pass = ck::profiler::profile_grouped_conv_bwd_data_impl<2,
+                                                                              OutLayout,
+                                                                              WeiLayout,
+                                                                              InLayout,
+                                                                              OutDataType,
+                                                                              WeiDataType,
+                                                                              InDataType>(
+                    do_verification, init_method, do_log, time_kernel, shape.param_, &ave_times[i]);
+            }
+            else
+            {
+                shape_pass =
+                    ck::profiler::profile_grouped_conv_bwd_weight_impl<2,
+                                                                       InLayout,
+                                                                       WeiLayout,
+                                                                       OutLayout,
+                                                                       InDataType,
+                                                                       BwdWeightWeiDataType,
+                                                                       OutDataType>(
+                        do_verification,
+                        init_method,
+                        do_log,
+                        time_kernel,
+                        shape.param_,
+                        ck::tensor_operation::device::KBatchAuto,
+                        &ave_times[i]);
+            }
+
+            pass = pass && shape_pass;
+        }
+
+        const std::string data_type_string = ck::is_same_v<InDataType, F32>   ? "f32"
+                                             : ck::is_same_v<InDataType, F16> ? "f16"
+                                                                              : "bf16";
+        const std::string layout_string    = ck::is_same_v<InLayout, GNHWC> ? "GNHWC" : "NHWGC";
+
+        // the best time of every shape times its count
+        ck::utils::ProfileResults results;
+        std::size_t num_missed = 0;
+
+        for(std::size_t i = 0; i < db.GetShapes().size(); ++i)
+        {
+            const auto& shape = db.GetShapes()[i];
+
+            if(ave_times[i] <= 0)
+            {
+                ++num_missed;
+                continue;
+            }
+
+            const ck::utils::ProfileRecord record{
+                "conv_" + ck::utils::conv::get_conv_direction_string(shape.direction_),
+                data_type_string + " " + layout_string + " " +
+                    ck::utils::conv::get_conv_param_string(shape.param_),
+                shape.count_,
+                ave_times[i],
+                shape.param_.GetFlops()};
+
+            results.Add(record);
+
+            if(!results_file_name.empty())
+                ck::utils::append_profile_record(results_file_name, record);
+
+            std::cout << "shape " << std::setw(3) << i << ": " << std::setw(15) << record.family_
+                      << " x" << std::setw(3) << shape.count_ << ", " << std::setw(10)
+                      << ave_times[i] << " ms, " << record.flop_ / 1.E9 / ave_times[i]
+                      << " TFlops, " << shape.count_ * ave_times[i] << " ms in total"
+                      << std::endl;
+        }
+
+        std::cout << ck::utils::make_profile_report(results);
+
+        if(num_missed > 0)
+            std::cout << num_missed << " shapes without a time are not in the total" << std::endl;
+
+        return pass ? 0 : 1;
+    };
+
+    if(layout == ConvLayout::GNHWC_GKYXC_GNHWK)
+    {
+        if(data_type == ConvDataType::F32_F32_F32)
+            return profile(GNHWC{}, GKYXC{}, GNHWK{}, F32{}, F32{}, F32{}, F32{});
+        else if(data_type == ConvDataType::F16_F16_F16)
+            return profile(GNHWC{}, GKYXC{}, GNHWK{}, F16{}, F16{}, F16{}, F16{});
+        else if(data_type == ConvDataType::BF16_BF16_BF16)
+            return profile(GNHWC{}, GKYXC{}, GNHWK{}, BF16{}, BF16{}, BF16{}, F32{});
+    }
+    else if(layout == ConvLayout::NHWGC_GKYXC_NHWGK)
+    {
+        if(data_type == ConvDataType::F32_F32_F32)
+            return profile(NHWGC{}, GKYXC{}, NHWGK{}, F32{}, F32{}, F32{}, F32{});
+        else if(data_type == ConvDataType::F16_F16_F16)
+            return profile(NHWGC{}, GKYXC{}, NHWGK{}, F16{}, F16{}, F16{}, F16{});
+        else if(data_type == ConvDataType::BF16_BF16_BF16)
+            return profile(NHWGC{}, GKYXC{}, NHWGK{}, BF16{}, BF16{}, BF16{}, F32{});
+    }
+
+    std::cout << "this data_type & layout is not implemented" << std::endl;
+
+    return 1;
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_conv_model);
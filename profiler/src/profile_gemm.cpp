@@ -1,10 +1,14 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
 
+#include <array>
 #include <iostream>
 #include <numeric>
 #include <initializer_list>
 #include <cstdlib>
+#include <string>
+
+#include "ck/library/utility/profile_report.hpp"
 
 #include "profiler/profile_gemm_impl.hpp"
 #include "profiler_operation_registry.hpp"
@@ -42,12 +46,16 @@ static void print_helper_msg()
               << "arg6: print tensor value (0: no; 1: yes)\n"
               << "arg7: time kernel (0: no, 1: yes)\n"
               << "arg8 to 13: M, N, K, StrideA, StrideB, StrideC\n"
+              << "optional:\n"
+              << "--input-file <A file> <B file> (.npy or CK tensor files of the [M, K] A and\n"
+              << "             [K, N] B, replacing the initialization)\n"
+              << "--results-file <file> (appends the best time, see ckProfiler report)\n"
               << std::endl;
 }
 
 int profile_gemm(int argc, char* argv[])
 {
-    if(argc != 14)
+    if(argc < 14)
     {
         print_helper_msg();
         exit(1);
@@ -68,6 +76,30 @@ int profile_gemm(int argc, char* argv[])
     const int StrideB = std::stoi(argv[12]);
     const int StrideC = std::stoi(argv[13]);
 
+    std::string a_file_name;
+    std::string b_file_name;
+    std::string results_file_name;
+
+    for(int i = 14; i < argc; ++i)
+    {
+        const std::string option = argv[i];
+
+        if(option == "--input-file" && i + 2 < argc)
+        {
+            a_file_name = argv[++i];
+            b_file_name = argv[++i];
+        }
+        else if(option == "--results-file" && i + 1 < argc)
+        {
+            results_file_name = argv[++i];
+        }
+        else
+        {
+            print_helper_msg();
+            exit(1);
+        }
+    }
+
     using F32 = float;
     using F16 = ck::half_t;
 #ifdef CK_ENABLE_BF16
@@ -104,6 +136,8 @@ int profile_gemm(int argc, char* argv[])
         const int DefaultStrideB = ck::is_same_v<BLayout, Row> ? N : K;
         const int DefaultStrideC = ck::is_same_v<CLayout, Row> ? N : M;
 
+        float ave_time = 0;
+
         bool pass =
             ck::profiler::profile_gemm_impl<ALayout,
                                             BLayout,
@@ -120,7 +154,25 @@ int profile_gemm(int argc, char* argv[])
                                                        K,
                                                        (StrideA < 0) ? DefaultStrideA : StrideA,
                                                        (StrideB < 0) ? DefaultStrideB : StrideB,
-                                                       (StrideC < 0) ? DefaultStrideC : StrideC);
+                                                       (StrideC < 0) ? DefaultStrideC : StrideC,
+                                                       a_file_name,
+                                                       b_file_name,
+                                                       &ave_time);
+
+        if(!results_file_name.empty() && ave_time > 0)
+        {
+            const std::array<std::string, 5> data_type_names{"f32", "f16", "bf16", "int8", "f8"};
+            const std::array<std::string, 4> layout_names{
+                "MK_KN_MN", "MK_NK_MN", "KM_KN_MN", "KM_NK_MN"};
+
+            const std::string problem = data_type_names[static_cast<int>(data_type)] + " " +
+                                        layout_names[static_cast<int>(layout)] + " " +
+                                        std::to_string(M) + " " + std::to_string(N) + " " +
+                                        std::to_string(K);
+
+            ck::utils::append_profile_record(
+                results_file_name, {"gemm", problem, 1, ave_time, std::size_t(2) * M * N * K});
+        }
 
         return pass ? 0 : 1;
     };
@@ -47,7 +47,7 @@ int profile_gemm_splitk(int argc, char* argv[])
         printf("arg6: print tensor value (0: no; 1: yes)\n");
         printf("arg7: time kernel (0=no, 1=yes)\n");
         printf("arg8 to 13: M, N, K, StrideA, StrideB, StrideC\n");
-        printf("arg14: split k into  mulitiple batch\n");
+        printf("arg14: split k into  mulitiple batch (0: sweep; -1: auto)\n");
         exit(1);
     }
 
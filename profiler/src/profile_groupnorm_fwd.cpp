@@ -2,9 +2,12 @@
 // Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
 
 #include <iostream>
+#include <string>
 #include <vector>
 #include <unordered_map>
 
+#include "ck/library/utility/profile_report.hpp"
+
 #include "profiler/data_type_enum.hpp"
 #include "profiler/profile_groupnorm_fwd_impl.hpp"
 #include "profiler_operation_registry.hpp"
@@ -56,6 +59,8 @@ void print_help_groupnorm()
               << "arg5: print tensor value (0: no; 1: yes)\n"
               << "arg6: time kernel (0=no, 1=yes)\n"
               << "--length: tensor extents (e.g, --length 1 16 16 32 40) \n"
+              << "optional:\n"
+              << "--results-file <file> (appends the best time, see ckProfiler report)\n"
               << std::endl;
 }
 
@@ -67,14 +72,15 @@ int profile_groupnorm(int argc, char* argv[])
     bool do_log                 = false;
     bool time_kernel            = 1;
     std::vector<index_t> length = {64, 16, 16, 32, 40};
+    std::string results_file_name;
 
-    if(argc != 1 && argc != 13)
+    if(argc != 1 && argc != 13 && argc != 15)
     {
         print_help_groupnorm();
         return 0;
     }
 
-    if(argc == 13)
+    if(argc >= 13)
     {
         data_type       = static_cast<ck::DataTypeEnum>(std::stoi(argv[2]));
         do_verification = std::stoi(argv[3]);
@@ -86,26 +92,45 @@ int profile_groupnorm(int argc, char* argv[])
         GroupnormArgParser arg_parser;
         arg_parser(argc, argv);
         length = arg_parser.long_opts["length"];
+
+        for(int i = 7; i + 1 < argc; ++i)
+        {
+            if(std::string(argv[i]) == "--results-file")
+                results_file_name = argv[i + 1];
+        }
     }
 
     using F16 = ck::half_t;
     using F32 = float;
 
+    float ave_time = 0;
+
     if(data_type == ck::DataTypeEnum::Float)
     {
         ck::profiler::profile_groupnorm_impl<F32, F32, F32, F32, F32, F32, false>(
-            do_verification, init_method, do_log, time_kernel, length);
+            do_verification, init_method, do_log, time_kernel, length, &ave_time);
     }
     else if(data_type == ck::DataTypeEnum::Half)
     {
         ck::profiler::profile_groupnorm_impl<F16, F16, F16, F32, F16, F32, false>(
-            do_verification, init_method, do_log, time_kernel, length);
+            do_verification, init_method, do_log, time_kernel, length, &ave_time);
     }
     else
     {
         throw std::runtime_error("not implemented yet");
     }
 
+    if(!results_file_name.empty() && ave_time > 0)
+    {
+        std::string problem = data_type == ck::DataTypeEnum::Half ? "f16" : "f32";
+
+        for(const auto l : length)
+            problem += " " + std::to_string(l);
+
+        // memory bound, no flop are counted
+        ck::utils::append_profile_record(results_file_name, {"groupnorm", problem, 1, ave_time, 0});
+    }
+
     return 0;
 }
 
@@ -2,9 +2,12 @@
 // Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
 
 #include <iostream>
+#include <string>
 #include <vector>
 #include <unordered_map>
 
+#include "ck/library/utility/profile_report.hpp"
+
 #include "profiler/data_type_enum.hpp"
 #include "profiler/profile_layernorm_fwd_impl.hpp"
 #include "profiler_operation_registry.hpp"
@@ -52,6 +55,8 @@ void print_help_layernorm()
               << "arg4: print tensor value (0: no; 1: yes)\n"
               << "arg5: time kernel (0=no, 1=yes)\n"
               << "--length: tensor extents (e.g, --length 1024 1024) \n"
+              << "optional:\n"
+              << "--results-file <file> (appends the best time, see ckProfiler report)\n"
               << std::endl;
 }
 
@@ -76,9 +81,19 @@ int profile_layernorm(int argc, char* argv[])
     arg_parser(argc, argv);
     const std::vector<index_t> length = arg_parser.long_opts["length"];
 
+    std::string results_file_name;
+
+    for(int i = 7; i + 1 < argc; ++i)
+    {
+        if(std::string(argv[i]) == "--results-file")
+            results_file_name = argv[i + 1];
+    }
+
     using F16 = ck::half_t;
     using F32 = float;
 
+    float ave_time = 0;
+
     if(length.size() == 2)
     {
         constexpr int rank = 2;
@@ -86,12 +101,12 @@ int profile_layernorm(int argc, char* argv[])
         if(data_type == ck::DataTypeEnum::Half)
         {
             ck::profiler::profile_layernorm_impl<F16, F16, F16, F32, F16, F32, false, rank>(
-                do_verification, init_method, do_log, time_kernel, length);
+                do_verification, init_method, do_log, time_kernel, length, &ave_time);
         }
         else if(data_type == ck::DataTypeEnum::Float)
         {
             ck::profiler::profile_layernorm_impl<F32, F32, F32, F32, F32, F32, false, rank>(
-                do_verification, init_method, do_log, time_kernel, length);
+                do_verification, init_method, do_log, time_kernel, length, &ave_time);
         }
         else
         {
@@ -105,12 +120,12 @@ int profile_layernorm(int argc, char* argv[])
         if(data_type == ck::DataTypeEnum::Half)
         {
             ck::profiler::profile_layernorm_impl<F16, F16, F16, F32, F16, F32, false, rank>(
-                do_verification, init_method, do_log, time_kernel, length);
+                do_verification, init_method, do_log, time_kernel, length, &ave_time);
         }
         else if(data_type == ck::DataTypeEnum::Float)
         {
             ck::profiler::profile_layernorm_impl<F32, F32, F32, F32, F32, F32, false, rank>(
-                do_verification, init_method, do_log, time_kernel, length);
+                do_verification, init_method, do_log, time_kernel, length, &ave_time);
         }
         else
         {
@@ -122,6 +137,17 @@ int profile_layernorm(int argc, char* argv[])
         throw std::runtime_error("not implemented yet");
     }
 
+    if(!results_file_name.empty() && ave_time > 0)
+    {
+        std::string problem = data_type == ck::DataTypeEnum::Half ? "f16" : "f32";
+
+        for(const auto l : length)
+            problem += " " + std::to_string(l);
+
+        // memory bound, no flop are counted
+        ck::utils::append_profile_record(results_file_name, {"layernorm", problem, 1, ave_time, 0});
+    }
+
     return 0;
 }
 
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "ck/library/utility/profile_report.hpp"
+
+#include "profiler_operation_registry.hpp"
+
+namespace {
+
+#define OP_NAME "report"
+#define OP_DESC "Model-level Report of Profiler Results"
+
+static void print_helper_msg()
+{
+    std::cout << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+              << "arg2: results file of lines \"<family> <problem> <count> <ave_time> <flop>\"\n"
+              << "      separated by tabs, appended to by conv_model and the --results-file\n"
+              << "      of gemm, layernorm, groupnorm and softmax\n"
+              << "optional:\n"
+              << "arg3: results file of a base run to compare with, returns 1 on a regression\n"
+              << "arg4: regression threshold in percent (default: 5)\n"
+              << std::endl;
+}
+
+bool load_profile_results(const std::string& file_name, ck::utils::ProfileResults& results)
+{
+    std::ifstream is(file_name);
+
+    if(!is)
+    {
+        std::cout << "cannot open " << file_name << std::endl;
+        return false;
+    }
+
+    const std::size_t num_records = results.Load(is);
+
+    // expected if a model calls a problem from several places, but also the result of profiling
+    // a model twice into the same file
+    if(num_records > results.GetRecords().size())
+    {
+        std::cout << "warning: " << num_records - results.GetRecords().size() << " records of "
+                  << file_name << " repeat a problem, their counts are added up" << std::endl;
+    }
+
+    return true;
+}
+
+} // namespace
+
+int profile_report(int argc, char* argv[])
+{
+    if(argc < 3 || argc > 5)
+    {
+        print_helper_msg();
+        return 1;
+    }
+
+    ck::utils::ProfileResults results;
+
+    if(!load_profile_results(argv[2], results))
+        return 1;
+
+    std::cout << ck::utils::make_profile_report(results);
+
+    if(argc == 3)
+        return 0;
+
+    ck::utils::ProfileResults base;
+
+    if(!load_profile_results(argv[3], base))
+        return 1;
+
+    const double threshold = argc == 5 ? std::stod(argv[4]) / 100 : 0.05;
+
+    const auto diff = ck::utils::diff_profile_results(base, results, threshold);
+
+    std::cout << diff;
+
+    return diff.HasRegression() ? 1 : 0;
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_report);
@@ -2,9 +2,12 @@
 // Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
 
 #include <iostream>
+#include <string>
 #include <vector>
 #include <unordered_map>
 
+#include "ck/library/utility/profile_report.hpp"
+
 #include "profiler/profile_softmax_impl.hpp"
 #include "profiler_operation_registry.hpp"
 
@@ -58,6 +61,7 @@ void print_help()
               << "--reduce: to-reduce dimensions (e.g, --reduce 2)\n"
               << "--alpha: alpha scaling value\n"
               << "--beta: beta scaling value\n"
+              << "--results-file <file> (appends the best time, see ckProfiler report)\n"
               << std::endl;
 }
 
@@ -87,6 +91,16 @@ int profile_softmax(int argc, char* argv[])
         arg_parser.long_opts["alpha"].empty() ? 1 : arg_parser.long_opts["alpha"][0];
     const index_t beta = arg_parser.long_opts["beta"].empty() ? 0 : arg_parser.long_opts["beta"][0];
 
+    std::string results_file_name;
+
+    for(int i = 7; i + 1 < argc; ++i)
+    {
+        if(std::string(argv[i]) == "--results-file")
+            results_file_name = argv[i + 1];
+    }
+
+    float ave_time = 0;
+
     // Rank 3
     if(length.size() == 3)
     {
@@ -102,7 +116,8 @@ int profile_softmax(int argc, char* argv[])
                     stride,
                     reduce,
                     double(alpha),
-                    double(beta));
+                    double(beta),
+                    &ave_time);
             else if(reduce.size() == 2)
                 ck::profiler::profile_softmax_impl<ck::half_t, float, ck::half_t, 3, 2>(
                     do_verification,
@@ -113,7 +128,8 @@ int profile_softmax(int argc, char* argv[])
                     stride,
                     reduce,
                     double(alpha),
-                    double(beta));
+                    double(beta),
+                    &ave_time);
             else if(reduce.size() == 3)
                 ck::profiler::profile_softmax_impl<ck::half_t, float, ck::half_t, 3, 3>(
                     do_verification,
@@ -124,7 +140,8 @@ int profile_softmax(int argc, char* argv[])
                     stride,
                     reduce,
                     double(alpha),
-                    double(beta));
+                    double(beta),
+                    &ave_time);
             else
                 throw std::runtime_error("invalid number of dimensions to reduce");
         }
@@ -139,7 +156,8 @@ int profile_softmax(int argc, char* argv[])
                                                                               stride,
                                                                               reduce,
                                                                               double(alpha),
-                                                                              double(beta));
+                                                                              double(beta),
+                                                                              &ave_time);
             else if(reduce.size() == 2)
                 ck::profiler::profile_softmax_impl<float, float, float, 3, 2>(do_verification,
                                                                               init_method,
@@ -149,7 +167,8 @@ int profile_softmax(int argc, char* argv[])
                                                                               stride,
                                                                               reduce,
                                                                               double(alpha),
-                                                                              double(beta));
+                                                                              double(beta),
+                                                                              &ave_time);
             else if(reduce.size() == 3)
                 ck::profiler::profile_softmax_impl<float, float, float, 3, 3>(do_verification,
                                                                               init_method,
@@ -159,7 +178,8 @@ int profile_softmax(int argc, char* argv[])
                                                                               stride,
                                                                               reduce,
                                                                               double(alpha),
-                                                                              double(beta));
+                                                                              double(beta),
+                                                                              &ave_time);
             else
                 throw std::runtime_error("invalid number of dimensions to reduce");
         }
@@ -183,7 +203,8 @@ int profile_softmax(int argc, char* argv[])
                     stride,
                     reduce,
                     double(alpha),
-                    double(beta));
+                    double(beta),
+                    &ave_time);
             else if(reduce.size() == 2)
                 ck::profiler::profile_softmax_impl<ck::half_t, float, ck::half_t, 4, 2>(
                     do_verification,
@@ -194,7 +215,8 @@ int profile_softmax(int argc, char* argv[])
                     stride,
                     reduce,
                     double(alpha),
-                    double(beta));
+                    double(beta),
+                    &ave_time);
             else if(reduce.size() == 3)
                 ck::profiler::profile_softmax_impl<ck::half_t, float, ck::half_t, 4, 3>(
                     do_verification,
@@ -205,7 +227,8 @@ int profile_softmax(int argc, char* argv[])
                     stride,
                     reduce,
                     double(alpha),
-                    double(beta));
+                    double(beta),
+                    &ave_time);
             else if(reduce.size() == 4)
                 ck::profiler::profile_softmax_impl<ck::half_t, float, ck::half_t, 4, 4>(
                     do_verification,
@@ -216,7 +239,8 @@ int profile_softmax(int argc, char* argv[])
                     stride,
                     reduce,
                     double(alpha),
-                    double(beta));
+                    double(beta),
+                    &ave_time);
             else
                 throw std::runtime_error("invalid number of dimensions to reduce");
         }
@@ -231,7 +255,8 @@ int profile_softmax(int argc, char* argv[])
                                                                               stride,
                                                                               reduce,
                                                                               double(alpha),
-                                                                              double(beta));
+                                                                              double(beta),
+                                                                              &ave_time);
             else if(reduce.size() == 2)
                 ck::profiler::profile_softmax_impl<float, float, float, 4, 2>(do_verification,
                                                                               init_method,
@@ -241,7 +266,8 @@ int profile_softmax(int argc, char* argv[])
                                                                               stride,
                                                                               reduce,
                                                                               double(alpha),
-                                                                              double(beta));
+                                                                              double(beta),
+                                                                              &ave_time);
             else if(reduce.size() == 3)
                 ck::profiler::profile_softmax_impl<float, float, float, 4, 3>(do_verification,
                                                                               init_method,
@@ -251,7 +277,8 @@ int profile_softmax(int argc, char* argv[])
                                                                               stride,
                                                                               reduce,
                                                                               double(alpha),
-                                                                              double(beta));
+                                                                              double(beta),
+                                                                              &ave_time);
             else if(reduce.size() == 4)
                 ck::profiler::profile_softmax_impl<float, float, float, 4, 4>(do_verification,
                                                                               init_method,
@@ -261,7 +288,8 @@ int profile_softmax(int argc, char* argv[])
                                                                               stride,
                                                                               reduce,
                                                                               double(alpha),
-                                                                              double(beta));
+                                                                              double(beta),
+                                                                              &ave_time);
             else
                 throw std::runtime_error("invalid number of dimensions to reduce");
         }
@@ -275,6 +303,30 @@ int profile_softmax(int argc, char* argv[])
         throw std::runtime_error("not implemented yet");
     }
 
+    if(!results_file_name.empty() && ave_time > 0)
+    {
+        std::string problem = data_type == SoftmaxDataType::F16_F16 ? "f16" : "f32";
+
+        for(const auto l : length)
+            problem += " " + std::to_string(l);
+
+        if(!stride.empty())
+        {
+            problem += " stride";
+
+            for(const auto s : stride)
+                problem += " " + std::to_string(s);
+        }
+
+        problem += " reduce";
+
+        for(const auto r : reduce)
+            problem += " " + std::to_string(r);
+
+        // memory bound, no flop are counted
+        ck::utils::append_profile_record(results_file_name, {"softmax", problem, 1, ave_time, 0});
+    }
+
     return 0;
 }
 
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+"""Aggregate the clang -ftime-trace files of a build tree per translation unit.
+
+Configure with -DCK_TIME_TRACE=ON, build, then run (or build the time_trace_report target):
+
+    analyze_time_trace.py <build>/library/src/tensor_operation_instance --save after.json
+
+The front-end and back-end times of every TU are summed over its host and device compilations,
+and the templates with the most instantiation time are listed. Compare against the summary of
+a baseline build with --compare before.json.
+"""
+import argparse
+import json
+import os
+import re
+import sys
+
+# suffixes of the host and device compilation jobs of a hip source
+JOB_SUFFIX = re.compile(r'(-hip-[\w.-]+|-host-[\w.-]+)?\.json$')
+
+
+def find_trace_files(build_dir):
+    for root, _, files in os.walk(build_dir):
+        for name in files:
+            if name.endswith('.json') and ('.cpp' in name or '.cu' in name):
+                yield os.path.join(root, name)
+
+
+def template_name(detail):
+    # drop the template arguments, ck::Sequence<1, 2> and ck::Sequence<3> are counted together
+    depth = 0
+    name = []
+    for c in detail:
+        if c == '<':
+            depth += 1
+        elif c == '>':
+            depth -= 1
+        elif depth == 0:
+            name.append(c)
+    return ''.join(name)
+
+
+def read_trace(path):
+    with open(path) as f:
+        try:
+            events = json.load(f).get('traceEvents', [])
+        except (ValueError, AttributeError):
+            return None
+
+    totals = {}
+    templates = {}
+
+    for e in events:
+        if e.get('ph') != 'X':
+            continue
+
+        name = e.get('name', '')
+        dur_ms = e.get('dur', 0) / 1000.0
+
+        if name.startswith('Total '):
+            totals[name[len('Total '):]] = totals.get(name[len('Total '):], 0.0) + dur_ms
+        elif name in ('InstantiateClass', 'InstantiateFunction'):
+            key = template_name(e.get('args', {}).get('detail', ''))
+            templates[key] = templates.get(key, 0.0) + dur_ms
+
+    return totals, templates
+
+
+def summarize(build_dir, filter_regex):
+    tus = {}
+    templates = {}
+
+    for path in find_trace_files(build_dir):
+        rel = os.path.relpath(path, build_dir)
+        if filter_regex and not re.search(filter_regex, rel):
+            continue
+
+        trace = read_trace(path)
+        if trace is None:
+            continue
+
+        totals, tu_templates = trace
+        tu = JOB_SUFFIX.sub('', rel)
+
+        entry = tus.setdefault(tu, {'frontend_ms': 0.0, 'backend_ms': 0.0})
+        entry['frontend_ms'] += totals.get('Frontend', 0.0)
+        entry['backend_ms'] += totals.get('Backend', 0.0)
+
+        for name, ms in tu_templates.items():
+            templates[name] = templates.get(name, 0.0) + ms
+
+    return {'tus': tus, 'templates': templates}
+
+
+def print_summary(summary, top):
+    tus = summary['tus']
+
+    print('%-100s %12s %12s' % ('translation unit', 'frontend ms', 'backend ms'))
+    for tu, t in sorted(tus.items(), key=lambda x: -x[1]['frontend_ms']):
+        print('%-100s %12.0f %12.0f' % (tu, t['frontend_ms'], t['backend_ms']))
+
+    frontend = sum(t['frontend_ms'] for t in tus.values())
+    backend = sum(t['backend_ms'] for t in tus.values())
+    print('%-100s %12.0f %12.0f' % ('total of %d TUs' % len(tus), frontend, backend))
+
+    # nested instantiations are counted in their parents as well
+    print('\ntop %d templates by instantiation time (inclusive):' % top)
+    for name, ms in sorted(summary['templates'].items(), key=lambda x: -x[1])[:top]:
+        print('%12.0f ms  %s' % (ms, name))
+
+
+def print_comparison(before, after):
+    print('%-100s %12s %12s %8s' % ('translation unit', 'before ms', 'after ms', 'change'))
+
+    total_before = 0.0
+    total_after = 0.0
+
+    for tu in sorted(after['tus']):
+        if tu not in before['tus']:
+            continue
+
+        b = before['tus'][tu]['frontend_ms']
+        a = after['tus'][tu]['frontend_ms']
+        total_before += b
+        total_after += a
+
+        print('%-100s %12.0f %12.0f %7.1f%%' % (tu, b, a, 100.0 * (a - b) / b if b > 0 else 0.0))
+
+    if total_before > 0:
+        print('%-100s %12.0f %12.0f %7.1f%%' %
+              ('frontend total', total_before, total_after,
+               100.0 * (total_after - total_before) / total_before))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Aggregate clang -ftime-trace files per TU')
+    parser.add_argument('build_dir', help='directory searched for the trace files')
+    parser.add_argument('--filter', default='', help='regex on the trace file paths')
+    parser.add_argument('--top', type=int, default=20, help='number of templates listed')
+    parser.add_argument('--save', help='write the summary to this json file')
+    parser.add_argument('--compare', help='summary json of a baseline build')
+    args = parser.parse_args()
+
+    summary = summarize(args.build_dir, args.filter)
+
+    if not summary['tus']:
+        print('no -ftime-trace files found under %s' % args.build_dir)
+        return 1
+
+    print_summary(summary, args.top)
+
+    if args.save:
+        with open(args.save, 'w') as f:
+            json.dump(summary, f, indent=1)
+
+    if args.compare:
+        with open(args.compare) as f:
+            before = json.load(f)
+        print('\nfrontend time against %s:' % args.compare)
+        print_comparison(before, summary)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+"""Wall-clock time and peak RSS of the instance library translation units.
+
+Configure with -DCK_INSTANCE_BUILD_STATS=ON, which runs every instance compilation through
+
+    instance_build_stats.py record <log> -- <compiler command>
+
+and appends one json line per TU to <log>. After the build, the instance_build_report target runs
+
+    instance_build_stats.py report <log> [--memory-gb 64]
+
+which lists the TUs by wall-clock time, sums them per instance library, and shows how many TUs
+of the peak RSS fit into the memory budget, i.e. the -j the build can afford.
+"""
+import argparse
+import json
+import os
+import re
+import resource
+import subprocess
+import sys
+import time
+
+
+def find_arg(command, flag):
+    for i, arg in enumerate(command[:-1]):
+        if arg == flag:
+            return command[i + 1]
+    return ''
+
+
+def record(log, command):
+    start = time.monotonic()
+    returncode = subprocess.call(command)
+    wall_s = time.monotonic() - start
+
+    # peak of the compiler driver and of every job it waited for, in kB on linux
+    rss_mb = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss / 1024.0
+
+    entry = {
+        'source': find_arg(command, '-c'),
+        'object': find_arg(command, '-o'),
+        'wall_s': round(wall_s, 3),
+        'rss_mb': round(rss_mb, 1),
+        'returncode': returncode
+    }
+
+    # a single short write with O_APPEND, so that parallel jobs do not interleave their lines
+    with open(log, 'a') as f:
+        f.write(json.dumps(entry) + '\n')
+
+    return returncode
+
+
+def read_log(log):
+    # the latest entry per object, the log keeps growing over incremental builds
+    entries = {}
+    with open(log) as f:
+        for line in f:
+            try:
+                entry = json.loads(line)
+            except ValueError:
+                continue
+            entries[entry.get('object') or entry.get('source')] = entry
+    return list(entries.values())
+
+
+def library_name(entry):
+    match = re.search(r'CMakeFiles/([^/]+)\.dir/', entry['object'])
+    return match.group(1) if match else '?'
+
+
+def tu_name(entry):
+    return os.path.basename(entry['source'] or entry['object'])
+
+
+def report(log, top, memory_gb):
+    entries = read_log(log)
+    if not entries:
+        print('no entries in %s' % log)
+        return 1
+
+    print('%-90s %10s %10s' % ('translation unit', 'wall s', 'peak MB'))
+    for e in sorted(entries, key=lambda x: -x['wall_s'])[:top]:
+        print('%-90s %10.1f %10.0f' % (tu_name(e), e['wall_s'], e['rss_mb']))
+
+    libraries = {}
+    for e in entries:
+        libraries.setdefault(library_name(e), []).append(e)
+
+    print('\n%-50s %6s %10s %10s %10s' % ('instance library', 'TUs', 'sum s', 'max s',
+                                          'peak MB'))
+    for name, tus in sorted(libraries.items(), key=lambda x: -sum(e['wall_s'] for e in x[1])):
+        print('%-50s %6d %10.1f %10.1f %10.0f' %
+              (name, len(tus), sum(e['wall_s'] for e in tus), max(e['wall_s'] for e in tus),
+               max(e['rss_mb'] for e in tus)))
+
+    total_s = sum(e['wall_s'] for e in entries)
+    longest_s = max(e['wall_s'] for e in entries)
+    peak_mb = max(e['rss_mb'] for e in entries)
+    print('%-50s %6d %10.1f %10.1f %10.0f' % ('total', len(entries), total_s, longest_s,
+                                              peak_mb))
+
+    failed = [e for e in entries if e.get('returncode')]
+    if failed:
+        print('\n%d TUs failed to compile' % len(failed))
+
+    # the build cannot be shorter than its longest TU, nor than the total spread over the jobs
+    if memory_gb and peak_mb > 0:
+        jobs = max(int(memory_gb * 1024 / peak_mb), 1)
+        print('\n%d parallel jobs fit into %g GB at the peak RSS, at least %.0f s of build time' %
+              (jobs, memory_gb, max(total_s / jobs, longest_s)))
+
+    return 0
+
+
+def main():
+    if len(sys.argv) > 1 and sys.argv[1] == 'record':
+        # record <log> -- <command>, parsed by hand as the command has options of its own
+        if len(sys.argv) < 5 or sys.argv[3] != '--':
+            print('usage: instance_build_stats.py record <log> -- <command>')
+            return 2
+        return record(sys.argv[2], sys.argv[4:])
+
+    parser = argparse.ArgumentParser(description='Wall-clock time and peak RSS per instance TU')
+    parser.add_argument('mode', choices=['report'])
+    parser.add_argument('log', help='json lines written by the record mode')
+    parser.add_argument('--top', type=int, default=30, help='number of TUs listed')
+    parser.add_argument('--memory-gb', type=float, default=0.0,
+                        help='memory of the build machine, to estimate the parallel jobs')
+    args = parser.parse_args()
+
+    return report(args.log, args.top, args.memory_gb)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
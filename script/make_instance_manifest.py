@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+"""Write an instance manifest for -DCK_INSTANCE_MANIFEST=<file> from ckProfiler logs.
+
+ckProfiler prints the instance id after the type string of every instance it runs:
+
+    Best Perf ... GB/s, DeviceGemm_Xdl_CShuffle<...>, instance id 3f2a9c0d5e4b1a27
+
+By default the winners of the logged runs are kept. With --type-strings, the type strings listed
+in a file, one per line, are resolved to their ids through the logs instead.
+
+    make_instance_manifest.py sweep1.log sweep2.log > manifest.txt
+"""
+import argparse
+import re
+import sys
+
+INSTANCE = re.compile(r', instance id ([0-9a-fA-F]{16})')
+
+
+def read_instances(logs, winners_only):
+    # type string -> id of every instance in the logs, and the ids of the winners
+    instances = {}
+    winners = []
+
+    for log in logs:
+        with open(log) as f:
+            for line in f:
+                match = INSTANCE.search(line)
+                if not match:
+                    continue
+
+                # the type string follows the timings, or the "name: " of the grouped conv summary
+                type_string = line[:match.start()].split('GB/s, ')[-1].split('name: ')[-1].strip()
+                instance_id = match.group(1).lower()
+                instances[type_string] = instance_id
+
+                if not winners_only or 'Best Perf' in line or line.startswith('name:'):
+                    winners.append((instance_id, type_string))
+
+    return instances, winners
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Instance manifest from ckProfiler logs')
+    parser.add_argument('logs', nargs='+', help='ckProfiler output')
+    parser.add_argument('--all', action='store_true', help='keep every instance that ran')
+    parser.add_argument('--type-strings', help='file of type strings to resolve instead')
+    args = parser.parse_args()
+
+    instances, winners = read_instances(args.logs, not args.all)
+
+    entries = winners
+    missing = 0
+
+    if args.type_strings:
+        entries = []
+        with open(args.type_strings) as f:
+            for line in f:
+                type_string = line.strip()
+                if not type_string or type_string.startswith('#'):
+                    continue
+                if type_string in instances:
+                    entries.append((instances[type_string], type_string))
+                else:
+                    print('# not found in the logs: %s' % type_string)
+                    missing += 1
+
+    seen = set()
+    for instance_id, type_string in entries:
+        if instance_id not in seen:
+            seen.add(instance_id)
+            print('%s  %s' % (instance_id, type_string))
+
+    print('%d instances, %d type strings not found' % (len(seen), missing), file=sys.stderr)
+
+    return 1 if missing else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
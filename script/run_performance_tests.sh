@@ -58,3 +58,9 @@ print_log_header $resnet256_log $env_type $branch $host_name
 export resnet4_log="perf_resnet50_N4.log"
 print_log_header $resnet4_log $env_type $branch $host_name
 ./profile_resnet50.sh conv_fwd_bias_relu 1 1 1 1 $verify 1 0 1 4 | tee -a $resnet4_log
+
+#run host dispatch overhead test, compared to the overheads of an earlier run if one is given
+#regressions are listed in the log as "regression:" lines, they do not fail the script
+export dispatch_log="perf_dispatch_overhead.log"
+print_log_header $dispatch_log $env_type $branch $host_name
+../build/bin/ckDispatchOverhead --output perf_dispatch_overhead.txt ${DISPATCH_OVERHEAD_BASELINE:+--baseline $DISPATCH_OVERHEAD_BASELINE} | tee -a $dispatch_log
@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ck/ck.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm_softmax_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_softmax.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+using ck::index_t;
+using ck::tensor_operation::device::MaskingSpecialization;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using Scale       = ck::tensor_operation::element_wise::Scale;
+
+namespace {
+
+// Gemm0 -> bias -> mask -> Softmax -> Gemm1 with the [G, M, N] scores materialized, A and C are
+// scaled by a_scale and c_scale
+template <MaskingSpecialization MaskingSpec>
+void run_chained_reference(const Tensor<float>& a_g_m_k,
+                           const Tensor<float>& b0_g_k_n,
+                           const Tensor<float>& b1_g_n_o,
+                           const Tensor<float>* p_d0_g_m_n,
+                           Tensor<float>& c_g_m_o,
+                           float a_scale,
+                           float alpha,
+                           float c_scale)
+{
+    const auto G = a_g_m_k.GetLengths()[0];
+    const auto M = a_g_m_k.GetLengths()[1];
+    const auto N = b0_g_k_n.GetLengths()[2];
+
+    Tensor<float> acc0_g_m_n({G, M, N});
+    Tensor<float> a1_g_m_n({G, M, N});
+
+    using ReferenceGemm0Instance = ck::tensor_operation::host::
+        ReferenceBatchedGemm<float, float, float, float, Scale, PassThrough, Scale>;
+    using ReferenceSoftmaxInstance =
+        ck::tensor_operation::host::ReferenceSoftmax<float, float, float>;
+    using ReferenceGemm1Instance = ck::tensor_operation::host::
+        ReferenceBatchedGemm<float, float, float, float, PassThrough, PassThrough, Scale>;
+
+    auto ref_gemm0_argument = ReferenceGemm0Instance::MakeArgument(
+        a_g_m_k, b0_g_k_n, acc0_g_m_n, Scale{a_scale}, PassThrough{}, Scale{alpha});
+    ReferenceGemm0Instance::MakeInvoker().Run(ref_gemm0_argument);
+
+    acc0_g_m_n.ForEach([&](auto& self, auto idx) {
+        if(p_d0_g_m_n != nullptr)
+            self(idx) += (*p_d0_g_m_n)(idx);
+
+        if(MaskingSpec == MaskingSpecialization::MaskOutUpperTriangle && idx[1] < idx[2])
+            self(idx) = -ck::NumericLimits<float>::Infinity();
+    });
+
+    auto ref_softmax_argument =
+        ReferenceSoftmaxInstance::MakeArgument(acc0_g_m_n, a1_g_m_n, 1, 0, {2});
+    ReferenceSoftmaxInstance::MakeInvoker().Run(ref_softmax_argument);
+
+    auto ref_gemm1_argument = ReferenceGemm1Instance::MakeArgument(
+        a1_g_m_n, b1_g_n_o, c_g_m_o, PassThrough{}, PassThrough{}, Scale{c_scale});
+    ReferenceGemm1Instance::MakeInvoker().Run(ref_gemm1_argument);
+}
+
+// small tiles, so that the lengths below span several partial and skippable tiles
+template <MaskingSpecialization MaskingSpec>
+using ReferenceInstance = ck::tensor_operation::host::ReferenceBatchedGemmSoftmaxGemm<
+    float,
+    float,
+    float,
+    float,
+    float,
+    Scale,
+    PassThrough,
+    Scale,
+    PassThrough,
+    Scale,
+    MaskingSpec,
+    float,
+    ck::tensor_operation::element_wise::Add,
+    16,
+    16>;
+
+template <MaskingSpecialization MaskingSpec>
+void run_test(bool with_bias)
+{
+    // G, M, N, K, O
+    const std::vector<std::vector<std::size_t>> lengths = {
+        {1, 16, 16, 8, 8}, {2, 37, 53, 19, 11}, {3, 64, 40, 32, 17}, {1, 5, 70, 7, 3}};
+
+    for(const auto& l : lengths)
+    {
+        const std::size_t G = l[0], M = l[1], N = l[2], K = l[3], O = l[4];
+
+        Tensor<float> a_g_m_k({G, M, K});
+        Tensor<float> b0_g_k_n({G, K, N});
+        Tensor<float> b1_g_n_o({G, N, O});
+        Tensor<float> d0_g_m_n({G, M, N});
+        Tensor<float> c_g_m_o({G, M, O});
+        Tensor<float> c_g_m_o_chained({G, M, O});
+
+        a_g_m_k.GenerateTensorValue(GeneratorTensor_3<float>{-1.0, 1.0});
+        b0_g_k_n.GenerateTensorValue(GeneratorTensor_3<float>{-1.0, 1.0});
+        b1_g_n_o.GenerateTensorValue(GeneratorTensor_3<float>{-1.0, 1.0});
+        d0_g_m_n.GenerateTensorValue(GeneratorTensor_3<float>{-2.0, 2.0});
+
+        const float a_scale = 2.0f;
+        const float alpha   = 0.5f;
+        const float c_scale = 0.25f;
+
+        if(with_bias)
+        {
+            auto ref_argument = ReferenceInstance<MaskingSpec>::MakeArgument(a_g_m_k,
+                                                                             b0_g_k_n,
+                                                                             b1_g_n_o,
+                                                                             c_g_m_o,
+                                                                             d0_g_m_n,
+                                                                             Scale{a_scale},
+                                                                             PassThrough{},
+                                                                             Scale{alpha},
+                                                                             {},
+                                                                             PassThrough{},
+                                                                             Scale{c_scale});
+            ReferenceInstance<MaskingSpec>::MakeInvoker().Run(ref_argument);
+        }
+        else
+        {
+            auto ref_argument = ReferenceInstance<MaskingSpec>::MakeArgument(a_g_m_k,
+                                                                             b0_g_k_n,
+                                                                             b1_g_n_o,
+                                                                             c_g_m_o,
+                                                                             Scale{a_scale},
+                                                                             PassThrough{},
+                                                                             Scale{alpha},
+                                                                             PassThrough{},
+                                                                             Scale{c_scale});
+            ReferenceInstance<MaskingSpec>::MakeInvoker().Run(ref_argument);
+        }
+
+        run_chained_reference<MaskingSpec>(a_g_m_k,
+                                           b0_g_k_n,
+                                           b1_g_n_o,
+                                           with_bias ? &d0_g_m_n : nullptr,
+                                           c_g_m_o_chained,
+                                           a_scale,
+                                           alpha,
+                                           c_scale);
+
+        EXPECT_TRUE(ck::utils::check_err(
+            c_g_m_o, c_g_m_o_chained, "Error: Incorrect results!", 1e-5, 1e-5));
+    }
+}
+
+} // namespace
+
+TEST(TestBatchedGemmSoftmaxGemmReference, MaskDisabled)
+{
+    run_test<MaskingSpecialization::MaskDisabled>(false);
+}
+
+TEST(TestBatchedGemmSoftmaxGemmReference, MaskOutUpperTriangle)
+{
+    run_test<MaskingSpecialization::MaskOutUpperTriangle>(false);
+}
+
+TEST(TestBatchedGemmSoftmaxGemmReference, MaskDisabledWithBias)
+{
+    run_test<MaskingSpecialization::MaskDisabled>(true);
+}
+
+TEST(TestBatchedGemmSoftmaxGemmReference, MaskOutUpperTriangleWithBias)
+{
+    run_test<MaskingSpecialization::MaskOutUpperTriangle>(true);
+}
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <numeric>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_batchnorm_common.hpp"
+
+using ck::tensor_operation::host::batchnorm_blocked_for_each;
+using ck::tensor_operation::host::batchnorm_welford_reduce;
+using ck::tensor_operation::host::BatchNormThreadPlan;
+using ck::tensor_operation::host::get_batchnorm_thread_plan;
+using ck::tensor_operation::host::HostWelford;
+
+TEST(BatchNormHostWelford, MergeMatchesSequentialUpdate)
+{
+    std::vector<double> values(1000);
+    for(std::size_t i = 0; i < values.size(); ++i)
+        values[i] = std::sin(static_cast<double>(i)) * 10.0 + 100.0;
+
+    HostWelford<double> sequential;
+    for(double v : values)
+        sequential.Update(v);
+
+    HostWelford<double> merged;
+    for(std::size_t begin = 0; begin < values.size(); begin += 77)
+    {
+        HostWelford<double> partial;
+        for(std::size_t i = begin; i < std::min(begin + 77, values.size()); ++i)
+            partial.Update(values[i]);
+        merged.Merge(partial);
+    }
+
+    EXPECT_EQ(merged.count_, sequential.count_);
+    EXPECT_NEAR(merged.GetMean(), sequential.GetMean(), 1e-10);
+    EXPECT_NEAR(merged.GetVariance(), sequential.GetVariance(), 1e-9);
+}
+
+TEST(BatchNormHostWelford, MergeWithEmptyPartial)
+{
+    HostWelford<float> a, empty;
+    a.Update(1.0f);
+    a.Update(3.0f);
+
+    a.Merge(empty);
+    empty.Merge(a);
+
+    EXPECT_FLOAT_EQ(a.GetMean(), 2.0f);
+    EXPECT_FLOAT_EQ(a.GetVariance(), 1.0f);
+    EXPECT_FLOAT_EQ(empty.GetMean(), 2.0f);
+    EXPECT_FLOAT_EQ(empty.GetVariance(), 1.0f);
+}
+
+TEST(BatchNormHostWelford, ThreadPlan)
+{
+    // enough channels, no partials to merge
+    const auto invariant_plan = get_batchnorm_thread_plan(256, 4, 16);
+    EXPECT_FALSE(invariant_plan.split_reduce_);
+    EXPECT_EQ(invariant_plan.num_thread_, 16);
+    EXPECT_EQ(invariant_plan.GetNumPartial(), 1);
+
+    const auto reduce_plan = get_batchnorm_thread_plan(3, 1000, 16);
+    EXPECT_TRUE(reduce_plan.split_reduce_);
+    EXPECT_EQ(reduce_plan.num_thread_, 16);
+    EXPECT_EQ(reduce_plan.GetNumPartial(), 16);
+
+    EXPECT_EQ(get_batchnorm_thread_plan(3, 5, 16).num_thread_, 5);
+}
+
+TEST(BatchNormHostWelford, BlockedForEachVisitsEveryIndexOnce)
+{
+    const std::size_t invariant_size = 5;
+    const std::size_t reduce_size    = 37;
+
+    for(bool invariant_innermost : {false, true})
+    {
+        for(const auto plan : {BatchNormThreadPlan{1, true},
+                                BatchNormThreadPlan{3, true},
+                                BatchNormThreadPlan{64, true},
+                                BatchNormThreadPlan{3, false},
+                                BatchNormThreadPlan{8, false}})
+        {
+            std::vector<std::vector<int>> visits(plan.GetNumPartial(),
+                                                 std::vector<int>(invariant_size * reduce_size));
+
+            batchnorm_blocked_for_each(invariant_size,
+                                       reduce_size,
+                                       plan,
+                                       invariant_innermost,
+                                       [&](std::size_t it, std::size_t i, std::size_t j) {
+                                           visits[it][i * reduce_size + j]++;
+                                       });
+
+            for(std::size_t k = 0; k < invariant_size * reduce_size; ++k)
+            {
+                int total = 0;
+                for(std::size_t it = 0; it < plan.GetNumPartial(); ++it)
+                    total += visits[it][k];
+                EXPECT_EQ(total, 1);
+            }
+        }
+    }
+}
+
+TEST(BatchNormHostWelford, ReduceNHWC)
+{
+    // x is N x C with C contiguous, reduce over N
+    const std::size_t N = 513, C = 7;
+
+    std::vector<float> x(N * C);
+    for(std::size_t k = 0; k < x.size(); ++k)
+        x[k] = static_cast<float>((k * 37) % 101) * 0.25f - 5.0f;
+
+    std::vector<size_t> invariant_offsets(C), reduce_offsets(N);
+    std::iota(invariant_offsets.begin(), invariant_offsets.end(), 0);
+    for(std::size_t n = 0; n < N; ++n)
+        reduce_offsets[n] = n * C;
+
+    const auto result =
+        batchnorm_welford_reduce<double>(x.data(), invariant_offsets, reduce_offsets, true);
+
+    for(std::size_t c = 0; c < C; ++c)
+    {
+        double sum = 0, sum_sq = 0;
+        for(std::size_t n = 0; n < N; ++n)
+            sum += x[n * C + c];
+        const double mean = sum / N;
+        for(std::size_t n = 0; n < N; ++n)
+            sum_sq += (x[n * C + c] - mean) * (x[n * C + c] - mean);
+
+        EXPECT_NEAR(result[c].GetMean(), mean, 1e-9);
+        EXPECT_NEAR(result[c].GetVariance(), sum_sq / N, 1e-9);
+    }
+}
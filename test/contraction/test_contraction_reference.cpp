@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ck/ck.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_contraction.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using Scale       = ck::tensor_operation::element_wise::Scale;
+
+TEST(TestContractionReference, M2_N2_K2)
+{
+    // odd lengths to cover the partial tiles of the blocked GEMM, B has K as the slow modes
+    const std::size_t M0 = 5, M1 = 29, N0 = 3, N1 = 47, K0 = 7, K1 = 41;
+
+    Tensor<float> a_ms_ks({M0, M1, K0, K1});
+    Tensor<float> b_ns_ks(std::vector<std::size_t>{N0, N1, K0, K1},
+                          std::vector<std::size_t>{N1, 1, N0 * N1 * K1, N0 * N1});
+    Tensor<float> c_ms_ns({M0, M1, N0, N1});
+    Tensor<float> c_ms_ns_naive({M0, M1, N0, N1});
+
+    a_ms_ks.GenerateTensorValue(GeneratorTensor_3<float>{-1.0, 1.0});
+    b_ns_ks.GenerateTensorValue(GeneratorTensor_3<float>{-1.0, 1.0});
+
+    using ReferenceInstance = ck::tensor_operation::host::ReferenceContraction_M2_N2_K2<2,
+                                                                                       2,
+                                                                                       2,
+                                                                                       float,
+                                                                                       float,
+                                                                                       float,
+                                                                                       float,
+                                                                                       float,
+                                                                                       Scale,
+                                                                                       PassThrough>;
+
+    auto ref_argument =
+        ReferenceInstance::MakeArgument(a_ms_ks, b_ns_ks, c_ms_ns, Scale{0.5f}, PassThrough{});
+    ReferenceInstance::MakeInvoker().Run(ref_argument);
+
+    c_ms_ns_naive.ForEach([&](auto& self, const auto& idx) {
+        float v_acc = 0;
+
+        for(std::size_t k0 = 0; k0 < K0; ++k0)
+            for(std::size_t k1 = 0; k1 < K1; ++k1)
+                v_acc += 0.5f * a_ms_ks(idx[0], idx[1], k0, k1) * b_ns_ks(idx[2], idx[3], k0, k1);
+
+        self(idx) = v_acc;
+    });
+
+    EXPECT_TRUE(ck::utils::check_err(c_ms_ns, c_ms_ns_naive));
+}
+
+TEST(TestContractionReference, M3_N1_K2)
+{
+    const std::size_t M0 = 2, M1 = 3, M2 = 11, N0 = 150, K0 = 9, K1 = 33;
+
+    Tensor<ck::half_t> a_ms_ks({M0, M1, M2, K0, K1});
+    Tensor<ck::half_t> b_ns_ks({N0, K0, K1});
+    Tensor<float> c_ms_ns({M0, M1, M2, N0});
+    Tensor<float> c_ms_ns_naive({M0, M1, M2, N0});
+
+    a_ms_ks.GenerateTensorValue(GeneratorTensor_2<ck::half_t>{-5, 5});
+    b_ns_ks.GenerateTensorValue(GeneratorTensor_2<ck::half_t>{-5, 5});
+
+    using ReferenceInstance = ck::tensor_operation::host::ReferenceContraction<3,
+                                                                              1,
+                                                                              2,
+                                                                              ck::half_t,
+                                                                              ck::half_t,
+                                                                              float,
+                                                                              float,
+                                                                              ck::half_t,
+                                                                              PassThrough,
+                                                                              PassThrough>;
+
+    auto ref_argument =
+        ReferenceInstance::MakeArgument(a_ms_ks, b_ns_ks, c_ms_ns, PassThrough{}, PassThrough{});
+    ReferenceInstance::MakeInvoker().Run(ref_argument);
+
+    c_ms_ns_naive.ForEach([&](auto& self, const auto& idx) {
+        float v_acc = 0;
+
+        for(std::size_t k0 = 0; k0 < K0; ++k0)
+            for(std::size_t k1 = 0; k1 < K1; ++k1)
+                v_acc += ck::type_convert<float>(a_ms_ks(idx[0], idx[1], idx[2], k0, k1)) *
+                         ck::type_convert<float>(b_ns_ks(idx[3], k0, k1));
+
+        self(idx) = v_acc;
+    });
+
+    // small integers, the results are exact
+    EXPECT_TRUE(ck::utils::check_err(c_ms_ns, c_ms_ns_naive, "Error: Incorrect results!", 0, 0));
+}
@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/conv_shape_db.hpp"
+
+using ck::utils::conv::ConvDirection;
+using ck::utils::conv::ConvParam;
+using ck::utils::conv::ConvShapeDb;
+using ck::utils::conv::get_conv_shape_db_model_names;
+using ck::utils::conv::is_same_conv_param;
+using ck::utils::conv::make_model_conv_shape_db;
+
+TEST(ConvShapeDb, Deduplicate)
+{
+    const ConvParam a(2, 1, 32, 64, 64, {3, 3}, {56, 56}, {1, 1}, {1, 1}, {1, 1}, {1, 1});
+    const ConvParam b(2, 1, 32, 64, 64, {3, 3}, {56, 56}, {2, 2}, {1, 1}, {1, 1}, {1, 1});
+
+    ConvShapeDb db;
+    db.Add(a);
+    db.Add(b);
+    db.Add(a, ConvDirection::Forward, 2);
+    db.Add(a, ConvDirection::BackwardData);
+
+    ASSERT_EQ(db.GetShapes().size(), 3);
+    EXPECT_EQ(db.GetShapes()[0].count_, 3);
+    EXPECT_EQ(db.GetShapes()[1].count_, 1);
+    EXPECT_EQ(db.GetShapes()[2].direction_, ConvDirection::BackwardData);
+    EXPECT_EQ(db.GetNumLayers(), 5);
+    EXPECT_EQ(db.GetFlops(), 4 * a.GetFlops() + b.GetFlops());
+
+    ConvShapeDb merged;
+    merged.Add(db);
+    merged.Add(db);
+
+    EXPECT_EQ(merged.GetShapes().size(), 3);
+    EXPECT_EQ(merged.GetNumLayers(), 10);
+}
+
+TEST(ConvShapeDb, Backward)
+{
+    auto db = make_model_conv_shape_db("resnet50", 8);
+
+    const auto num_shapes = db.GetShapes().size();
+    const auto flops      = db.GetFlops();
+
+    db.AddBackward();
+
+    ASSERT_EQ(db.GetShapes().size(), 3 * num_shapes);
+    EXPECT_EQ(db.GetFlops(), 3 * flops);
+
+    for(std::size_t i = 0; i < num_shapes; ++i)
+    {
+        const auto& fwd      = db.GetShapes()[i];
+        const auto& bwd_data = db.GetShapes()[num_shapes + 2 * i];
+
+        EXPECT_EQ(bwd_data.direction_, ConvDirection::BackwardData);
+        EXPECT_EQ(bwd_data.count_, fwd.count_);
+        EXPECT_TRUE(is_same_conv_param(bwd_data.param_, fwd.param_));
+        EXPECT_EQ(db.GetShapes()[num_shapes + 2 * i + 1].direction_,
+                  ConvDirection::BackwardWeight);
+    }
+}
+
+TEST(ConvShapeDb, Models)
+{
+    // 4.1 GMACs per image
+    const auto resnet50 = make_model_conv_shape_db("resnet50", 1);
+
+    EXPECT_EQ(resnet50.GetNumLayers(), 54);
+    EXPECT_LT(resnet50.GetShapes().size(), 54);
+    EXPECT_NEAR(resnet50.GetFlops() / 1.E9, 8.2, 0.1);
+
+    // 300 MMACs per image
+    const auto mobilenet_v2 = make_model_conv_shape_db("mobilenet_v2", 1);
+
+    EXPECT_EQ(mobilenet_v2.GetNumLayers(), 53);
+    EXPECT_NEAR(mobilenet_v2.GetFlops() / 1.E9, 0.6, 0.02);
+
+    const auto bert_base = make_model_conv_shape_db("bert_base", 2);
+
+    ASSERT_EQ(bert_base.GetShapes().size(), 5);
+    EXPECT_EQ(bert_base.GetShapes()[0].count_, 12);
+    EXPECT_EQ(bert_base.GetShapes()[0].param_.N_, 2);
+    EXPECT_EQ(bert_base.GetShapes()[0].param_.K_, 3 * 768);
+
+    for(const auto& model : get_conv_shape_db_model_names())
+    {
+        const auto db = make_model_conv_shape_db(model, 4);
+
+        for(const auto& shape : db.GetShapes())
+        {
+            EXPECT_EQ(shape.param_.num_dim_spatial_, 2);
+            EXPECT_EQ(shape.param_.N_, 4);
+            EXPECT_GT(shape.param_.output_spatial_lengths_[0], 0);
+        }
+    }
+
+    EXPECT_THROW(make_model_conv_shape_db("alexnet", 1), std::runtime_error);
+}
+
+TEST(ConvShapeDb, SaveLoad)
+{
+    auto db = make_model_conv_shape_db("mobilenet_v2", 16);
+    db.AddBackward();
+
+    std::stringstream ss;
+    ss << "# mobilenet_v2, training\n\n";
+    db.Save(ss);
+
+    ConvShapeDb loaded;
+
+    EXPECT_EQ(loaded.Load(ss), db.GetShapes().size());
+    ASSERT_EQ(loaded.GetShapes().size(), db.GetShapes().size());
+
+    for(std::size_t i = 0; i < db.GetShapes().size(); ++i)
+    {
+        EXPECT_EQ(loaded.GetShapes()[i].direction_, db.GetShapes()[i].direction_);
+        EXPECT_EQ(loaded.GetShapes()[i].count_, db.GetShapes()[i].count_);
+        EXPECT_TRUE(is_same_conv_param(loaded.GetShapes()[i].param_, db.GetShapes()[i].param_));
+    }
+
+    std::istringstream invalid_direction("bwd 1 1 1 1 1 1 1 1 1 1 0 0");
+    EXPECT_THROW(loaded.Load(invalid_direction), std::runtime_error);
+
+    std::istringstream missing_arg("fwd 1 1 1 1 1 1 1 1 1 1 0");
+    EXPECT_THROW(loaded.Load(missing_arg), std::runtime_error);
+}
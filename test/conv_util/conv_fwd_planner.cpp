@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/convolution_forward_planner.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+
+using ck::utils::conv::ConvFwdFamily;
+using ck::utils::conv::ConvFwdPlan;
+using ck::utils::conv::ConvParam;
+using ck::tensor_operation::device::ConvolutionForwardSpecialization;
+
+namespace {
+
+namespace ctl = ck::tensor_layout::convolution;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+template <ck::index_t NDimSpatial>
+using InLayout = std::conditional_t<NDimSpatial == 1,
+                                    ctl::NWGC,
+                                    std::conditional_t<NDimSpatial == 2, ctl::NHWGC, ctl::NDHWGC>>;
+template <ck::index_t NDimSpatial>
+using WeiLayout = std::conditional_t<NDimSpatial == 1,
+                                     ctl::GKXC,
+                                     std::conditional_t<NDimSpatial == 2, ctl::GKYXC, ctl::GKZYXC>>;
+template <ck::index_t NDimSpatial>
+using OutLayout = std::conditional_t<NDimSpatial == 1,
+                                     ctl::NWGK,
+                                     std::conditional_t<NDimSpatial == 2, ctl::NHWGK, ctl::NDHWGK>>;
+
+template <ck::index_t NDimSpatial>
+Tensor<float> run_reference_conv_fwd(const ConvParam& param,
+                                     const Tensor<float>& input,
+                                     const Tensor<float>& weight)
+{
+    Tensor<float> output(
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<
+            OutLayout<NDimSpatial>>(param));
+
+    auto ref_conv = ck::tensor_operation::host::
+        ReferenceConvFwd<NDimSpatial, float, float, float, PassThrough, PassThrough, PassThrough>();
+
+    auto ref_argument = ref_conv.MakeArgument(input,
+                                              weight,
+                                              output,
+                                              param.conv_filter_strides_,
+                                              param.conv_filter_dilations_,
+                                              param.input_left_pads_,
+                                              param.input_right_pads_,
+                                              PassThrough{},
+                                              PassThrough{},
+                                              PassThrough{});
+
+    ref_conv.MakeInvoker().Run(ref_argument);
+
+    return output;
+}
+
+// runs the planned problem on host and compares it with the reference convolution of the
+// original problem
+template <ck::index_t NDimSpatial>
+ConvFwdPlan check_plan(const ConvParam& param, ConvFwdFamily expected_family)
+{
+    const auto plan = ck::utils::conv::make_conv_fwd_plan(param);
+
+    EXPECT_EQ(plan.family_, expected_family);
+
+    Tensor<float> input(
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout<NDimSpatial>>(
+            param));
+    Tensor<float> weight(
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<
+            WeiLayout<NDimSpatial>>(param));
+
+    ck::utils::FillUniformDistributionIntegerValue<float>{-5.f, 5.f}(input);
+    ck::utils::FillUniformDistributionIntegerValue<float>{-5.f, 5.f}(weight);
+
+    const auto ref_output = run_reference_conv_fwd<NDimSpatial>(param, input, weight);
+
+    if(plan.family_ == ConvFwdFamily::GroupedConvFwd)
+    {
+        const auto output = run_reference_conv_fwd<NDimSpatial>(plan.param_, input, weight);
+
+        EXPECT_TRUE(ck::utils::check_err(output, ref_output));
+
+        return plan;
+    }
+
+    // every output is written once
+    Tensor<float> output(ref_output.mDesc);
+    output.SetZero();
+
+    const auto& gemm  = plan.gemm_;
+    const float* p_a  = input.mData.data();
+    const float* p_b  = weight.mData.data();
+    float* p_e        = output.mData.data();
+    std::size_t count = 0;
+
+    for(ck::index_t b = 0; b < gemm.Batch_; ++b)
+    {
+        for(ck::index_t m = 0; m < gemm.M_; ++m)
+        {
+            for(ck::index_t n = 0; n < gemm.N_; ++n)
+            {
+                float acc = 0;
+
+                for(ck::index_t k = 0; k < gemm.K_; ++k)
+                {
+                    acc += p_a[b * gemm.BatchStrideA_ + m * gemm.StrideA_ + k] *
+                           p_b[b * gemm.BatchStrideB_ + n * gemm.StrideB_ + k];
+                }
+
+                p_e[b * gemm.BatchStrideE_ + m * gemm.StrideE_ + n] = acc;
+                ++count;
+            }
+        }
+    }
+
+    EXPECT_EQ(count, output.mData.size());
+    EXPECT_TRUE(ck::utils::check_err(output, ref_output));
+
+    return plan;
+}
+
+} // namespace
+
+TEST(TestConvFwdPlanner, Gemm)
+{
+    // 1x1, stride 1
+    auto plan = check_plan<2>(
+        ConvParam{2, 1, 2, 8, 16, {1, 1}, {5, 7}, {1, 1}, {1, 1}, {0, 0}, {0, 0}},
+        ConvFwdFamily::Gemm);
+    EXPECT_EQ(plan.gemm_.M_, 2 * 5 * 7);
+    EXPECT_EQ(plan.gemm_.StrideA_, 16);
+
+    // the dilation of a 1x1 filter does not matter
+    check_plan<3>(
+        ConvParam{3, 1, 2, 8, 16, {1, 1, 1}, {3, 4, 5}, {1, 1, 1}, {2, 3, 2}, {0, 0, 0}, {0, 0, 0}},
+        ConvFwdFamily::Gemm);
+
+    // stride 2 over an input of an even length reads every second pixel of a single row
+    plan = check_plan<1>(ConvParam{1, 1, 3, 8, 16, {1}, {8}, {2}, {1}, {0}, {0}},
+                         ConvFwdFamily::Gemm);
+    EXPECT_EQ(plan.gemm_.M_, 3 * 4);
+    EXPECT_EQ(plan.gemm_.StrideA_, 2 * 16);
+
+    // a single output pixel
+    check_plan<2>(ConvParam{2, 1, 1, 8, 16, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {0, 0}, {0, 0}},
+                  ConvFwdFamily::Gemm);
+}
+
+TEST(TestConvFwdPlanner, BatchedGemm)
+{
+    // stride 2, a batch per output row
+    auto plan = check_plan<2>(
+        ConvParam{2, 1, 2, 8, 16, {1, 1}, {8, 8}, {2, 2}, {1, 1}, {0, 0}, {0, 0}},
+        ConvFwdFamily::BatchedGemm);
+    EXPECT_EQ(plan.gemm_.Batch_, 2 * 4);
+    EXPECT_EQ(plan.gemm_.M_, 4);
+    EXPECT_EQ(plan.gemm_.BatchStrideB_, 0);
+
+    // stride 1, a batch per group
+    plan = check_plan<2>(ConvParam{2, 3, 2, 8, 16, {1, 1}, {5, 7}, {1, 1}, {1, 1}, {0, 0}, {0, 0}},
+                         ConvFwdFamily::BatchedGemm);
+    EXPECT_EQ(plan.gemm_.Batch_, 3);
+    EXPECT_EQ(plan.gemm_.StrideA_, 3 * 16);
+}
+
+TEST(TestConvFwdPlanner, GroupedConvFwd)
+{
+    // stride 2 over an input of an odd length, the unread right pad is dropped
+    auto plan = check_plan<2>(
+        ConvParam{2, 1, 2, 8, 16, {1, 1}, {7, 7}, {2, 2}, {1, 1}, {0, 0}, {1, 1}},
+        ConvFwdFamily::GroupedConvFwd);
+    EXPECT_EQ(plan.param_.input_right_pads_, (std::vector<ck::index_t>{0, 0}));
+    EXPECT_EQ(plan.param_.output_spatial_lengths_, (std::vector<ck::index_t>{4, 4}));
+    EXPECT_EQ(plan.conv_fwd_specializations_,
+              (std::vector<ConvolutionForwardSpecialization>{
+                  ConvolutionForwardSpecialization::Filter1x1Pad0,
+                  ConvolutionForwardSpecialization::Default}));
+
+    // stride 2 over several groups
+    plan = check_plan<2>(ConvParam{2, 2, 2, 8, 16, {1, 1}, {8, 8}, {2, 2}, {1, 1}, {0, 0}, {0, 0}},
+                         ConvFwdFamily::GroupedConvFwd);
+    EXPECT_EQ(plan.conv_fwd_specializations_.front(),
+              ConvolutionForwardSpecialization::Filter1x1Pad0);
+
+    // padded 3x3x3 with few channels
+    plan = check_plan<3>(
+        ConvParam{3, 2, 2, 4, 3, {3, 3, 3}, {5, 6, 7}, {1, 2, 1}, {1, 1, 2}, {1, 1, 1}, {1, 1, 1}},
+        ConvFwdFamily::GroupedConvFwd);
+    EXPECT_EQ(plan.conv_fwd_specializations_,
+              (std::vector<ConvolutionForwardSpecialization>{
+                  ConvolutionForwardSpecialization::OddC,
+                  ConvolutionForwardSpecialization::Default}));
+
+    // depthwise 3x3
+    plan = check_plan<2>(ConvParam{2, 8, 2, 1, 1, {3, 3}, {9, 9}, {1, 1}, {1, 1}, {1, 1}, {1, 1}},
+                         ConvFwdFamily::GroupedConvFwd);
+    EXPECT_EQ(plan.conv_fwd_specializations_.front(), ConvolutionForwardSpecialization::OddC);
+
+    EXPECT_TRUE(ck::utils::conv::is_conv_fwd_instance_in_plan(
+        plan, "DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle<64, 64, 64, 32, Default, 32, 32>"));
+    EXPECT_FALSE(ck::utils::conv::is_conv_fwd_instance_in_plan(
+        plan, "DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle<64, 64, 64, 32, Filter1x1Pad0, 32>"));
+}
@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/error_bound.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+template <typename DataType, typename AccDataType>
+void run_gemm_oracle_test(std::size_t M, std::size_t N, std::size_t K)
+{
+    Tensor<DataType> a_m_k({M, K});
+    Tensor<DataType> b_k_n({K, N});
+    Tensor<DataType> c_m_n({M, N});
+    Tensor<DataType> c_m_n_oracle({M, N});
+    Tensor<double> c_m_n_err_bound({M, N});
+
+    ck::utils::FillUniformDistribution<DataType>{-1.f, 1.f}(a_m_k);
+    ck::utils::FillUniformDistribution<DataType>{-1.f, 1.f}(b_k_n);
+
+    using ReferenceGemm = ck::tensor_operation::host::ReferenceGemm<DataType,
+                                                                    DataType,
+                                                                    DataType,
+                                                                    AccDataType,
+                                                                    PassThrough,
+                                                                    PassThrough,
+                                                                    PassThrough>;
+
+    auto ref_gemm    = ReferenceGemm{};
+    auto ref_invoker = ref_gemm.MakeInvoker();
+
+    auto ref_argument =
+        ref_gemm.MakeArgument(a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+    ref_invoker.Run(ref_argument);
+
+    auto oracle_argument = ref_gemm.MakeArgument(
+        a_m_k, b_k_n, c_m_n_oracle, c_m_n_err_bound, PassThrough{}, PassThrough{}, PassThrough{});
+    ref_invoker.Run(oracle_argument);
+
+    // plain accumulation in AccDataType stays within the oracle bounds
+    EXPECT_TRUE(ck::utils::check_err(c_m_n, c_m_n_oracle, c_m_n_err_bound));
+
+    // bounds are finite and tighter than the magnitude of the accumulated terms
+    for(std::size_t i = 0; i < c_m_n_err_bound.mData.size(); ++i)
+    {
+        EXPECT_TRUE(std::isfinite(c_m_n_err_bound.mData[i]));
+        EXPECT_GT(c_m_n_err_bound.mData[i], 0.0);
+    }
+
+    // an error well above the bound is detected
+    Tensor<DataType> c_m_n_wrong = c_m_n;
+    c_m_n_wrong(0, 0) = ck::type_convert<DataType>(ck::type_convert<float>(c_m_n(0, 0)) +
+                                                   100.f * c_m_n_err_bound(0, 0) + 1.f);
+    EXPECT_FALSE(ck::utils::check_err(c_m_n_wrong, c_m_n_oracle, c_m_n_err_bound));
+}
+
+} // anonymous namespace
+
+TEST(ErrorBound, UnitRoundoff)
+{
+    EXPECT_EQ(ck::utils::get_unit_roundoff<float>(), std::ldexp(1.0, -24));
+    EXPECT_EQ(ck::utils::get_unit_roundoff<ck::half_t>(), std::ldexp(1.0, -11));
+    EXPECT_EQ(ck::utils::get_unit_roundoff<ck::bhalf_t>(), std::ldexp(1.0, -8));
+    EXPECT_EQ(ck::utils::get_unit_roundoff<int32_t>(), 0.0);
+}
+
+TEST(ErrorBound, ConvertDouble)
+{
+    // fp8 types are integral under clang, they must still be converted by value
+    EXPECT_EQ(ck::utils::to_double(ck::type_convert<ck::f8_t>(1.5f)), 1.5);
+    EXPECT_EQ(ck::utils::to_double(ck::type_convert<ck::bf8_t>(-3.f)), -3.0);
+    EXPECT_EQ(ck::type_convert<float>(ck::utils::from_double<ck::f8_t>(0.5)), 0.5f);
+    EXPECT_EQ(ck::type_convert<float>(ck::utils::from_double<ck::bf8_t>(2.0)), 2.0f);
+    EXPECT_EQ(ck::utils::to_double(ck::type_convert<ck::bhalf_t>(1.5f)), 1.5);
+    EXPECT_EQ(ck::utils::from_double<int32_t>(7.0), 7);
+}
+
+TEST(ErrorBound, CompensatedDotProduct)
+{
+    // naive summation in double loses the small terms completely
+    const std::vector<double> a{1e16, 1.0, -1e16, 1.0};
+
+    ck::utils::CompensatedDotProduct dot;
+    for(double v : a)
+    {
+        dot.Add(v, 1.0);
+    }
+
+    EXPECT_EQ(dot.GetValue(), 2.0);
+    EXPECT_EQ(dot.GetAbsValue(), 2e16 + 2.0);
+    EXPECT_EQ(dot.GetLength(), a.size());
+}
+
+TEST(ErrorBound, AccumulationBound)
+{
+    const double u = ck::utils::get_unit_roundoff<float>();
+
+    const double deterministic = ck::utils::get_accumulation_error_bound(
+        4096, 1.0, u, ck::utils::ErrorBoundMode::Deterministic);
+    const double probabilistic = ck::utils::get_accumulation_error_bound(
+        4096, 1.0, u, ck::utils::ErrorBoundMode::Probabilistic);
+
+    EXPECT_GT(deterministic, 4096 * u);
+    EXPECT_LT(probabilistic, deterministic);
+    EXPECT_EQ(ck::utils::get_accumulation_error_bound(4096, 1.0, 0.0), 0.0);
+}
+
+TEST(ErrorBound, GemmOracleFp32) { run_gemm_oracle_test<float, float>(16, 16, 4096); }
+
+TEST(ErrorBound, GemmOracleFp16) { run_gemm_oracle_test<ck::half_t, float>(16, 16, 1024); }
+
+TEST(ErrorBound, GemmOracleBf16) { run_gemm_oracle_test<ck::bhalf_t, float>(16, 16, 1024); }
+
+TEST(ErrorBound, ConvFwdOracle)
+{
+    using InLayout  = ck::tensor_layout::convolution::GNHWC;
+    using WeiLayout = ck::tensor_layout::convolution::GKYXC;
+    using OutLayout = ck::tensor_layout::convolution::GNHWK;
+
+    ck::utils::conv::ConvParam conv_param(2,
+                                          1,
+                                          2,
+                                          8,
+                                          256,
+                                          std::vector<ck::index_t>{3, 3},
+                                          std::vector<ck::index_t>{8, 8},
+                                          std::vector<ck::index_t>{1, 1},
+                                          std::vector<ck::index_t>{1, 1},
+                                          std::vector<ck::index_t>{1, 1},
+                                          std::vector<ck::index_t>{1, 1});
+
+    const auto in_desc =
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param);
+    const auto wei_desc =
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(conv_param);
+    const auto out_desc =
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(conv_param);
+
+    Tensor<ck::half_t> input(in_desc);
+    Tensor<ck::half_t> weight(wei_desc);
+    Tensor<ck::half_t> output(out_desc);
+    Tensor<ck::half_t> output_oracle(out_desc);
+    Tensor<double> output_err_bound(out_desc);
+
+    ck::utils::FillUniformDistribution<ck::half_t>{-1.f, 1.f}(input);
+    ck::utils::FillUniformDistribution<ck::half_t>{-1.f, 1.f}(weight);
+
+    auto ref_conv    = ck::tensor_operation::host::ReferenceConvFwd<2,
+                                                                 ck::half_t,
+                                                                 ck::half_t,
+                                                                 ck::half_t,
+                                                                 PassThrough,
+                                                                 PassThrough,
+                                                                 PassThrough>{};
+    auto ref_invoker = ref_conv.MakeInvoker();
+
+    auto ref_argument = ref_conv.MakeArgument(input,
+                                              weight,
+                                              output,
+                                              conv_param.conv_filter_strides_,
+                                              conv_param.conv_filter_dilations_,
+                                              conv_param.input_left_pads_,
+                                              conv_param.input_right_pads_,
+                                              PassThrough{},
+                                              PassThrough{},
+                                              PassThrough{});
+    ref_invoker.Run(ref_argument);
+
+    auto oracle_argument = ref_conv.MakeArgument(input,
+                                                 weight,
+                                                 output_oracle,
+                                                 output_err_bound,
+                                                 conv_param.conv_filter_strides_,
+                                                 conv_param.conv_filter_dilations_,
+                                                 conv_param.input_left_pads_,
+                                                 conv_param.input_right_pads_,
+                                                 PassThrough{},
+                                                 PassThrough{},
+                                                 PassThrough{});
+    ref_invoker.Run(oracle_argument);
+
+    EXPECT_TRUE(ck::utils::check_err(output, output_oracle, output_err_bound));
+}
@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/fusion_planner.hpp"
+
+using ck::utils::fusion::FusionGraph;
+using ck::utils::fusion::make_fusion_plan;
+using ck::utils::fusion::make_unfused_plan;
+
+namespace {
+
+constexpr ck::long_index_t M = 256;
+constexpr ck::long_index_t N = 1024;
+constexpr ck::long_index_t K = 512;
+
+constexpr std::size_t fp16_size = 2;
+
+std::size_t get_num_bytes(const FusionGraph& graph, const std::vector<ck::index_t>& tensors)
+{
+    std::size_t num_bytes = 0;
+
+    for(const ck::index_t tensor : tensors)
+        num_bytes += graph.GetTensors()[tensor].GetNumBytes();
+
+    return num_bytes;
+}
+
+} // namespace
+
+TEST(TestFusionPlanner, GemmBiasGeluResidualLayerNorm)
+{
+    FusionGraph graph;
+
+    const auto x        = graph.AddTensor({M, K}, fp16_size);
+    const auto w        = graph.AddTensor({K, N}, fp16_size);
+    const auto bias     = graph.AddTensor({N}, fp16_size);
+    const auto residual = graph.AddTensor({M, N}, fp16_size);
+    const auto gamma    = graph.AddTensor({N}, fp16_size);
+    const auto beta     = graph.AddTensor({N}, fp16_size);
+
+    const auto gemm = graph.AddGemm(x, w);
+    const auto add  = graph.AddAdd(gemm, bias);
+    const auto gelu = graph.AddFastGelu(add);
+    const auto sum  = graph.AddAdd(gelu, residual);
+    const auto y    = graph.AddLayerNorm(sum, gamma, beta);
+
+    const auto plan = make_fusion_plan(graph);
+
+    ASSERT_EQ(plan.ops_.size(), 2);
+    EXPECT_EQ(plan.ops_[0].device_op_, "DeviceGemmMultipleD<AddFastGelu>");
+    EXPECT_EQ(plan.ops_[0].inputs_, (std::vector<ck::index_t>{x, w, bias}));
+    EXPECT_EQ(plan.ops_[0].output_, gelu);
+    EXPECT_EQ(plan.ops_[1].device_op_, "DeviceElementwiseNormalization<Add>");
+    EXPECT_EQ(plan.ops_[1].inputs_, (std::vector<ck::index_t>{gelu, residual, gamma, beta}));
+    EXPECT_EQ(plan.ops_[1].output_, y);
+
+    // the GELU output is the only intermediate written and read back
+    EXPECT_EQ(plan.bytes_, get_num_bytes(graph, {x, w, bias, residual, gamma, beta, y}) +
+                               2 * get_num_bytes(graph, {gelu}));
+    EXPECT_EQ(plan.bytes_, 3414016);
+
+    // every intermediate is, and the residual sum is normalized in a separate pass
+    EXPECT_EQ(plan.unfused_bytes_,
+              get_num_bytes(graph, {x, w, bias, residual, gamma, beta, y}) +
+                  2 * get_num_bytes(graph, {gemm, add, gelu, sum}));
+    EXPECT_EQ(plan.unfused_bytes_, 6559744);
+    EXPECT_EQ(make_unfused_plan(graph).bytes_, plan.unfused_bytes_);
+}
+
+TEST(TestFusionPlanner, GemmBiasReluResidualLayerNorm)
+{
+    FusionGraph graph;
+
+    const auto x        = graph.AddTensor({M, K}, fp16_size);
+    const auto w        = graph.AddTensor({K, N}, fp16_size);
+    const auto bias     = graph.AddTensor({N}, fp16_size);
+    const auto residual = graph.AddTensor({M, N}, fp16_size);
+    const auto gamma    = graph.AddTensor({N}, fp16_size);
+    const auto beta     = graph.AddTensor({N}, fp16_size);
+
+    const auto sum = graph.AddAdd(graph.AddRelu(graph.AddAdd(graph.AddGemm(x, w), bias)), residual);
+    const auto y   = graph.AddLayerNorm(sum, gamma, beta);
+
+    const auto plan = make_fusion_plan(graph);
+
+    ASSERT_EQ(plan.ops_.size(), 1);
+    EXPECT_EQ(plan.ops_[0].device_op_, "DeviceGemmMultipleDLayernorm<AddReluAdd>");
+    EXPECT_EQ(plan.ops_[0].nodes_.size(), 5);
+    EXPECT_EQ(plan.ops_[0].output_, y);
+
+    // the residual sum goes through a workspace between the GEMM and the normalization
+    EXPECT_EQ(plan.ops_[0].workspace_bytes_, 2 * get_num_bytes(graph, {sum}));
+    EXPECT_EQ(plan.bytes_,
+              get_num_bytes(graph, {x, w, bias, residual, gamma, beta, y}) +
+                  plan.ops_[0].workspace_bytes_);
+}
+
+TEST(TestFusionPlanner, Attention)
+{
+    constexpr ck::long_index_t G = 16;
+
+    FusionGraph graph;
+
+    const auto q = graph.AddTensor({G, M, 64}, fp16_size);
+    const auto k = graph.AddTensor({G, 64, M}, fp16_size);
+    const auto v = graph.AddTensor({G, M, 64}, fp16_size);
+
+    const auto p   = graph.AddSoftmax(graph.AddScale(graph.AddGemm(q, k)));
+    const auto out = graph.AddGemm(p, v);
+
+    const auto plan = make_fusion_plan(graph);
+
+    ASSERT_EQ(plan.ops_.size(), 1);
+    EXPECT_EQ(plan.ops_[0].device_op_, "DeviceBatchedGemmSoftmaxGemmPermute");
+    EXPECT_EQ(plan.ops_[0].inputs_, (std::vector<ck::index_t>{q, k, v}));
+    EXPECT_EQ(plan.bytes_, get_num_bytes(graph, {q, k, v, out}));
+
+    // the probabilities as the B matrix of the second GEMM are not fused
+    FusionGraph transposed_graph;
+
+    const auto q_t = transposed_graph.AddTensor({G, M, M}, fp16_size);
+    const auto k_t = transposed_graph.AddTensor({G, M, M}, fp16_size);
+    const auto v_t = transposed_graph.AddTensor({G, M, M}, fp16_size);
+
+    transposed_graph.AddGemm(v_t, transposed_graph.AddSoftmax(transposed_graph.AddGemm(q_t, k_t)));
+
+    const auto transposed_plan = make_fusion_plan(transposed_graph);
+
+    ASSERT_EQ(transposed_plan.ops_.size(), 3);
+    EXPECT_EQ(transposed_plan.ops_[0].device_op_, "DeviceBatchedGemm");
+    EXPECT_EQ(transposed_plan.ops_[1].device_op_, "DeviceSoftmax");
+    EXPECT_EQ(transposed_plan.ops_[2].device_op_, "DeviceBatchedGemm");
+}
+
+TEST(TestFusionPlanner, ConvScaleAddAddRelu)
+{
+    FusionGraph graph;
+
+    const auto in   = graph.AddTensor({1, 32, 28, 28, 64}, fp16_size);
+    const auto wei  = graph.AddTensor({1, 64, 3, 3, 64}, fp16_size);
+    const auto d0   = graph.AddTensor({1, 32, 28, 28, 64}, fp16_size);
+    const auto d1   = graph.AddTensor({64}, fp16_size);
+    const auto conv = graph.AddConv(in, wei, {1, 32, 28, 28, 64});
+
+    graph.AddRelu(graph.AddAdd(graph.AddAdd(graph.AddScale(conv), d0), d1));
+
+    const auto plan = make_fusion_plan(graph);
+
+    ASSERT_EQ(plan.ops_.size(), 1);
+    EXPECT_EQ(plan.ops_[0].device_op_, "DeviceGroupedConvFwdMultipleABD<ScaleAddScaleAddRelu>");
+    EXPECT_EQ(plan.ops_[0].inputs_, (std::vector<ck::index_t>{in, wei, d0, d1}));
+}
+
+TEST(TestFusionPlanner, Chains)
+{
+    FusionGraph graph;
+
+    const auto a = graph.AddTensor({M, K}, fp16_size);
+    const auto b = graph.AddTensor({K, N}, fp16_size);
+    const auto c = graph.AddTensor({M, N}, fp16_size);
+
+    // the GEMM output is read twice, so it is materialized
+    const auto gemm = graph.AddGemm(a, b);
+    const auto sum  = graph.AddAdd(graph.AddFastGelu(gemm), gemm);
+
+    // the elementwise nodes after it run as a single kernel
+    graph.AddRelu(graph.AddMultiply(graph.AddScale(sum), c));
+
+    const auto plan = make_fusion_plan(graph);
+
+    ASSERT_EQ(plan.ops_.size(), 2);
+    EXPECT_EQ(plan.ops_[0].device_op_, "DeviceGemm");
+    EXPECT_EQ(plan.ops_[1].device_op_, "DeviceElementwise");
+    EXPECT_EQ(plan.ops_[1].nodes_.size(), 5);
+    EXPECT_EQ(plan.ops_[1].inputs_, (std::vector<ck::index_t>{gemm, c}));
+
+    const auto unfused_plan = make_unfused_plan(graph);
+
+    EXPECT_EQ(unfused_plan.ops_.size(), graph.GetNodes().size());
+    EXPECT_EQ(unfused_plan.bytes_, unfused_plan.unfused_bytes_);
+    EXPECT_LT(plan.bytes_, unfused_plan.bytes_);
+}
+
+TEST(TestFusionPlanner, InvalidGraph)
+{
+    FusionGraph graph;
+
+    const auto a = graph.AddTensor({M, K}, fp16_size);
+    const auto b = graph.AddTensor({N, K}, fp16_size);
+
+    EXPECT_THROW(graph.AddGemm(a, b), std::runtime_error);
+    EXPECT_THROW(graph.AddGemm(a, 2), std::runtime_error);
+    EXPECT_THROW(graph.AddRelu(-1), std::out_of_range);
+}
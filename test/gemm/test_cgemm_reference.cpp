@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ck/ck.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_cgemm.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+using ck::tensor_operation::host::CGemmAlgorithm;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using ReferenceInstance = ck::tensor_operation::host::
+    ReferenceCGemm<float, float, float, PassThrough, PassThrough, PassThrough>;
+
+namespace {
+
+void run_test(CGemmAlgorithm algorithm)
+{
+    // M, N, K
+    const std::vector<std::vector<std::size_t>> lengths = {
+        {1, 1, 1}, {64, 128, 256}, {37, 150, 300}, {130, 17, 5}};
+
+    for(const auto& l : lengths)
+    {
+        const std::size_t M = l[0], N = l[1], K = l[2];
+
+        Tensor<float> a_m_k_real({M, K});
+        Tensor<float> a_m_k_imag({M, K});
+        Tensor<float> b_k_n_real({K, N});
+        Tensor<float> b_k_n_imag({K, N});
+        Tensor<float> c_m_n_real({M, N});
+        Tensor<float> c_m_n_imag({M, N});
+        Tensor<float> c_m_n_real_naive({M, N});
+        Tensor<float> c_m_n_imag_naive({M, N});
+
+        a_m_k_real.GenerateTensorValue(GeneratorTensor_3<float>{-1.0, 1.0});
+        a_m_k_imag.GenerateTensorValue(GeneratorTensor_3<float>{-1.0, 1.0});
+        b_k_n_real.GenerateTensorValue(GeneratorTensor_3<float>{-1.0, 1.0});
+        b_k_n_imag.GenerateTensorValue(GeneratorTensor_3<float>{-1.0, 1.0});
+
+        auto ref_argument = ReferenceInstance::MakeArgument(a_m_k_real,
+                                                            a_m_k_imag,
+                                                            b_k_n_real,
+                                                            b_k_n_imag,
+                                                            c_m_n_real,
+                                                            c_m_n_imag,
+                                                            PassThrough{},
+                                                            PassThrough{},
+                                                            PassThrough{},
+                                                            algorithm);
+        ReferenceInstance::MakeInvoker().Run(ref_argument);
+
+        c_m_n_real_naive.ForEach([&](auto& self, const auto& idx) {
+            double v_c_real = 0;
+            double v_c_imag = 0;
+
+            for(std::size_t k = 0; k < K; ++k)
+            {
+                double v_a_real = a_m_k_real(idx[0], k);
+                double v_a_imag = a_m_k_imag(idx[0], k);
+                double v_b_real = b_k_n_real(k, idx[1]);
+                double v_b_imag = b_k_n_imag(k, idx[1]);
+
+                v_c_real += v_a_real * v_b_real - v_a_imag * v_b_imag;
+                v_c_imag += v_a_real * v_b_imag + v_a_imag * v_b_real;
+            }
+
+            self(idx)                        = static_cast<float>(v_c_real);
+            c_m_n_imag_naive(idx[0], idx[1]) = static_cast<float>(v_c_imag);
+        });
+
+        // fp32 accumulation of up to K products of magnitude up to 4 (ThreeM)
+        EXPECT_TRUE(ck::utils::check_err(
+            c_m_n_real, c_m_n_real_naive, "Error: Incorrect results!", 1e-3, 1e-3));
+        EXPECT_TRUE(ck::utils::check_err(
+            c_m_n_imag, c_m_n_imag_naive, "Error: Incorrect results!", 1e-3, 1e-3));
+    }
+}
+
+} // namespace
+
+TEST(TestCGemmReference, FourM) { run_test(CGemmAlgorithm::FourM); }
+
+TEST(TestCGemmReference, ThreeM) { run_test(CGemmAlgorithm::ThreeM); }
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm_multiple_d.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/host_utility/device_prop.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/gemm_add_add_fastgelu.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace {
+
+using F16 = ck::half_t;
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+using PassThrough    = ck::tensor_operation::element_wise::PassThrough;
+using AddAddFastGelu = ck::tensor_operation::element_wise::AddAddFastGelu;
+
+using ck::tensor_operation::device::BaseArgument;
+using ck::tensor_operation::device::BaseInvoker;
+
+using DeviceOp = ck::tensor_operation::device::DeviceGemmMultipleD<Row,
+                                                                   Col,
+                                                                   ck::Tuple<Row, Row>,
+                                                                   Row,
+                                                                   F16,
+                                                                   F16,
+                                                                   ck::Tuple<F16, F16>,
+                                                                   F16,
+                                                                   PassThrough,
+                                                                   PassThrough,
+                                                                   AddAddFastGelu>;
+
+// an operation which does not override SetDataPointers()
+struct DeviceOpWithoutRebind : public DeviceOp
+{
+    std::unique_ptr<BaseArgument> MakeArgumentPointer(const void*,
+                                                      const void*,
+                                                      std::array<const void*, 2>,
+                                                      void*,
+                                                      ck::index_t,
+                                                      ck::index_t,
+                                                      ck::index_t,
+                                                      ck::index_t,
+                                                      ck::index_t,
+                                                      std::array<ck::index_t, 2>,
+                                                      ck::index_t,
+                                                      PassThrough,
+                                                      PassThrough,
+                                                      AddAddFastGelu) override
+    {
+        return std::make_unique<BaseArgument>();
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<BaseInvoker>();
+    }
+};
+
+// the A, B, D0 and D1 tensors of one problem, on host and on device
+struct GemmBuffers
+{
+    GemmBuffers(ck::index_t M, ck::index_t N, ck::index_t K)
+        : a_m_k_({M, K}, {K, 1}),
+          b_k_n_({K, N}, {1, K}),
+          d0_m_n_({M, N}, {N, 1}),
+          d1_m_n_({M, N}, {N, 1}),
+          a_device_buf_(sizeof(F16) * M * K),
+          b_device_buf_(sizeof(F16) * K * N),
+          d0_device_buf_(sizeof(F16) * M * N),
+          d1_device_buf_(sizeof(F16) * M * N)
+    {
+        ck::utils::FillUniformDistribution<F16>{-1.f, 1.f}(a_m_k_);
+        ck::utils::FillUniformDistribution<F16>{-1.f, 1.f}(b_k_n_);
+        ck::utils::FillUniformDistribution<F16>{-1.f, 1.f}(d0_m_n_);
+        ck::utils::FillUniformDistribution<F16>{-1.f, 1.f}(d1_m_n_);
+
+        a_device_buf_.ToDevice(a_m_k_.mData.data());
+        b_device_buf_.ToDevice(b_k_n_.mData.data());
+        d0_device_buf_.ToDevice(d0_m_n_.mData.data());
+        d1_device_buf_.ToDevice(d1_m_n_.mData.data());
+    }
+
+    std::array<const void*, 2> GetDsPointers() const
+    {
+        return {d0_device_buf_.GetDeviceBuffer(), d1_device_buf_.GetDeviceBuffer()};
+    }
+
+    Tensor<F16> a_m_k_;
+    Tensor<F16> b_k_n_;
+    Tensor<F16> d0_m_n_;
+    Tensor<F16> d1_m_n_;
+    DeviceMem a_device_buf_;
+    DeviceMem b_device_buf_;
+    DeviceMem d0_device_buf_;
+    DeviceMem d1_device_buf_;
+};
+
+} // anonymous namespace
+
+TEST(TestGemmMultipleDRebind, DefaultReturnsFalse)
+{
+    DeviceOpWithoutRebind op;
+
+    auto argument_ptr = op.MakeArgumentPointer(
+        nullptr, nullptr, {}, nullptr, 16, 16, 16, 16, 16, {16, 16}, 16, {}, {}, {});
+
+    EXPECT_FALSE(op.SetDataPointers(argument_ptr.get(), nullptr, nullptr, {}, nullptr));
+}
+
+TEST(TestGemmMultipleDRebind, RebindMatchesNewArgument)
+{
+    if(!ck::is_xdl_supported())
+    {
+        GTEST_SKIP();
+    }
+
+    constexpr ck::index_t M = 256;
+    constexpr ck::index_t N = 256;
+    constexpr ck::index_t K = 128;
+
+    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+        DeviceOp>::GetInstances();
+
+    // the argument is made on x and then rebound to y
+    GemmBuffers x(M, N, K);
+    GemmBuffers y(M, N, K);
+
+    Tensor<F16> e_m_n_rebind({M, N}, {N, 1});
+    Tensor<F16> e_m_n_new({M, N}, {N, 1});
+    DeviceMem e_x_device_buf(sizeof(F16) * M * N);
+    DeviceMem e_rebind_device_buf(sizeof(F16) * M * N);
+    DeviceMem e_new_device_buf(sizeof(F16) * M * N);
+
+    const auto make_argument = [&](DeviceOp& op, const GemmBuffers& buffers, DeviceMem& e_buf) {
+        return op.MakeArgumentPointer(buffers.a_device_buf_.GetDeviceBuffer(),
+                                      buffers.b_device_buf_.GetDeviceBuffer(),
+                                      buffers.GetDsPointers(),
+                                      e_buf.GetDeviceBuffer(),
+                                      M,
+                                      N,
+                                      K,
+                                      K,
+                                      K,
+                                      {N, N},
+                                      N,
+                                      PassThrough{},
+                                      PassThrough{},
+                                      AddAddFastGelu{});
+    };
+
+    std::size_t num_rebound = 0;
+    std::unique_ptr<BaseArgument> previous_argument_ptr;
+    std::string previous_type_id;
+
+    for(auto& op_ptr : op_ptrs)
+    {
+        auto argument_ptr = make_argument(*op_ptr, x, e_x_device_buf);
+
+        if(!op_ptr->IsSupportedArgument(argument_ptr.get()))
+            continue;
+
+        // an argument of another instance is rejected
+        if(previous_argument_ptr && op_ptr->GetTypeIdName() != previous_type_id)
+        {
+            EXPECT_FALSE(op_ptr->SetDataPointers(previous_argument_ptr.get(),
+                                                 y.a_device_buf_.GetDeviceBuffer(),
+                                                 y.b_device_buf_.GetDeviceBuffer(),
+                                                 y.GetDsPointers(),
+                                                 e_rebind_device_buf.GetDeviceBuffer()));
+        }
+
+        if(!op_ptr->SetDataPointers(argument_ptr.get(),
+                                    y.a_device_buf_.GetDeviceBuffer(),
+                                    y.b_device_buf_.GetDeviceBuffer(),
+                                    y.GetDsPointers(),
+                                    e_rebind_device_buf.GetDeviceBuffer()))
+            continue;
+
+        ++num_rebound;
+
+        e_rebind_device_buf.SetZero();
+        e_new_device_buf.SetZero();
+
+        op_ptr->MakeInvokerPointer()->Run(argument_ptr.get());
+
+        auto new_argument_ptr = make_argument(*op_ptr, y, e_new_device_buf);
+        op_ptr->MakeInvokerPointer()->Run(new_argument_ptr.get());
+
+        e_rebind_device_buf.FromDevice(e_m_n_rebind.mData.data());
+        e_new_device_buf.FromDevice(e_m_n_new.mData.data());
+
+        EXPECT_TRUE(ck::utils::check_err(e_m_n_rebind, e_m_n_new, op_ptr->GetTypeString()));
+
+        previous_argument_ptr = std::move(argument_ptr);
+        previous_type_id      = op_ptr->GetTypeIdName();
+    }
+
+    EXPECT_GT(num_rebound, 0u);
+}
@@ -0,0 +1,217 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/split_k_selector.hpp"
+
+#include "ck/library/utility/split_k_tuning_db.hpp"
+
+using ck::tensor_operation::device::SplitKCostModel;
+using ck::tensor_operation::device::SplitKProblem;
+using ck::tensor_operation::device::SplitKTile;
+using ck::tensor_operation::device::select_k_batch;
+
+namespace {
+
+const SplitKTile tile{256, 128, 32};
+
+SplitKCostModel make_model()
+{
+    SplitKCostModel model{};
+
+    model.num_cu_ = 120;
+
+    return model;
+}
+
+constexpr const char* op_name = "GemmXdlSplitKCShuffle_Default_RCR_B256_Vec8x8x8_256x128x4x8 "
+                                "LoopScheduler: Default, PipelineVersion: v1";
+
+// sweeps of a single instance in the format of a ckProfiler gemm_splitk log, the timings are
+// synthetic and only exercise the parsing, the model is checked against the logs in data/
+std::string make_log()
+{
+    const std::vector<std::tuple<std::string, std::vector<std::pair<int, float>>>> sweeps{
+        {"M = 256 N = 256 K = 16384",
+         {{1, 2.1f},
+          {2, 1.07f},
+          {4, 0.55f},
+          {8, 0.29f},
+          {16, 0.16f},
+          {32, 0.095f},
+          {40, 0.085f},
+          {64, 0.09f}}},
+        {"M = 3840 N = 3840 K = 3840", {{1, 0.4f}, {2, 0.44f}, {4, 0.47f}}},
+        {"M = 1024 N = 1024 K = 8192", {{1, 0.8f}, {2, 0.33f}, {4, 0.3f}}}};
+
+    std::ostringstream log;
+
+    log << "found 1 instances" << std::endl;
+
+    for(const auto& [problem, times] : sweeps)
+    {
+        for(const auto& [k_batch, time] : times)
+        {
+            log << "Perf: " << std::setw(10) << time << " ms, 1 TFlops, 1 GB/s, " << op_name
+                << ", instance id 3, KBatch " << k_batch << std::endl;
+        }
+
+        log << "DeviceGemmDl does not support this problem" << std::endl;
+        log << "Best Perf for datatype = f16 ALayout =  RowMajor BLayout =  ColumnMajor "
+            << problem << " StrideA = 0 StrideB = 0 StrideC = 0 KBatch = 1 : 1 ms, 1 TFlops, "
+            << "1 GB/s, " << op_name << std::endl;
+    }
+
+    return log.str();
+}
+
+} // namespace
+
+TEST(TestSplitKSelector, CostModel)
+{
+    const auto model = make_model();
+
+    // 2 tiles with 512 iterations each, the most splits of 9 iterations fitting in a wave
+    EXPECT_EQ(select_k_batch(SplitKProblem{1, 256, 256, 16384}, tile, model), 57);
+
+    // 450 tiles, already 4 waves
+    EXPECT_EQ(select_k_batch(SplitKProblem{1, 3840, 3840, 3840}, tile, model), 1);
+
+    // a single iteration
+    EXPECT_EQ(select_k_batch(SplitKProblem{1, 256, 256, 32}, tile, model), 1);
+
+    // the groups of a grouped convolution share the waves
+    EXPECT_EQ(select_k_batch(SplitKProblem{4, 256, 256, 16384}, tile, model), 15);
+
+    // empty groups of a grouped GEMM are skipped
+    EXPECT_EQ(select_k_batch(std::vector<SplitKProblem>{{1, 256, 256, 16384}, {1, 0, 256, 64}},
+                             tile,
+                             model),
+              57);
+    EXPECT_EQ(select_k_batch(std::vector<SplitKProblem>{{1, 0, 0, 0}}, tile, model), 1);
+
+    // more splits than iterations are never picked
+    SplitKCostModel many_cu_model = model;
+    many_cu_model.num_cu_         = 1024;
+
+    EXPECT_EQ(select_k_batch(SplitKProblem{1, 256, 256, 1024}, tile, many_cu_model), 32);
+
+    // without K padding only the splits dividing the 512 iterations are supported
+    SplitKTile unpadded_tile = tile;
+    unpadded_tile.PadK_      = false;
+
+    EXPECT_EQ(select_k_batch(SplitKProblem{1, 256, 256, 16384}, unpadded_tile, model), 32);
+    EXPECT_EQ(select_k_batch(SplitKProblem{1, 256, 256, 16384 + 16}, unpadded_tile, model), 1);
+
+    // and for every group of a grouped GEMM
+    EXPECT_EQ(select_k_batch(std::vector<SplitKProblem>{{1, 256, 256, 16384}, {1, 256, 256, 64}},
+                             unpadded_tile,
+                             model),
+              2);
+
+    // atomics which are paid for at k = 1 as well make the first split cheaper
+    SplitKTile atomic_tile          = tile;
+    atomic_tile.AtomicAtEverySplit_ = true;
+
+    EXPECT_EQ(select_k_batch(SplitKProblem{1, 2048, 2048, 1024}, tile, model), 1);
+    EXPECT_EQ(select_k_batch(SplitKProblem{1, 2048, 2048, 1024}, atomic_tile, model), 2);
+}
+
+TEST(TestSplitKSelector, TuningDb)
+{
+    std::istringstream log(make_log());
+
+    ck::utils::SplitKTuningDb db;
+
+    EXPECT_EQ(db.Load(log), 14);
+    EXPECT_EQ(db.GetRecords().front().op_name_, op_name);
+    EXPECT_EQ(db.GetRecords().back().K_, 8192);
+
+    EXPECT_EQ(db.FindBestKBatch(256, 256, 16384, op_name), 40);
+    EXPECT_EQ(db.FindBestKBatch(256, 256, 16384, "GemmXdlSplitKCShuffle"), 0);
+
+    SplitKTile op_tile{};
+
+    EXPECT_TRUE(ck::utils::get_split_k_tile(op_name, op_tile));
+    EXPECT_EQ(op_tile.MPerBlock_, 256);
+    EXPECT_EQ(op_tile.NPerBlock_, 128);
+    EXPECT_EQ(op_tile.KPerBlock_, 32);
+    EXPECT_FALSE(op_tile.PadK_);
+    EXPECT_TRUE(ck::utils::get_split_k_tile(
+        "GemmXdlSplitKCShuffle_MNKPadding_RCR_B256_Vec8x8x8_256x128x4x8 LoopScheduler: Default",
+        op_tile));
+    EXPECT_TRUE(op_tile.PadK_);
+    EXPECT_FALSE(ck::utils::get_split_k_tile("DeviceGemmDl<256, 128, 128, 16>", op_tile));
+
+    // the recorded sweep refines the model
+    const auto model = make_model();
+
+    EXPECT_EQ(ck::utils::select_k_batch(db, op_name, {1, 256, 256, 16384}, tile, model), 40);
+    EXPECT_EQ(
+        ck::utils::select_k_batch(db, "GemmXdlSplitKCShuffle", {1, 256, 256, 16384}, tile, model),
+        57);
+}
+
+TEST(TestSplitKSelector, EvaluateModel)
+{
+    std::istringstream log(make_log());
+
+    ck::utils::SplitKTuningDb db;
+    db.Load(log);
+
+    const auto report = ck::utils::evaluate_split_k_model(db, make_model());
+
+    // the model picks 2 splits instead of 4 for the last problem
+    EXPECT_EQ(report.num_sweeps_, 3);
+    EXPECT_EQ(report.num_best_, 2);
+    EXPECT_NEAR(report.max_slowdown_, 1.1f, 1e-4f);
+    EXPECT_NEAR(report.mean_slowdown_, 3.1f / 3.f, 1e-4f);
+}
+
+TEST(TestSplitKSelector, RecordedSweeps)
+{
+    const std::regex num_cu_regex(R"(_([0-9]+)cu\.log$)");
+
+    std::size_t num_logs = 0;
+
+    for(const auto& entry : std::filesystem::directory_iterator(CK_SPLIT_K_SWEEP_DIR))
+    {
+        const std::string path = entry.path().string();
+        std::smatch match;
+
+        if(!std::regex_search(path, match, num_cu_regex))
+            continue;
+
+        std::ifstream log(path);
+
+        ck::utils::SplitKTuningDb db;
+        db.Load(log);
+
+        SplitKCostModel model{};
+        model.num_cu_ = std::stoi(match[1]);
+
+        const auto report = ck::utils::evaluate_split_k_model(db, model);
+
+        EXPECT_GT(report.num_sweeps_, 0u) << path;
+        EXPECT_LE(report.mean_slowdown_, 1.1f) << path;
+        EXPECT_LE(report.max_slowdown_, 1.5f) << path;
+
+        ++num_logs;
+    }
+
+    if(num_logs == 0)
+    {
+        GTEST_SKIP() << "no recorded gemm_splitk sweep in " << CK_SPLIT_K_SWEEP_DIR;
+    }
+}
@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/host_utility/device_prop.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/grouped_convolution_forward.hpp"
+
+#include "ck/library/utility/algorithm.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace {
+
+using F16 = ck::half_t;
+
+using InLayout  = ck::tensor_layout::convolution::NHWGC;
+using WeiLayout = ck::tensor_layout::convolution::GKYXC;
+using OutLayout = ck::tensor_layout::convolution::NHWGK;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using ck::tensor_operation::device::BaseArgument;
+
+using DeviceOp = ck::tensor_operation::device::DeviceGroupedConvFwdMultipleABD<2,
+                                                                               InLayout,
+                                                                               WeiLayout,
+                                                                               ck::Tuple<>,
+                                                                               OutLayout,
+                                                                               F16,
+                                                                               F16,
+                                                                               ck::Tuple<>,
+                                                                               F16,
+                                                                               PassThrough,
+                                                                               PassThrough,
+                                                                               PassThrough>;
+
+// the input and weight of one problem, on host and on device
+struct ConvBuffers
+{
+    ConvBuffers(const HostTensorDescriptor& in_desc, const HostTensorDescriptor& wei_desc)
+        : input_(in_desc),
+          weight_(wei_desc),
+          in_device_buf_(sizeof(F16) * in_desc.GetElementSpaceSize()),
+          wei_device_buf_(sizeof(F16) * wei_desc.GetElementSpaceSize())
+    {
+        ck::utils::FillUniformDistribution<F16>{-1.f, 1.f}(input_);
+        ck::utils::FillUniformDistribution<F16>{-1.f, 1.f}(weight_);
+
+        in_device_buf_.ToDevice(input_.mData.data());
+        wei_device_buf_.ToDevice(weight_.mData.data());
+    }
+
+    Tensor<F16> input_;
+    Tensor<F16> weight_;
+    DeviceMem in_device_buf_;
+    DeviceMem wei_device_buf_;
+};
+
+} // anonymous namespace
+
+TEST(TestGroupedConvndFwdRebind, RebindMatchesNewArgument)
+{
+    if(!ck::is_xdl_supported())
+    {
+        GTEST_SKIP();
+    }
+
+    const ck::utils::conv::ConvParam conv_param{
+        2, 2, 4, 64, 32, {3, 3}, {14, 14}, {1, 1}, {1, 1}, {1, 1}, {1, 1}};
+
+    const auto in_desc =
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param);
+    const auto wei_desc =
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(conv_param);
+    const auto out_desc =
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(
+            conv_param);
+
+    std::array<ck::index_t, 5> a_g_n_c_wis_lengths{};
+    std::array<ck::index_t, 5> a_g_n_c_wis_strides{};
+    std::array<ck::index_t, 5> b_g_k_c_xs_lengths{};
+    std::array<ck::index_t, 5> b_g_k_c_xs_strides{};
+    std::array<ck::index_t, 5> e_g_n_k_wos_lengths{};
+    std::array<ck::index_t, 5> e_g_n_k_wos_strides{};
+    std::array<ck::index_t, 2> conv_filter_strides{};
+    std::array<ck::index_t, 2> conv_filter_dilations{};
+    std::array<ck::index_t, 2> input_left_pads{};
+    std::array<ck::index_t, 2> input_right_pads{};
+
+    auto copy = [](const auto& x, auto& y) { ck::ranges::copy(x, y.begin()); };
+
+    copy(in_desc.GetLengths(), a_g_n_c_wis_lengths);
+    copy(in_desc.GetStrides(), a_g_n_c_wis_strides);
+    copy(wei_desc.GetLengths(), b_g_k_c_xs_lengths);
+    copy(wei_desc.GetStrides(), b_g_k_c_xs_strides);
+    copy(out_desc.GetLengths(), e_g_n_k_wos_lengths);
+    copy(out_desc.GetStrides(), e_g_n_k_wos_strides);
+    copy(conv_param.conv_filter_strides_, conv_filter_strides);
+    copy(conv_param.conv_filter_dilations_, conv_filter_dilations);
+    copy(conv_param.input_left_pads_, input_left_pads);
+    copy(conv_param.input_right_pads_, input_right_pads);
+
+    // the argument is made on x and then rebound to y
+    ConvBuffers x(in_desc, wei_desc);
+    ConvBuffers y(in_desc, wei_desc);
+
+    Tensor<F16> out_rebind(out_desc);
+    Tensor<F16> out_new(out_desc);
+    DeviceMem out_x_device_buf(sizeof(F16) * out_desc.GetElementSpaceSize());
+    DeviceMem out_rebind_device_buf(sizeof(F16) * out_desc.GetElementSpaceSize());
+    DeviceMem out_new_device_buf(sizeof(F16) * out_desc.GetElementSpaceSize());
+
+    const auto make_argument = [&](DeviceOp& op, const ConvBuffers& buffers, DeviceMem& out_buf) {
+        return op.MakeArgumentPointer(buffers.in_device_buf_.GetDeviceBuffer(),
+                                      buffers.wei_device_buf_.GetDeviceBuffer(),
+                                      {},
+                                      out_buf.GetDeviceBuffer(),
+                                      a_g_n_c_wis_lengths,
+                                      a_g_n_c_wis_strides,
+                                      b_g_k_c_xs_lengths,
+                                      b_g_k_c_xs_strides,
+                                      {},
+                                      {},
+                                      e_g_n_k_wos_lengths,
+                                      e_g_n_k_wos_strides,
+                                      conv_filter_strides,
+                                      conv_filter_dilations,
+                                      input_left_pads,
+                                      input_right_pads,
+                                      PassThrough{},
+                                      PassThrough{},
+                                      PassThrough{});
+    };
+
+    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+        DeviceOp>::GetInstances();
+
+    std::size_t num_rebound = 0;
+    std::unique_ptr<BaseArgument> previous_argument_ptr;
+    std::string previous_type_id;
+
+    for(auto& op_ptr : op_ptrs)
+    {
+        const std::string op_name = op_ptr->GetTypeString();
+
+        auto argument_ptr = make_argument(*op_ptr, x, out_x_device_buf);
+
+        if(!op_ptr->IsSupportedArgument(argument_ptr.get()))
+            continue;
+
+        // an argument of another instance is rejected
+        if(previous_argument_ptr && op_ptr->GetTypeIdName() != previous_type_id)
+        {
+            EXPECT_FALSE(op_ptr->SetDataPointers(previous_argument_ptr.get(),
+                                                 y.in_device_buf_.GetDeviceBuffer(),
+                                                 y.wei_device_buf_.GetDeviceBuffer(),
+                                                 {},
+                                                 out_rebind_device_buf.GetDeviceBuffer()));
+        }
+
+        const bool rebound = op_ptr->SetDataPointers(argument_ptr.get(),
+                                                     y.in_device_buf_.GetDeviceBuffer(),
+                                                     y.wei_device_buf_.GetDeviceBuffer(),
+                                                     {},
+                                                     out_rebind_device_buf.GetDeviceBuffer());
+
+        // only the XDL instances override SetDataPointers(), the others keep the default
+        EXPECT_EQ(rebound, op_name.rfind("DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle", 0) == 0)
+            << op_name;
+
+        if(!rebound)
+            continue;
+
+        ++num_rebound;
+
+        out_rebind_device_buf.SetZero();
+        out_new_device_buf.SetZero();
+
+        op_ptr->MakeInvokerPointer()->Run(argument_ptr.get());
+
+        auto new_argument_ptr = make_argument(*op_ptr, y, out_new_device_buf);
+        op_ptr->MakeInvokerPointer()->Run(new_argument_ptr.get());
+
+        out_rebind_device_buf.FromDevice(out_rebind.mData.data());
+        out_new_device_buf.FromDevice(out_new.mData.data());
+
+        EXPECT_TRUE(ck::utils::check_err(out_rebind, out_new, op_name));
+
+        previous_argument_ptr = std::move(argument_ptr);
+        previous_type_id      = op_ptr->GetTypeIdName();
+    }
+
+    EXPECT_GT(num_rebound, 0u);
+}
@@ -0,0 +1,172 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_io.hpp"
+
+using ck::utils::load_tensor;
+using ck::utils::MappedTensor;
+using ck::utils::save_tensor;
+using ck::utils::TensorFileDataType;
+using ck::utils::TensorFileFormat;
+using ck::utils::TensorFileInfo;
+using ck::utils::TensorFileWriter;
+
+namespace {
+
+template <typename DataType>
+void fill(Tensor<DataType>& a)
+{
+    for(std::size_t i = 0; i < a.mData.size(); ++i)
+        a.mData[i] = static_cast<DataType>(i % 127);
+}
+
+// removes the file when going out of scope
+class TempFile
+{
+    public:
+    explicit TempFile(const std::string& file_name) : file_name_(file_name) {}
+
+    ~TempFile() { std::remove(file_name_.c_str()); }
+
+    const std::string& GetName() const { return file_name_; }
+
+    private:
+    std::string file_name_;
+};
+
+std::string read_file(const std::string& file_name)
+{
+    std::ifstream is(file_name, std::ios::binary);
+
+    return {std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+}
+
+} // namespace
+
+TEST(HostTensorIO, RoundTripCK)
+{
+    const TempFile file("test_host_tensor_io_round_trip.ckt");
+
+    Tensor<float> a(std::vector<std::size_t>{2, 3, 5, 7});
+    fill(a);
+
+    save_tensor(file.GetName(), a, "NHWC");
+
+    const MappedTensor<float> mapped(file.GetName());
+
+    EXPECT_EQ(mapped.GetLayout(), "NHWC");
+    EXPECT_EQ(mapped.GetLengths(), a.GetLengths());
+    EXPECT_EQ(mapped.GetStrides(), a.GetStrides());
+    EXPECT_EQ(mapped(1, 2, 4, 6), a(1, 2, 4, 6));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapped.data()) % 64, 0);
+
+    const auto b = load_tensor<float>(file.GetName());
+
+    EXPECT_EQ(b.mData, a.mData);
+}
+
+TEST(HostTensorIO, RoundTripNpy)
+{
+    const TempFile file("test_host_tensor_io_round_trip.npy");
+
+    Tensor<int8_t> a(std::vector<std::size_t>{4, 9, 3});
+    fill(a);
+
+    save_tensor(file.GetName(), a);
+
+    const std::string contents = read_file(file.GetName());
+
+    // what numpy.save writes for the same array
+    EXPECT_EQ(contents.substr(0, 8), std::string("\x93NUMPY\x01\x00", 8));
+    EXPECT_NE(contents.find("{'descr': '|i1', 'fortran_order': False, 'shape': (4, 9, 3), }"),
+              std::string::npos);
+    EXPECT_EQ((contents.size() - a.mData.size()) % 64, 0);
+    EXPECT_EQ(contents[contents.size() - a.mData.size() - 1], '\n');
+
+    const auto b = load_tensor<int8_t>(file.GetName());
+
+    EXPECT_EQ(b.GetStrides(), a.GetStrides());
+    EXPECT_EQ(b.mData, a.mData);
+}
+
+TEST(HostTensorIO, Strided)
+{
+    const TempFile ck_file("test_host_tensor_io_strided.ckt");
+    const TempFile npy_file("test_host_tensor_io_strided.npy");
+
+    // NCHW lengths in NHWC memory
+    Tensor<float> a(HostTensorDescriptor({2, 3, 4, 5}, {60, 1, 15, 3}));
+    fill(a);
+
+    save_tensor(ck_file.GetName(), a);
+    save_tensor(npy_file.GetName(), a);
+
+    for(const auto& file : {ck_file.GetName(), npy_file.GetName()})
+    {
+        // into packed NCHW
+        Tensor<float> b(a.GetLengths());
+        load_tensor(file, b, 2);
+
+        b.ForEach([&](auto& self, const std::vector<std::size_t>& idx) {
+            EXPECT_EQ(self(idx), a(idx));
+        });
+    }
+
+    // the CK format keeps the strides
+    EXPECT_EQ(MappedTensor<float>(ck_file.GetName()).GetStrides(), a.GetStrides());
+}
+
+TEST(HostTensorIO, Errors)
+{
+    const TempFile file("test_host_tensor_io_errors.ckt");
+
+    Tensor<float> a(std::vector<std::size_t>{8, 8});
+    fill(a);
+
+    save_tensor(file.GetName(), a);
+
+    EXPECT_THROW(MappedTensor<int32_t>{file.GetName()}, std::runtime_error);
+
+    Tensor<float> b(std::vector<std::size_t>{8, 4});
+    EXPECT_THROW(load_tensor(file.GetName(), b), std::runtime_error);
+
+    EXPECT_THROW(MappedTensor<float>{"test_host_tensor_io_missing.ckt"}, std::runtime_error);
+
+    // truncated data
+    const std::string contents = read_file(file.GetName());
+    std::ofstream(file.GetName(), std::ios::binary).write(contents.data(), contents.size() - 4);
+
+    EXPECT_THROW(MappedTensor<float>{file.GetName()}, std::runtime_error);
+}
+
+TEST(HostTensorIO, ChunkedWrite)
+{
+    const TempFile file("test_host_tensor_io_chunked.ckt");
+
+    Tensor<int32_t> a(std::vector<std::size_t>{1000});
+    fill(a);
+
+    // chunks not a multiple of the element size
+    save_tensor(file.GetName(), a, "", 7);
+
+    EXPECT_EQ(load_tensor<int32_t>(file.GetName()).mData, a.mData);
+
+    TensorFileWriter writer(file.GetName(),
+                            TensorFileInfo{TensorFileDataType::I32, a.mDesc, "", 0},
+                            TensorFileFormat::CK);
+
+    writer.Write(a.data(), 400 * sizeof(int32_t));
+
+    EXPECT_THROW(writer.Write(a.data(), 601 * sizeof(int32_t)), std::runtime_error);
+    EXPECT_THROW(writer.Close(), std::runtime_error);
+}
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ck/ck.hpp"
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+
+using ck::tensor_operation::device::BaseOperator;
+using namespace ck::tensor_operation::device::instance;
+
+namespace {
+
+template <ck::index_t BlockSize, ck::index_t MPerBlock>
+struct DeviceOpInstance : public BaseOperator
+{
+};
+
+using Op0 = DeviceOpInstance<256, 128>;
+using Op1 = DeviceOpInstance<256, 64>;
+using Op2 = DeviceOpInstance<128, 128>;
+
+} // namespace
+
+TEST(TestInstanceId, CompileTime)
+{
+    constexpr auto id0 = get_instance_id<Op0>();
+    constexpr auto id1 = get_instance_id<Op1>();
+    constexpr auto id2 = get_instance_id<Op2>();
+
+    static_assert(id0 != id1 && id0 != id2 && id1 != id2, "instance ids collide");
+    static_assert(id0 == get_instance_id<DeviceOpInstance<256, 128>>(), "unstable instance id");
+}
+
+TEST(TestInstanceId, Registry)
+{
+    std::vector<std::unique_ptr<BaseOperator>> op_ptrs;
+
+    add_device_operation_instances(op_ptrs, std::tuple<Op0, Op1, Op2>{});
+
+    ASSERT_EQ(op_ptrs.size(), size_t{3});
+    EXPECT_EQ(get_instance_id(*op_ptrs[0]), get_instance_id<Op0>());
+    EXPECT_EQ(get_instance_id(*op_ptrs[1]), get_instance_id<Op1>());
+    EXPECT_EQ(get_instance_id(*op_ptrs[2]), get_instance_id<Op2>());
+
+    // printed with leading zeros, as read back from manifests
+    EXPECT_EQ(get_instance_id_string(*op_ptrs[0]).size(), size_t{16});
+
+    // not added through add_device_operation_instances
+    EXPECT_EQ(get_instance_id(BaseOperator{}), uint64_t{0});
+}
@@ -0,0 +1,370 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ck/ck.hpp"
+#include "ck/utility/magic_division.hpp"
+#include "ck/tensor_description/multi_index_transform_helper.hpp"
+
+using ck::MagicDivision;
+
+namespace {
+
+// dividends around the multiples of the divisor and at both ends of the range
+std::vector<uint32_t> get_edge_dividends(uint32_t divisor)
+{
+    std::vector<uint32_t> dividends = {
+        0, 1, 2, 0x7fffffffU, 0x80000000U, UINT32_MAX - 1, UINT32_MAX};
+
+    for(uint64_t q : {uint64_t{1}, uint64_t{2}, uint64_t{UINT32_MAX} / divisor})
+    {
+        const uint64_t n = q * divisor;
+
+        for(uint64_t m : {n - 1, n, n + 1})
+        {
+            if(m <= UINT32_MAX)
+                dividends.push_back(static_cast<uint32_t>(m));
+        }
+    }
+
+    return dividends;
+}
+
+bool check_full_range(uint32_t dividend, uint32_t divisor)
+{
+    const auto magic = MagicDivision::CalculateMagicNumbersFullRange(divisor);
+
+    return MagicDivision::DoMagicDivisionFullRange(
+               dividend, magic[ck::Number<0>{}], magic[ck::Number<1>{}]) == dividend / divisor;
+}
+
+} // namespace
+
+TEST(TestMagicDivisionHost, ExhaustiveSmallDivisors)
+{
+    // every dividend within 24 bits for the smallest divisors, and the fast path on the same range
+    for(uint32_t divisor = 1; divisor <= 16; ++divisor)
+    {
+        const auto magic      = MagicDivision::CalculateMagicNumbers(divisor);
+        const auto multiplier = magic[ck::Number<0>{}];
+        const auto shift      = magic[ck::Number<1>{}];
+
+        for(uint32_t dividend = 0; dividend < (1U << 24); ++dividend)
+        {
+            const uint32_t quotient = dividend / divisor;
+
+            ASSERT_EQ(MagicDivision::DoMagicDivisionFullRange(dividend, multiplier, shift),
+                      quotient);
+            ASSERT_EQ(MagicDivision::DoMagicDivision(dividend, multiplier, shift), quotient);
+        }
+    }
+}
+
+TEST(TestMagicDivisionHost, FastPathDivisors)
+{
+    // the shift of the fast path stays below 32, larger divisors get no magic numbers
+    for(uint32_t divisor : {1U, 2U, 3U, 0x40000001U, 0x7fffffffU})
+    {
+        EXPECT_LT(MagicDivision::CalculateMagicShift(divisor), 32U) << divisor;
+        EXPECT_EQ(MagicDivision::CalculateMagicNumbers(divisor)[ck::Number<0>{}],
+                  MagicDivision::CalculateMagicNumbersFullRange(divisor)[ck::Number<0>{}]);
+    }
+
+    for(uint32_t divisor : {0U, 0x80000000U, 0x80000001U, UINT32_MAX})
+    {
+        EXPECT_EQ(MagicDivision::CalculateMagicMultiplier(divisor), 0U) << divisor;
+        EXPECT_EQ(MagicDivision::CalculateMagicShift(divisor), 0U) << divisor;
+    }
+
+    EXPECT_EQ(MagicDivision::CalculateMagicShift(0x80000001U), 0U);
+    EXPECT_EQ(MagicDivision::CalculateMagicNumbersFullRange(0x80000001U)[ck::Number<1>{}], 32U);
+}
+
+TEST(TestMagicDivisionHost, ExhaustiveLargeDividends)
+{
+    // windows just below 2^31 and 2^32, where the 33-bit sum of the magic division overflows
+    for(uint32_t divisor : {1U, 3U, 7U, 641U, 65537U, 0x7fffffffU, 0x80000000U, 0xfffffffbU})
+    {
+        for(uint64_t base : {uint64_t{1} << 31, uint64_t{1} << 32})
+        {
+            for(uint64_t dividend = base - (1U << 20); dividend < base; ++dividend)
+            {
+                ASSERT_TRUE(check_full_range(static_cast<uint32_t>(dividend), divisor))
+                    << dividend << " / " << divisor;
+            }
+        }
+    }
+}
+
+TEST(TestMagicDivisionHost, AllDivisors)
+{
+    // every divisor within 20 bits, every power of two and its neighbours, with edge dividends
+    std::vector<uint32_t> divisors;
+
+    for(uint32_t divisor = 1; divisor <= (1U << 20); ++divisor)
+        divisors.push_back(divisor);
+
+    for(uint32_t i = 20; i < 32; ++i)
+    {
+        divisors.push_back((1U << i) - 1);
+        divisors.push_back(1U << i);
+        divisors.push_back((1U << i) + 1);
+    }
+
+    divisors.push_back(UINT32_MAX);
+
+    for(uint32_t divisor : divisors)
+    {
+        for(uint32_t dividend : get_edge_dividends(divisor))
+        {
+            ASSERT_TRUE(check_full_range(dividend, divisor)) << dividend << " / " << divisor;
+        }
+    }
+}
+
+TEST(TestMagicDivisionHost, RandomFullRange)
+{
+    std::mt19937 gen(11939);
+    std::uniform_int_distribution<uint32_t> dis(1, UINT32_MAX);
+
+    for(int i = 0; i < 10000000; ++i)
+    {
+        // random bit width of the divisor, so that small divisors are covered as well
+        const uint32_t divisor  = std::max(dis(gen) >> (dis(gen) % 32), 1U);
+        const uint32_t dividend = dis(gen);
+
+        ASSERT_TRUE(check_full_range(dividend, divisor)) << dividend << " / " << divisor;
+    }
+}
+
+TEST(TestMagicDivisionHost, Signed)
+{
+    std::mt19937 gen(11939);
+    std::uniform_int_distribution<int32_t> dis(std::numeric_limits<int32_t>::min(),
+                                               std::numeric_limits<int32_t>::max());
+
+    std::vector<int32_t> divisors = {1, -1, 2, -2, 3, -3, 7, -7, 1000, -1000};
+    std::vector<int32_t> dividends = {0,
+                                      1,
+                                      -1,
+                                      2,
+                                      -2,
+                                      999,
+                                      -999,
+                                      1000,
+                                      -1000,
+                                      std::numeric_limits<int32_t>::max(),
+                                      std::numeric_limits<int32_t>::min() + 1,
+                                      std::numeric_limits<int32_t>::min()};
+
+    divisors.push_back(std::numeric_limits<int32_t>::max());
+    divisors.push_back(std::numeric_limits<int32_t>::min());
+
+    for(int i = 0; i < 1000; ++i)
+    {
+        divisors.push_back(dis(gen) >> (i % 31));
+        dividends.push_back(dis(gen));
+    }
+
+    for(int32_t divisor : divisors)
+    {
+        if(divisor == 0)
+            continue;
+
+        const ck::MDivSigned mdiv(divisor);
+
+        for(int32_t dividend : dividends)
+        {
+            // the quotient overflows
+            if(divisor == -1 && dividend == std::numeric_limits<int32_t>::min())
+                continue;
+
+            int32_t quotient, remainder;
+            mdiv.divmod(dividend, quotient, remainder);
+
+            ASSERT_EQ(quotient, dividend / divisor) << dividend << " / " << divisor;
+            ASSERT_EQ(remainder, dividend % divisor) << dividend << " % " << divisor;
+        }
+    }
+}
+
+TEST(TestMagicDivisionHost, LongIndex)
+{
+    std::mt19937_64 gen(11939);
+    std::uniform_int_distribution<uint64_t> dis(1, uint64_t{1} << 63);
+
+    constexpr ck::long_index_t max_index = std::numeric_limits<ck::long_index_t>::max();
+
+    std::vector<uint64_t> divisors = {1,
+                                      2,
+                                      3,
+                                      7,
+                                      641,
+                                      0xffffffffULL,
+                                      0x100000000ULL,
+                                      0x100000001ULL,
+                                      uint64_t{1} << 62,
+                                      (uint64_t{1} << 63) - 1,
+                                      uint64_t{1} << 63};
+    std::vector<ck::long_index_t> dividends = {
+        0, 1, -1, 641, -641, max_index, -max_index, std::numeric_limits<ck::long_index_t>::min()};
+
+    for(int i = 0; i < 1000; ++i)
+    {
+        divisors.push_back(std::max(dis(gen) >> (i % 64), uint64_t{1}));
+        dividends.push_back(static_cast<ck::long_index_t>(dis(gen) - 1) * (i % 2 == 0 ? 1 : -1));
+    }
+
+    for(uint64_t divisor : divisors)
+    {
+        const auto magic      = MagicDivision::CalculateMagicNumbers64(divisor);
+        const auto multiplier = magic[ck::Number<0>{}];
+        const auto shift      = magic[ck::Number<1>{}];
+
+        for(ck::long_index_t dividend : dividends)
+        {
+            // reference on the absolute values, which cover the dividend of -2^63
+            const uint64_t abs_dividend =
+                dividend < 0 ? 0ULL - static_cast<uint64_t>(dividend) : uint64_t(dividend);
+            const uint64_t abs_quotient = abs_dividend / divisor;
+            const ck::long_index_t quotient =
+                static_cast<ck::long_index_t>(dividend < 0 ? 0ULL - abs_quotient : abs_quotient);
+
+            ASSERT_EQ(MagicDivision::DoMagicDivision64(dividend, multiplier, shift), quotient)
+                << dividend << " / " << divisor;
+        }
+    }
+
+    // out of range divisors
+    EXPECT_EQ(MagicDivision::CalculateMagicNumbers64(0)[ck::Number<1>{}], 0U);
+    EXPECT_EQ(MagicDivision::CalculateMagicNumbers64((uint64_t{1} << 63) + 1)[ck::Number<0>{}],
+              0U);
+}
+
+TEST(TestMagicDivisionHost, MergeLongIndex)
+{
+    using ck::long_index_t;
+
+    // the upper length 2^42 + ... does not fit into index_t, so the Merge picks the 64-bit magic
+    // division
+    const auto low_lengths =
+        ck::make_tuple(long_index_t{4097}, long_index_t{1} << 20, long_index_t{1000003});
+
+    const auto merge_v2   = ck::Merge_v2_magic_division<ck::remove_cvref_t<decltype(low_lengths)>>{
+        low_lengths};
+    const auto merge_v2r2 = ck::Merge_v2r2_magic_division<
+        ck::remove_cvref_t<decltype(low_lengths)>>{low_lengths};
+
+    static_assert(std::is_same<decltype(merge_v2)::DivisionIndex, long_index_t>::value, "");
+    static_assert(std::is_same<decltype(merge_v2r2)::DivisionIndex, long_index_t>::value, "");
+
+    const long_index_t length2 = low_lengths[ck::Number<2>{}];
+    const long_index_t length1 = low_lengths[ck::Number<1>{}];
+    const long_index_t up_length =
+        low_lengths[ck::Number<0>{}] * length1 * length2;
+
+    std::mt19937_64 gen(11939);
+    std::uniform_int_distribution<long_index_t> dis(0, up_length - 1);
+
+    for(int i = 0; i < 100000; ++i)
+    {
+        const long_index_t up = i < 2 ? (i == 0 ? 0 : up_length - 1) : dis(gen);
+
+        const ck::Array<long_index_t, 1> idx_up{up};
+        ck::Array<long_index_t, 3> idx_low_v2{};
+        ck::Array<long_index_t, 3> idx_low_v2r2{};
+
+        merge_v2.CalculateLowerIndex(idx_low_v2, idx_up);
+        merge_v2r2.CalculateLowerIndex(idx_low_v2r2, idx_up);
+
+        for(const auto& idx_low : {idx_low_v2, idx_low_v2r2})
+        {
+            ASSERT_EQ(idx_low[0], up / (length1 * length2)) << up;
+            ASSERT_EQ(idx_low[1], up / length2 % length1) << up;
+            ASSERT_EQ(idx_low[2], up % length2) << up;
+        }
+    }
+
+    // index_t lengths keep the fast path
+    using Lengths32 = ck::Tuple<ck::index_t, ck::Number<8>>;
+
+    static_assert(
+        std::is_same<ck::Merge_v2_magic_division<Lengths32>::DivisionIndex, ck::index_t>::value,
+        "");
+
+    // and so do Sequence lengths, which e.g. SpaceFillingCurve merges
+    using LengthsSeq = ck::Sequence<3, 5, 7>;
+
+    static_assert(
+        std::is_same<ck::Merge_v2_magic_division<LengthsSeq>::DivisionIndex, ck::index_t>::value,
+        "");
+
+    const auto merge_seq = ck::Merge_v2_magic_division<LengthsSeq>{LengthsSeq{}};
+
+    for(ck::index_t up = 0; up < 3 * 5 * 7; ++up)
+    {
+        ck::Array<ck::index_t, 3> idx_low{};
+
+        merge_seq.CalculateLowerIndex(idx_low, ck::Array<ck::index_t, 1>{up});
+
+        ASSERT_EQ(idx_low[0], up / 35) << up;
+        ASSERT_EQ(idx_low[1], up / 7 % 5) << up;
+        ASSERT_EQ(idx_low[2], up % 7) << up;
+    }
+}
+
+TEST(TestMagicDivisionHost, MergeMixedIndex)
+{
+    using ck::long_index_t;
+
+    // a single long_index_t length makes the Merge use the 64-bit magic division, the magic
+    // numbers of the index_t and Number lengths must be the 64-bit ones too
+    const auto low_lengths =
+        ck::make_tuple((long_index_t{1} << 33) + 7, ck::Number<3>{}, ck::index_t{1000003});
+
+    using Lengths = ck::remove_cvref_t<decltype(low_lengths)>;
+
+    const auto merge_v2   = ck::Merge_v2_magic_division<Lengths>{low_lengths};
+    const auto merge_v2r2 = ck::Merge_v2r2_magic_division<Lengths>{low_lengths};
+
+    static_assert(std::is_same<decltype(merge_v2)::DivisionIndex, long_index_t>::value, "");
+    static_assert(
+        std::is_same<ck::remove_cvref_t<decltype(
+                         merge_v2.low_lengths_magic_divisor_multiplier_[ck::Number<1>{}])>,
+                     ck::integral_constant<uint64_t,
+                                           MagicDivision::CalculateMagicMultiplier(
+                                               long_index_t{3})>>::value,
+        "");
+
+    const long_index_t length2   = low_lengths[ck::Number<2>{}];
+    const long_index_t length1   = 3;
+    const long_index_t up_length = low_lengths[ck::Number<0>{}] * length1 * length2;
+
+    std::mt19937_64 gen(4099);
+    std::uniform_int_distribution<long_index_t> dis(0, up_length - 1);
+
+    for(int i = 0; i < 100000; ++i)
+    {
+        const long_index_t up = i < 2 ? (i == 0 ? 0 : up_length - 1) : dis(gen);
+
+        const ck::Array<long_index_t, 1> idx_up{up};
+        ck::Array<long_index_t, 3> idx_low_v2{};
+        ck::Array<long_index_t, 3> idx_low_v2r2{};
+
+        merge_v2.CalculateLowerIndex(idx_low_v2, idx_up);
+        merge_v2r2.CalculateLowerIndex(idx_low_v2r2, idx_up);
+
+        for(const auto& idx_low : {idx_low_v2, idx_low_v2r2})
+        {
+            ASSERT_EQ(idx_low[0], up / (length1 * length2)) << up;
+            ASSERT_EQ(idx_low[1], up / length2 % length1) << up;
+            ASSERT_EQ(idx_low[2], up % length2) << up;
+        }
+    }
+}
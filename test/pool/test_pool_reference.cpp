@@ -0,0 +1,268 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_pool_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_maxpool_bwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_avgpool_bwd.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "test_pool_fwd_common.hpp"
+
+namespace {
+
+// [N, C, D, H, W] lengths with NDHWC strides
+HostTensorDescriptor make_ndhwc_descriptor(const std::vector<index_t>& l)
+{
+    return HostTensorDescriptor(
+        std::vector<std::size_t>{static_cast<std::size_t>(l[0]),
+                                 static_cast<std::size_t>(l[1]),
+                                 static_cast<std::size_t>(l[2]),
+                                 static_cast<std::size_t>(l[3]),
+                                 static_cast<std::size_t>(l[4])},
+        std::vector<std::size_t>{static_cast<std::size_t>(l[1] * l[2] * l[3] * l[4]),
+                                 1,
+                                 static_cast<std::size_t>(l[1] * l[3] * l[4]),
+                                 static_cast<std::size_t>(l[1] * l[4]),
+                                 static_cast<std::size_t>(l[1])});
+}
+
+std::vector<index_t> get_out_lengths(const PoolingParam& p)
+{
+    std::vector<index_t> out = {p.length_[0], p.length_[1]};
+
+    for(int i = 0; i < 3; ++i)
+    {
+        index_t eff = (p.window_spatial_lengths_[i] - 1) * p.window_dilations_[i] + 1;
+        out.push_back((p.length_[i + 2] + p.input_left_pads_[i] + p.input_right_pads_[i] - eff) /
+                          p.window_strides_[i] +
+                      1);
+    }
+
+    return out;
+}
+
+// direct evaluation of every window, visiting the elements in (z, y, x) order
+template <typename F>
+void for_each_window_element(const PoolingParam& p,
+                             const Tensor<float>& in,
+                             std::size_t do_,
+                             std::size_t ho,
+                             std::size_t wo,
+                             F f)
+{
+    const auto& lengths = in.GetLengths();
+
+    for(index_t z = 0; z < p.window_spatial_lengths_[0]; ++z)
+        for(index_t y = 0; y < p.window_spatial_lengths_[1]; ++y)
+            for(index_t x = 0; x < p.window_spatial_lengths_[2]; ++x)
+            {
+                long di = do_ * p.window_strides_[0] + z * p.window_dilations_[0] -
+                          p.input_left_pads_[0];
+                long hi = ho * p.window_strides_[1] + y * p.window_dilations_[1] -
+                          p.input_left_pads_[1];
+                long wi = wo * p.window_strides_[2] + x * p.window_dilations_[2] -
+                          p.input_left_pads_[2];
+
+                if(di >= 0 && di < static_cast<long>(lengths[2]) && hi >= 0 &&
+                   hi < static_cast<long>(lengths[3]) && wi >= 0 &&
+                   wi < static_cast<long>(lengths[4]))
+                    f(di, hi, wi);
+            }
+}
+
+std::vector<PoolingParam> get_params()
+{
+    // length, window_length, window_stride, window_dilation, left_pad, right_pad
+    return {{{2, 5, 7, 9, 11}, {3, 3, 3}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}},
+            {{1, 3, 9, 10, 13}, {2, 3, 4}, {2, 1, 3}, {1, 2, 1}, {0, 1, 2}, {1, 0, 2}},
+            {{2, 70, 4, 6, 8}, {1, 2, 3}, {1, 2, 2}, {1, 1, 2}, {0, 0, 1}, {0, 1, 1}},
+            {{1, 2, 5, 5, 5}, {5, 5, 5}, {3, 3, 3}, {1, 1, 1}, {2, 2, 2}, {2, 2, 2}}};
+}
+
+} // namespace
+
+TEST(TestPoolReference, MaxPoolFwdWithIndex)
+{
+    for(const auto& p : get_params())
+    {
+        const auto out_lengths = get_out_lengths(p);
+
+        Tensor<float> in(make_ndhwc_descriptor(p.length_));
+        Tensor<float> out(make_ndhwc_descriptor(out_lengths));
+        Tensor<int32_t> out_indices(make_ndhwc_descriptor(out_lengths));
+
+        // few distinct values to exercise the tie breaking
+        in.GenerateTensorValue(GeneratorTensor_2<float>{-3, 3});
+
+        using ReferenceInstance =
+            ck::tensor_operation::host::ReferencePoolingFwd<5,
+                                                            3,
+                                                            float,
+                                                            float,
+                                                            float,
+                                                            int32_t,
+                                                            ck::ReduceTensorOp::MAX,
+                                                            false,
+                                                            true>;
+
+        auto ref_argument = ReferenceInstance::MakeArgument(in,
+                                                            out,
+                                                            out_indices,
+                                                            p.window_spatial_lengths_,
+                                                            p.window_strides_,
+                                                            p.window_dilations_,
+                                                            p.input_left_pads_,
+                                                            p.input_right_pads_);
+        ReferenceInstance::MakeInvoker().Run(ref_argument);
+
+        out.ForEach([&](auto& self, const auto& idx) {
+            float max_val   = ck::NumericLimits<float>::Lowest();
+            int32_t max_idx = 0;
+
+            for_each_window_element(p, in, idx[2], idx[3], idx[4], [&](long di, long hi, long wi) {
+                float v = in(idx[0], idx[1], di, hi, wi);
+                if(max_val < v)
+                {
+                    max_val = v;
+                    max_idx = in.GetOffsetFromMultiIndex(idx[0], idx[1], di, hi, wi);
+                }
+            });
+
+            EXPECT_EQ(self(idx), max_val);
+            EXPECT_EQ(out_indices(idx), max_idx);
+        });
+    }
+}
+
+TEST(TestPoolReference, AvgPoolFwd)
+{
+    for(const auto& p : get_params())
+    {
+        const auto out_lengths = get_out_lengths(p);
+
+        Tensor<float> in(make_ndhwc_descriptor(p.length_));
+        Tensor<float> out(make_ndhwc_descriptor(out_lengths));
+        Tensor<float> out_host(make_ndhwc_descriptor(out_lengths));
+        Tensor<int32_t> out_indices(make_ndhwc_descriptor(out_lengths));
+
+        in.GenerateTensorValue(GeneratorTensor_3<float>{-1.0, 1.0});
+
+        using ReferenceInstance =
+            ck::tensor_operation::host::ReferencePoolingFwd<5,
+                                                            3,
+                                                            float,
+                                                            float,
+                                                            float,
+                                                            int32_t,
+                                                            ck::ReduceTensorOp::AVG,
+                                                            false,
+                                                            false>;
+
+        auto ref_argument = ReferenceInstance::MakeArgument(in,
+                                                            out,
+                                                            out_indices,
+                                                            p.window_spatial_lengths_,
+                                                            p.window_strides_,
+                                                            p.window_dilations_,
+                                                            p.input_left_pads_,
+                                                            p.input_right_pads_);
+        ReferenceInstance::MakeInvoker().Run(ref_argument);
+
+        const float window_size = p.window_spatial_lengths_[0] * p.window_spatial_lengths_[1] *
+                                  p.window_spatial_lengths_[2];
+
+        out_host.ForEach([&](auto& self, const auto& idx) {
+            double sum = 0;
+
+            for_each_window_element(p, in, idx[2], idx[3], idx[4], [&](long di, long hi, long wi) {
+                sum += in(idx[0], idx[1], di, hi, wi);
+            });
+
+            self(idx) = sum / window_size;
+        });
+
+        EXPECT_TRUE(ck::utils::check_err(out, out_host));
+    }
+}
+
+TEST(TestPoolReference, MaxPoolBwd)
+{
+    for(const auto& p : get_params())
+    {
+        const auto out_lengths = get_out_lengths(p);
+
+        Tensor<float> in(make_ndhwc_descriptor(p.length_));
+        Tensor<float> dout(make_ndhwc_descriptor(out_lengths));
+        Tensor<int32_t> indices(make_ndhwc_descriptor(out_lengths));
+        Tensor<float> din(make_ndhwc_descriptor(p.length_));
+        Tensor<float> din_host(make_ndhwc_descriptor(p.length_));
+
+        dout.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+        indices.GenerateTensorValue(
+            GeneratorTensor_2<int32_t>{-1, static_cast<int>(in.GetElementSpaceSize()) + 1});
+
+        using PassThrough       = ck::tensor_operation::element_wise::PassThrough;
+        using ReferenceInstance = ck::tensor_operation::host::
+            ReferenceMaxPoolBwd<float, int32_t, float, float, PassThrough>;
+
+        auto ref_argument = ReferenceInstance::MakeArgument(dout, indices, din, PassThrough{});
+        ReferenceInstance::MakeInvoker().Run(ref_argument);
+
+        std::fill(din_host.mData.begin(), din_host.mData.end(), 0.f);
+        for(std::size_t i = 0; i < dout.mData.size(); ++i)
+        {
+            int32_t index = indices.mData[i];
+            if(index >= 0 && index < static_cast<int32_t>(din_host.mData.size()))
+                din_host.mData[index] += dout.mData[i];
+        }
+
+        EXPECT_TRUE(ck::utils::check_err(din, din_host));
+    }
+}
+
+TEST(TestPoolReference, AvgPoolBwd)
+{
+    for(const auto& p : get_params())
+    {
+        const auto out_lengths = get_out_lengths(p);
+
+        Tensor<float> in(make_ndhwc_descriptor(p.length_));
+        Tensor<float> dout(make_ndhwc_descriptor(out_lengths));
+        Tensor<float> din(make_ndhwc_descriptor(p.length_));
+        Tensor<float> din_host(make_ndhwc_descriptor(p.length_));
+
+        dout.GenerateTensorValue(GeneratorTensor_3<float>{-1.0, 1.0});
+
+        using ReferenceInstance = ck::tensor_operation::host::ReferenceAvgPoolBwd<3, float, float>;
+
+        auto ref_argument = ReferenceInstance::MakeArgument(din,
+                                                            dout,
+                                                            p.window_spatial_lengths_,
+                                                            p.window_strides_,
+                                                            p.window_dilations_,
+                                                            p.input_left_pads_,
+                                                            p.input_right_pads_);
+        ReferenceInstance::MakeInvoker().Run(ref_argument);
+
+        // transpose of the forward window sum
+        std::fill(din_host.mData.begin(), din_host.mData.end(), 0.f);
+
+        const float window_size = p.window_spatial_lengths_[0] * p.window_spatial_lengths_[1] *
+                                  p.window_spatial_lengths_[2];
+
+        dout.ForEach([&](auto& self, const auto& idx) {
+            for_each_window_element(p, in, idx[2], idx[3], idx[4], [&](long di, long hi, long wi) {
+                din_host(idx[0], idx[1], di, hi, wi) += self(idx) / window_size;
+            });
+        });
+
+        EXPECT_TRUE(ck::utils::check_err(din, din_host));
+    }
+}
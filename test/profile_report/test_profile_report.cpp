@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/profile_report.hpp"
+
+using ck::utils::append_profile_record;
+using ck::utils::diff_profile_results;
+using ck::utils::make_profile_report;
+using ck::utils::ProfileResults;
+
+namespace {
+
+constexpr std::size_t qkv_flop = std::size_t{2} * 384 * 768 * 768;
+constexpr std::size_t mlp_flop = std::size_t{2} * 384 * 3072 * 768;
+
+ProfileResults make_results(float gemm_time, float conv_time, float softmax_time)
+{
+    ProfileResults results;
+
+    results.Add({"gemm", "f16 MK_NK_MN 384 768 768", 12, gemm_time, qkv_flop});
+    results.Add({"gemm", "f16 MK_NK_MN 384 3072 768", 12, 2 * gemm_time, mlp_flop});
+    results.Add({"conv_fwd", "f16 NHWGC 2 1 32 64 64 3 3 56 56", 3, conv_time, 1000000});
+    results.Add({"softmax", "f16 2 384 384", 12, softmax_time, 0});
+
+    return results;
+}
+
+} // namespace
+
+TEST(ProfileReport, Report)
+{
+    const auto results = make_results(0.1f, 0.2f, 0.05f);
+
+    const auto report = make_profile_report(results);
+
+    // 12 * 0.1 + 12 * 0.2, 3 * 0.2, 12 * 0.05
+    EXPECT_NEAR(report.time_, 3.6 + 0.6 + 0.6, 1e-5);
+    ASSERT_EQ(report.families_.size(), 3);
+
+    EXPECT_EQ(report.families_[0].family_, "gemm");
+    EXPECT_EQ(report.families_[0].num_problems_, 2);
+    EXPECT_EQ(report.families_[0].count_, 24);
+    EXPECT_NEAR(report.families_[0].share_, 3.6 / 4.8, 1e-6);
+    EXPECT_EQ(report.families_[0].flop_, 12 * qkv_flop + 12 * mlp_flop);
+
+    EXPECT_NEAR(report.families_[1].share_ + report.families_[2].share_, 1.2 / 4.8, 1e-6);
+}
+
+TEST(ProfileReport, Merge)
+{
+    ProfileResults results;
+
+    results.Add({"conv_fwd", "a", 2, 0.5f, 10});
+    results.Add({"conv_fwd", "a", 1, 0.4f, 10});
+    results.Add({"conv_bwd_data", "a", 1, 0.3f, 10});
+
+    ASSERT_EQ(results.GetRecords().size(), 2);
+    EXPECT_EQ(results.GetRecords()[0].count_, 3);
+    EXPECT_FLOAT_EQ(results.GetRecords()[0].ave_time_, 0.4f);
+    EXPECT_EQ(results.Find("conv_bwd_weight", "a"), nullptr);
+}
+
+TEST(ProfileReport, SaveLoad)
+{
+    const auto results = make_results(0.125f, 0.25f, 0.0625f);
+
+    std::stringstream ss;
+    results.Save(ss);
+
+    ProfileResults loaded;
+
+    EXPECT_EQ(loaded.Load(ss), results.GetRecords().size());
+    ASSERT_EQ(loaded.GetRecords().size(), results.GetRecords().size());
+
+    for(std::size_t i = 0; i < results.GetRecords().size(); ++i)
+    {
+        EXPECT_EQ(loaded.GetRecords()[i].family_, results.GetRecords()[i].family_);
+        EXPECT_EQ(loaded.GetRecords()[i].problem_, results.GetRecords()[i].problem_);
+        EXPECT_EQ(loaded.GetRecords()[i].count_, results.GetRecords()[i].count_);
+        EXPECT_FLOAT_EQ(loaded.GetRecords()[i].ave_time_, results.GetRecords()[i].ave_time_);
+        EXPECT_EQ(loaded.GetRecords()[i].flop_, results.GetRecords()[i].flop_);
+    }
+
+    std::istringstream invalid("gemm\t256 256 256\t1\t0.1\n");
+    EXPECT_THROW(loaded.Load(invalid), std::runtime_error);
+
+    // records appended by separate profiler invocations
+    const std::string file_name = "test_profile_report_results.txt";
+    std::remove(file_name.c_str());
+
+    for(const auto& r : results.GetRecords())
+        append_profile_record(file_name, r);
+
+    std::ifstream is(file_name);
+    ProfileResults appended;
+
+    EXPECT_EQ(appended.Load(is), results.GetRecords().size());
+
+    std::remove(file_name.c_str());
+}
+
+TEST(ProfileReport, Diff)
+{
+    const auto base = make_results(0.1f, 0.2f, 0.05f);
+
+    // within the threshold
+    const auto same = diff_profile_results(base, make_results(0.102f, 0.198f, 0.05f), 0.05);
+
+    EXPECT_FALSE(same.HasRegression());
+    EXPECT_TRUE(same.regressions_.empty());
+    EXPECT_TRUE(same.improvements_.empty());
+
+    // slower softmax, faster conv
+    auto results = make_results(0.1f, 0.1f, 0.06f);
+    results.Add({"layernorm", "f16 384 768", 24, 0.01f, 0});
+
+    const auto diff = diff_profile_results(base, results, 0.05);
+
+    ASSERT_EQ(diff.regressions_.size(), 1);
+    EXPECT_EQ(diff.regressions_[0].family_, "softmax");
+    ASSERT_EQ(diff.improvements_.size(), 1);
+    EXPECT_EQ(diff.improvements_[0].family_, "conv_fwd");
+    ASSERT_EQ(diff.added_.size(), 1);
+    EXPECT_EQ(diff.added_[0].family_, "layernorm");
+    EXPECT_TRUE(diff.missing_.empty());
+    EXPECT_TRUE(diff.HasRegression());
+
+    // the model is faster even so
+    EXPECT_LT(diff.time_, diff.base_time_);
+
+    const auto reverse = diff_profile_results(results, base, 0.05);
+
+    EXPECT_EQ(reverse.missing_.size(), 1);
+    EXPECT_EQ(reverse.regressions_.size(), 1);
+    EXPECT_EQ(reverse.regressions_[0].family_, "conv_fwd");
+}
@@ -0,0 +1,172 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "ck/ck.hpp"
+#include "ck/utility/common_header.hpp"
+
+using ck::index_t;
+using ck::is_same;
+using ck::Number;
+using ck::Sequence;
+
+namespace {
+
+template <index_t... Is>
+ck::Tuple<Number<Is>...> make_number_tuple(Sequence<Is...>);
+
+} // namespace
+
+TEST(TestSequence, Generate)
+{
+    static_assert(is_same<ck::make_index_sequence<0>, Sequence<>>::value);
+    static_assert(is_same<ck::make_index_sequence<4>, Sequence<0, 1, 2, 3>>::value);
+    static_assert(is_same<ck::arithmetic_sequence_gen<0, 3, 1>::type, Sequence<0, 1, 2>>::value);
+    static_assert(is_same<ck::arithmetic_sequence_gen<2, 11, 3>::type, Sequence<2, 5, 8>>::value);
+    static_assert(is_same<ck::arithmetic_sequence_gen<5, 0, -2>::type, Sequence<5, 3>>::value);
+    static_assert(is_same<ck::arithmetic_sequence_gen<3, 3, 1>::type, Sequence<>>::value);
+    static_assert(is_same<ck::uniform_sequence_gen_t<3, 7>, Sequence<7, 7, 7>>::value);
+}
+
+TEST(TestSequence, MergeAndReverse)
+{
+    using Merged = ck::sequence_merge<Sequence<1>, Sequence<2, 3>, Sequence<>, Sequence<4>>::type;
+
+    static_assert(is_same<Merged, Sequence<1, 2, 3, 4>>::value);
+    static_assert(is_same<ck::sequence_merge<const Sequence<1>, Sequence<2>>::type,
+                          Sequence<1, 2>>::value);
+    static_assert(is_same<ck::sequence_reverse<Sequence<1, 2, 3, 4, 5>>::type,
+                          Sequence<5, 4, 3, 2, 1>>::value);
+    static_assert(is_same<decltype(Sequence<1, 2, 3>::PopBack()), Sequence<1, 2>>::value);
+    static_assert(is_same<decltype(Sequence<1, 2, 3>::Modify(Number<1>{}, Number<9>{})),
+                          Sequence<1, 9, 3>>::value);
+}
+
+TEST(TestSequence, Scan)
+{
+    constexpr auto seq = Sequence<2, 3, 4>{};
+    constexpr auto mul = ck::math::multiplies{};
+
+    static_assert(is_same<decltype(ck::reverse_inclusive_scan_sequence(seq, mul, Number<1>{})),
+                          Sequence<24, 12, 4>>::value);
+    static_assert(is_same<decltype(ck::reverse_exclusive_scan_sequence(seq, mul, Number<1>{})),
+                          Sequence<12, 4, 1>>::value);
+    static_assert(
+        is_same<decltype(ck::inclusive_scan_sequence(seq, ck::math::plus<index_t>{}, Number<0>{})),
+                Sequence<2, 5, 9>>::value);
+}
+
+TEST(TestSequence, Sort)
+{
+    using Sort = ck::sequence_sort<Sequence<5, 2, 9, 2, 0>, ck::math::less<index_t>>;
+
+    static_assert(is_same<Sort::type, Sequence<0, 2, 2, 5, 9>>::value);
+    static_assert(is_same<Sort::sorted2unsorted_map, Sequence<4, 3, 1, 0, 2>>::value);
+
+    using UniqueSort = ck::sequence_unique_sort<Sequence<5, 2, 9, 2, 0, 5>,
+                                                ck::math::less<index_t>,
+                                                ck::math::equal<index_t>>;
+
+    static_assert(is_same<UniqueSort::type, Sequence<0, 2, 5, 9>>::value);
+}
+
+TEST(TestSequence, Map)
+{
+    static_assert(ck::is_valid_sequence_map<Sequence<2, 0, 1>>::value);
+    static_assert(!ck::is_valid_sequence_map<Sequence<2, 0, 0>>::value);
+    static_assert(!ck::is_valid_sequence_map<Sequence<3, 0, 1>>::value);
+    static_assert(is_same<ck::sequence_map_inverse<Sequence<2, 0, 1>>::type,
+                          Sequence<1, 2, 0>>::value);
+    static_assert(is_same<decltype(Sequence<10, 20, 30>::ReorderGivenOld2New(Sequence<2, 0, 1>{})),
+                          Sequence<20, 30, 10>>::value);
+}
+
+TEST(TestSequence, PickAndModify)
+{
+    constexpr auto seq = Sequence<4, 5, 6, 7>{};
+
+    static_assert(is_same<decltype(ck::pick_sequence_elements_by_mask(seq, Sequence<1, 0, 0, 1>{})),
+                          Sequence<4, 7>>::value);
+    static_assert(is_same<decltype(ck::modify_sequence_elements_by_ids(
+                              seq, Sequence<9, 8>{}, Sequence<3, 0>{})),
+                          Sequence<8, 5, 6, 9>>::value);
+}
+
+TEST(TestSequence, Reverse)
+{
+    static_assert(is_same<decltype(Sequence<>::Reverse()), Sequence<>>::value);
+    static_assert(is_same<decltype(Sequence<7>::Reverse()), Sequence<7>>::value);
+    static_assert(is_same<decltype(Sequence<1, 2, 3, 4>::Reverse()), Sequence<4, 3, 2, 1>>::value);
+    static_assert(is_same<decltype(Sequence<3, -1, 3>::Reverse()), Sequence<3, -1, 3>>::value);
+
+    using Long = ck::make_index_sequence<200>;
+
+    static_assert(ck::sequence_reverse<Long>::type::At(0) == 199);
+    static_assert(ck::sequence_reverse<Long>::type::At(199) == 0);
+    static_assert(is_same<decltype(Long::Reverse().Reverse()), Long>::value);
+}
+
+TEST(TestSequence, Reorder)
+{
+    using Seq     = Sequence<10, 20, 30, 40>;
+    using New2Old = Sequence<3, 0, 2, 1>;
+    using Old2New = ck::sequence_map_inverse<New2Old>::type;
+
+    static_assert(is_same<Old2New, Sequence<1, 3, 2, 0>>::value);
+    static_assert(
+        is_same<decltype(Seq::ReorderGivenNew2Old(New2Old{})), Sequence<40, 10, 30, 20>>::value);
+    static_assert(
+        is_same<decltype(Seq::ReorderGivenOld2New(Old2New{})), Sequence<40, 10, 30, 20>>::value);
+    static_assert(is_same<decltype(ck::container_reorder_given_new2old(Seq{}, New2Old{})),
+                          Sequence<40, 10, 30, 20>>::value);
+    static_assert(is_same<decltype(ck::container_reorder_given_old2new(Seq{}, New2Old{})),
+                          Sequence<20, 40, 30, 10>>::value);
+
+    // an identity map and a map that is its own inverse
+    static_assert(is_same<decltype(Seq::ReorderGivenNew2Old(ck::make_index_sequence<4>{})),
+                          Seq>::value);
+    static_assert(is_same<ck::sequence_map_inverse<Sequence<1, 0, 3, 2>>::type,
+                          Sequence<1, 0, 3, 2>>::value);
+
+    const auto tuple     = ck::make_tuple(Number<1>{}, 2.0f, 3);
+    const auto reordered = ck::container_reorder_given_new2old(tuple, Sequence<2, 0, 1>{});
+
+    static_assert(
+        is_same<ck::remove_cvref_t<decltype(reordered)>, ck::Tuple<int, Number<1>, float>>::value);
+    EXPECT_EQ(reordered[Number<0>{}], 3);
+    EXPECT_EQ(reordered[Number<2>{}], 2.0f);
+
+    const auto restored = ck::container_reorder_given_old2new(reordered, Sequence<2, 0, 1>{});
+
+    static_assert(is_same<ck::remove_cvref_t<decltype(restored)>,
+                          ck::remove_cvref_t<decltype(tuple)>>::value);
+    EXPECT_EQ(restored[Number<1>{}], 2.0f);
+    EXPECT_EQ(restored[Number<2>{}], 3);
+}
+
+TEST(TestSequence, TupleElement)
+{
+    using Tuple = ck::Tuple<int, float&, const Number<3>, Sequence<1, 2>>;
+
+    static_assert(is_same<ck::tuple_element_t<0, Tuple>, int>::value);
+    static_assert(is_same<ck::tuple_element_t<1, Tuple>, float&>::value);
+    static_assert(is_same<ck::tuple_element_t<2, Tuple>, const Number<3>>::value);
+    static_assert(is_same<ck::tuple_element_t<3, Tuple>, Sequence<1, 2>>::value);
+    static_assert(is_same<ck::tuple_element_t<1, ck::Tuple<int, float, double>>, float>::value);
+
+    // the same types as the overload resolution over the tuple bases, which is used without
+    // __type_pack_element
+    ck::static_for<0, Tuple::Size(), 1>{}([](auto i) {
+        using Element = decltype(ck::detail::get_tuple_element_data<ck::detail::TupleElementKey<i>>(
+            std::declval<Tuple>()));
+
+        static_assert(is_same<ck::tuple_element_t<i, Tuple>, Element>::value);
+    });
+
+    using Long = decltype(make_number_tuple(ck::make_index_sequence<300>{}));
+
+    static_assert(is_same<ck::tuple_element_t<0, Long>, Number<0>>::value);
+    static_assert(is_same<ck::tuple_element_t<299, Long>, Number<299>>::value);
+}
@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <array>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/dims_canonicalizer.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_elementwise_impl.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_reduce_common.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+using namespace ck;
+using namespace ck::tensor_operation::device;
+
+namespace {
+
+template <index_t NumDim, index_t NumTensor>
+struct Dims
+{
+    std::array<index_t, NumDim> lengths_;
+    std::array<std::array<index_t, NumDim>, NumTensor> strides_;
+
+    index_t Canonicalize(index_t ref_tensor, bool reorder)
+    {
+        std::array<index_t*, NumTensor> strides;
+
+        for(index_t t = 0; t < NumTensor; ++t)
+            strides[t] = strides_[t].data();
+
+        return canonicalize_dims<NumTensor>(
+            lengths_.data(), strides, NumDim, ref_tensor, reorder);
+    }
+
+    // offsets in all tensors of every element, in row-major order
+    std::vector<std::array<long_index_t, NumTensor>> GetOffsets() const
+    {
+        std::vector<std::array<long_index_t, NumTensor>> offsets;
+        std::array<index_t, NumDim> idx{};
+
+        if(std::find(lengths_.begin(), lengths_.end(), 0) != lengths_.end())
+            return offsets;
+
+        while(true)
+        {
+            std::array<long_index_t, NumTensor> offset{};
+
+            for(index_t t = 0; t < NumTensor; ++t)
+            {
+                for(index_t i = 0; i < NumDim; ++i)
+                    offset[t] += static_cast<long_index_t>(idx[i]) * strides_[t][i];
+            }
+
+            offsets.push_back(offset);
+
+            index_t i = NumDim - 1;
+
+            for(; i >= 0 && ++idx[i] == lengths_[i]; --i)
+                idx[i] = 0;
+
+            if(i < 0)
+                return offsets;
+        }
+    }
+};
+
+template <index_t NumDim, index_t NumTensor>
+void check_equivalent(const Dims<NumDim, NumTensor>& dims,
+                      index_t ref_tensor,
+                      bool reorder,
+                      index_t expected_num_dim)
+{
+    auto canonical_dims = dims;
+
+    EXPECT_EQ(canonical_dims.Canonicalize(ref_tensor, reorder), expected_num_dim);
+
+    auto offsets           = dims.GetOffsets();
+    auto canonical_offsets = canonical_dims.GetOffsets();
+
+    // the same elements, in the same order unless reordered
+    if(reorder)
+    {
+        std::sort(offsets.begin(), offsets.end());
+        std::sort(canonical_offsets.begin(), canonical_offsets.end());
+    }
+
+    EXPECT_EQ(offsets, canonical_offsets);
+
+    // padding is outermost
+    for(index_t i = 0; i < NumDim - expected_num_dim; ++i)
+        EXPECT_EQ(canonical_dims.lengths_[i], 1);
+}
+
+} // namespace
+
+TEST(TestDimsCanonicalizer, Packed)
+{
+    Dims<4, 1> dims{{2, 1, 3, 4}, {{{12, 12, 4, 1}}}};
+
+    check_equivalent(dims, 0, true, 1);
+
+    dims.Canonicalize(0, true);
+    EXPECT_EQ(dims.lengths_, (std::array<index_t, 4>{1, 1, 1, 24}));
+    EXPECT_EQ(dims.strides_[0][3], 1);
+}
+
+TEST(TestDimsCanonicalizer, Padded)
+{
+    // rows of 16 padded to 20, the row is not merged with the outer dims
+    Dims<3, 1> dims{{4, 8, 16}, {{{160, 20, 1}}}};
+
+    check_equivalent(dims, 0, true, 2);
+
+    dims.Canonicalize(0, true);
+    EXPECT_EQ(dims.lengths_, (std::array<index_t, 3>{1, 32, 16}));
+    EXPECT_EQ(dims.strides_[0], (std::array<index_t, 3>{1, 20, 1}));
+}
+
+TEST(TestDimsCanonicalizer, Reorder)
+{
+    // NCHW lengths of an NHWC tensor, only H and W are adjacent
+    Dims<4, 1> dims{{2, 8, 3, 5}, {{{120, 1, 40, 8}}}};
+
+    check_equivalent(dims, 0, false, 3);
+    check_equivalent(dims, 0, true, 1);
+
+    // an NCHW and an NHWC tensor, ordered by either of them
+    Dims<4, 2> mixed_dims{{2, 8, 3, 5}, {{{120, 15, 5, 1}, {120, 1, 40, 8}}}};
+
+    check_equivalent(mixed_dims, 0, true, 3);
+    check_equivalent(mixed_dims, 1, true, 3);
+
+    mixed_dims.Canonicalize(1, true);
+    EXPECT_EQ(mixed_dims.lengths_, (std::array<index_t, 4>{1, 2, 15, 8}));
+    EXPECT_EQ(mixed_dims.strides_[0], (std::array<index_t, 4>{1, 120, 1, 15}));
+    EXPECT_EQ(mixed_dims.strides_[1], (std::array<index_t, 4>{1, 120, 8, 1}));
+}
+
+TEST(TestDimsCanonicalizer, Broadcast)
+{
+    // a bias broadcast over the rows and the batch of an output
+    Dims<3, 2> dims{{4, 6, 32}, {{{0, 0, 1}, {192, 32, 1}}}};
+
+    check_equivalent(dims, 1, true, 2);
+
+    dims.Canonicalize(1, true);
+    EXPECT_EQ(dims.lengths_, (std::array<index_t, 3>{1, 24, 32}));
+    EXPECT_EQ(dims.strides_[0], (std::array<index_t, 3>{1, 0, 1}));
+
+    // broadcast dims of the reference tensor go outermost
+    Dims<3, 2> inner_broadcast_dims{{6, 32, 4}, {{{32, 1, 0}, {128, 4, 1}}}};
+
+    check_equivalent(inner_broadcast_dims, 0, true, 2);
+
+    inner_broadcast_dims.Canonicalize(0, true);
+    EXPECT_EQ(inner_broadcast_dims.lengths_, (std::array<index_t, 3>{1, 4, 192}));
+    EXPECT_EQ(inner_broadcast_dims.strides_[1], (std::array<index_t, 3>{1, 1, 4}));
+}
+
+TEST(TestDimsCanonicalizer, Degenerate)
+{
+    // a single element
+    Dims<3, 2> scalar_dims{{1, 1, 1}, {{{5, 3, 2}, {0, 0, 0}}}};
+
+    check_equivalent(scalar_dims, 0, true, 0);
+
+    // empty tensors are kept as they are
+    Dims<3, 1> empty_dims{{4, 0, 8}, {{{0, 8, 1}}}};
+
+    EXPECT_EQ(empty_dims.Canonicalize(0, true), 3);
+    EXPECT_EQ(empty_dims.lengths_, (std::array<index_t, 3>{4, 0, 8}));
+}
+
+TEST(TestDimsCanonicalizer, ReduceDims)
+{
+    // softmax over H and W of an NHWC tensor with C = 1
+    constexpr index_t Rank         = 4;
+    constexpr index_t NumReduceDim = 2;
+
+    std::array<index_t, Rank> lengths{8, 1, 16, 32};
+    std::array<index_t, Rank> strides{512, 1, 32, 1};
+
+    lengths = shuffle_tensor_dimensions<Rank, NumReduceDim>(lengths, {2, 3});
+    strides = shuffle_tensor_dimensions<Rank, NumReduceDim>(strides, {2, 3});
+
+    canonicalize_shuffled_dimensions<Rank, NumReduceDim>(
+        lengths.data(), strides.data(), nullptr, nullptr, true);
+
+    EXPECT_EQ(lengths, (std::array<index_t, Rank>{1, 8, 1, 512}));
+    EXPECT_EQ(strides, (std::array<index_t, Rank>{1, 512, 1, 1}));
+
+    // reduction over C of an NHWC tensor into an NHW tensor, the invariant dims are merged with
+    // those of the output
+    std::array<index_t, Rank> in_lengths{2, 8, 4, 4};
+    std::array<index_t, Rank> in_strides{128, 1, 32, 8};
+    std::array<index_t, Rank - 1> out_lengths{2, 4, 4};
+    std::array<index_t, Rank - 1> out_strides{16, 4, 1};
+
+    in_lengths = shuffle_tensor_dimensions<Rank, 1>(in_lengths, {1});
+    in_strides = shuffle_tensor_dimensions<Rank, 1>(in_strides, {1});
+
+    canonicalize_shuffled_dimensions<Rank, 1>(
+        in_lengths.data(), in_strides.data(), out_lengths.data(), out_strides.data(), false);
+
+    EXPECT_EQ(in_lengths, (std::array<index_t, Rank>{1, 1, 32, 8}));
+    EXPECT_EQ(in_strides, (std::array<index_t, Rank>{1, 1, 8, 1}));
+    EXPECT_EQ(out_lengths, (std::array<index_t, Rank - 1>{1, 1, 32}));
+    EXPECT_EQ(out_strides, (std::array<index_t, Rank - 1>{1, 1, 1}));
+}
+
+TEST(TestDimsCanonicalizer, ElementwisePermute)
+{
+    // NCHW to NHWC permute of example 44, 8-wide loads of the input and scalar stores of the
+    // output, the dims must not be ordered by the output strides
+    using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+    using DeviceOp    = DeviceElementwiseImpl<ck::Tuple<ck::half_t>,
+                                              ck::Tuple<ck::half_t>,
+                                              PassThrough,
+                                              4,
+                                              8,
+                                              ck::Sequence<8>,
+                                              ck::Sequence<1>>;
+
+    const std::array<index_t, 4> lengths{16, 128, 32, 64};
+    const std::array<index_t, 4> a_strides{262144, 2048, 64, 1};
+    const std::array<index_t, 4> b_strides{262144, 1, 4096, 128};
+
+    auto arg = DeviceOp::MakeArgument(
+        lengths, {a_strides}, {b_strides}, {nullptr}, {nullptr}, PassThrough{});
+
+    EXPECT_TRUE(DeviceOp::IsSupportedArgument(arg));
+
+    // the same argument without canonicalization
+    auto raw_arg             = arg;
+    raw_arg.lengths_         = lengths;
+    raw_arg.inStridesArray_  = {a_strides};
+    raw_arg.outStridesArray_ = {b_strides};
+
+    EXPECT_TRUE(DeviceOp::IsSupportedArgument(raw_arg));
+
+    Dims<4, 2> dims{lengths, {{a_strides, b_strides}}};
+
+    check_equivalent(dims, 1, false, 4);
+}
@@ -0,0 +1,220 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/block/blockwise_gemm_xdlops.hpp"
+#include "ck/library/utility/lds_bank_conflict.hpp"
+
+using namespace ck;
+
+using ck::utils::LdsBankConflicts;
+using ck::utils::LdsWaveAccess;
+
+namespace {
+
+LdsBankConflicts get_total_conflicts(const ck::utils::LdsAccessPattern& pattern, index_t num_bank)
+{
+    LdsBankConflicts total;
+
+    for(const auto& conflicts : ck::utils::get_lds_bank_conflicts(pattern, num_bank))
+        total += conflicts;
+
+    return total;
+}
+
+// (K0, MN, K1) LDS tiles of half_t of a 256x256x32 GEMM, K1 = 8
+constexpr auto K0 = Number<4>{};
+constexpr auto M  = Number<256>{};
+constexpr auto N  = Number<256>{};
+constexpr auto K1 = Number<8>{};
+
+template <typename MN>
+constexpr auto make_lds_desc(MN)
+{
+    return make_naive_tensor_descriptor_packed(make_tuple(K0, MN{}, K1));
+}
+
+// padding of one K1 vector per K0, the ABlockLdsExtraM = 1 of the gridwise GEMMs
+template <typename MN>
+constexpr auto make_padded_lds_desc(MN)
+{
+    return make_naive_tensor_descriptor(make_tuple(K0, MN{}, K1),
+                                        make_tuple(Number<(MN{} + 1) * K1>{}, K1, Number<1>{}));
+}
+
+// K1 vector of the row MN stored at column MN ^ K0
+template <typename MN>
+constexpr auto make_xor_lds_desc(MN)
+{
+    return transform_tensor_descriptor(
+        make_lds_desc(MN{}),
+        make_tuple(make_xor_transform(make_tuple(K0, MN{})), make_pass_through_transform(K1)),
+        make_tuple(Sequence<0, 1>{}, Sequence<2>{}),
+        make_tuple(Sequence<0, 1>{}, Sequence<2>{}));
+}
+
+template <typename ADesc, typename BDesc>
+void check_gemm_lds(const ADesc& a_desc,
+                    const BDesc& b_desc,
+                    index_t num_bank,
+                    bool expect_write_conflicts)
+{
+    constexpr index_t BlockSize = 256;
+
+    // ABlockTransferThreadClusterLengths_AK0_M_AK1 S<4, 64, 1>, ArrangeOrder S<1, 0, 2>
+    const auto a_write = ck::utils::get_thread_group_slice_transfer_write_pattern<
+        half_t,
+        Sequence<K0, M, K1>,
+        Sequence<4, 64, 1>,
+        Sequence<1, 0, 2>,
+        2,
+        K1>(a_desc, BlockSize);
+    const auto b_write = ck::utils::get_thread_group_slice_transfer_write_pattern<
+        half_t,
+        Sequence<K0, N, K1>,
+        Sequence<4, 64, 1>,
+        Sequence<1, 0, 2>,
+        2,
+        K1>(b_desc, BlockSize);
+
+    using BlockwiseGemm =
+        BlockwiseGemmXdlops_k0mk1_k0nk1_m0n0m1n1m2m3m4n2_v1<BlockSize,
+                                                            half_t,
+                                                            half_t,
+                                                            float,
+                                                            ADesc,
+                                                            BDesc,
+                                                            32,
+                                                            32,
+                                                            4,
+                                                            4,
+                                                            K1>;
+
+    const auto a_read =
+        ck::utils::get_blockwise_gemm_xdlops_a_read_pattern<half_t, BlockwiseGemm>();
+    const auto b_read =
+        ck::utils::get_blockwise_gemm_xdlops_b_read_pattern<half_t, BlockwiseGemm>();
+
+    // 4 waves, a thread writes K1 vectors of 4 rows, a lane reads 2 K1 vectors per repeat
+    ASSERT_EQ(a_write.size(), 4);
+    EXPECT_EQ(a_write[0].size(), 4);
+    EXPECT_EQ(b_write[0].size(), 4);
+    ASSERT_EQ(a_read.size(), 4);
+    EXPECT_EQ(a_read[0].size(), 8);
+
+    if(expect_write_conflicts)
+    {
+        EXPECT_GT(get_total_conflicts(a_write, num_bank).conflict_cycles_, 0);
+        EXPECT_GT(get_total_conflicts(b_write, num_bank).conflict_cycles_, 0);
+    }
+    else
+    {
+        EXPECT_EQ(get_total_conflicts(a_write, num_bank).conflict_cycles_, 0);
+        EXPECT_EQ(get_total_conflicts(b_write, num_bank).conflict_cycles_, 0);
+    }
+
+    EXPECT_EQ(get_total_conflicts(a_read, num_bank).conflict_cycles_, 0);
+    EXPECT_EQ(get_total_conflicts(b_read, num_bank).conflict_cycles_, 0);
+}
+
+} // namespace
+
+TEST(TestLdsBankConflict, BankModel)
+{
+    // b32, a phase of 32 lanes on 32 banks
+    LdsWaveAccess access{4, std::vector<long_index_t>(64)};
+
+    for(index_t lane = 0; lane < 64; ++lane)
+        access.lane_addresses_[lane] = lane * 4;
+
+    auto conflicts = ck::utils::get_lds_bank_conflicts(access, 32);
+    EXPECT_EQ(conflicts.cycles_, 2);
+    EXPECT_EQ(conflicts.conflict_cycles_, 0);
+
+    // the same word is a broadcast
+    std::fill(access.lane_addresses_.begin(), access.lane_addresses_.end(), 64);
+    EXPECT_EQ(ck::utils::get_lds_bank_conflicts(access, 32).conflict_cycles_, 0);
+
+    // a stride of 32 words puts all lanes of a phase in the same bank
+    for(index_t lane = 0; lane < 64; ++lane)
+        access.lane_addresses_[lane] = lane * 128;
+
+    conflicts = ck::utils::get_lds_bank_conflicts(access, 32);
+    EXPECT_EQ(conflicts.cycles_, 64);
+    EXPECT_EQ(conflicts.conflict_cycles_, 62);
+
+    // with 64 banks every second lane shares a bank
+    EXPECT_EQ(ck::utils::get_lds_bank_conflicts(access, 64).cycles_, 32);
+
+    // b128, phases of 8 lanes, the phases without active lanes are skipped
+    LdsWaveAccess vector_access{16, std::vector<long_index_t>(64, -1)};
+
+    for(index_t lane = 0; lane < 8; ++lane)
+        vector_access.lane_addresses_[lane] = lane * 16;
+
+    conflicts = ck::utils::get_lds_bank_conflicts(vector_access, 32);
+    EXPECT_EQ(conflicts.cycles_, 1);
+    EXPECT_EQ(conflicts.conflict_cycles_, 0);
+}
+
+TEST(TestLdsBankConflict, XorTransform)
+{
+    constexpr auto desc = make_xor_lds_desc(M);
+
+    static_assert(decltype(desc)::IsKnownAtCompileTime());
+
+    std::vector<index_t> offsets;
+
+    for(index_t k0 = 0; k0 < K0; ++k0)
+    {
+        for(index_t m = 0; m < M; ++m)
+        {
+            const index_t offset = desc.CalculateOffset(make_multi_index(k0, m, 1));
+
+            EXPECT_EQ(offset, (k0 * M + (m ^ k0)) * K1 + 1);
+
+            offsets.push_back(offset);
+        }
+    }
+
+    // a permutation of the tile
+    std::sort(offsets.begin(), offsets.end());
+    EXPECT_EQ(std::unique(offsets.begin(), offsets.end()), offsets.end());
+
+    // coordinate steps agree with CalculateOffset()
+    auto coord = make_tensor_coordinate(desc, make_multi_index(0, 0, 0));
+
+    const auto step_m  = make_tensor_coordinate_step(desc, make_multi_index(0, 1, 0));
+    const auto step_k0 = make_tensor_coordinate_step(desc, make_multi_index(1, -5, 0));
+
+    for(index_t m = 1; m < 6; ++m)
+    {
+        move_tensor_coordinate(desc, coord, step_m);
+        EXPECT_EQ(coord.GetOffset(), desc.CalculateOffset(make_multi_index(0, m, 0)));
+    }
+
+    for(index_t k0 = 1; k0 < K0; ++k0)
+    {
+        move_tensor_coordinate(desc, coord, step_k0);
+        EXPECT_EQ(coord.GetOffset(), desc.CalculateOffset(make_multi_index(k0, 0, 0)));
+
+        move_tensor_coordinate(
+            desc, coord, make_tensor_coordinate_step(desc, make_multi_index(0, 5, 0)));
+        EXPECT_EQ(coord.GetOffset(), desc.CalculateOffset(make_multi_index(k0, 5, 0)));
+    }
+}
+
+TEST(TestLdsBankConflict, GemmLdsTiles)
+{
+    for(index_t num_bank : {32, 64})
+    {
+        // without padding, the threads writing the K0 of a row hit the same banks
+        check_gemm_lds(make_lds_desc(M), make_lds_desc(N), num_bank, true);
+        check_gemm_lds(make_padded_lds_desc(M), make_padded_lds_desc(N), num_bank, false);
+        check_gemm_lds(make_xor_lds_desc(M), make_xor_lds_desc(N), num_bank, false);
+    }
+}
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/tensor_descriptor_cost.hpp"
+
+using namespace ck;
+
+using ck::utils::IndexMathCost;
+
+namespace {
+
+void expect_cost(const IndexMathCost& cost,
+                 index_t transforms,
+                 index_t adds,
+                 index_t multiplies,
+                 index_t magic_divisions,
+                 index_t branches)
+{
+    EXPECT_EQ(cost.transforms_, transforms);
+    EXPECT_EQ(cost.adds_, adds);
+    EXPECT_EQ(cost.multiplies_, multiplies);
+    EXPECT_EQ(cost.magic_divisions_, magic_divisions);
+    EXPECT_EQ(cost.divisions_, 0);
+    EXPECT_EQ(cost.modulos_, 0);
+    EXPECT_EQ(cost.branches_, branches);
+}
+
+// a transform without a cost of its own
+struct UnknownTransform
+{
+    static constexpr index_t GetNumOfLowerDimension() { return 2; }
+
+    static constexpr bool IsValidUpperIndexAlwaysMappedToValidLowerIndex() { return false; }
+};
+
+} // namespace
+
+TEST(TestTensorDescriptorCost, MergeOfPackedTensor)
+{
+    const index_t M = 5, N = 6, K = 7;
+
+    const auto desc_m_n_k = make_naive_tensor_descriptor_packed(make_tuple(M, N, K));
+
+    const auto desc_mn_k = transform_tensor_descriptor(
+        desc_m_n_k,
+        make_tuple(make_merge_transform_v2_magic_division(make_tuple(M, N)),
+                   make_pass_through_transform(K)),
+        make_tuple(Sequence<0, 1>{}, Sequence<2>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    const auto cost = ck::utils::get_tensor_descriptor_cost(desc_mn_k);
+
+    // UnMerge: the stride of K is a Number<1>
+    expect_cost(cost.offset_, 3, 3, 3, 1, 0);
+    expect_cost(cost.check_, 0, 0, 0, 0, 0);
+
+    ASSERT_EQ(cost.steps_.size(), 2);
+
+    // a step of MN goes through the Merge and the UnMerge, a step of K skips the Merge
+    expect_cost(cost.steps_[0], 2, 4, 3, 1, 0);
+    expect_cost(cost.steps_[1], 2, 4, 2, 0, 0);
+
+    const auto time = ck::utils::time_tensor_descriptor(desc_mn_k, M * N * K, 1);
+
+    EXPECT_GT(time.calculate_offset_ns_, 0);
+    EXPECT_GT(time.move_coordinate_ns_, 0);
+}
+
+TEST(TestTensorDescriptorCost, Padding)
+{
+    const index_t H = 5, W = 6;
+
+    const auto desc_h_w = make_naive_tensor_descriptor(make_tuple(H, W), make_tuple(W, 1));
+
+    const auto desc_hp_w = transform_tensor_descriptor(
+        desc_h_w,
+        make_tuple(make_pad_transform(H, 1, 1), make_pass_through_transform(W)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    const auto cost = ck::utils::get_tensor_descriptor_cost(desc_hp_w);
+
+    // Embed with a runtime stride of H and a runtime stride of 1 for W
+    expect_cost(cost.offset_, 3, 2, 2, 0, 0);
+    expect_cost(cost.check_, 0, 0, 0, 0, 2);
+    expect_cost(cost.steps_[0], 2, 3, 2, 0, 0);
+    expect_cost(cost.steps_[1], 2, 3, 2, 0, 0);
+}
+
+TEST(TestTensorDescriptorCost, FrozenDimension)
+{
+    const index_t M = 5, N = 6;
+
+    const auto desc_m_n = make_naive_tensor_descriptor_packed(make_tuple(M, N));
+
+    const auto desc_n = transform_tensor_descriptor(
+        desc_m_n,
+        make_tuple(make_freeze_transform(2), make_pass_through_transform(N)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}),
+        make_tuple(Sequence<>{}, Sequence<0>{}));
+
+    const auto cost = ck::utils::get_tensor_descriptor_cost(desc_n);
+
+    // the Freeze is counted as a transform without index math
+    expect_cost(cost.offset_, 3, 1, 1, 0, 0);
+    expect_cost(cost.check_, 0, 0, 0, 0, 0);
+
+    ASSERT_EQ(cost.steps_.size(), 1);
+    expect_cost(cost.steps_[0], 2, 3, 1, 0, 0);
+}
+
+TEST(TestTensorDescriptorCost, UnknownTransform)
+{
+    const auto cost = ck::utils::get_transform_cost(UnknownTransform{});
+
+    // a division, a modulo and a multiply-add per lower dimension, and a validity check
+    EXPECT_EQ(cost.calculate_.transforms_, 1);
+    EXPECT_EQ(cost.calculate_.adds_, 2);
+    EXPECT_EQ(cost.calculate_.multiplies_, 2);
+    EXPECT_EQ(cost.calculate_.divisions_, 2);
+    EXPECT_EQ(cost.calculate_.modulos_, 2);
+    EXPECT_EQ(cost.update_.divisions_, 2);
+    EXPECT_EQ(cost.check_.branches_, 1);
+}
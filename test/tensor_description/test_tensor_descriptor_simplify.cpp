@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_description/tensor_descriptor_simplify.hpp"
+
+using namespace ck;
+
+static constexpr auto I0 = Number<0>{};
+static constexpr auto I1 = Number<1>{};
+static constexpr auto I2 = Number<2>{};
+static constexpr auto I3 = Number<3>{};
+static constexpr auto I4 = Number<4>{};
+
+namespace {
+
+// compares the offset and its validity over the whole visible index space
+template <typename Desc, typename SimplifiedDesc>
+void check_equivalent(const Desc& desc, const SimplifiedDesc& simplified_desc)
+{
+    constexpr index_t NDim = Desc::GetNumOfDimension();
+
+    static_assert(SimplifiedDesc::GetNumOfDimension() == NDim, "wrong! rank changed");
+
+    EXPECT_EQ(desc.GetElementSpaceSize(), simplified_desc.GetElementSpaceSize());
+
+    MultiIndex<NDim> lengths;
+
+    static_for<0, NDim, 1>{}([&](auto i) {
+        lengths(i) = desc.GetLength(i);
+        EXPECT_EQ(desc.GetLength(i), simplified_desc.GetLength(i));
+    });
+
+    const index_t size = container_reduce(lengths, math::multiplies{}, index_t{1});
+
+    for(index_t i = 0; i < size; ++i)
+    {
+        MultiIndex<NDim> idx;
+
+        index_t rest = i;
+
+        static_for<NDim - 1, -1, -1>{}([&](auto d) {
+            idx(d) = rest % lengths[d];
+            rest /= lengths[d];
+        });
+
+        const auto coord            = make_tensor_coordinate(desc, idx);
+        const auto simplified_coord = make_tensor_coordinate(simplified_desc, idx);
+
+        const bool is_valid = coordinate_has_valid_offset(desc, coord);
+
+        EXPECT_EQ(is_valid, coordinate_has_valid_offset(simplified_desc, simplified_coord));
+
+        if(is_valid)
+            EXPECT_EQ(coord.GetOffset(), simplified_coord.GetOffset());
+    }
+}
+
+} // namespace
+
+TEST(TestTensorDescriptorSimplify, UnMergeOfPackedTensor)
+{
+    const index_t M0 = 3, N = 5;
+
+    const auto desc_m_n = make_naive_tensor_descriptor_packed(make_tuple(M0 * 4, N));
+
+    const auto desc_m0_m1_n = transform_tensor_descriptor(
+        desc_m_n,
+        make_tuple(make_unmerge_transform(make_tuple(M0, I4)), make_pass_through_transform(N)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}),
+        make_tuple(Sequence<0, 1>{}, Sequence<2>{}));
+
+    const auto simplified_desc = simplify_tensor_descriptor(desc_m0_m1_n);
+
+    // UnMerge, UnMerge, PassThrough -> Embed
+    EXPECT_EQ(desc_m0_m1_n.GetNumOfTransform(), 3);
+    EXPECT_EQ(simplified_desc.GetNumOfTransform(), 1);
+
+    check_equivalent(desc_m0_m1_n, simplified_desc);
+}
+
+TEST(TestTensorDescriptorSimplify, ZeroPadding)
+{
+    const index_t H = 4, W = 6, C = 3;
+
+    const auto desc_h_w_c = make_naive_tensor_descriptor(make_tuple(H, W, C), make_tuple(40, 5, 1));
+
+    const auto desc_hp_wp_c =
+        transform_tensor_descriptor(desc_h_w_c,
+                                    make_tuple(make_pad_transform(H, I0, I0),
+                                               make_pad_transform(W, I1, I2),
+                                               make_right_pad_transform(C, I0)),
+                                    make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}),
+                                    make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}));
+
+    const auto simplified_desc = simplify_tensor_descriptor(desc_hp_wp_c);
+
+    // the zero paddings are removed, the padding of W is kept
+    EXPECT_EQ(desc_hp_wp_c.GetNumOfTransform(), 4);
+    EXPECT_EQ(simplified_desc.GetNumOfTransform(), 2);
+
+    check_equivalent(desc_hp_wp_c, simplified_desc);
+}
+
+TEST(TestTensorDescriptorSimplify, UnMergeOfMerge)
+{
+    const index_t M = 5;
+
+    const auto desc_m_k0_k1 = make_naive_tensor_descriptor_packed(make_tuple(M, I3, I4));
+
+    const auto desc_m_k = transform_tensor_descriptor(
+        desc_m_k0_k1,
+        make_tuple(make_pass_through_transform(M), make_merge_transform(make_tuple(I3, I4))),
+        make_tuple(Sequence<0>{}, Sequence<1, 2>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    const auto desc_m_k0_k1_again = transform_tensor_descriptor(
+        desc_m_k,
+        make_tuple(make_pass_through_transform(M), make_unmerge_transform(make_tuple(I3, I4))),
+        make_tuple(Sequence<0>{}, Sequence<1>{}),
+        make_tuple(Sequence<0>{}, Sequence<1, 2>{}));
+
+    const auto simplified_desc = simplify_tensor_descriptor(desc_m_k0_k1_again);
+
+    EXPECT_EQ(desc_m_k0_k1_again.GetNumOfTransform(), 5);
+    EXPECT_EQ(simplified_desc.GetNumOfTransform(), 1);
+
+    check_equivalent(desc_m_k0_k1_again, simplified_desc);
+}
+
+TEST(TestTensorDescriptorSimplify, MergeOfContiguousDimensions)
+{
+    const index_t N = 2, Ho = 3, Wo = 5, K = 4;
+
+    // packed NHWK merged into GEMM M, N: the lengths are only known at runtime
+    const auto desc_n_ho_wo_k = make_naive_tensor_descriptor_packed(make_tuple(N, Ho, Wo, K));
+
+    const auto desc_gemmm_gemmn =
+        transform_tensor_descriptor(desc_n_ho_wo_k,
+                                    make_tuple(make_merge_transform(make_tuple(N, Ho, Wo)),
+                                               make_pass_through_transform(K)),
+                                    make_tuple(Sequence<0, 1, 2>{}, Sequence<3>{}),
+                                    make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    const auto simplified_desc = simplify_tensor_descriptor(desc_gemmm_gemmn);
+
+    EXPECT_EQ(desc_gemmm_gemmn.GetNumOfTransform(), 3);
+    EXPECT_EQ(simplified_desc.GetNumOfTransform(), 1);
+
+    check_equivalent(desc_gemmm_gemmn, simplified_desc);
+
+    // strided tensor, contiguous when the strides are Number<>
+    const auto desc_m0_m1_n = make_naive_tensor_descriptor(
+        make_tuple(I3, I4, 5), make_tuple(Number<40>{}, Number<10>{}, I1));
+
+    const auto desc_m_n = transform_tensor_descriptor(
+        desc_m0_m1_n,
+        make_tuple(make_merge_transform(make_tuple(I3, I4)), make_pass_through_transform(5)),
+        make_tuple(Sequence<0, 1>{}, Sequence<2>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    const auto simplified_desc_m_n = simplify_tensor_descriptor(desc_m_n);
+
+    EXPECT_EQ(desc_m_n.GetNumOfTransform(), 3);
+    EXPECT_EQ(simplified_desc_m_n.GetNumOfTransform(), 1);
+
+    check_equivalent(desc_m_n, simplified_desc_m_n);
+}
+
+TEST(TestTensorDescriptorSimplify, MergeOfNonContiguousDimensions)
+{
+    // the Merge needs its division when the strides are not known to be contiguous
+    const auto desc_m0_m1_n =
+        make_naive_tensor_descriptor(make_tuple(3, 4, 5), make_tuple(48, 12, 1));
+
+    const auto desc_m_n = transform_tensor_descriptor(
+        desc_m0_m1_n,
+        make_tuple(make_merge_transform(make_tuple(3, 4)), make_pass_through_transform(5)),
+        make_tuple(Sequence<0, 1>{}, Sequence<2>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    const auto simplified_desc = simplify_tensor_descriptor(desc_m_n);
+
+    EXPECT_EQ(desc_m_n.GetNumOfTransform(), 3);
+    EXPECT_EQ(simplified_desc.GetNumOfTransform(), 2);
+
+    check_equivalent(desc_m_n, simplified_desc);
+}
+
+TEST(TestTensorDescriptorSimplify, ConvolutionInputToGemm)
+{
+    const index_t N = 2, Hi = 7, C = 3, Y = 3, Ho = 4;
+    const index_t ConvStride = 2, ConvDilation = 1, InLeftPad = 1, InRightPad = 1;
+
+    const auto in_n_hi_c = make_naive_tensor_descriptor_packed(make_tuple(N, Hi, C));
+
+    const auto in_n_hip_c = transform_tensor_descriptor(
+        in_n_hi_c,
+        make_tuple(make_pass_through_transform(N),
+                   make_pad_transform(Hi, InLeftPad, InRightPad),
+                   make_pass_through_transform(C)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}));
+
+    const auto in_n_y_ho_c = transform_tensor_descriptor(
+        in_n_hip_c,
+        make_tuple(make_pass_through_transform(N),
+                   make_embed_transform(make_tuple(Y, Ho), make_tuple(ConvDilation, ConvStride)),
+                   make_pass_through_transform(C)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}),
+        make_tuple(Sequence<0>{}, Sequence<1, 2>{}, Sequence<3>{}));
+
+    const auto in_gemmk_gemmm = transform_tensor_descriptor(
+        in_n_y_ho_c,
+        make_tuple(make_merge_transform(make_tuple(Y, C)), make_merge_transform(make_tuple(N, Ho))),
+        make_tuple(Sequence<1, 3>{}, Sequence<0, 2>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    const auto simplified_desc = simplify_tensor_descriptor(in_gemmk_gemmm);
+
+    // the pass-throughs are removed, the padding, the Embed and the Merges are kept
+    EXPECT_EQ(in_gemmk_gemmm.GetNumOfTransform(), 9);
+    EXPECT_EQ(simplified_desc.GetNumOfTransform(), 5);
+
+    check_equivalent(in_gemmk_gemmm, simplified_desc);
+}
+
+TEST(TestTensorDescriptorSimplify, SharedHiddenDimension)
+{
+    // diagonal of a packed 4x4 tensor, the row and the column read the same hidden dimension x,
+    // which is itself unmerged into the visible dimensions: offset = 5 * x, x = 2 * v0 + v1
+    const auto transforms = make_tuple(make_unmerge_transform(make_tuple(I4, I4)),
+                                       make_pass_through_transform(I4),
+                                       make_unmerge_transform(make_tuple(I2, I2)));
+
+    using LowIdss    = Tuple<Sequence<0>, Sequence<2>, Sequence<1>>;
+    using UpIdss     = Tuple<Sequence<1, 2>, Sequence<1>, Sequence<3, 4>>;
+    using VisibleIds = Sequence<3, 4>;
+    using Transforms = remove_cv_t<decltype(transforms)>;
+    using Descriptor = TensorDescriptor<Transforms, LowIdss, UpIdss, VisibleIds, Number<16>>;
+
+    const auto desc = Descriptor{transforms, Number<16>{}};
+
+    const auto simplified_desc = simplify_tensor_descriptor(desc);
+
+    // the PassThrough is removed, the UnMerges are not fused since the outer one reads x twice
+    EXPECT_EQ(desc.GetNumOfTransform(), 3);
+    EXPECT_EQ(simplified_desc.GetNumOfTransform(), 2);
+
+    check_equivalent(desc, simplified_desc);
+}
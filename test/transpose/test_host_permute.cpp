@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/host_permute.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace {
+
+template <typename DataType>
+void fill(Tensor<DataType>& a)
+{
+    for(std::size_t i = 0; i < a.mData.size(); ++i)
+        a.mData[i] = static_cast<DataType>(i % 1021);
+}
+
+// element by element through the multi-indices
+template <typename ADataType, typename BDataType, typename Op>
+void reference_permute(const Tensor<ADataType>& a,
+                       const std::vector<std::size_t>& new2old,
+                       Tensor<BDataType>& b,
+                       Op op)
+{
+    b.ForEach([&](auto& self, const std::vector<std::size_t>& idx) {
+        std::vector<std::size_t> a_idx(idx.size());
+
+        for(std::size_t i = 0; i < idx.size(); ++i)
+            a_idx[new2old[i]] = idx[i];
+
+        op(self(idx), a(a_idx));
+    });
+}
+
+template <typename DataType>
+void check_permute(const std::vector<std::size_t>& lengths,
+                   const std::vector<std::size_t>& new2old,
+                   std::size_t num_thread)
+{
+    Tensor<DataType> a(lengths);
+    fill(a);
+
+    const auto b = ck::utils::make_permuted_host_tensor(a, new2old, num_thread);
+
+    Tensor<DataType> b_ref(b.mDesc);
+    reference_permute(a, new2old, b_ref, [](DataType& y, const DataType& x) { y = x; });
+
+    EXPECT_EQ(b.mData, b_ref.mData);
+}
+
+template <typename DataType>
+void check_permutes()
+{
+    for(const std::size_t num_thread : {1, 4})
+    {
+        // the in-register tiles, their remainders and the recursion
+        check_permute<DataType>({67, 131}, {1, 0}, num_thread);
+        check_permute<DataType>({256, 320}, {1, 0}, num_thread);
+        check_permute<DataType>({3, 37, 5, 41}, {0, 3, 2, 1}, num_thread);
+        check_permute<DataType>({2, 7, 3, 9, 11}, {0, 1, 3, 4, 2}, num_thread);
+        check_permute<DataType>({2, 7, 3, 9, 11}, {4, 2, 0, 3, 1}, num_thread);
+
+        // unit dims, merged dims, a copy
+        check_permute<DataType>({1, 16, 1, 33, 9}, {3, 4, 0, 2, 1}, num_thread);
+        check_permute<DataType>({5, 6, 7, 8}, {2, 3, 0, 1}, num_thread);
+        check_permute<DataType>({5, 6, 7, 8}, {0, 1, 2, 3}, num_thread);
+        check_permute<DataType>({1, 1}, {1, 0}, num_thread);
+    }
+
+    // split between threads along the outer dims and along the tile
+    check_permute<DataType>({4, 300, 200}, {0, 2, 1}, 8);
+    check_permute<DataType>({600, 500}, {1, 0}, 8);
+}
+
+} // namespace
+
+TEST(TestHostPermute, Types)
+{
+    check_permutes<int8_t>();
+    check_permutes<ck::half_t>();
+    check_permutes<float>();
+    check_permutes<double>();
+}
+
+TEST(TestHostPermute, ElementwiseOperation)
+{
+    const std::vector<std::size_t> new2old{0, 2, 3, 1};
+
+    Tensor<float> a(std::vector<std::size_t>{4, 33, 18, 20});
+    fill(a);
+
+    // NCHW to NHWC into a tensor with padded rows
+    Tensor<double> b(std::vector<std::size_t>{4, 18, 20, 33},
+                     std::vector<std::size_t>{18 * 20 * 40, 20 * 40, 40, 1});
+    Tensor<double> b_ref(b.mDesc);
+
+    auto op = [](double& y, float x) { y = 2.0 * x + 1.0; };
+
+    ck::utils::host_permute(a, new2old, b, op, 4);
+    reference_permute(a, new2old, b_ref, op);
+
+    b.ForEach([&](auto& self, const std::vector<std::size_t>& idx) {
+        EXPECT_EQ(self(idx), b_ref(idx));
+    });
+
+    Tensor<double> wrong_b(std::vector<std::size_t>{4, 33, 18, 20});
+
+    EXPECT_THROW(ck::utils::host_permute(a, new2old, wrong_b, op), std::runtime_error);
+}
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/utility/common_header.hpp"
+
+#include "ck/wrapper/layout.hpp"
+#include "ck/wrapper/tensor.hpp"
+#include "ck/wrapper/operations/copy.hpp"
+
+using ck::wrapper::make_layout;
+using ck::wrapper::make_tensor;
+
+static constexpr auto Global = ck::AddressSpaceEnum::Global;
+static constexpr auto I1     = ck::Number<1>{};
+
+class TestWrapperCopy : public ::testing::Test
+{
+    protected:
+    static constexpr ck::index_t d1 = 8;
+    static constexpr ck::index_t d0 = 12;
+
+    // row-major (d1, d0)
+    std::vector<float> src_ = std::vector<float>(d1 * d0);
+    std::vector<float> dst_ = std::vector<float>(d1 * d0, -1.f);
+
+    void SetUp() override { std::iota(src_.begin(), src_.end(), 0.f); }
+};
+
+TEST_F(TestWrapperCopy, Contiguous)
+{
+    // Compile-time shape and unit stride, copied with vectors along dim 1
+    const auto layout = make_layout(ck::make_tuple(ck::Number<d1>{}, ck::Number<d0>{}),
+                                    ck::make_tuple(ck::Number<d0>{}, I1));
+    const auto src    = make_tensor<Global>(src_.data(), layout);
+    auto dst          = make_tensor<Global>(dst_.data(), layout);
+
+    ck::wrapper::copy(src, dst);
+    EXPECT_EQ(dst_, src_);
+}
+
+TEST_F(TestWrapperCopy, Runtime)
+{
+    const auto layout = make_layout(ck::make_tuple(d1, d0), ck::make_tuple(d0, 1));
+
+    ck::wrapper::copy(make_tensor<Global>(src_.data(), layout),
+                      make_tensor<Global>(dst_.data(), layout));
+    EXPECT_EQ(dst_, src_);
+}
+
+TEST_F(TestWrapperCopy, Transpose)
+{
+    // Source row-major, destination column-major, vectors along the destination dim 0
+    const auto shape = ck::make_tuple(ck::Number<d1>{}, ck::Number<d0>{});
+    const auto src =
+        make_tensor<Global>(src_.data(), make_layout(shape, ck::make_tuple(ck::Number<d0>{}, I1)));
+    const auto dst = make_tensor<Global>(dst_.data(), make_layout(shape));
+
+    ck::wrapper::copy(src, dst);
+    for(ck::index_t h = 0; h < d1; h++)
+    {
+        for(ck::index_t w = 0; w < d0; w++)
+        {
+            EXPECT_EQ(dst_[h + w * d1], src_[h * d0 + w]);
+        }
+    }
+}
+
+TEST_F(TestWrapperCopy, TileToRegisterAndBack)
+{
+    // 4x4 tiles through registers, converted to half and back
+    const auto tensor_layout = make_layout(ck::make_tuple(d1, d0), ck::make_tuple(d0, I1));
+    const auto tile_shape    = ck::make_tuple(ck::Number<4>{}, ck::Number<4>{});
+    const auto src           = make_tensor<Global>(src_.data(), tensor_layout);
+    const auto dst           = make_tensor<Global>(dst_.data(), tensor_layout);
+
+    for(ck::index_t tile_h = 0; tile_h < d1 / 4; tile_h++)
+    {
+        for(ck::index_t tile_w = 0; tile_w < d0 / 4; tile_w++)
+        {
+            auto registers = ck::wrapper::make_register_tensor<ck::AddressSpaceEnum::Vgpr,
+                                                               ck::half_t>(make_layout(tile_shape));
+            const auto tile_coords = ck::make_tuple(tile_h, tile_w);
+
+            ck::wrapper::copy(ck::wrapper::local_tile(src, tile_shape, tile_coords), registers);
+            ck::wrapper::copy(registers, ck::wrapper::local_tile(dst, tile_shape, tile_coords));
+        }
+    }
+    EXPECT_EQ(dst_, src_);
+}
+
+TEST_F(TestWrapperCopy, FillAndClear)
+{
+    const auto layout = make_layout(ck::make_tuple(ck::Number<d1>{}, ck::Number<d0>{}),
+                                    ck::make_tuple(ck::Number<d0>{}, I1));
+    auto tensor       = make_tensor<Global>(dst_.data(), layout);
+
+    ck::wrapper::fill(tensor, 2);
+    EXPECT_EQ(dst_, std::vector<float>(d1 * d0, 2.f));
+
+    // Strided column of the tensor
+    ck::wrapper::clear(tensor(ck::wrapper::make_slice(d1), 3));
+    for(ck::index_t h = 0; h < d1; h++)
+    {
+        for(ck::index_t w = 0; w < d0; w++)
+        {
+            EXPECT_EQ(dst_[h * d0 + w], w == 3 ? 0.f : 2.f);
+        }
+    }
+
+    auto registers = ck::wrapper::make_register_tensor<ck::AddressSpaceEnum::Vgpr, float>(
+        make_layout(ck::make_tuple(ck::Number<2>{}, ck::Number<3>{})));
+    ck::wrapper::fill(registers, 1.5f);
+    ck::static_for<0, 6, 1>{}([&](auto i) { EXPECT_EQ(registers.GetBuffer()[i], 1.5f); });
+}
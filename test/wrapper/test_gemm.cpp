@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/utility/common_header.hpp"
+
+#include "ck/wrapper/layout.hpp"
+#include "ck/wrapper/tensor.hpp"
+#include "ck/wrapper/operations/copy.hpp"
+#include "ck/wrapper/operations/gemm.hpp"
+
+using ck::wrapper::make_layout;
+using ck::wrapper::make_tensor;
+
+static constexpr auto Global = ck::AddressSpaceEnum::Global;
+
+template <typename ADataType, typename BDataType, typename CDataType>
+void reference_gemm(const std::vector<ADataType>& a,
+                    const std::vector<BDataType>& b,
+                    std::vector<CDataType>& c,
+                    ck::index_t M,
+                    ck::index_t N,
+                    ck::index_t K)
+{
+    // a (M, K) row-major, b (N, K) row-major, c (M, N) row-major
+    for(ck::index_t m = 0; m < M; m++)
+    {
+        for(ck::index_t n = 0; n < N; n++)
+        {
+            for(ck::index_t k = 0; k < K; k++)
+            {
+                c[m * N + n] += ck::type_convert<CDataType>(a[m * K + k]) *
+                                ck::type_convert<CDataType>(b[n * K + k]);
+            }
+        }
+    }
+}
+
+TEST(TestWrapperGemm, Memory)
+{
+    constexpr ck::index_t M = 6;
+    constexpr ck::index_t N = 5;
+    constexpr ck::index_t K = 7;
+
+    std::vector<ck::index_t> a(M * K);
+    std::vector<ck::index_t> b(N * K);
+    std::vector<ck::index_t> c(M * N, 1);
+    for(ck::index_t i = 0; i < M * K; i++)
+        a[i] = i % 5 - 2;
+    for(ck::index_t i = 0; i < N * K; i++)
+        b[i] = i % 3 - 1;
+
+    std::vector<ck::index_t> c_ref = c;
+    reference_gemm(a, b, c_ref, M, N, K);
+
+    const auto a_tensor =
+        make_tensor<Global>(a.data(), make_layout(ck::make_tuple(M, K), ck::make_tuple(K, 1)));
+    const auto b_tensor =
+        make_tensor<Global>(b.data(), make_layout(ck::make_tuple(N, K), ck::make_tuple(K, 1)));
+    ck::wrapper::gemm(
+        a_tensor,
+        b_tensor,
+        make_tensor<Global>(c.data(), make_layout(ck::make_tuple(M, N), ck::make_tuple(N, 1))));
+
+    EXPECT_EQ(c, c_ref);
+}
+
+TEST(TestWrapperGemm, Register)
+{
+    // Half inputs copied to registers, accumulated in float registers
+    constexpr auto M = ck::Number<4>{};
+    constexpr auto N = ck::Number<2>{};
+    constexpr auto K = ck::Number<8>{};
+
+    std::vector<ck::half_t> a(M * K);
+    std::vector<ck::half_t> b(N * K);
+    for(ck::index_t i = 0; i < M * K; i++)
+        a[i] = ck::type_convert<ck::half_t>(static_cast<float>(i % 7 - 3));
+    for(ck::index_t i = 0; i < N * K; i++)
+        b[i] = ck::type_convert<ck::half_t>(static_cast<float>(i % 4));
+
+    std::vector<float> c_ref(M * N, 0.f);
+    reference_gemm(a, b, c_ref, M, N, K);
+
+    const auto a_layout = make_layout(ck::make_tuple(M, K), ck::make_tuple(K, ck::Number<1>{}));
+    const auto b_layout = make_layout(ck::make_tuple(N, K), ck::make_tuple(K, ck::Number<1>{}));
+    const auto c_layout = make_layout(ck::make_tuple(M, N), ck::make_tuple(N, ck::Number<1>{}));
+
+    auto a_registers =
+        ck::wrapper::make_register_tensor<ck::AddressSpaceEnum::Vgpr, ck::half_t>(a_layout);
+    auto b_registers =
+        ck::wrapper::make_register_tensor<ck::AddressSpaceEnum::Vgpr, ck::half_t>(b_layout);
+    auto c_registers =
+        ck::wrapper::make_register_tensor<ck::AddressSpaceEnum::Vgpr, float>(c_layout);
+
+    ck::wrapper::copy(make_tensor<Global>(a.data(), a_layout), a_registers);
+    ck::wrapper::copy(make_tensor<Global>(b.data(), b_layout), b_registers);
+    ck::wrapper::clear(c_registers);
+    ck::wrapper::gemm(a_registers, b_registers, c_registers);
+
+    std::vector<float> c(M * N);
+    ck::wrapper::copy(c_registers, make_tensor<Global>(c.data(), c_layout));
+    EXPECT_EQ(c, c_ref);
+}
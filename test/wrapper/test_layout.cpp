@@ -479,3 +479,16 @@ TEST(TestLayoutHelpers, Hierarchical)
 
     EXPECT_EQ((ck::wrapper::get<0, 0, 0>(runtime_shape)), d4);
 }
+
+TEST(TestLayoutHelpers, SameTypeDifferentShape)
+{
+    // Runtime layouts of the same type must not share the transformed descriptor
+    const auto layout_small = ck::wrapper::make_layout(
+        ck::make_tuple(ck::make_tuple(2, 2), 3), ck::make_tuple(ck::make_tuple(1, 2), 4));
+    const auto layout_large = ck::wrapper::make_layout(
+        ck::make_tuple(ck::make_tuple(4, 2), 3), ck::make_tuple(ck::make_tuple(1, 4), 8));
+
+    EXPECT_EQ(layout_small(ck::make_tuple(3, 2)), 1 + 2 + 2 * 4);
+    EXPECT_EQ(layout_large(ck::make_tuple(5, 2)), 1 + 4 + 2 * 8);
+    EXPECT_EQ(layout_large(ck::make_tuple(ck::make_tuple(1, 1), 2)), 1 + 4 + 2 * 8);
+}
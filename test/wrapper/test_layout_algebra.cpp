@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/utility/common_header.hpp"
+
+#include "ck/wrapper/layout.hpp"
+#include "ck/wrapper/layout_algebra.hpp"
+
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+
+using ck::wrapper::make_layout;
+
+template <ck::index_t N>
+using N_ = ck::Number<N>;
+
+class TestWrapperLayoutAlgebra : public ::testing::Test
+{
+    protected:
+    // 1d offsets of the layout
+    template <typename Layout>
+    std::vector<ck::index_t> GetOffsets(const Layout& layout)
+    {
+        std::vector<ck::index_t> offsets;
+        for(ck::index_t i = 0; i < ck::wrapper::size(layout); i++)
+            offsets.push_back(layout(ck::make_tuple(i)));
+        return offsets;
+    }
+
+    // Offsets of the flat layout from the naive descriptor, column-major 1d index
+    template <typename Shape, typename Strides>
+    std::vector<ck::index_t> GetDescriptorOffsets(const Shape& shape, const Strides& strides)
+    {
+        const auto desc = ck::make_naive_tensor_descriptor(shape, strides);
+        std::vector<ck::index_t> offsets;
+        const ck::index_t size = ck::wrapper::size(shape);
+        for(ck::index_t i = 0; i < size; i++)
+        {
+            ck::index_t rest = i;
+            const auto idx   = ck::generate_tuple(
+                [&](auto d) {
+                    const ck::index_t dim_idx = rest % shape.At(d);
+                    rest /= shape.At(d);
+                    return dim_idx;
+                },
+                ck::Number<Shape::Size()>{});
+            offsets.push_back(desc.CalculateOffset(idx));
+        }
+        return offsets;
+    }
+
+    // Checks result(i) == a(b(i))
+    template <typename LayoutA, typename LayoutB, typename LayoutResult>
+    void CheckComposition(const LayoutA& a, const LayoutB& b, const LayoutResult& result)
+    {
+        EXPECT_EQ(ck::wrapper::size(result), ck::wrapper::size(b));
+        for(ck::index_t i = 0; i < ck::wrapper::size(b); i++)
+            EXPECT_EQ(result(ck::make_tuple(i)), a(ck::make_tuple(b(ck::make_tuple(i)))));
+    }
+};
+
+TEST_F(TestWrapperLayoutAlgebra, Coalesce)
+{
+    // ((2, 4), 3):((1, 2), 8) is (24):(1)
+    const auto layout    = make_layout(ck::make_tuple(ck::make_tuple(N_<2>{}, N_<4>{}), N_<3>{}),
+                                    ck::make_tuple(ck::make_tuple(N_<1>{}, N_<2>{}), N_<8>{}));
+    const auto coalesced = ck::wrapper::coalesce(layout);
+    static_assert(std::is_same_v<decltype(coalesced.GetShape()), ck::Tuple<N_<24>>>);
+    static_assert(std::is_same_v<decltype(coalesced.GetStrides()), ck::Tuple<N_<1>>>);
+    EXPECT_EQ(GetOffsets(coalesced), GetOffsets(layout));
+
+    // (2, 1, 3, 2):(1, 5, 4, 2) is (2, 3, 2):(1, 4, 2), size-1 mode dropped only
+    const auto holes = make_layout(ck::make_tuple(N_<2>{}, N_<1>{}, N_<3>{}, N_<2>{}),
+                                   ck::make_tuple(N_<1>{}, N_<5>{}, N_<4>{}, N_<2>{}));
+    const auto holes_coalesced = ck::wrapper::coalesce(holes);
+    static_assert(decltype(holes_coalesced.GetShape())::Size() == 3);
+    EXPECT_EQ(GetOffsets(holes_coalesced),
+              GetDescriptorOffsets(ck::make_tuple(2, 3, 2), ck::make_tuple(1, 4, 2)));
+}
+
+TEST_F(TestWrapperLayoutAlgebra, Composition)
+{
+    // (6, 2):(8, 2) o (4, 3):(3, 1) is ((2, 2), 3):((24, 2), 8)
+    constexpr auto a =
+        make_layout(ck::make_tuple(N_<6>{}, N_<2>{}), ck::make_tuple(N_<8>{}, N_<2>{}));
+    constexpr auto b =
+        make_layout(ck::make_tuple(N_<4>{}, N_<3>{}), ck::make_tuple(N_<3>{}, N_<1>{}));
+    constexpr auto result = ck::wrapper::composition(a, b);
+    static_assert(std::is_same_v<decltype(result.GetShape()),
+                                 ck::Tuple<ck::Tuple<N_<2>, N_<2>>, N_<3>>>);
+    static_assert(std::is_same_v<decltype(result.GetStrides()),
+                                 ck::Tuple<ck::Tuple<N_<24>, N_<2>>, N_<8>>>);
+    // Offsets of static layouts are compile-time constants
+    static_assert(result(ck::make_tuple(N_<1>{}, N_<0>{}, N_<2>{})) == 40);
+    CheckComposition(a, b, result);
+    EXPECT_EQ(GetOffsets(result),
+              GetDescriptorOffsets(ck::make_tuple(2, 2, 3), ck::make_tuple(24, 2, 8)));
+
+    // Single-mode a, runtime layouts
+    const auto a_runtime      = make_layout(ck::make_tuple(12), ck::make_tuple(2));
+    const auto b_runtime      = make_layout(ck::make_tuple(4, 3), ck::make_tuple(3, 1));
+    const auto result_runtime = ck::wrapper::composition(a_runtime, b_runtime);
+    CheckComposition(a_runtime, b_runtime, result_runtime);
+    EXPECT_EQ(GetOffsets(result_runtime),
+              GetDescriptorOffsets(ck::make_tuple(4, 3), ck::make_tuple(6, 2)));
+}
+
+TEST_F(TestWrapperLayoutAlgebra, Complement)
+{
+    // complement((4):(2), 24) is (2, 3):(1, 8)
+    const auto layout     = make_layout(ck::make_tuple(N_<4>{}), ck::make_tuple(N_<2>{}));
+    const auto complement = ck::wrapper::complement(layout, N_<24>{});
+    static_assert(std::is_same_v<decltype(complement.GetShape()), ck::Tuple<N_<2>, N_<3>>>);
+    static_assert(std::is_same_v<decltype(complement.GetStrides()), ck::Tuple<N_<1>, N_<8>>>);
+
+    // (layout, complement) is a bijection onto [0, 24)
+    const auto full = make_layout(ck::make_tuple(layout.GetShape(), complement.GetShape()),
+                                  ck::make_tuple(layout.GetStrides(), complement.GetStrides()));
+    std::vector<ck::index_t> offsets = GetOffsets(full);
+    std::sort(offsets.begin(), offsets.end());
+    std::vector<ck::index_t> expected(24);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(offsets, expected);
+
+    // Up to the cosize, complement((2, 2):(1, 6)) is (3):(2)
+    const auto complement_cosize = ck::wrapper::complement(
+        make_layout(ck::make_tuple(N_<2>{}, N_<2>{}), ck::make_tuple(N_<1>{}, N_<6>{})));
+    static_assert(std::is_same_v<decltype(complement_cosize.GetShape()), ck::Tuple<N_<3>>>);
+    static_assert(std::is_same_v<decltype(complement_cosize.GetStrides()), ck::Tuple<N_<2>>>);
+}
+
+TEST_F(TestWrapperLayoutAlgebra, LogicalDivideByLayout)
+{
+    // (4, 2, 3):(2, 1, 8) divided by (4):(2) is (((2, 2)), (2, 3)):(((4, 1)), (2, 8))
+    const auto layout  = make_layout(ck::make_tuple(N_<4>{}, N_<2>{}, N_<3>{}),
+                                    ck::make_tuple(N_<2>{}, N_<1>{}, N_<8>{}));
+    const auto tiler   = make_layout(ck::make_tuple(N_<4>{}), ck::make_tuple(N_<2>{}));
+    const auto divided = ck::wrapper::logical_divide(layout, tiler);
+    static_assert(std::is_same_v<decltype(divided.GetStrides()),
+                                 ck::Tuple<ck::Tuple<ck::Tuple<N_<4>, N_<1>>>,
+                                           ck::Tuple<N_<2>, N_<8>>>>);
+    EXPECT_EQ(ck::wrapper::size(divided), ck::wrapper::size(layout));
+    EXPECT_EQ(GetOffsets(divided),
+              GetDescriptorOffsets(ck::make_tuple(2, 2, 2, 3), ck::make_tuple(4, 1, 2, 8)));
+
+    // The first tile is the layout composed with the tiler
+    for(ck::index_t i = 0; i < ck::wrapper::size(tiler); i++)
+        EXPECT_EQ(divided(ck::make_tuple(i)), layout(ck::make_tuple(tiler(ck::make_tuple(i)))));
+    EXPECT_EQ(GetOffsets(ck::wrapper::zipped_divide(layout, tiler)), GetOffsets(divided));
+}
+
+TEST_F(TestWrapperLayoutAlgebra, LogicalDivideByShape)
+{
+    // (8, 6):(6, 1) divided by (2, 3) is ((2, 4), (3, 2)):((6, 12), (1, 3))
+    constexpr ck::index_t d1  = 8;
+    constexpr ck::index_t d0  = 6;
+    const auto tiles          = ck::make_tuple(2, 3);
+    const auto layout_runtime = make_layout(ck::make_tuple(d1, d0), ck::make_tuple(d0, 1));
+    const auto layout_compiletime =
+        make_layout(ck::make_tuple(N_<d1>{}, N_<d0>{}), ck::make_tuple(N_<d0>{}, N_<1>{}));
+
+    const auto divided_runtime     = ck::wrapper::logical_divide(layout_runtime, tiles);
+    const auto divided_compiletime =
+        ck::wrapper::logical_divide(layout_compiletime, ck::make_tuple(N_<2>{}, N_<3>{}));
+    static_assert(ck::is_known_at_compile_time<decltype(divided_compiletime.GetShape())>::value);
+    static_assert(
+        ck::is_known_at_compile_time<decltype(divided_compiletime.GetStrides())>::value);
+
+    for(ck::index_t h = 0; h < d1; h++)
+    {
+        for(ck::index_t w = 0; w < d0; w++)
+        {
+            const auto idx =
+                ck::make_tuple(ck::make_tuple(h % 2, h / 2), ck::make_tuple(w % 3, w / 3));
+            EXPECT_EQ(divided_runtime(idx), layout_runtime(ck::make_tuple(h, w)));
+            EXPECT_EQ(divided_compiletime(idx), layout_runtime(ck::make_tuple(h, w)));
+        }
+    }
+
+    // Tiles gathered in the first mode, rests in the second
+    const auto zipped = ck::wrapper::zipped_divide(layout_runtime, tiles);
+    EXPECT_EQ(GetOffsets(zipped),
+              GetDescriptorOffsets(ck::make_tuple(2, 3, 4, 2), ck::make_tuple(6, 1, 12, 3)));
+
+    // Divide of a nested dim, ((2, 4), 6):((1, 2), 8) by (4, 3)
+    const auto nested = make_layout(ck::make_tuple(ck::make_tuple(N_<2>{}, N_<4>{}), N_<6>{}),
+                                    ck::make_tuple(ck::make_tuple(N_<1>{}, N_<2>{}), N_<8>{}));
+    const auto divided_nested =
+        ck::wrapper::logical_divide(nested, ck::make_tuple(N_<4>{}, N_<3>{}));
+    static_assert(std::is_same_v<decltype(divided_nested.GetStrides()),
+                                 ck::Tuple<ck::Tuple<N_<1>, N_<4>>, ck::Tuple<N_<8>, N_<24>>>>);
+    EXPECT_EQ(GetOffsets(divided_nested),
+              GetDescriptorOffsets(ck::make_tuple(4, 2, 3, 2), ck::make_tuple(1, 4, 8, 24)));
+}
+
+TEST_F(TestWrapperLayoutAlgebra, RightInverse)
+{
+    // (4, 2):(2, 1) has right inverse (2, 4):(4, 1)
+    const auto layout =
+        make_layout(ck::make_tuple(N_<4>{}, N_<2>{}), ck::make_tuple(N_<2>{}, N_<1>{}));
+    const auto inverse = ck::wrapper::right_inverse(layout);
+    static_assert(std::is_same_v<decltype(inverse.GetShape()), ck::Tuple<N_<2>, N_<4>>>);
+    static_assert(std::is_same_v<decltype(inverse.GetStrides()), ck::Tuple<N_<4>, N_<1>>>);
+    for(ck::index_t i = 0; i < ck::wrapper::size(inverse); i++)
+        EXPECT_EQ(layout(ck::make_tuple(inverse(ck::make_tuple(i)))), i);
+
+    // Offset 1 is not reached, only offset 0 is inverted
+    const auto strided_inverse = ck::wrapper::right_inverse(
+        make_layout(ck::make_tuple(N_<4>{}), ck::make_tuple(N_<2>{})));
+    static_assert(std::is_same_v<decltype(strided_inverse.GetShape()), ck::Tuple<N_<1>>>);
+}
@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/utility/common_header.hpp"
+
+#include "ck/wrapper/layout.hpp"
+#include "ck/wrapper/tensor.hpp"
+
+using ck::wrapper::make_layout;
+using ck::wrapper::make_slice;
+using ck::wrapper::make_tensor;
+
+static constexpr auto Global = ck::AddressSpaceEnum::Global;
+
+TEST(TestWrapperTensor, ReadWrite)
+{
+    // dims:(4, 3) packed column-major
+    constexpr ck::index_t d1 = 4;
+    constexpr ck::index_t d0 = 3;
+    std::vector<ck::index_t> data(d1 * d0);
+    std::iota(data.begin(), data.end(), 0);
+
+    auto tensor_runtime = make_tensor<Global>(data.data(), make_layout(ck::make_tuple(d1, d0)));
+    auto tensor_compiletime = make_tensor<Global>(
+        data.data(), make_layout(ck::make_tuple(ck::Number<d1>{}, ck::Number<d0>{})));
+
+    EXPECT_EQ(ck::wrapper::size(tensor_runtime), d1 * d0);
+    EXPECT_EQ(ck::wrapper::size(tensor_compiletime), d1 * d0);
+
+    for(ck::index_t h = 0; h < d1; h++)
+    {
+        for(ck::index_t w = 0; w < d0; w++)
+        {
+            EXPECT_EQ(tensor_runtime(h, w), data[h + w * d1]);
+            EXPECT_EQ(tensor_compiletime(ck::make_tuple(h, w)), data[h + w * d1]);
+        }
+    }
+    // 1d access
+    for(ck::index_t i = 0; i < d1 * d0; i++)
+    {
+        EXPECT_EQ(tensor_runtime(i), data[i]);
+    }
+
+    tensor_runtime(1, 2) = -1;
+    EXPECT_EQ(data[1 + 2 * d1], -1);
+    tensor_compiletime[ck::make_tuple(3, 0)] = -2;
+    EXPECT_EQ(data[3], -2);
+}
+
+TEST(TestWrapperTensor, ReadNested)
+{
+    // dims:((2, 2), 3) strides:((1, 2), 4)
+    constexpr ck::index_t d2 = 2;
+    constexpr ck::index_t d1 = 2;
+    constexpr ck::index_t d0 = 3;
+    std::vector<ck::index_t> data(d2 * d1 * d0);
+    std::iota(data.begin(), data.end(), 0);
+
+    const auto tensor = make_tensor<Global>(
+        data.data(), make_layout(ck::make_tuple(ck::make_tuple(d2, d1), d0)));
+
+    for(ck::index_t e = 0; e < d2; e++)
+    {
+        for(ck::index_t h = 0; h < d1; h++)
+        {
+            for(ck::index_t w = 0; w < d0; w++)
+            {
+                const ck::index_t offset = e + h * d2 + w * d2 * d1;
+                EXPECT_EQ(tensor(ck::make_tuple(e, h), w), data[offset]);
+                EXPECT_EQ(tensor(e + h * d2, w), data[offset]);
+                EXPECT_EQ(tensor(e, h, w), data[offset]);
+            }
+        }
+    }
+}
+
+TEST(TestWrapperTensor, Slice)
+{
+    // dims:(4, 6) strides:(1, 4)
+    constexpr ck::index_t d1 = 4;
+    constexpr ck::index_t d0 = 6;
+    std::vector<ck::index_t> data(d1 * d0);
+    std::iota(data.begin(), data.end(), 0);
+
+    const auto tensor = make_tensor<Global>(data.data(), make_layout(ck::make_tuple(d1, d0)));
+
+    // Integer indexed dim is dropped
+    const auto column = tensor(make_slice(1, 3), 2);
+    EXPECT_EQ(ck::wrapper::rank(ck::wrapper::layout(column)), 1);
+    EXPECT_EQ(ck::wrapper::size(column), 2);
+    for(ck::index_t h = 0; h < 2; h++)
+    {
+        EXPECT_EQ(column(h), data[(h + 1) + 2 * d1]);
+    }
+
+    // Compile-time slices keep compile-time shape
+    const auto block =
+        tensor(make_slice(ck::Number<1>{}, ck::Number<3>{}), make_slice(ck::Number<4>{}));
+    constexpr bool check_compiletime_shape =
+        std::is_same_v<decltype(ck::wrapper::shape(ck::wrapper::layout(block))),
+                       ck::Tuple<ck::Number<2>, ck::Number<4>>>;
+    EXPECT_TRUE(check_compiletime_shape);
+    for(ck::index_t h = 0; h < 2; h++)
+    {
+        for(ck::index_t w = 0; w < 4; w++)
+        {
+            EXPECT_EQ(block(h, w), data[(h + 1) + w * d1]);
+        }
+    }
+
+    // Slice of slice
+    const auto row = block(1, make_slice(1, 4));
+    for(ck::index_t w = 0; w < 3; w++)
+    {
+        EXPECT_EQ(row(w), data[2 + (w + 1) * d1]);
+    }
+}
+
+TEST(TestWrapperTensor, LocalTileAndPartition)
+{
+    // dims:(8, 6) strides:(6, 1), 2x2 tiles of (4, 3), 2x3 threads per tile
+    constexpr ck::index_t d1 = 8;
+    constexpr ck::index_t d0 = 6;
+    const auto tile_shape    = ck::make_tuple(ck::Number<4>{}, ck::Number<3>{});
+    const auto thread_shape  = ck::make_tuple(ck::Number<2>{}, ck::Number<3>{});
+    std::vector<ck::index_t> data(d1 * d0, 0);
+
+    const auto tensor = make_tensor<Global>(
+        data.data(), make_layout(ck::make_tuple(d1, d0), ck::make_tuple(d0, 1)));
+
+    for(ck::index_t tile_h = 0; tile_h < 2; tile_h++)
+    {
+        for(ck::index_t tile_w = 0; tile_w < 2; tile_w++)
+        {
+            const auto tile =
+                ck::wrapper::local_tile(tensor, tile_shape, ck::make_tuple(tile_h, tile_w));
+            EXPECT_EQ(tile.GetPointer(), data.data() + tile_h * 4 * d0 + tile_w * 3);
+
+            for(ck::index_t thread_id = 0; thread_id < 6; thread_id++)
+            {
+                auto partition = ck::wrapper::local_partition(tile, thread_shape, thread_id);
+                // Compile-time tile and thread shapes give compile-time partition shape
+                constexpr bool check_compiletime_shape =
+                    std::is_same_v<decltype(ck::wrapper::shape(ck::wrapper::layout(partition))),
+                                   ck::Tuple<ck::Number<2>, ck::Number<1>>>;
+                EXPECT_TRUE(check_compiletime_shape);
+
+                const ck::index_t h = tile_h * 4 + thread_id % 2;
+                const ck::index_t w = tile_w * 3 + thread_id / 2;
+                EXPECT_EQ(&partition(0, 0), &data[h * d0 + w]);
+                EXPECT_EQ(&partition(1, 0), &data[(h + 2) * d0 + w]);
+
+                partition(0, 0) += 1;
+                partition(1, 0) += 1;
+            }
+        }
+    }
+
+    // Every element is owned by exactly one thread
+    for(const ck::index_t visits : data)
+    {
+        EXPECT_EQ(visits, 1);
+    }
+}
+
+TEST(TestWrapperTensor, Register)
+{
+    // dims:(2, 3) strides:(3, 1)
+    auto tensor = ck::wrapper::make_register_tensor<ck::AddressSpaceEnum::Vgpr, float>(
+        make_layout(ck::make_tuple(ck::Number<2>{}, ck::Number<3>{}),
+                    ck::make_tuple(ck::Number<3>{}, ck::Number<1>{})));
+
+    EXPECT_EQ(tensor.GetBuffer().Size(), 6);
+
+    ck::static_for<0, 2, 1>{}([&](auto h) {
+        ck::static_for<0, 3, 1>{}([&](auto w) {
+            tensor(h, w) = static_cast<float>(h.value * 10 + w.value);
+        });
+    });
+
+    const auto& buffer = tensor.GetBuffer();
+    ck::static_for<0, 2, 1>{}([&](auto h) {
+        ck::static_for<0, 3, 1>{}([&](auto w) {
+            EXPECT_EQ(tensor(ck::make_tuple(h, w)), static_cast<float>(h.value * 10 + w.value));
+            EXPECT_EQ(buffer[ck::Number<h.value * 3 + w.value>{}],
+                      static_cast<float>(h.value * 10 + w.value));
+        });
+    });
+}